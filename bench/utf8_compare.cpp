@@ -0,0 +1,386 @@
+/*
+** Differential benchmark: runs the same corpora through this library and the
+** converters it would replace, checks that every backend produces identical
+** output, and reports throughput and per-call latency.
+**
+** Build (add '-march=native' to measure the vectorised kernels):
+**    g++ -std=c++17 -O2 -Isrc bench/utf8_compare.cpp -o utf8_compare
+**
+** Usage:
+**    utf8_compare [--rounds N] [FILE...]
+**
+** Without files it uses synthetic corpora. Each file is one corpus whose
+** lines are the documents of the run.
+*/
+#define _SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING
+
+#include "utf8.h"
+
+#include <algorithm>
+#include <chrono>
+#include <codecvt>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iconv.h>
+#include <locale>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__GNUC__)
+#   pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+
+namespace {
+    struct Corpus {
+        std::string name;
+        std::vector<std::string> documents;
+        std::size_t bytes = 0;
+    };
+
+    template <typename OutputT>
+    struct Backend {
+        const char* name;
+        std::function<bool(const std::string&, const std::wstring&, OutputT&)> run;
+    };
+
+    // Inputs are passed as both utf8 and wide strings so that each backend
+    // only reads the side that it converts from.
+    using DecodeBackend = Backend<std::wstring>;
+    using EncodeBackend = Backend<std::string>;
+
+    /*
+    ** @brief: A deliberately simple decoder, written independently of the
+    **    library so that it can cross-check it.
+    */
+    bool naiveDecode(const std::string& in, std::wstring& out) {
+        out.clear();
+        for (std::size_t i = 0; i < in.size();) {
+            const unsigned char c = in[i];
+            uint32_t value;
+            int extra;
+
+            if (c < 0x80) { value = c; extra = 0; }
+            else if (c >= 0xf0) { value = c & 0x07; extra = 3; }
+            else if (c >= 0xe0) { value = c & 0x0f; extra = 2; }
+            else if (c >= 0xc0) { value = c & 0x1f; extra = 1; }
+            else return false;
+
+            if (i + extra >= in.size()) {
+                return false;
+            }
+            for (int k = 1; k <= extra; ++k) {
+                value = (value << 6) | (in[i + k] & 0x3f);
+            }
+            out.push_back(static_cast<wchar_t>(value));
+            i += 1 + extra;
+        }
+        return true;
+    }
+
+    bool naiveEncode(const std::wstring& in, std::string& out) {
+        out.clear();
+        for (wchar_t ch : in) {
+            const uint32_t c = static_cast<uint32_t>(ch);
+            if (c < 0x80) {
+                out.push_back(static_cast<char>(c));
+            } else if (c < 0x800) {
+                out.push_back(static_cast<char>(0xc0 | (c >> 6)));
+                out.push_back(static_cast<char>(0x80 | (c & 0x3f)));
+            } else if (c < 0x10000) {
+                out.push_back(static_cast<char>(0xe0 | (c >> 12)));
+                out.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3f)));
+                out.push_back(static_cast<char>(0x80 | (c & 0x3f)));
+            } else {
+                out.push_back(static_cast<char>(0xf0 | (c >> 18)));
+                out.push_back(static_cast<char>(0x80 | ((c >> 12) & 0x3f)));
+                out.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3f)));
+                out.push_back(static_cast<char>(0x80 | (c & 0x3f)));
+            }
+        }
+        return true;
+    }
+
+    /*
+    ** @brief: Runs one conversion through an iconv descriptor that is opened
+    **    once and reused, as a long-lived service would.
+    */
+    bool runIconv(iconv_t cd, const char* in, std::size_t inBytes, char* out, std::size_t& outBytes) {
+        iconv(cd, nullptr, nullptr, nullptr, nullptr);
+        char* source = const_cast<char*>(in);
+        char* target = out;
+        std::size_t left = outBytes;
+
+        if (iconv(cd, &source, &inBytes, &target, &left) == static_cast<std::size_t>(-1)) {
+            return false;
+        }
+        outBytes -= left;
+        return true;
+    }
+
+    std::string randomDocument(std::mt19937& rng, std::size_t length, const uint32_t* ranges, int rangeCount) {
+        std::string s;
+        while (s.size() < length) {
+            const int range = rng() % rangeCount;
+            const uint32_t low = ranges[2 * range];
+            const uint32_t high = ranges[2 * range + 1];
+            gc::appendUtf8(s, low + rng() % (high - low + 1));
+        }
+        return s;
+    }
+
+    std::vector<Corpus> syntheticCorpora() {
+        struct Spec {
+            const char* name;
+            std::vector<uint32_t> ranges;
+        };
+        const Spec specs[] = {
+            {"ascii", {0x20, 0x7e}},
+            {"latin", {0x20, 0x7e, 0x20, 0x7e, 0x20, 0x7e, 0xc0, 0xff}},
+            {"cyrillic", {0x20, 0x20, 0x410, 0x44f, 0x410, 0x44f, 0x410, 0x44f}},
+            {"cjk", {0x4e00, 0x9fff}},
+            {"emoji-mix", {0x20, 0x7e, 0x20, 0x7e, 0x4e00, 0x9fff, 0x1f600, 0x1f64f}},
+        };
+        // Mostly short documents, with a long tail of large ones.
+        const std::size_t sizes[] = {16, 64, 64, 256, 256, 1024, 4096, 65536};
+
+        std::mt19937 rng(12345);
+        std::vector<Corpus> corpora;
+
+        for (const Spec& spec : specs) {
+            Corpus corpus;
+            corpus.name = spec.name;
+            while (corpus.bytes < (8u << 20)) {
+                const std::size_t size = sizes[rng() % (sizeof(sizes) / sizeof(sizes[0]))];
+                corpus.documents.push_back(randomDocument(
+                    rng, size, spec.ranges.data(), static_cast<int>(spec.ranges.size() / 2)
+                ));
+                corpus.bytes += corpus.documents.back().size();
+            }
+            corpora.push_back(std::move(corpus));
+        }
+        return corpora;
+    }
+
+    bool loadCorpus(const char* path, Corpus& corpus) {
+        std::ifstream file(path, std::ios::binary);
+        if (not file) {
+            return false;
+        }
+
+        corpus.name = path;
+        std::string line;
+        while (std::getline(file, line)) {
+            if (not gc::isValidUtf8(line)) {
+                continue;
+            }
+            corpus.bytes += line.size();
+            corpus.documents.push_back(std::move(line));
+        }
+        return true;
+    }
+
+    struct Measurement {
+        double megabytesPerSecond;
+        double p50;
+        double p90;
+        double p99;
+    };
+
+    double percentile(std::vector<double>& values, double fraction) {
+        const std::size_t index = static_cast<std::size_t>(fraction * (values.size() - 1));
+        std::nth_element(values.begin(), values.begin() + index, values.end());
+        return values[index];
+    }
+
+    template <typename OutputT>
+    Measurement measure(
+        const Backend<OutputT>& backend,
+        const Corpus& corpus,
+        const std::vector<std::wstring>& wide,
+        int rounds
+    ) {
+        using Clock = std::chrono::steady_clock;
+        std::vector<double> latencies;
+        latencies.reserve(corpus.documents.size() * rounds);
+        double total = 0;
+        OutputT output;
+
+        for (int round = 0; round < rounds; ++round) {
+            for (std::size_t i = 0; i < corpus.documents.size(); ++i) {
+                const auto start = Clock::now();
+                backend.run(corpus.documents[i], wide[i], output);
+                const double elapsed = std::chrono::duration<double, std::nano>(
+                    Clock::now() - start
+                ).count();
+                latencies.push_back(elapsed);
+                total += elapsed;
+            }
+        }
+
+        Measurement m;
+        m.megabytesPerSecond = (static_cast<double>(corpus.bytes) * rounds) / (total / 1e9) / 1e6;
+        m.p50 = percentile(latencies, 0.50);
+        m.p90 = percentile(latencies, 0.90);
+        m.p99 = percentile(latencies, 0.99);
+        return m;
+    }
+
+    /*
+    ** @returns: The number of documents whose output differs from that of
+    **    the first (reference) backend.
+    */
+    template <typename OutputT>
+    std::size_t countMismatches(
+        const std::vector<Backend<OutputT>>& backends,
+        std::size_t index,
+        const Corpus& corpus,
+        const std::vector<std::wstring>& wide
+    ) {
+        std::size_t mismatches = 0;
+        OutputT expected;
+        OutputT actual;
+
+        for (std::size_t i = 0; i < corpus.documents.size(); ++i) {
+            const bool ok = backends[0].run(corpus.documents[i], wide[i], expected);
+            const bool same = backends[index].run(corpus.documents[i], wide[i], actual);
+            if (ok != same || expected != actual) {
+                ++mismatches;
+            }
+        }
+        return mismatches;
+    }
+
+    template <typename OutputT>
+    void report(
+        const char* direction,
+        const std::vector<Backend<OutputT>>& backends,
+        const Corpus& corpus,
+        const std::vector<std::wstring>& wide,
+        int rounds
+    ) {
+        std::printf("\n%s / %s (%zu documents, %.1f MB)\n",
+            corpus.name.c_str(), direction, corpus.documents.size(), corpus.bytes / 1e6);
+        std::printf("  %-10s %10s %8s %10s %10s %10s %10s\n",
+            "backend", "MB/s", "relative", "p50 ns", "p90 ns", "p99 ns", "mismatch");
+
+        double baseline = 0;
+        for (std::size_t b = 0; b < backends.size(); ++b) {
+            const std::size_t mismatches = countMismatches(backends, b, corpus, wide);
+            const Measurement m = measure(backends[b], corpus, wide, rounds);
+            if (b == 0) {
+                baseline = m.megabytesPerSecond;
+            }
+            std::printf("  %-10s %10.1f %7.2fx %10.0f %10.0f %10.0f %10zu\n",
+                backends[b].name, m.megabytesPerSecond, m.megabytesPerSecond / baseline,
+                m.p50, m.p90, m.p99, mismatches);
+        }
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    int rounds = 5;
+    std::vector<Corpus> corpora;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--rounds") == 0 && i + 1 < argc) {
+            rounds = std::max(1, std::atoi(argv[++i]));
+            continue;
+        }
+        Corpus corpus;
+        if (not loadCorpus(argv[i], corpus)) {
+            std::fprintf(stderr, "cannot read %s\n", argv[i]);
+            return 1;
+        }
+        corpora.push_back(std::move(corpus));
+    }
+    if (corpora.empty()) {
+        corpora = syntheticCorpora();
+    }
+
+    iconv_t toWide = iconv_open("WCHAR_T", "UTF-8");
+    iconv_t fromWide = iconv_open("UTF-8", "WCHAR_T");
+    if (toWide == reinterpret_cast<iconv_t>(-1) || fromWide == reinterpret_cast<iconv_t>(-1)) {
+        std::fprintf(stderr, "iconv does not support UTF-8 <-> WCHAR_T\n");
+        return 1;
+    }
+
+    std::wstring_convert<std::codecvt_utf8<wchar_t>> codecvt;
+
+    // The first backend of each list is the reference for the mismatch
+    // column and for the relative throughput.
+    const std::vector<DecodeBackend> decoders = {
+        {"gc", [](const std::string& in, const std::wstring&, std::wstring& out) {
+            out = gc::convertUtf8ToWString(in);
+            return true;
+        }},
+        {"iconv", [&](const std::string& in, const std::wstring&, std::wstring& out) {
+            out.resize(in.size());
+            std::size_t bytes = out.size() * sizeof(wchar_t);
+            const bool ok = runIconv(toWide, in.data(), in.size(), reinterpret_cast<char*>(&out[0]), bytes);
+            out.resize(bytes / sizeof(wchar_t));
+            return ok;
+        }},
+        {"codecvt", [&](const std::string& in, const std::wstring&, std::wstring& out) {
+            out = codecvt.from_bytes(in);
+            return true;
+        }},
+        {"naive", [](const std::string& in, const std::wstring&, std::wstring& out) {
+            return naiveDecode(in, out);
+        }},
+    };
+
+    const std::vector<EncodeBackend> encoders = {
+        {"gc", [](const std::string&, const std::wstring& in, std::string& out) {
+            out = gc::convertWStringToUtf8(in);
+            return true;
+        }},
+        {"iconv", [&](const std::string&, const std::wstring& in, std::string& out) {
+            out.resize(in.size() * 4);
+            std::size_t bytes = out.size();
+            const bool ok = runIconv(fromWide, reinterpret_cast<const char*>(in.data()),
+                in.size() * sizeof(wchar_t), &out[0], bytes);
+            out.resize(bytes);
+            return ok;
+        }},
+        {"codecvt", [&](const std::string&, const std::wstring& in, std::string& out) {
+            out = codecvt.to_bytes(in);
+            return true;
+        }},
+        {"naive", [](const std::string&, const std::wstring& in, std::string& out) {
+            return naiveEncode(in, out);
+        }},
+    };
+
+    std::size_t totalMismatches = 0;
+    for (const Corpus& corpus : corpora) {
+        if (corpus.documents.empty()) {
+            continue;
+        }
+
+        std::vector<std::wstring> wide;
+        wide.reserve(corpus.documents.size());
+        for (const std::string& document : corpus.documents) {
+            wide.push_back(gc::convertUtf8ToWString(document));
+        }
+
+        report("utf8 -> wstring", decoders, corpus, wide, rounds);
+        report("wstring -> utf8", encoders, corpus, wide, rounds);
+
+        for (std::size_t b = 1; b < decoders.size(); ++b) {
+            totalMismatches += countMismatches(decoders, b, corpus, wide);
+        }
+        for (std::size_t b = 1; b < encoders.size(); ++b) {
+            totalMismatches += countMismatches(encoders, b, corpus, wide);
+        }
+    }
+
+    iconv_close(toWide);
+    iconv_close(fromWide);
+
+    // A non-zero exit status flags a divergence between backends.
+    return totalMismatches == 0 ? 0 : 2;
+}
@@ -1,58 +1,282 @@
 #ifndef __GENIUS_C_UTF8__
 #define __GENIUS_C_UTF8__
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "utf8_kernels.h"
+#include "utf8_probes.h"
+
 namespace gc {
+    /*
+    ** @brief: Why a sequence was rejected.
+    */
+    enum class Utf8ErrorKind {
+        None,
+        // A continuation byte, or a byte that never starts a sequence.
+        BadLead,
+        // A byte inside a sequence that is not of the form 10xxxxxx.
+        BadTrail,
+        // The input ends in the middle of a sequence.
+        Truncated,
+        // A longer sequence than the value needs (eg. C0 80 for U+0000).
+        Overlong,
+        // An encoded UTF-16 surrogate (U+D800 to U+DFFF).
+        Surrogate,
+        // An encoded value above U+10FFFF.
+        OutOfRange,
+        // Valid input that the target encoding cannot hold.
+        Unrepresentable
+    };
+
+    /*
+    ** @brief: Where and why a conversion or validation failed.
+    ** @note: 'offset' counts input code units (bytes for utf8 input). 'bytes'
+    **    holds the offending sequence up to and including the byte that made 
+    **    it invalid.
+    */
+    struct Utf8Error {
+        Utf8ErrorKind kind = Utf8ErrorKind::None;
+        std::size_t offset = 0;
+        unsigned char bytes[4] = {};
+        int length = 0;
+    };
+
     struct InvalidUtf8 : public std::exception {
         InvalidUtf8(const char* msg) 
             : msg(msg) {}
 
+        InvalidUtf8(const char* msg, const Utf8Error& details) 
+            : msg(msg), details(details) {}
+
         const char* what() const noexcept { 
             return msg; 
         }
 
+        /*
+        ** @brief: The location, kind and bytes of the error.
+        */
+        const Utf8Error& error() const noexcept { 
+            return details; 
+        }
+
         private:
             const char* msg;
+            Utf8Error details;
     };
 
+namespace detail {
+    inline const char* getUtf8ErrorMessage(Utf8ErrorKind kind) {
+        switch (kind) {
+            case Utf8ErrorKind::BadLead:
+                return "invalid leading byte for utf8 sequence";
+            case Utf8ErrorKind::BadTrail:
+                return "invalid trailing byte for utf8 sequence";
+            case Utf8ErrorKind::Truncated:
+                return "utf8 sequence too short. Expected more bytes";
+            case Utf8ErrorKind::Overlong:
+                return "overlong utf8 sequence";
+            case Utf8ErrorKind::Surrogate:
+                return "utf8 sequence encodes a utf16 surrogate";
+            case Utf8ErrorKind::OutOfRange:
+                return "utf8 sequence encodes a value above U+10FFFF";
+            case Utf8ErrorKind::Unrepresentable:
+                return "code point cannot be represented in the target encoding";
+            case Utf8ErrorKind::None:
+                break;
+        }
+        return "valid utf8";
+    }
+
     /*
-    ** @brief: Finds the length of a utf8 sequence based on the leading byte.
-    ** @param byte: The leading byte in a utf8 sequence.
-    ** @returns: The number of trail bytes in the utf8 sequence.
-    ** @note: May return 0 if the given byte is not a valid utf8 lead byte.
-    ** @note: This works for ascii as well.
+    ** @brief: Explains why the sequence at 'offset' is not strictly valid 
+    **    utf8.
+    ** @note: Only called once a kernel has failed at 'offset', so valid input
+    **    never pays for the classification. Does not count the error in the
+    **    stats: that is up to whoever reports it.
     */
-    template <typename ByteT>
-    inline int getUtf8SequenceLength(ByteT byte) {
-        if ((byte & 0x80) == 0) {
-            return 1;
+    inline Utf8Error describeUtf8Error(
+        const unsigned char* bytes, 
+        std::size_t length, 
+        std::size_t offset
+    ) {
+        Utf8Error error;
+        error.offset = offset;
+
+        const unsigned char* sequence = bytes + offset;
+        const std::size_t available = length - offset;
+        const unsigned char lead = sequence[0];
+        const int expected = lead >= 0xf0 ? 4 : lead >= 0xe0 ? 3 : 2;
+
+        auto fail = [&](Utf8ErrorKind kind, int size) {
+            error.kind = kind;
+            error.length = size;
+            std::memcpy(error.bytes, sequence, size);
+            return error;
+        };
+
+        if (lead < 0xc0 || lead >= 0xf8) {
+            return fail(Utf8ErrorKind::BadLead, 1);
         }
 
-        if ((byte & 0xe0) == 0xc0) {
-            return 2;
+        // These leads are invalid whatever follows them.
+        if (lead < 0xc2) {
+            return fail(Utf8ErrorKind::Overlong, 1);
+        }
+        if (lead >= 0xf5) {
+            return fail(Utf8ErrorKind::OutOfRange, 1);
         }
 
-        if ((byte & 0xf0) == 0xe0) {
-            return 3;
+        for (int index = 1; index < expected; ++index) {
+            if (static_cast<std::size_t>(index) >= available) {
+                return fail(Utf8ErrorKind::Truncated, index);
+            }
+            if ((sequence[index] & 0xc0) != 0x80) {
+                return fail(Utf8ErrorKind::BadTrail, index + 1);
+            }
+            if (index > 1) {
+                continue;
+            }
+
+            const unsigned char second = sequence[1];
+            if ((lead == 0xe0 && second < 0xa0) || (lead == 0xf0 && second < 0x90)) {
+                return fail(Utf8ErrorKind::Overlong, 2);
+            }
+            if (lead == 0xed && second >= 0xa0) {
+                return fail(Utf8ErrorKind::Surrogate, 2);
+            }
+            if (lead == 0xf4 && second >= 0x90) {
+                return fail(Utf8ErrorKind::OutOfRange, 2);
+            }
         }
 
-        if ((byte & 0xf8) == 0xf0) {
-            return 4;
+        return error;
+    }
+
+    /*
+    ** @brief: Describes the strictly invalid sequence at 'offset' for a
+    **    caller that returns it, and counts it in the stats.
+    */
+    inline Utf8Error reportUtf8Error(
+        const unsigned char* bytes,
+        std::size_t length,
+        std::size_t offset
+    ) {
+        const Utf8Error error = describeUtf8Error(bytes, length, offset);
+        recordUtf8Error(static_cast<int>(error.kind));
+        return error;
+    }
+
+    /*
+    ** @brief: Counts the given error in the stats and throws it as
+    **    InvalidUtf8.
+    */
+    [[noreturn]] inline void throwUtf8Error(const char* message, const Utf8Error& error) {
+        recordUtf8Error(static_cast<int>(error.kind));
+        throw InvalidUtf8(message, error);
+    }
+
+    /*
+    ** @brief: Throws InvalidUtf8 for the strictly invalid sequence at 
+    **    'offset'.
+    */
+    [[noreturn]] inline void throwUtf8Error(
+        const unsigned char* bytes, 
+        std::size_t length, 
+        std::size_t offset
+    ) {
+        const Utf8Error error = describeUtf8Error(bytes, length, offset);
+        throwUtf8Error(getUtf8ErrorMessage(error.kind), error);
+    }
+
+    /*
+    ** @brief: Describes a valid sequence at 'offset' that the target encoding
+    **    of a conversion cannot hold.
+    */
+    inline Utf8Error describeUnrepresentable(
+        const unsigned char* bytes, 
+        std::size_t length, 
+        std::size_t offset
+    ) {
+        Utf8Error error;
+        error.kind = Utf8ErrorKind::Unrepresentable;
+        error.offset = offset;
+
+        int size = 1;
+        while (size < 4 && offset + size < length && 
+               (bytes[offset + size] & 0xc0) == 0x80) {
+            ++size;
         }
+        error.length = size;
+        std::memcpy(error.bytes, bytes + offset, size);
+        return error;
+    }
 
-        if ((byte & 0xfc) == 0xf8) {
-            return 5;
+    /*
+    ** @brief: The length of the maximal subpart at the given error (Unicode,
+    **    section 3.9): the longest prefix of a valid sequence found there,
+    **    or 1 if no valid sequence starts with that byte. Each maximal
+    **    subpart is what one U+FFFD stands for.
+    */
+    inline std::size_t getInvalidSubpartLength(const Utf8Error& error) {
+        switch (error.kind) {
+            case Utf8ErrorKind::Truncated:
+                return error.length;
+            case Utf8ErrorKind::BadTrail:
+                // The byte that broke the sequence starts the next one.
+                return error.length - 1;
+            default:
+                return 1;
         }
+    }
+
+    /*
+    ** @brief: Whether 'str' points into the contents of 'output', as when
+    **    the same string is passed as both the input and the output buffer.
+    */
+    inline bool isViewInto(std::string_view str, const std::string& output) {
+        const std::less<const char*> before;
+        return not str.empty() and
+            not before(str.data(), output.data()) and
+            before(str.data(), output.data() + output.size());
+    }
+} // namespace detail
 
-        if ((byte & 0xfe) == 0xfc) {
-            return 6;
+    /*
+    ** @brief: Finds the length of a utf8 sequence based on the leading byte.
+    ** @param byte: The leading byte in a utf8 sequence.
+    ** @returns: The number of trail bytes in the utf8 sequence.
+    ** @note: May return 0 if the given byte is not a valid utf8 lead byte.
+    ** @note: This works for ascii as well.
+    */
+    template <typename ByteT>
+    inline int getUtf8SequenceLength(ByteT byte) {
+        int length = 0;
+
+        if ((byte & 0x80) == 0) {
+            length = 1;
+        } else if ((byte & 0xe0) == 0xc0) {
+            length = 2;
+        } else if ((byte & 0xf0) == 0xe0) {
+            length = 3;
+        } else if ((byte & 0xf8) == 0xf0) {
+            length = 4;
+        } else if ((byte & 0xfc) == 0xf8) {
+            length = 5;
+        } else if ((byte & 0xfe) == 0xfc) {
+            length = 6;
         }
 
-        return 0;
+        detail::recordSequenceLength(length);
+        return length;
     }
 
     /*
@@ -101,19 +325,34 @@ namespace gc {
         uint32_t value = 0;
         auto numberOfBytes = getUtf8SequenceLength(*octetIterator);
 
+        // The offset is left at 0: only the caller knows where the stream 
+        // starts.
+        auto fail = [&](Utf8ErrorKind kind, int size) {
+            Utf8Error error;
+            error.kind = kind;
+            error.length = size < 4 ? size : 4;
+            for (int x = 0; x < error.length; ++x) {
+                error.bytes[x] = static_cast<unsigned char>(octetIterator[x]);
+            }
+            detail::throwUtf8Error(detail::getUtf8ErrorMessage(kind), error);
+        };
+
         if (std::distance(octetIterator, iteratorEnd) < numberOfBytes) {
-            throw InvalidUtf8("utf8 sequence too short. Expected more bytes");
+            fail(
+                Utf8ErrorKind::Truncated, 
+                static_cast<int>(std::distance(octetIterator, iteratorEnd))
+            );
         }
 
         for (int x = 1; x < numberOfBytes; ++x) {
             if (not isValidUtf8TrailByte(octetIterator[x])) {
-                throw InvalidUtf8("invalid trailing byte for utf8 sequence");
+                fail(Utf8ErrorKind::BadTrail, x + 1);
             }
         }
 
         switch (numberOfBytes) {
             case 0: {
-                throw InvalidUtf8("invalid leading byte for utf8 sequence");
+                fail(Utf8ErrorKind::BadLead, 1);
                 break;
             }
             case 1: {
@@ -230,11 +469,29 @@ namespace gc {
     **    that is utf8 encoded.
     ** @param wstr: The "std::wstring" instance.
     **/
-    std::string convertWStringToUtf8(const std::wstring& wstr) {
+    inline std::string convertWStringToUtf8(const std::wstring& wstr) {
+        detail::ProbeScope probe("convertWStringToUtf8", wstr.size());
         std::string s;
+
+        if (sizeof(wchar_t) == 4) {
+            s.resize(wstr.size() * 4);
+            const auto result = detail::convertUtf32ToUtf8(
+                wstr.data(), wstr.size(), &s[0]
+            );
+            if (result.ok) {
+                s.resize(result.written);
+                probe.finish(s.size());
+                return s;
+            }
+            // Values that are not unicode scalar values are still encoded,
+            // the same way 'put_utf8_char' always has.
+            s.clear();
+        }
+
         for (auto ch : wstr) {
             appendUtf8(s, static_cast<uint32_t>(ch));
         }
+        probe.finish(s.size());
         return s;
     }
 
@@ -249,10 +506,498 @@ namespace gc {
         std::wstring output;
         auto it = str.begin();
 
-        while (it != str.end()) {
-            output += static_cast<wchar_t>(getUtf8Character(it, str.end()));
+        try {
+            while (it != str.end()) {
+                output += static_cast<wchar_t>(getUtf8Character(it, str.end()));
+            }
+        } catch (const InvalidUtf8& e) {
+            // 'getUtf8Character' does not advance past a bad sequence.
+            Utf8Error error = e.error();
+            error.offset = static_cast<std::size_t>(std::distance(str.begin(), it));
+            throw InvalidUtf8(e.what(), error);
+        }
+
+        return output;
+    }
+
+    /*
+    ** @brief: Converts the given utf8-encoded "std::string" into a 
+    **    "std::wstring".
+    ** @note: Strictly valid utf8 goes through the bulk kernels; anything else 
+    **    is decoded (or rejected) exactly as by the generic overload.
+    **/
+    inline std::wstring convertUtf8ToWString(const std::string& str) {
+        detail::ProbeScope probe("convertUtf8ToWString", str.size());
+
+        if (sizeof(wchar_t) == 4) {
+            std::wstring output(str.size(), L'\0');
+            const auto result = detail::convertUtf8ToUtf32(
+                reinterpret_cast<const unsigned char*>(str.data()), 
+                str.size(), 
+                &output[0]
+            );
+            if (result.ok) {
+                output.resize(result.written);
+                probe.finish(output.size());
+                return output;
+            }
+        }
+
+        std::wstring output = convertUtf8ToWString<std::string>(str);
+        probe.finish(output.size());
+        return output;
+    }
+
+    /*
+    ** @brief: Checks that the given bytes are strictly valid utf8 (RFC 3629): 
+    **    no overlong forms, no surrogates and nothing above U+10FFFF.
+    */
+    inline bool isValidUtf8(std::string_view str) {
+        detail::ProbeScope probe("isValidUtf8", str.size());
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data());
+        const std::size_t offset = detail::validateUtf8(bytes, str.size());
+        if (offset != str.size()) {
+            detail::reportUtf8Error(bytes, str.size(), offset);
+        }
+        probe.finish(offset, offset == str.size() ? detail::PROBE_OK : detail::PROBE_REJECTED);
+        return offset == str.size();
+    }
+
+    /*
+    ** @brief: Checks that the given bytes are strictly valid utf8, without 
+    **    throwing.
+    ** @param error: Receives the offset, kind and bytes of the first invalid 
+    **    sequence. Left untouched if the input is valid.
+    */
+    inline bool isValidUtf8(std::string_view str, Utf8Error& error) {
+        detail::ProbeScope probe("isValidUtf8", str.size());
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data());
+        const std::size_t offset = detail::validateUtf8(bytes, str.size());
+
+        if (offset == str.size()) {
+            probe.finish(offset);
+            return true;
+        }
+
+        error = detail::reportUtf8Error(bytes, str.size(), offset);
+        probe.finish(offset, detail::PROBE_REJECTED);
+        return false;
+    }
+
+    /*
+    ** @brief: Checks that the given bytes are strictly valid utf8 and, in the
+    **    same pass, computes a 64-bit hash of them, eg. for deduplication.
+    ** @param hash: Receives the hash. Left untouched if the input is invalid.
+    ** @note: With AVX-512 the hash is taken from the vectors the validator
+    **    has already loaded; otherwise each 1 KiB block is hashed right
+    **    after it is validated, while it is still in cache. Either way a
+    **    cold input is read from memory once rather than twice.
+    ** @note: The hash is not cryptographic. It is the same on every target,
+    **    and the same as 'hashUtf8' gives for the bytes.
+    */
+    inline bool validateAndHashUtf8(std::string_view str, uint64_t& hash) {
+        detail::ProbeScope probe("validateAndHashUtf8", str.size());
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data());
+        const std::size_t offset = detail::validateAndHashUtf8(bytes, str.size(), hash);
+        if (offset != str.size()) {
+            detail::reportUtf8Error(bytes, str.size(), offset);
+        }
+        probe.finish(offset, offset == str.size() ? detail::PROBE_OK : detail::PROBE_REJECTED);
+        return offset == str.size();
+    }
+
+    /*
+    ** @brief: Validates and hashes the given bytes in one pass, without
+    **    throwing.
+    ** @param error: Receives the offset, kind and bytes of the first invalid
+    **    sequence. Left untouched if the input is valid.
+    */
+    inline bool validateAndHashUtf8(std::string_view str, uint64_t& hash, Utf8Error& error) {
+        detail::ProbeScope probe("validateAndHashUtf8", str.size());
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data());
+        const std::size_t offset = detail::validateAndHashUtf8(bytes, str.size(), hash);
+
+        if (offset == str.size()) {
+            probe.finish(offset);
+            return true;
+        }
+
+        error = detail::reportUtf8Error(bytes, str.size(), offset);
+        probe.finish(offset, detail::PROBE_REJECTED);
+        return false;
+    }
+
+    /*
+    ** @brief: Hashes bytes that are already known to be valid, giving the
+    **    same value as 'validateAndHashUtf8'.
+    */
+    inline uint64_t hashUtf8(std::string_view str) noexcept {
+        return detail::hashBytes(
+            reinterpret_cast<const unsigned char*>(str.data()), str.size()
+        );
+    }
+
+    /*
+    ** @brief: What a piece of text holds, as found by 'classifyUtf8'.
+    */
+    struct Utf8Classification {
+        enum Flag : uint32_t {
+            // Strictly valid utf8.
+            Valid = 1 << 0,
+            // Only U+0000 to U+007F.
+            Ascii = 1 << 1,
+            // Only U+0000 to U+00FF, ie. representable in Latin-1.
+            Latin1 = 1 << 2,
+            // No supplementary characters, ie. one utf16 unit apiece.
+            BmpOnly = 1 << 3,
+            // Some C0 or C1 control, or U+007F (NUL included).
+            HasControl = 1 << 4,
+            HasNul = 1 << 5,
+            // Some character from U+10000 up.
+            HasSupplementary = 1 << 6
+        };
+
+        uint32_t flags;
+        std::size_t codePoints;
+
+        /*
+        ** @brief: Whether all the given flags are set.
+        */
+        bool has(uint32_t wanted) const {
+            return (flags & wanted) == wanted;
+        }
+    };
+
+    /*
+    ** @brief: Validates the given text and finds out, in the same pass, what
+    **    range of characters it uses and how many code points it holds, eg.
+    **    to pick a storage or transcoding strategy.
+    ** @returns: The flags and the code point count. For invalid text
+    **    'Valid' is clear, and the rest describes the text before the first
+    **    invalid sequence.
+    ** @note: The properties follow from the bytes alone (eg. nothing beyond
+    **    Latin-1 means no lead byte from 0xc4 up), so with AVX-512 they are
+    **    tested on the blocks the validator has loaded. Otherwise each
+    **    1 KiB block is classified right after it is validated.
+    */
+    inline Utf8Classification classifyUtf8(std::string_view str) {
+        detail::ProbeScope probe("classifyUtf8", str.size());
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data());
+        uint32_t seen;
+        std::size_t codePoints;
+        const std::size_t offset = detail::classifyUtf8(bytes, str.size(), seen, codePoints);
+        probe.finish(offset, offset == str.size() ? detail::PROBE_OK : detail::PROBE_REJECTED);
+
+        Utf8Classification result = {0, codePoints};
+        if (offset == str.size()) {
+            result.flags |= Utf8Classification::Valid;
+        } else {
+            detail::reportUtf8Error(bytes, str.size(), offset);
+        }
+        if (not (seen & detail::SEEN_NON_ASCII)) {
+            result.flags |= Utf8Classification::Ascii;
+        }
+        if (not (seen & detail::SEEN_NON_LATIN1)) {
+            result.flags |= Utf8Classification::Latin1;
+        }
+        if (seen & detail::SEEN_SUPPLEMENTARY) {
+            result.flags |= Utf8Classification::HasSupplementary;
+        } else {
+            result.flags |= Utf8Classification::BmpOnly;
+        }
+        if (seen & detail::SEEN_CONTROL) {
+            result.flags |= Utf8Classification::HasControl;
+        }
+        if (seen & detail::SEEN_NUL) {
+            result.flags |= Utf8Classification::HasNul;
+        }
+        return result;
+    }
+
+    /*
+    ** @brief: Makes the given string strictly valid utf8 by replacing every
+    **    maximal subpart of an invalid sequence with U+FFFD, as decoders
+    **    that follow the Unicode and WHATWG recommendations do.
+    ** @returns: The number of replacements, ie. 0 if the string was valid.
+    ** @note: Valid input is only validated and left untouched. Repairs start
+    **    at the first error and are made in place for as long as each
+    **    subpart is three bytes long, the size of U+FFFD. From the first
+    **    shorter one, the rest of the string is rebuilt once, copying the
+    **    valid runs in between in bulk.
+    */
+    inline std::size_t sanitizeUtf8(std::string& str) {
+        static const char replacement[] = "\xef\xbf\xbd";
+
+        detail::ProbeScope probe("sanitizeUtf8", str.size());
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data());
+        const std::size_t length = str.size();
+        std::size_t pos = detail::validateUtf8(bytes, length);
+        std::size_t replaced = 0;
+
+        // The error at 'pos' is described once, and counted once it is
+        // repaired.
+        Utf8Error error;
+        while (pos < length) {
+            error = detail::describeUtf8Error(bytes, length, pos);
+            if (detail::getInvalidSubpartLength(error) < 3) {
+                break;
+            }
+            detail::recordUtf8Error(static_cast<int>(error.kind));
+            std::memcpy(&str[pos], replacement, 3);
+            ++replaced;
+            pos += 3;
+            pos += detail::validateUtf8(bytes + pos, length - pos);
+        }
+
+        if (pos == length) {
+            probe.finish(length);
+            return replaced;
+        }
+
+        // Each shorter subpart grows the text, so the rest goes through a
+        // second buffer.
+        const std::size_t start = pos;
+        std::string repaired;
+        repaired.reserve(length - start + (length - start) / 2 + 3);
+
+        while (true) {
+            detail::recordUtf8Error(static_cast<int>(error.kind));
+            repaired.append(replacement, 3);
+            ++replaced;
+            pos += detail::getInvalidSubpartLength(error);
+
+            const std::size_t valid = detail::validateUtf8(bytes + pos, length - pos);
+            repaired.append(str, pos, valid);
+            pos += valid;
+            if (pos == length) {
+                break;
+            }
+            error = detail::describeUtf8Error(bytes, length, pos);
+        }
+
+        str.resize(start);
+        str += repaired;
+        probe.finish(str.size());
+        return replaced;
+    }
+
+    /*
+    ** @brief: Converts strictly valid utf8 into utf32.
+    ** @throws InvalidUtf8: If the input is not strictly valid utf8.
+    */
+    inline std::u32string convertUtf8ToUtf32(std::string_view str) {
+        detail::ProbeScope probe("convertUtf8ToUtf32", str.size());
+        std::u32string output(str.size(), U'\0');
+        const auto result = detail::convertUtf8ToUtf32(
+            reinterpret_cast<const unsigned char*>(str.data()), 
+            str.size(), 
+            &output[0]
+        );
+        if (not result.ok) {
+            detail::throwUtf8Error(
+                reinterpret_cast<const unsigned char*>(str.data()), 
+                str.size(), 
+                result.read
+            );
+        }
+        output.resize(result.written);
+        probe.finish(output.size());
+        return output;
+    }
+
+    /*
+    ** @brief: Converts strictly valid utf8 into utf16.
+    ** @throws InvalidUtf8: If the input is not strictly valid utf8.
+    */
+    inline std::u16string convertUtf8ToUtf16(std::string_view str) {
+        detail::ProbeScope probe("convertUtf8ToUtf16", str.size());
+        std::u16string output(str.size(), u'\0');
+        const auto result = detail::convertUtf8ToUtf16(
+            reinterpret_cast<const unsigned char*>(str.data()), 
+            str.size(), 
+            &output[0]
+        );
+        if (not result.ok) {
+            detail::throwUtf8Error(
+                reinterpret_cast<const unsigned char*>(str.data()), 
+                str.size(), 
+                result.read
+            );
+        }
+        output.resize(result.written);
+        probe.finish(output.size());
+        return output;
+    }
+
+    /*
+    ** @brief: Converts utf32 into utf8.
+    ** @throws InvalidUtf8: If the input holds a surrogate or a value above 
+    **    U+10FFFF, neither of which has a utf8 encoding.
+    */
+    inline std::string convertUtf32ToUtf8(std::u32string_view str) {
+        detail::ProbeScope probe("convertUtf32ToUtf8", str.size());
+        std::string output(str.size() * 4, '\0');
+        const auto result = detail::convertUtf32ToUtf8(
+            str.data(), str.size(), &output[0]
+        );
+        if (not result.ok) {
+            Utf8Error error;
+            error.offset = result.read;
+            error.kind = str[result.read] > 0x10ffff 
+                ? Utf8ErrorKind::OutOfRange 
+                : Utf8ErrorKind::Surrogate;
+            detail::throwUtf8Error("code point cannot be encoded as utf8", error);
+        }
+        output.resize(result.written);
+        probe.finish(output.size());
+        return output;
+    }
+
+    /*
+    ** @brief: Converts utf16 into utf8.
+    ** @throws InvalidUtf8: If the input holds an unpaired surrogate.
+    */
+    inline std::string convertUtf16ToUtf8(std::u16string_view str) {
+        detail::ProbeScope probe("convertUtf16ToUtf8", str.size());
+        std::string output(str.size() * 3, '\0');
+        const auto result = detail::convertUtf16ToUtf8(
+            str.data(), str.size(), &output[0]
+        );
+        if (not result.ok) {
+            Utf8Error error;
+            error.offset = result.read;
+            error.kind = Utf8ErrorKind::Surrogate;
+            detail::throwUtf8Error("unpaired utf16 surrogate", error);
+        }
+        output.resize(result.written);
+        probe.finish(output.size());
+        return output;
+    }
+
+    /*
+    ** @brief: Compares two utf8 strings in the order of their utf16 code
+    **    units, the string order of Java, JavaScript and C#.
+    ** @returns: A negative value, zero or a positive value, as 'first'
+    **    orders before, the same as or after 'second'.
+    ** @note: This is code point order (and so utf8 byte order) except that
+    **    supplementary characters, whose high surrogates are D800 to DBFF,
+    **    sort before U+E000 to U+FFFF. The common prefix is skipped at
+    **    'memcmp' speed, and only the code points where the strings first
+    **    differ are decoded.
+    ** @note: Does not throw. If either of those code points is invalid,
+    **    the differing bytes are compared instead.
+    */
+    inline int compareUtf8AsUtf16(std::string_view first, std::string_view second) noexcept {
+        const auto left = reinterpret_cast<const unsigned char*>(first.data());
+        const auto right = reinterpret_cast<const unsigned char*>(second.data());
+        const std::size_t length = std::min(first.size(), second.size());
+        const std::size_t common = detail::commonPrefixLength(left, right, length);
+
+        if (common == length) {
+            return first.size() < second.size() ? -1 : first.size() > second.size();
+        }
+
+        // Both strings share the bytes of the code point up to 'common'.
+        std::size_t start = common;
+        while (start > 0 && common - start < 3 && isValidUtf8TrailByte(left[start])) {
+            --start;
+        }
+
+        uint32_t leftCodePoint = 0;
+        uint32_t rightCodePoint = 0;
+        const int leftSize = detail::scalar::decodeUtf8Sequence(
+            left + start, first.size() - start, leftCodePoint
+        );
+        const int rightSize = detail::scalar::decodeUtf8Sequence(
+            right + start, second.size() - start, rightCodePoint
+        );
+        if (start + leftSize <= common || start + rightSize <= common) {
+            return left[common] < right[common] ? -1 : 1;
+        }
+
+        // The first utf16 unit decides, unless both are the same high
+        // surrogate, in which case code point order does.
+        auto firstUnit = [](uint32_t codePoint) {
+            return codePoint < 0x10000 ? codePoint : 0xd800 + ((codePoint - 0x10000) >> 10);
+        };
+        const uint32_t leftUnit = firstUnit(leftCodePoint);
+        const uint32_t rightUnit = firstUnit(rightCodePoint);
+        if (leftUnit != rightUnit) {
+            return leftUnit < rightUnit ? -1 : 1;
+        }
+        return leftCodePoint < rightCodePoint ? -1 : 1;
+    }
+
+    /*
+    ** @brief: Utf16 code unit ordering for ordered containers and sorting,
+    **    eg. 'std::map<std::string, T, Utf16OrderLess>'.
+    */
+    struct Utf16OrderLess {
+        using is_transparent = void;
+
+        bool operator()(std::string_view first, std::string_view second) const noexcept {
+            return compareUtf8AsUtf16(first, second) < 0;
+        }
+    };
+
+    /*
+    ** @brief: How a conversion into a narrower encoding handles input that 
+    **    it cannot represent.
+    */
+    enum class ConversionPolicy {
+        // Throw InvalidUtf8.
+        Strict,
+        // Substitute '?' and carry on.
+        Lossy
+    };
+
+    /*
+    ** @brief: Converts latin1 (ISO-8859-1) text into utf8.
+    ** @note: Every latin1 string is convertible, so this never throws.
+    */
+    inline std::string convertLatin1ToUtf8(std::string_view str) {
+        detail::ProbeScope probe("convertLatin1ToUtf8", str.size());
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data());
+        std::string output(
+            str.size() + detail::countNonAscii(bytes, str.size()), '\0'
+        );
+        detail::convertLatin1ToUtf8(bytes, str.size(), &output[0]);
+        probe.finish(output.size());
+        return output;
+    }
+
+    /*
+    ** @brief: Converts utf8 text into latin1 (ISO-8859-1).
+    ** @param policy: What to do with invalid utf8 and with code points above 
+    **    U+00FF. 'Lossy' writes one '?' for each of those.
+    ** @throws InvalidUtf8: Under 'ConversionPolicy::Strict', if the input is 
+    **    not valid utf8 or does not fit in latin1.
+    */
+    inline std::string convertUtf8ToLatin1(
+        std::string_view str, 
+        ConversionPolicy policy = ConversionPolicy::Strict
+    ) {
+        detail::ProbeScope probe("convertUtf8ToLatin1", str.size());
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data());
+        std::string output(str.size(), '\0');
+        const auto result = detail::convertUtf8ToLatin1(
+            bytes, str.size(), &output[0], policy == ConversionPolicy::Lossy
+        );
+
+        if (not result.ok) {
+            uint32_t codePoint;
+            if (detail::scalar::decodeUtf8Sequence(
+                    bytes + result.read, str.size() - result.read, codePoint)) {
+                detail::throwUtf8Error(
+                    "code point cannot be represented in latin1", 
+                    detail::describeUnrepresentable(bytes, str.size(), result.read)
+                );
+            }
+            detail::throwUtf8Error(bytes, str.size(), result.read);
         }
 
+        output.resize(result.written);
+        probe.finish(output.size());
         return output;
     }
 
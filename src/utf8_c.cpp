@@ -0,0 +1,313 @@
+#include "utf8_c.h"
+
+#include <cstring>
+
+#include "utf8.h"
+
+static_assert(GC_UTF8_ERROR_OUT_OF_RANGE == static_cast<int>(gc::Utf8ErrorKind::OutOfRange),
+    "the C error kinds have to match gc::Utf8ErrorKind");
+
+namespace {
+    using gc::detail::TranscodeResult;
+
+    gc_utf8_result makeResult(
+        int32_t status,
+        std::size_t read,
+        std::size_t written,
+        gc::Utf8ErrorKind kind = gc::Utf8ErrorKind::None
+    ) {
+        gc_utf8_result result;
+        result.status = status;
+        result.error_kind = static_cast<int32_t>(kind);
+        result.read = read;
+        result.written = written;
+        return result;
+    }
+
+    /*
+    ** @brief: Reports invalid input, counting the error in the stats.
+    */
+    gc_utf8_result makeError(std::size_t read, std::size_t written, gc::Utf8ErrorKind kind) {
+        gc::detail::recordUtf8Error(static_cast<int>(kind));
+        return makeResult(GC_UTF8_INVALID, read, written, kind);
+    }
+
+    int getProbeStatus(const gc_utf8_result& result) {
+        return result.status == GC_UTF8_OK ? gc::detail::PROBE_OK : gc::detail::PROBE_REJECTED;
+    }
+
+    /*
+    ** @brief: Runs the body of a C entry point. Nothing in there is meant
+    **    to throw, but should anything ever fail (eg. taking the lock that
+    **    registers a thread's stats), the process stops here rather than
+    **    unwinding into C.
+    */
+    template <typename BodyT>
+    gc_utf8_result callFromC(BodyT body) noexcept {
+        return body();
+    }
+
+    /*
+    ** @brief: Moves the end of a piece of utf8 input back to the start of a
+    **    sequence that would not fit before it, so that the kernels never
+    **    see a sequence cut short that the whole input completes.
+    */
+    std::size_t cutUtf8(
+        const unsigned char* bytes,
+        std::size_t pos,
+        std::size_t end,
+        std::size_t length
+    ) {
+        if (end == length) {
+            return end;
+        }
+        // A lead more than three bytes back always fits, and a sequence that
+        // starts before the last lead is cut short by it anyway.
+        for (std::size_t lead = end; lead > pos && end - lead < 3;) {
+            const unsigned char byte = bytes[--lead];
+            if ((byte & 0xc0) != 0x80) {
+                const std::size_t size = byte < 0xc0 ? 1 : byte < 0xe0 ? 2 : byte < 0xf0 ? 3 : 4;
+                return lead + size > end ? lead : end;
+            }
+        }
+        return end;
+    }
+
+    /*
+    ** @brief: Keeps a surrogate pair from being split.
+    */
+    std::size_t cutUtf16(
+        const uint16_t* units,
+        std::size_t pos,
+        std::size_t end,
+        std::size_t length
+    ) {
+        if (end == length || end == pos) {
+            return end;
+        }
+        return (units[end - 1] & 0xfc00) == 0xd800 ? end - 1 : end;
+    }
+
+    std::size_t cutUtf32(const uint32_t*, std::size_t, std::size_t end, std::size_t) {
+        return end;
+    }
+
+    /*
+    ** @brief: Converts as much of the input as fits in the output.
+    ** @param expansion: The most output units one input unit can make.
+    **    Pieces of input that are sure to fit go through the bulk kernel;
+    **    when what is left of the output is too small for that, the
+    **    characters are converted one at a time until one does not fit.
+    ** @param step: Converts the character at 'pos' into 'units'.
+    **    Returns the number of input units read, or 0 if it is invalid.
+    */
+    template <
+        typename InT, typename OutT,
+        typename CutT, typename KernelT, typename StepT, typename ErrorT
+    >
+    gc_utf8_result transcode(
+        const InT* input,
+        std::size_t length,
+        OutT* output,
+        std::size_t capacity,
+        std::size_t expansion,
+        CutT cut,
+        KernelT kernel,
+        StepT step,
+        ErrorT describe
+    ) {
+        if ((input == nullptr && length != 0) || (output == nullptr && capacity != 0)) {
+            return makeResult(GC_UTF8_BAD_ARGUMENT, 0, 0);
+        }
+
+        std::size_t pos = 0;
+        std::size_t written = 0;
+
+        while (pos < length) {
+            const std::size_t room = (capacity - written) / expansion;
+            const std::size_t end = cut(
+                input, pos, length - pos <= room ? length : pos + room, length
+            );
+
+            if (end > pos) {
+                const TranscodeResult result = kernel(input + pos, end - pos, output + written);
+                written += result.written;
+                if (not result.ok) {
+                    const std::size_t offset = pos + result.read;
+                    return makeError(offset, written, describe(offset));
+                }
+                pos = end;
+                continue;
+            }
+
+            OutT units[4];
+            std::size_t produced = 0;
+            const std::size_t consumed = step(input, pos, length, units, produced);
+            if (consumed == 0) {
+                return makeError(pos, written, describe(pos));
+            }
+            if (produced > capacity - written) {
+                return makeResult(GC_UTF8_OUTPUT_TOO_SMALL, pos, written);
+            }
+            std::memcpy(output + written, units, produced * sizeof(OutT));
+            pos += consumed;
+            written += produced;
+        }
+
+        return makeResult(GC_UTF8_OK, length, written);
+    }
+
+    template <typename OutT, typename KernelT>
+    gc_utf8_result transcodeUtf8(
+        const char* input,
+        std::size_t length,
+        OutT* output,
+        std::size_t capacity,
+        KernelT kernel
+    ) {
+        const auto bytes = reinterpret_cast<const unsigned char*>(input);
+
+        auto step = [](const unsigned char* bytes, std::size_t pos, std::size_t length,
+                       OutT* units, std::size_t& produced) -> std::size_t {
+            uint32_t codePoint;
+            const int size = gc::detail::scalar::decodeUtf8Sequence(
+                bytes + pos, length - pos, codePoint
+            );
+            if (size == 0) {
+                return 0;
+            }
+
+            if (sizeof(OutT) == 4 || codePoint < 0x10000) {
+                units[0] = static_cast<OutT>(codePoint);
+                produced = 1;
+            } else {
+                codePoint -= 0x10000;
+                units[0] = static_cast<OutT>(0xd800 | (codePoint >> 10));
+                units[1] = static_cast<OutT>(0xdc00 | (codePoint & 0x3ff));
+                produced = 2;
+            }
+            return size;
+        };
+        auto describe = [bytes, length](std::size_t offset) {
+            return gc::detail::describeUtf8Error(bytes, length, offset).kind;
+        };
+        return transcode(bytes, length, output, capacity, 1, cutUtf8, kernel, step, describe);
+    }
+} // namespace
+
+extern "C" {
+    gc_utf8_result gc_utf8_validate(const char* input, size_t length) {
+        return callFromC([&] {
+            gc::detail::ProbeScope probe("gc_utf8_validate", length);
+            if (input == nullptr && length != 0) {
+                return makeResult(GC_UTF8_BAD_ARGUMENT, 0, 0);
+            }
+
+            const auto bytes = reinterpret_cast<const unsigned char*>(input);
+            const std::size_t offset = gc::detail::validateUtf8(bytes, length);
+            const gc_utf8_result result = offset == length
+                ? makeResult(GC_UTF8_OK, length, 0)
+                : makeError(offset, 0, gc::detail::describeUtf8Error(bytes, length, offset).kind);
+
+            probe.finish(result.read, getProbeStatus(result));
+            return result;
+        });
+    }
+
+    gc_utf8_result gc_utf8_count_code_points(const char* input, size_t length) {
+        return callFromC([&] {
+            gc::detail::ProbeScope probe("gc_utf8_count_code_points", length);
+            if (input == nullptr && length != 0) {
+                return makeResult(GC_UTF8_BAD_ARGUMENT, 0, 0);
+            }
+
+            const auto bytes = reinterpret_cast<const unsigned char*>(input);
+            uint32_t seen;
+            std::size_t codePoints;
+            const std::size_t offset = gc::detail::classifyUtf8(bytes, length, seen, codePoints);
+            const gc_utf8_result result = offset == length
+                ? makeResult(GC_UTF8_OK, length, codePoints)
+                : makeError(offset, codePoints,
+                    gc::detail::describeUtf8Error(bytes, length, offset).kind);
+
+            probe.finish(result.written, getProbeStatus(result));
+            return result;
+        });
+    }
+
+    gc_utf8_result gc_utf8_to_utf16(
+        const char* input, size_t length, uint16_t* output, size_t capacity
+    ) {
+        return callFromC([&] {
+            gc::detail::ProbeScope probe("gc_utf8_to_utf16", length);
+            const gc_utf8_result result = transcodeUtf8(input, length, output, capacity,
+                [](const unsigned char* bytes, std::size_t size, uint16_t* out) {
+                    return gc::detail::convertUtf8ToUtf16(bytes, size, out);
+                });
+            probe.finish(result.written, getProbeStatus(result));
+            return result;
+        });
+    }
+
+    gc_utf8_result gc_utf8_to_utf32(
+        const char* input, size_t length, uint32_t* output, size_t capacity
+    ) {
+        return callFromC([&] {
+            gc::detail::ProbeScope probe("gc_utf8_to_utf32", length);
+            const gc_utf8_result result = transcodeUtf8(input, length, output, capacity,
+                [](const unsigned char* bytes, std::size_t size, uint32_t* out) {
+                    return gc::detail::convertUtf8ToUtf32(bytes, size, out);
+                });
+            probe.finish(result.written, getProbeStatus(result));
+            return result;
+        });
+    }
+
+    gc_utf8_result gc_utf16_to_utf8(
+        const uint16_t* input, size_t length, char* output, size_t capacity
+    ) {
+        return callFromC([&] {
+            gc::detail::ProbeScope probe("gc_utf16_to_utf8", length);
+            const gc_utf8_result result = transcode(input, length, output, capacity, 3, cutUtf16,
+                [](const uint16_t* units, std::size_t size, char* out) {
+                    return gc::detail::convertUtf16ToUtf8(units, size, out);
+                },
+                [](const uint16_t* units, std::size_t pos, std::size_t length,
+                   char* bytes, std::size_t& produced) -> std::size_t {
+                    return gc::detail::scalar::encodeUtf16Unit(units, pos, length, bytes, produced);
+                },
+                [](std::size_t) {
+                    return gc::Utf8ErrorKind::Surrogate;
+                });
+            probe.finish(result.written, getProbeStatus(result));
+            return result;
+        });
+    }
+
+    gc_utf8_result gc_utf32_to_utf8(
+        const uint32_t* input, size_t length, char* output, size_t capacity
+    ) {
+        return callFromC([&] {
+            gc::detail::ProbeScope probe("gc_utf32_to_utf8", length);
+            const gc_utf8_result result = transcode(input, length, output, capacity, 4, cutUtf32,
+                [](const uint32_t* units, std::size_t size, char* out) {
+                    return gc::detail::convertUtf32ToUtf8(units, size, out);
+                },
+                [](const uint32_t* units, std::size_t pos, std::size_t,
+                   char* bytes, std::size_t& produced) -> std::size_t {
+                    if (not gc::detail::scalar::isScalarValue(units[pos])) {
+                        return 0;
+                    }
+                    produced = gc::detail::scalar::encodeUtf8Sequence(units[pos], bytes);
+                    return 1;
+                },
+                [input](std::size_t offset) {
+                    return input[offset] > 0x10ffff
+                        ? gc::Utf8ErrorKind::OutOfRange
+                        : gc::Utf8ErrorKind::Surrogate;
+                });
+            probe.finish(result.written, getProbeStatus(result));
+            return result;
+        });
+    }
+} // extern "C"
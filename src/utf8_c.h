@@ -0,0 +1,116 @@
+#ifndef __GENIUS_C_UTF8_C__
+#define __GENIUS_C_UTF8_C__
+
+/*
+** A C interface to the bulk kernels, for use from C and through FFI (Rust,
+** Python, ...). It is built from 'utf8_c.cpp', which is the only file that
+** needs a C++ compiler; callers include this header alone.
+**
+** Nothing here throws or allocates. Output goes into buffers that the
+** caller owns, and every call reports how far it got in a gc_utf8_result,
+** so a call that stops (on invalid input, or for want of room) can be
+** resumed from 'read' and 'written'. Lengths and capacities are counted in
+** code units: bytes for utf8, 16-bit units for utf16 and 32-bit units for
+** utf32. Strings need not be NUL-terminated.
+**
+** The one exception is a build with GC_UTF8_STATS: the first call on each
+** thread then takes a lock to link the thread's counters into the list
+** that 'gc::getUtf8Stats' reads, and the C++ runtime may allocate a little
+** to run the thread's exit hook. Should either ever fail, the process is
+** terminated; no exception ever unwinds into the caller.
+*/
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+    /* Everything was read (and written). */
+    GC_UTF8_OK = 0,
+    /* The input is invalid at 'read'; 'error_kind' says why. */
+    GC_UTF8_INVALID = 1,
+    /* The next character at 'read' does not fit in what is left of the
+    ** output. Converting into a buffer of the worst-case size never
+    ** stops for this: as many units as the input for utf8 to utf16 or
+    ** utf32, three times as many for utf16 to utf8, and four times as
+    ** many for utf32 to utf8. */
+    GC_UTF8_OUTPUT_TOO_SMALL = 2,
+    /* A NULL pointer was given with a non-zero length or capacity. */
+    GC_UTF8_BAD_ARGUMENT = 3
+};
+
+/*
+** The same values as gc::Utf8ErrorKind.
+*/
+enum {
+    GC_UTF8_ERROR_NONE = 0,
+    GC_UTF8_ERROR_BAD_LEAD = 1,
+    GC_UTF8_ERROR_BAD_TRAIL = 2,
+    GC_UTF8_ERROR_TRUNCATED = 3,
+    GC_UTF8_ERROR_OVERLONG = 4,
+    GC_UTF8_ERROR_SURROGATE = 5,
+    GC_UTF8_ERROR_OUT_OF_RANGE = 6
+};
+
+/*
+** @brief: How a call went.
+** @note: The fields have fixed sizes so that the layout is the same for
+**    every compiler that agrees on 'size_t'.
+*/
+typedef struct gc_utf8_result {
+    /* One of GC_UTF8_OK, GC_UTF8_INVALID, ... */
+    int32_t status;
+    /* One of GC_UTF8_ERROR_*, for GC_UTF8_INVALID; otherwise NONE. */
+    int32_t error_kind;
+    /* The input units read: all of them on success, or the offset where
+    ** the call stopped. */
+    size_t read;
+    /* The output units written (for the counting calls, the count). */
+    size_t written;
+} gc_utf8_result;
+
+/*
+** @brief: Checks that the input is strictly valid utf8 (RFC 3629).
+** @returns: 'read' is the length of the valid prefix.
+*/
+gc_utf8_result gc_utf8_validate(const char* input, size_t length);
+
+/*
+** @brief: Validates the input and counts its code points, ie. the length
+**    of its utf32 form, in one pass.
+** @returns: 'written' is the number of code points in the valid prefix.
+*/
+gc_utf8_result gc_utf8_count_code_points(const char* input, size_t length);
+
+/*
+** @brief: Converts strictly valid utf8 into utf16 or utf32.
+*/
+gc_utf8_result gc_utf8_to_utf16(
+    const char* input, size_t length, uint16_t* output, size_t capacity
+);
+gc_utf8_result gc_utf8_to_utf32(
+    const char* input, size_t length, uint32_t* output, size_t capacity
+);
+
+/*
+** @brief: Converts utf16 into utf8. An unpaired surrogate is invalid.
+*/
+gc_utf8_result gc_utf16_to_utf8(
+    const uint16_t* input, size_t length, char* output, size_t capacity
+);
+
+/*
+** @brief: Converts utf32 into utf8. Surrogates and values above U+10FFFF
+**    are invalid.
+*/
+gc_utf8_result gc_utf32_to_utf8(
+    const uint32_t* input, size_t length, char* output, size_t capacity
+);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* __GENIUS_C_UTF8_C__ */
@@ -0,0 +1,484 @@
+#ifndef __GENIUS_C_UTF8_CASE__
+#define __GENIUS_C_UTF8_CASE__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include "utf8.h"
+#include "utf8_case_tables.h"
+
+namespace gc {
+namespace detail {
+    /*
+    ** @brief: The mappings held by 'CaseRecord', in the order of its fields.
+    */
+    enum class CaseMapping {
+        Lower,
+        Upper,
+        Fold
+    };
+
+    inline const CaseRecord& getCaseRecord(uint32_t codePoint) {
+        const uint32_t block = CASE_RECORD_INDEX[codePoint >> CASE_RECORD_SHIFT];
+        return CASE_RECORDS[CASE_RECORD_BLOCKS[
+            (block << CASE_RECORD_SHIFT) +
+            (codePoint & ((1u << CASE_RECORD_SHIFT) - 1))
+        ]];
+    }
+
+    /*
+    ** @brief: Whether the capital sigma at 'pos' ends a word, in which case it
+    **    lowercases to 'ς' instead of 'σ' (the Final_Sigma condition).
+    ** @note: Everything before 'pos' has already been validated.
+    */
+    inline bool isFinalSigma(
+        const unsigned char* bytes,
+        std::size_t length,
+        std::size_t pos
+    ) {
+        bool cased = false;
+        std::size_t before = pos;
+
+        while (before > 0) {
+            std::size_t start = before - 1;
+            while (start > 0 && (bytes[start] & 0xc0) == 0x80) {
+                --start;
+            }
+
+            uint32_t codePoint = 0;
+            scalar::decodeUtf8Sequence(bytes + start, before - start, codePoint);
+            const uint8_t flags = getCaseRecord(codePoint).flags;
+            if (not (flags & CASE_IGNORABLE)) {
+                cased = (flags & CASE_CASED) != 0;
+                break;
+            }
+            before = start;
+        }
+
+        if (not cased) {
+            return false;
+        }
+
+        std::size_t after = pos + 2;
+        while (after < length) {
+            uint32_t codePoint;
+            const int size = scalar::decodeUtf8Sequence(
+                bytes + after, length - after, codePoint
+            );
+            if (size == 0) {
+                return true;
+            }
+
+            const uint8_t flags = getCaseRecord(codePoint).flags;
+            if (not (flags & CASE_IGNORABLE)) {
+                return not (flags & CASE_CASED);
+            }
+            after += size;
+        }
+        return true;
+    }
+
+    /*
+    ** @brief: Writes the case mapping of the given utf8 text over 'output'.
+    ** @note: 'output' is sized up front for a mapping that keeps the length,
+    **    and only grows when the mapped text gets longer than that. When the
+    **    text lies in 'output', it is mapped into a new string instead.
+    ** @throws InvalidUtf8: If the text is not strictly valid utf8.
+    */
+    inline void convertCase(
+        const unsigned char* bytes,
+        std::size_t length,
+        CaseMapping mapping,
+        std::string& output
+    ) {
+        if (isViewInto(std::string_view(reinterpret_cast<const char*>(bytes), length), output)) {
+            std::string converted;
+            convertCase(bytes, length, mapping, converted);
+            output.swap(converted);
+            return;
+        }
+
+        const int field = static_cast<int>(mapping);
+        const bool upper = mapping == CaseMapping::Upper;
+
+        output.resize(length + CASE_MAX_MAPPING_BYTES);
+        std::size_t pos = 0;
+        std::size_t written = 0;
+
+        while (pos < length) {
+            // Ascii maps to ascii, so this covers the next ascii run too.
+            if (output.size() - written < length - pos + CASE_MAX_MAPPING_BYTES) {
+                output.resize(2 * output.size() + CASE_MAX_MAPPING_BYTES);
+            }
+            char* out = &output[0];
+
+            if (bytes[pos] < 0x80) {
+                const std::size_t run = convertAsciiCase(
+                    bytes + pos, length - pos, out + written, upper
+                );
+                pos += run;
+                written += run;
+                continue;
+            }
+
+            uint32_t codePoint;
+            const int size = scalar::decodeUtf8Sequence(
+                bytes + pos, length - pos, codePoint
+            );
+            if (size == 0) {
+                throwUtf8Error(bytes, length, pos);
+            }
+
+            const CaseRecord& record = getCaseRecord(codePoint);
+            const uint16_t special = record.special[field];
+
+            if (special != 0) {
+                const unsigned char* mapped = CASE_SPECIAL_POOL + special;
+                std::memcpy(out + written, mapped + 1, mapped[0]);
+                written += mapped[0];
+            } else if (record.delta[field] == 0) {
+                std::memcpy(out + written, bytes + pos, size);
+                written += size;
+            } else if (codePoint == 0x3a3 && mapping == CaseMapping::Lower &&
+                       isFinalSigma(bytes, length, pos)) {
+                written += scalar::encodeUtf8Sequence(0x3c2, out + written);
+            } else {
+                written += scalar::encodeUtf8Sequence(
+                    codePoint + record.delta[field], out + written
+                );
+            }
+            pos += size;
+        }
+
+        output.resize(written);
+    }
+
+    /*
+    ** @brief: Produces the case folded utf8 bytes of a text one at a time,
+    **    without allocating.
+    ** @note: Bytes that are not part of a strictly valid sequence come out
+    **    as they are, so any byte string has a well-defined folding.
+    */
+    struct CaseFoldCursor {
+        const unsigned char* bytes;
+        std::size_t length;
+        std::size_t pos = 0;
+        unsigned char folded[CASE_MAX_MAPPING_BYTES];
+        int foldedPos = 0;
+        int foldedLength = 0;
+
+        CaseFoldCursor(std::string_view str)
+            : bytes(reinterpret_cast<const unsigned char*>(str.data())),
+              length(str.size()) {}
+
+        bool isBetweenCodePoints() const {
+            return foldedPos == foldedLength;
+        }
+
+        /*
+        ** @returns: The next folded byte, or -1 at the end of the text.
+        */
+        int next() {
+            if (foldedPos < foldedLength) {
+                return folded[foldedPos++];
+            }
+            if (pos >= length) {
+                return -1;
+            }
+
+            const unsigned char byte = bytes[pos];
+            if (byte < 0x80) {
+                ++pos;
+                return static_cast<unsigned char>(byte - 'A') < 26 ? byte | 0x20 : byte;
+            }
+
+            uint32_t codePoint;
+            const int size = scalar::decodeUtf8Sequence(bytes + pos, length - pos, codePoint);
+            if (size == 0) {
+                ++pos;
+                return byte;
+            }
+            pos += size;
+
+            const CaseRecord& record = getCaseRecord(codePoint);
+            const int field = static_cast<int>(CaseMapping::Fold);
+            if (record.special[field] != 0) {
+                const unsigned char* mapped = CASE_SPECIAL_POOL + record.special[field];
+                foldedLength = mapped[0];
+                std::memcpy(folded, mapped + 1, foldedLength);
+            } else {
+                foldedLength = scalar::encodeUtf8Sequence(
+                    codePoint + record.delta[field], reinterpret_cast<char*>(folded)
+                );
+            }
+
+            foldedPos = 1;
+            return folded[0];
+        }
+    };
+
+    /*
+    ** @brief: A streaming 64-bit hash over bytes that are fed in pieces of
+    **    any size. The result only depends on the concatenated bytes.
+    */
+    struct StreamHasher {
+        uint64_t hash = 0x243f6a8885a308d3ull;
+        uint64_t pending = 0;
+        int pendingBytes = 0;
+        uint64_t total = 0;
+
+        static uint64_t loadWord(const unsigned char* bytes) {
+            uint64_t word;
+            std::memcpy(&word, bytes, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            word = __builtin_bswap64(word);
+#endif
+            return word;
+        }
+
+        void mix(uint64_t word) {
+            hash = (hash ^ word) * 0x9e3779b97f4a7c15ull;
+            hash ^= hash >> 29;
+        }
+
+        void update(unsigned char byte) {
+            pending |= static_cast<uint64_t>(byte) << (8 * pendingBytes);
+            ++total;
+            if (++pendingBytes == 8) {
+                mix(pending);
+                pending = 0;
+                pendingBytes = 0;
+            }
+        }
+
+        void update(const unsigned char* bytes, std::size_t length) {
+            std::size_t pos = 0;
+            while (pendingBytes != 0 && pos < length) {
+                update(bytes[pos++]);
+            }
+            for (; pos + 8 <= length; pos += 8) {
+                mix(loadWord(bytes + pos));
+                total += 8;
+            }
+            while (pos < length) {
+                update(bytes[pos++]);
+            }
+        }
+
+        uint64_t finish() const {
+            uint64_t result = hash;
+            result = (result ^ pending) * 0x9e3779b97f4a7c15ull;
+            result = (result ^ total) * 0xff51afd7ed558ccdull;
+            result ^= result >> 33;
+            result *= 0xc4ceb9fe1a85ec53ull;
+            return result ^ (result >> 33);
+        }
+    };
+} // namespace detail
+
+    /*
+    ** @brief: Lowercases the given utf8 text into 'output', replacing its
+    **    contents but reusing its storage. 'str' may view 'output'.
+    ** @note: Applies the full, locale-independent mappings, so the length
+    **    may change (eg. 'İ' becomes "i̇"). A capital sigma that ends a word
+    **    becomes 'ς'.
+    ** @throws InvalidUtf8: If the text is not strictly valid utf8.
+    */
+    inline void toLower(std::string_view str, std::string& output) {
+        detail::convertCase(
+            reinterpret_cast<const unsigned char*>(str.data()),
+            str.size(),
+            detail::CaseMapping::Lower,
+            output
+        );
+    }
+
+    /*
+    ** @brief: Uppercases the given utf8 text into 'output', replacing its
+    **    contents but reusing its storage. 'str' may view 'output'.
+    ** @note: Applies the full, locale-independent mappings, so the length
+    **    may change (eg. 'ß' becomes "SS").
+    ** @throws InvalidUtf8: If the text is not strictly valid utf8.
+    */
+    inline void toUpper(std::string_view str, std::string& output) {
+        detail::convertCase(
+            reinterpret_cast<const unsigned char*>(str.data()),
+            str.size(),
+            detail::CaseMapping::Upper,
+            output
+        );
+    }
+
+    /*
+    ** @brief: Applies full case folding to the given utf8 text into 'output',
+    **    replacing its contents but reusing its storage. Texts that only
+    **    differ in case fold to the same bytes. 'str' may view 'output'.
+    ** @note: Uses the default (non-Turkic) foldings, so 'ß' becomes "ss".
+    ** @throws InvalidUtf8: If the text is not strictly valid utf8.
+    */
+    inline void caseFold(std::string_view str, std::string& output) {
+        detail::convertCase(
+            reinterpret_cast<const unsigned char*>(str.data()),
+            str.size(),
+            detail::CaseMapping::Fold,
+            output
+        );
+    }
+
+    /*
+    ** @brief: Returns the given utf8 text lowercased.
+    ** @throws InvalidUtf8: If the text is not strictly valid utf8.
+    */
+    inline std::string toLower(std::string_view str) {
+        std::string output;
+        toLower(str, output);
+        return output;
+    }
+
+    /*
+    ** @brief: Returns the given utf8 text uppercased.
+    ** @throws InvalidUtf8: If the text is not strictly valid utf8.
+    */
+    inline std::string toUpper(std::string_view str) {
+        std::string output;
+        toUpper(str, output);
+        return output;
+    }
+
+    /*
+    ** @brief: Returns the given utf8 text case folded.
+    ** @throws InvalidUtf8: If the text is not strictly valid utf8.
+    */
+    inline std::string caseFold(std::string_view str) {
+        std::string output;
+        caseFold(str, output);
+        return output;
+    }
+
+    /*
+    ** @brief: Compares two utf8 texts by their full case foldings, without
+    **    allocating: "Straße" equals "STRASSE".
+    ** @returns: A negative value, zero or a positive value, as the folded
+    **    'first' orders before, the same as or after the folded 'second'
+    **    (in code point order).
+    ** @note: Does not throw. Invalid bytes take part as they are, unfolded.
+    */
+    inline int caseInsensitiveCompare(std::string_view first, std::string_view second) noexcept {
+        detail::CaseFoldCursor left(first);
+        detail::CaseFoldCursor right(second);
+
+        while (true) {
+            if (left.isBetweenCodePoints() && right.isBetweenCodePoints()) {
+                const std::size_t available = std::min(
+                    left.length - left.pos, right.length - right.pos
+                );
+                const std::size_t same = detail::asciiCaseInsensitivePrefix(
+                    left.bytes + left.pos, right.bytes + right.pos, available
+                );
+                left.pos += same;
+                right.pos += same;
+            }
+
+            const int leftByte = left.next();
+            const int rightByte = right.next();
+            if (leftByte != rightByte) {
+                return leftByte < rightByte ? -1 : 1;
+            }
+            if (leftByte < 0) {
+                return 0;
+            }
+        }
+    }
+
+    /*
+    ** @brief: Whether two utf8 texts are equal once case folded.
+    ** @note: Does not throw or allocate.
+    */
+    inline bool caseInsensitiveEqual(std::string_view first, std::string_view second) noexcept {
+        if (first.size() == second.size() &&
+            std::memcmp(first.data(), second.data(), first.size()) == 0) {
+            return true;
+        }
+        return caseInsensitiveCompare(first, second) == 0;
+    }
+
+    /*
+    ** @brief: Hashes the full case folding of a utf8 text, without
+    **    allocating. Texts that 'caseInsensitiveEqual' finds equal hash the
+    **    same.
+    ** @note: Does not throw. Ascii runs are folded 64 bytes at a time.
+    */
+    inline std::size_t caseInsensitiveHash(std::string_view str) noexcept {
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data());
+        const std::size_t length = str.size();
+        detail::StreamHasher hasher;
+        unsigned char buffer[64];
+        std::size_t pos = 0;
+
+        while (pos < length) {
+            const std::size_t chunk = std::min<std::size_t>(length - pos, sizeof(buffer));
+            const std::size_t run = detail::convertAsciiCase(
+                bytes + pos, chunk, reinterpret_cast<char*>(buffer), false
+            );
+            if (run != 0) {
+                hasher.update(buffer, run);
+                pos += run;
+                continue;
+            }
+
+            // One code point at a time, up to the next ascii byte.
+            detail::CaseFoldCursor cursor(str.substr(pos));
+            do {
+                hasher.update(static_cast<unsigned char>(cursor.next()));
+            } while (not cursor.isBetweenCodePoints() || 
+                     (cursor.pos < cursor.length && cursor.bytes[cursor.pos] >= 0x80));
+            pos += cursor.pos;
+        }
+
+        return static_cast<std::size_t>(hasher.finish());
+    }
+
+    /*
+    ** @brief: Case-insensitive hasher for unordered containers keyed on utf8
+    **    strings, eg. 
+    **    'std::unordered_map<std::string, T, CaseInsensitiveHash, CaseInsensitiveEqual>'.
+    ** @note: Transparent, so that with C++20 heterogeneous lookup 'find' 
+    **    takes a 'std::string_view' or a literal without building a key.
+    */
+    struct CaseInsensitiveHash {
+        using is_transparent = void;
+
+        std::size_t operator()(std::string_view str) const noexcept {
+            return caseInsensitiveHash(str);
+        }
+    };
+
+    /*
+    ** @brief: The equality that goes with 'CaseInsensitiveHash'.
+    */
+    struct CaseInsensitiveEqual {
+        using is_transparent = void;
+
+        bool operator()(std::string_view first, std::string_view second) const noexcept {
+            return caseInsensitiveEqual(first, second);
+        }
+    };
+
+    /*
+    ** @brief: Case-insensitive ordering for ordered containers, eg. 
+    **    'std::map<std::string, T, CaseInsensitiveLess>'.
+    */
+    struct CaseInsensitiveLess {
+        using is_transparent = void;
+
+        bool operator()(std::string_view first, std::string_view second) const noexcept {
+            return caseInsensitiveCompare(first, second) < 0;
+        }
+    };
+} // namespace gc
+
+#endif // __GENIUS_C_UTF8_CASE__
@@ -0,0 +1,380 @@
+// Generated by tools/gen_codepages.py. Do not edit.
+#ifndef __GENIUS_C_UTF8_CODEPAGE_TABLES__
+#define __GENIUS_C_UTF8_CODEPAGE_TABLES__
+
+#include <cstdint>
+
+namespace gc {
+namespace detail {
+    // Marks a byte that the codepage leaves undefined.
+    inline constexpr uint16_t CODEPAGE_UNDEFINED = 0xffff;
+
+    struct CodepageInverseEntry {
+        uint16_t codePoint;
+        uint8_t byte;
+    };
+
+    struct CodepageTable {
+        // The code points of bytes 0x80 to 0xff.
+        uint16_t toUnicode[128];
+        // The defined upper-half bytes, sorted by code point.
+        const CodepageInverseEntry* fromUnicode;
+        int fromUnicodeSize;
+    };
+
+    // Windows-1252 (Western European)
+    inline constexpr CodepageInverseEntry CODEPAGE_WINDOWS1252_INVERSE[] = {
+        {0x00a0, 0xa0}, {0x00a1, 0xa1}, {0x00a2, 0xa2}, {0x00a3, 0xa3},
+        {0x00a4, 0xa4}, {0x00a5, 0xa5}, {0x00a6, 0xa6}, {0x00a7, 0xa7},
+        {0x00a8, 0xa8}, {0x00a9, 0xa9}, {0x00aa, 0xaa}, {0x00ab, 0xab},
+        {0x00ac, 0xac}, {0x00ad, 0xad}, {0x00ae, 0xae}, {0x00af, 0xaf},
+        {0x00b0, 0xb0}, {0x00b1, 0xb1}, {0x00b2, 0xb2}, {0x00b3, 0xb3},
+        {0x00b4, 0xb4}, {0x00b5, 0xb5}, {0x00b6, 0xb6}, {0x00b7, 0xb7},
+        {0x00b8, 0xb8}, {0x00b9, 0xb9}, {0x00ba, 0xba}, {0x00bb, 0xbb},
+        {0x00bc, 0xbc}, {0x00bd, 0xbd}, {0x00be, 0xbe}, {0x00bf, 0xbf},
+        {0x00c0, 0xc0}, {0x00c1, 0xc1}, {0x00c2, 0xc2}, {0x00c3, 0xc3},
+        {0x00c4, 0xc4}, {0x00c5, 0xc5}, {0x00c6, 0xc6}, {0x00c7, 0xc7},
+        {0x00c8, 0xc8}, {0x00c9, 0xc9}, {0x00ca, 0xca}, {0x00cb, 0xcb},
+        {0x00cc, 0xcc}, {0x00cd, 0xcd}, {0x00ce, 0xce}, {0x00cf, 0xcf},
+        {0x00d0, 0xd0}, {0x00d1, 0xd1}, {0x00d2, 0xd2}, {0x00d3, 0xd3},
+        {0x00d4, 0xd4}, {0x00d5, 0xd5}, {0x00d6, 0xd6}, {0x00d7, 0xd7},
+        {0x00d8, 0xd8}, {0x00d9, 0xd9}, {0x00da, 0xda}, {0x00db, 0xdb},
+        {0x00dc, 0xdc}, {0x00dd, 0xdd}, {0x00de, 0xde}, {0x00df, 0xdf},
+        {0x00e0, 0xe0}, {0x00e1, 0xe1}, {0x00e2, 0xe2}, {0x00e3, 0xe3},
+        {0x00e4, 0xe4}, {0x00e5, 0xe5}, {0x00e6, 0xe6}, {0x00e7, 0xe7},
+        {0x00e8, 0xe8}, {0x00e9, 0xe9}, {0x00ea, 0xea}, {0x00eb, 0xeb},
+        {0x00ec, 0xec}, {0x00ed, 0xed}, {0x00ee, 0xee}, {0x00ef, 0xef},
+        {0x00f0, 0xf0}, {0x00f1, 0xf1}, {0x00f2, 0xf2}, {0x00f3, 0xf3},
+        {0x00f4, 0xf4}, {0x00f5, 0xf5}, {0x00f6, 0xf6}, {0x00f7, 0xf7},
+        {0x00f8, 0xf8}, {0x00f9, 0xf9}, {0x00fa, 0xfa}, {0x00fb, 0xfb},
+        {0x00fc, 0xfc}, {0x00fd, 0xfd}, {0x00fe, 0xfe}, {0x00ff, 0xff},
+        {0x0152, 0x8c}, {0x0153, 0x9c}, {0x0160, 0x8a}, {0x0161, 0x9a},
+        {0x0178, 0x9f}, {0x017d, 0x8e}, {0x017e, 0x9e}, {0x0192, 0x83},
+        {0x02c6, 0x88}, {0x02dc, 0x98}, {0x2013, 0x96}, {0x2014, 0x97},
+        {0x2018, 0x91}, {0x2019, 0x92}, {0x201a, 0x82}, {0x201c, 0x93},
+        {0x201d, 0x94}, {0x201e, 0x84}, {0x2020, 0x86}, {0x2021, 0x87},
+        {0x2022, 0x95}, {0x2026, 0x85}, {0x2030, 0x89}, {0x2039, 0x8b},
+        {0x203a, 0x9b}, {0x20ac, 0x80}, {0x2122, 0x99},
+    };
+
+    inline constexpr CodepageTable CODEPAGE_WINDOWS1252 = {
+        {
+            0x20ac, 0xffff, 0x201a, 0x0192, 0x201e, 0x2026, 0x2020, 0x2021,
+            0x02c6, 0x2030, 0x0160, 0x2039, 0x0152, 0xffff, 0x017d, 0xffff,
+            0xffff, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+            0x02dc, 0x2122, 0x0161, 0x203a, 0x0153, 0xffff, 0x017e, 0x0178,
+            0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7,
+            0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+            0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+            0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf,
+            0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+            0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+            0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7,
+            0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df,
+            0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7,
+            0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
+            0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7,
+            0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff,
+        },
+        CODEPAGE_WINDOWS1252_INVERSE,
+        123
+    };
+
+    // ISO-8859-2 (Central European)
+    inline constexpr CodepageInverseEntry CODEPAGE_ISO8859_2_INVERSE[] = {
+        {0x0080, 0x80}, {0x0081, 0x81}, {0x0082, 0x82}, {0x0083, 0x83},
+        {0x0084, 0x84}, {0x0085, 0x85}, {0x0086, 0x86}, {0x0087, 0x87},
+        {0x0088, 0x88}, {0x0089, 0x89}, {0x008a, 0x8a}, {0x008b, 0x8b},
+        {0x008c, 0x8c}, {0x008d, 0x8d}, {0x008e, 0x8e}, {0x008f, 0x8f},
+        {0x0090, 0x90}, {0x0091, 0x91}, {0x0092, 0x92}, {0x0093, 0x93},
+        {0x0094, 0x94}, {0x0095, 0x95}, {0x0096, 0x96}, {0x0097, 0x97},
+        {0x0098, 0x98}, {0x0099, 0x99}, {0x009a, 0x9a}, {0x009b, 0x9b},
+        {0x009c, 0x9c}, {0x009d, 0x9d}, {0x009e, 0x9e}, {0x009f, 0x9f},
+        {0x00a0, 0xa0}, {0x00a4, 0xa4}, {0x00a7, 0xa7}, {0x00a8, 0xa8},
+        {0x00ad, 0xad}, {0x00b0, 0xb0}, {0x00b4, 0xb4}, {0x00b8, 0xb8},
+        {0x00c1, 0xc1}, {0x00c2, 0xc2}, {0x00c4, 0xc4}, {0x00c7, 0xc7},
+        {0x00c9, 0xc9}, {0x00cb, 0xcb}, {0x00cd, 0xcd}, {0x00ce, 0xce},
+        {0x00d3, 0xd3}, {0x00d4, 0xd4}, {0x00d6, 0xd6}, {0x00d7, 0xd7},
+        {0x00da, 0xda}, {0x00dc, 0xdc}, {0x00dd, 0xdd}, {0x00df, 0xdf},
+        {0x00e1, 0xe1}, {0x00e2, 0xe2}, {0x00e4, 0xe4}, {0x00e7, 0xe7},
+        {0x00e9, 0xe9}, {0x00eb, 0xeb}, {0x00ed, 0xed}, {0x00ee, 0xee},
+        {0x00f3, 0xf3}, {0x00f4, 0xf4}, {0x00f6, 0xf6}, {0x00f7, 0xf7},
+        {0x00fa, 0xfa}, {0x00fc, 0xfc}, {0x00fd, 0xfd}, {0x0102, 0xc3},
+        {0x0103, 0xe3}, {0x0104, 0xa1}, {0x0105, 0xb1}, {0x0106, 0xc6},
+        {0x0107, 0xe6}, {0x010c, 0xc8}, {0x010d, 0xe8}, {0x010e, 0xcf},
+        {0x010f, 0xef}, {0x0110, 0xd0}, {0x0111, 0xf0}, {0x0118, 0xca},
+        {0x0119, 0xea}, {0x011a, 0xcc}, {0x011b, 0xec}, {0x0139, 0xc5},
+        {0x013a, 0xe5}, {0x013d, 0xa5}, {0x013e, 0xb5}, {0x0141, 0xa3},
+        {0x0142, 0xb3}, {0x0143, 0xd1}, {0x0144, 0xf1}, {0x0147, 0xd2},
+        {0x0148, 0xf2}, {0x0150, 0xd5}, {0x0151, 0xf5}, {0x0154, 0xc0},
+        {0x0155, 0xe0}, {0x0158, 0xd8}, {0x0159, 0xf8}, {0x015a, 0xa6},
+        {0x015b, 0xb6}, {0x015e, 0xaa}, {0x015f, 0xba}, {0x0160, 0xa9},
+        {0x0161, 0xb9}, {0x0162, 0xde}, {0x0163, 0xfe}, {0x0164, 0xab},
+        {0x0165, 0xbb}, {0x016e, 0xd9}, {0x016f, 0xf9}, {0x0170, 0xdb},
+        {0x0171, 0xfb}, {0x0179, 0xac}, {0x017a, 0xbc}, {0x017b, 0xaf},
+        {0x017c, 0xbf}, {0x017d, 0xae}, {0x017e, 0xbe}, {0x02c7, 0xb7},
+        {0x02d8, 0xa2}, {0x02d9, 0xff}, {0x02db, 0xb2}, {0x02dd, 0xbd},
+    };
+
+    inline constexpr CodepageTable CODEPAGE_ISO8859_2 = {
+        {
+            0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+            0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+            0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+            0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+            0x00a0, 0x0104, 0x02d8, 0x0141, 0x00a4, 0x013d, 0x015a, 0x00a7,
+            0x00a8, 0x0160, 0x015e, 0x0164, 0x0179, 0x00ad, 0x017d, 0x017b,
+            0x00b0, 0x0105, 0x02db, 0x0142, 0x00b4, 0x013e, 0x015b, 0x02c7,
+            0x00b8, 0x0161, 0x015f, 0x0165, 0x017a, 0x02dd, 0x017e, 0x017c,
+            0x0154, 0x00c1, 0x00c2, 0x0102, 0x00c4, 0x0139, 0x0106, 0x00c7,
+            0x010c, 0x00c9, 0x0118, 0x00cb, 0x011a, 0x00cd, 0x00ce, 0x010e,
+            0x0110, 0x0143, 0x0147, 0x00d3, 0x00d4, 0x0150, 0x00d6, 0x00d7,
+            0x0158, 0x016e, 0x00da, 0x0170, 0x00dc, 0x00dd, 0x0162, 0x00df,
+            0x0155, 0x00e1, 0x00e2, 0x0103, 0x00e4, 0x013a, 0x0107, 0x00e7,
+            0x010d, 0x00e9, 0x0119, 0x00eb, 0x011b, 0x00ed, 0x00ee, 0x010f,
+            0x0111, 0x0144, 0x0148, 0x00f3, 0x00f4, 0x0151, 0x00f6, 0x00f7,
+            0x0159, 0x016f, 0x00fa, 0x0171, 0x00fc, 0x00fd, 0x0163, 0x02d9,
+        },
+        CODEPAGE_ISO8859_2_INVERSE,
+        128
+    };
+
+    // ISO-8859-5 (Cyrillic)
+    inline constexpr CodepageInverseEntry CODEPAGE_ISO8859_5_INVERSE[] = {
+        {0x0080, 0x80}, {0x0081, 0x81}, {0x0082, 0x82}, {0x0083, 0x83},
+        {0x0084, 0x84}, {0x0085, 0x85}, {0x0086, 0x86}, {0x0087, 0x87},
+        {0x0088, 0x88}, {0x0089, 0x89}, {0x008a, 0x8a}, {0x008b, 0x8b},
+        {0x008c, 0x8c}, {0x008d, 0x8d}, {0x008e, 0x8e}, {0x008f, 0x8f},
+        {0x0090, 0x90}, {0x0091, 0x91}, {0x0092, 0x92}, {0x0093, 0x93},
+        {0x0094, 0x94}, {0x0095, 0x95}, {0x0096, 0x96}, {0x0097, 0x97},
+        {0x0098, 0x98}, {0x0099, 0x99}, {0x009a, 0x9a}, {0x009b, 0x9b},
+        {0x009c, 0x9c}, {0x009d, 0x9d}, {0x009e, 0x9e}, {0x009f, 0x9f},
+        {0x00a0, 0xa0}, {0x00a7, 0xfd}, {0x00ad, 0xad}, {0x0401, 0xa1},
+        {0x0402, 0xa2}, {0x0403, 0xa3}, {0x0404, 0xa4}, {0x0405, 0xa5},
+        {0x0406, 0xa6}, {0x0407, 0xa7}, {0x0408, 0xa8}, {0x0409, 0xa9},
+        {0x040a, 0xaa}, {0x040b, 0xab}, {0x040c, 0xac}, {0x040e, 0xae},
+        {0x040f, 0xaf}, {0x0410, 0xb0}, {0x0411, 0xb1}, {0x0412, 0xb2},
+        {0x0413, 0xb3}, {0x0414, 0xb4}, {0x0415, 0xb5}, {0x0416, 0xb6},
+        {0x0417, 0xb7}, {0x0418, 0xb8}, {0x0419, 0xb9}, {0x041a, 0xba},
+        {0x041b, 0xbb}, {0x041c, 0xbc}, {0x041d, 0xbd}, {0x041e, 0xbe},
+        {0x041f, 0xbf}, {0x0420, 0xc0}, {0x0421, 0xc1}, {0x0422, 0xc2},
+        {0x0423, 0xc3}, {0x0424, 0xc4}, {0x0425, 0xc5}, {0x0426, 0xc6},
+        {0x0427, 0xc7}, {0x0428, 0xc8}, {0x0429, 0xc9}, {0x042a, 0xca},
+        {0x042b, 0xcb}, {0x042c, 0xcc}, {0x042d, 0xcd}, {0x042e, 0xce},
+        {0x042f, 0xcf}, {0x0430, 0xd0}, {0x0431, 0xd1}, {0x0432, 0xd2},
+        {0x0433, 0xd3}, {0x0434, 0xd4}, {0x0435, 0xd5}, {0x0436, 0xd6},
+        {0x0437, 0xd7}, {0x0438, 0xd8}, {0x0439, 0xd9}, {0x043a, 0xda},
+        {0x043b, 0xdb}, {0x043c, 0xdc}, {0x043d, 0xdd}, {0x043e, 0xde},
+        {0x043f, 0xdf}, {0x0440, 0xe0}, {0x0441, 0xe1}, {0x0442, 0xe2},
+        {0x0443, 0xe3}, {0x0444, 0xe4}, {0x0445, 0xe5}, {0x0446, 0xe6},
+        {0x0447, 0xe7}, {0x0448, 0xe8}, {0x0449, 0xe9}, {0x044a, 0xea},
+        {0x044b, 0xeb}, {0x044c, 0xec}, {0x044d, 0xed}, {0x044e, 0xee},
+        {0x044f, 0xef}, {0x0451, 0xf1}, {0x0452, 0xf2}, {0x0453, 0xf3},
+        {0x0454, 0xf4}, {0x0455, 0xf5}, {0x0456, 0xf6}, {0x0457, 0xf7},
+        {0x0458, 0xf8}, {0x0459, 0xf9}, {0x045a, 0xfa}, {0x045b, 0xfb},
+        {0x045c, 0xfc}, {0x045e, 0xfe}, {0x045f, 0xff}, {0x2116, 0xf0},
+    };
+
+    inline constexpr CodepageTable CODEPAGE_ISO8859_5 = {
+        {
+            0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+            0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+            0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+            0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+            0x00a0, 0x0401, 0x0402, 0x0403, 0x0404, 0x0405, 0x0406, 0x0407,
+            0x0408, 0x0409, 0x040a, 0x040b, 0x040c, 0x00ad, 0x040e, 0x040f,
+            0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417,
+            0x0418, 0x0419, 0x041a, 0x041b, 0x041c, 0x041d, 0x041e, 0x041f,
+            0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427,
+            0x0428, 0x0429, 0x042a, 0x042b, 0x042c, 0x042d, 0x042e, 0x042f,
+            0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+            0x0438, 0x0439, 0x043a, 0x043b, 0x043c, 0x043d, 0x043e, 0x043f,
+            0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+            0x0448, 0x0449, 0x044a, 0x044b, 0x044c, 0x044d, 0x044e, 0x044f,
+            0x2116, 0x0451, 0x0452, 0x0453, 0x0454, 0x0455, 0x0456, 0x0457,
+            0x0458, 0x0459, 0x045a, 0x045b, 0x045c, 0x00a7, 0x045e, 0x045f,
+        },
+        CODEPAGE_ISO8859_5_INVERSE,
+        128
+    };
+
+    // ISO-8859-15 (Western European with euro)
+    inline constexpr CodepageInverseEntry CODEPAGE_ISO8859_15_INVERSE[] = {
+        {0x0080, 0x80}, {0x0081, 0x81}, {0x0082, 0x82}, {0x0083, 0x83},
+        {0x0084, 0x84}, {0x0085, 0x85}, {0x0086, 0x86}, {0x0087, 0x87},
+        {0x0088, 0x88}, {0x0089, 0x89}, {0x008a, 0x8a}, {0x008b, 0x8b},
+        {0x008c, 0x8c}, {0x008d, 0x8d}, {0x008e, 0x8e}, {0x008f, 0x8f},
+        {0x0090, 0x90}, {0x0091, 0x91}, {0x0092, 0x92}, {0x0093, 0x93},
+        {0x0094, 0x94}, {0x0095, 0x95}, {0x0096, 0x96}, {0x0097, 0x97},
+        {0x0098, 0x98}, {0x0099, 0x99}, {0x009a, 0x9a}, {0x009b, 0x9b},
+        {0x009c, 0x9c}, {0x009d, 0x9d}, {0x009e, 0x9e}, {0x009f, 0x9f},
+        {0x00a0, 0xa0}, {0x00a1, 0xa1}, {0x00a2, 0xa2}, {0x00a3, 0xa3},
+        {0x00a5, 0xa5}, {0x00a7, 0xa7}, {0x00a9, 0xa9}, {0x00aa, 0xaa},
+        {0x00ab, 0xab}, {0x00ac, 0xac}, {0x00ad, 0xad}, {0x00ae, 0xae},
+        {0x00af, 0xaf}, {0x00b0, 0xb0}, {0x00b1, 0xb1}, {0x00b2, 0xb2},
+        {0x00b3, 0xb3}, {0x00b5, 0xb5}, {0x00b6, 0xb6}, {0x00b7, 0xb7},
+        {0x00b9, 0xb9}, {0x00ba, 0xba}, {0x00bb, 0xbb}, {0x00bf, 0xbf},
+        {0x00c0, 0xc0}, {0x00c1, 0xc1}, {0x00c2, 0xc2}, {0x00c3, 0xc3},
+        {0x00c4, 0xc4}, {0x00c5, 0xc5}, {0x00c6, 0xc6}, {0x00c7, 0xc7},
+        {0x00c8, 0xc8}, {0x00c9, 0xc9}, {0x00ca, 0xca}, {0x00cb, 0xcb},
+        {0x00cc, 0xcc}, {0x00cd, 0xcd}, {0x00ce, 0xce}, {0x00cf, 0xcf},
+        {0x00d0, 0xd0}, {0x00d1, 0xd1}, {0x00d2, 0xd2}, {0x00d3, 0xd3},
+        {0x00d4, 0xd4}, {0x00d5, 0xd5}, {0x00d6, 0xd6}, {0x00d7, 0xd7},
+        {0x00d8, 0xd8}, {0x00d9, 0xd9}, {0x00da, 0xda}, {0x00db, 0xdb},
+        {0x00dc, 0xdc}, {0x00dd, 0xdd}, {0x00de, 0xde}, {0x00df, 0xdf},
+        {0x00e0, 0xe0}, {0x00e1, 0xe1}, {0x00e2, 0xe2}, {0x00e3, 0xe3},
+        {0x00e4, 0xe4}, {0x00e5, 0xe5}, {0x00e6, 0xe6}, {0x00e7, 0xe7},
+        {0x00e8, 0xe8}, {0x00e9, 0xe9}, {0x00ea, 0xea}, {0x00eb, 0xeb},
+        {0x00ec, 0xec}, {0x00ed, 0xed}, {0x00ee, 0xee}, {0x00ef, 0xef},
+        {0x00f0, 0xf0}, {0x00f1, 0xf1}, {0x00f2, 0xf2}, {0x00f3, 0xf3},
+        {0x00f4, 0xf4}, {0x00f5, 0xf5}, {0x00f6, 0xf6}, {0x00f7, 0xf7},
+        {0x00f8, 0xf8}, {0x00f9, 0xf9}, {0x00fa, 0xfa}, {0x00fb, 0xfb},
+        {0x00fc, 0xfc}, {0x00fd, 0xfd}, {0x00fe, 0xfe}, {0x00ff, 0xff},
+        {0x0152, 0xbc}, {0x0153, 0xbd}, {0x0160, 0xa6}, {0x0161, 0xa8},
+        {0x0178, 0xbe}, {0x017d, 0xb4}, {0x017e, 0xb8}, {0x20ac, 0xa4},
+    };
+
+    inline constexpr CodepageTable CODEPAGE_ISO8859_15 = {
+        {
+            0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+            0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+            0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+            0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+            0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x20ac, 0x00a5, 0x0160, 0x00a7,
+            0x0161, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+            0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x017d, 0x00b5, 0x00b6, 0x00b7,
+            0x017e, 0x00b9, 0x00ba, 0x00bb, 0x0152, 0x0153, 0x0178, 0x00bf,
+            0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+            0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+            0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7,
+            0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df,
+            0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7,
+            0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
+            0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7,
+            0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff,
+        },
+        CODEPAGE_ISO8859_15_INVERSE,
+        128
+    };
+
+    // KOI8-R (Russian)
+    inline constexpr CodepageInverseEntry CODEPAGE_KOI8R_INVERSE[] = {
+        {0x00a0, 0x9a}, {0x00a9, 0xbf}, {0x00b0, 0x9c}, {0x00b2, 0x9d},
+        {0x00b7, 0x9e}, {0x00f7, 0x9f}, {0x0401, 0xb3}, {0x0410, 0xe1},
+        {0x0411, 0xe2}, {0x0412, 0xf7}, {0x0413, 0xe7}, {0x0414, 0xe4},
+        {0x0415, 0xe5}, {0x0416, 0xf6}, {0x0417, 0xfa}, {0x0418, 0xe9},
+        {0x0419, 0xea}, {0x041a, 0xeb}, {0x041b, 0xec}, {0x041c, 0xed},
+        {0x041d, 0xee}, {0x041e, 0xef}, {0x041f, 0xf0}, {0x0420, 0xf2},
+        {0x0421, 0xf3}, {0x0422, 0xf4}, {0x0423, 0xf5}, {0x0424, 0xe6},
+        {0x0425, 0xe8}, {0x0426, 0xe3}, {0x0427, 0xfe}, {0x0428, 0xfb},
+        {0x0429, 0xfd}, {0x042a, 0xff}, {0x042b, 0xf9}, {0x042c, 0xf8},
+        {0x042d, 0xfc}, {0x042e, 0xe0}, {0x042f, 0xf1}, {0x0430, 0xc1},
+        {0x0431, 0xc2}, {0x0432, 0xd7}, {0x0433, 0xc7}, {0x0434, 0xc4},
+        {0x0435, 0xc5}, {0x0436, 0xd6}, {0x0437, 0xda}, {0x0438, 0xc9},
+        {0x0439, 0xca}, {0x043a, 0xcb}, {0x043b, 0xcc}, {0x043c, 0xcd},
+        {0x043d, 0xce}, {0x043e, 0xcf}, {0x043f, 0xd0}, {0x0440, 0xd2},
+        {0x0441, 0xd3}, {0x0442, 0xd4}, {0x0443, 0xd5}, {0x0444, 0xc6},
+        {0x0445, 0xc8}, {0x0446, 0xc3}, {0x0447, 0xde}, {0x0448, 0xdb},
+        {0x0449, 0xdd}, {0x044a, 0xdf}, {0x044b, 0xd9}, {0x044c, 0xd8},
+        {0x044d, 0xdc}, {0x044e, 0xc0}, {0x044f, 0xd1}, {0x0451, 0xa3},
+        {0x2219, 0x95}, {0x221a, 0x96}, {0x2248, 0x97}, {0x2264, 0x98},
+        {0x2265, 0x99}, {0x2320, 0x93}, {0x2321, 0x9b}, {0x2500, 0x80},
+        {0x2502, 0x81}, {0x250c, 0x82}, {0x2510, 0x83}, {0x2514, 0x84},
+        {0x2518, 0x85}, {0x251c, 0x86}, {0x2524, 0x87}, {0x252c, 0x88},
+        {0x2534, 0x89}, {0x253c, 0x8a}, {0x2550, 0xa0}, {0x2551, 0xa1},
+        {0x2552, 0xa2}, {0x2553, 0xa4}, {0x2554, 0xa5}, {0x2555, 0xa6},
+        {0x2556, 0xa7}, {0x2557, 0xa8}, {0x2558, 0xa9}, {0x2559, 0xaa},
+        {0x255a, 0xab}, {0x255b, 0xac}, {0x255c, 0xad}, {0x255d, 0xae},
+        {0x255e, 0xaf}, {0x255f, 0xb0}, {0x2560, 0xb1}, {0x2561, 0xb2},
+        {0x2562, 0xb4}, {0x2563, 0xb5}, {0x2564, 0xb6}, {0x2565, 0xb7},
+        {0x2566, 0xb8}, {0x2567, 0xb9}, {0x2568, 0xba}, {0x2569, 0xbb},
+        {0x256a, 0xbc}, {0x256b, 0xbd}, {0x256c, 0xbe}, {0x2580, 0x8b},
+        {0x2584, 0x8c}, {0x2588, 0x8d}, {0x258c, 0x8e}, {0x2590, 0x8f},
+        {0x2591, 0x90}, {0x2592, 0x91}, {0x2593, 0x92}, {0x25a0, 0x94},
+    };
+
+    inline constexpr CodepageTable CODEPAGE_KOI8R = {
+        {
+            0x2500, 0x2502, 0x250c, 0x2510, 0x2514, 0x2518, 0x251c, 0x2524,
+            0x252c, 0x2534, 0x253c, 0x2580, 0x2584, 0x2588, 0x258c, 0x2590,
+            0x2591, 0x2592, 0x2593, 0x2320, 0x25a0, 0x2219, 0x221a, 0x2248,
+            0x2264, 0x2265, 0x00a0, 0x2321, 0x00b0, 0x00b2, 0x00b7, 0x00f7,
+            0x2550, 0x2551, 0x2552, 0x0451, 0x2553, 0x2554, 0x2555, 0x2556,
+            0x2557, 0x2558, 0x2559, 0x255a, 0x255b, 0x255c, 0x255d, 0x255e,
+            0x255f, 0x2560, 0x2561, 0x0401, 0x2562, 0x2563, 0x2564, 0x2565,
+            0x2566, 0x2567, 0x2568, 0x2569, 0x256a, 0x256b, 0x256c, 0x00a9,
+            0x044e, 0x0430, 0x0431, 0x0446, 0x0434, 0x0435, 0x0444, 0x0433,
+            0x0445, 0x0438, 0x0439, 0x043a, 0x043b, 0x043c, 0x043d, 0x043e,
+            0x043f, 0x044f, 0x0440, 0x0441, 0x0442, 0x0443, 0x0436, 0x0432,
+            0x044c, 0x044b, 0x0437, 0x0448, 0x044d, 0x0449, 0x0447, 0x044a,
+            0x042e, 0x0410, 0x0411, 0x0426, 0x0414, 0x0415, 0x0424, 0x0413,
+            0x0425, 0x0418, 0x0419, 0x041a, 0x041b, 0x041c, 0x041d, 0x041e,
+            0x041f, 0x042f, 0x0420, 0x0421, 0x0422, 0x0423, 0x0416, 0x0412,
+            0x042c, 0x042b, 0x0417, 0x0428, 0x042d, 0x0429, 0x0427, 0x042a,
+        },
+        CODEPAGE_KOI8R_INVERSE,
+        128
+    };
+
+    // CP437 (IBM PC)
+    inline constexpr CodepageInverseEntry CODEPAGE_CP437_INVERSE[] = {
+        {0x00a0, 0xff}, {0x00a1, 0xad}, {0x00a2, 0x9b}, {0x00a3, 0x9c},
+        {0x00a5, 0x9d}, {0x00aa, 0xa6}, {0x00ab, 0xae}, {0x00ac, 0xaa},
+        {0x00b0, 0xf8}, {0x00b1, 0xf1}, {0x00b2, 0xfd}, {0x00b5, 0xe6},
+        {0x00b7, 0xfa}, {0x00ba, 0xa7}, {0x00bb, 0xaf}, {0x00bc, 0xac},
+        {0x00bd, 0xab}, {0x00bf, 0xa8}, {0x00c4, 0x8e}, {0x00c5, 0x8f},
+        {0x00c6, 0x92}, {0x00c7, 0x80}, {0x00c9, 0x90}, {0x00d1, 0xa5},
+        {0x00d6, 0x99}, {0x00dc, 0x9a}, {0x00df, 0xe1}, {0x00e0, 0x85},
+        {0x00e1, 0xa0}, {0x00e2, 0x83}, {0x00e4, 0x84}, {0x00e5, 0x86},
+        {0x00e6, 0x91}, {0x00e7, 0x87}, {0x00e8, 0x8a}, {0x00e9, 0x82},
+        {0x00ea, 0x88}, {0x00eb, 0x89}, {0x00ec, 0x8d}, {0x00ed, 0xa1},
+        {0x00ee, 0x8c}, {0x00ef, 0x8b}, {0x00f1, 0xa4}, {0x00f2, 0x95},
+        {0x00f3, 0xa2}, {0x00f4, 0x93}, {0x00f6, 0x94}, {0x00f7, 0xf6},
+        {0x00f9, 0x97}, {0x00fa, 0xa3}, {0x00fb, 0x96}, {0x00fc, 0x81},
+        {0x00ff, 0x98}, {0x0192, 0x9f}, {0x0393, 0xe2}, {0x0398, 0xe9},
+        {0x03a3, 0xe4}, {0x03a6, 0xe8}, {0x03a9, 0xea}, {0x03b1, 0xe0},
+        {0x03b4, 0xeb}, {0x03b5, 0xee}, {0x03c0, 0xe3}, {0x03c3, 0xe5},
+        {0x03c4, 0xe7}, {0x03c6, 0xed}, {0x207f, 0xfc}, {0x20a7, 0x9e},
+        {0x2219, 0xf9}, {0x221a, 0xfb}, {0x221e, 0xec}, {0x2229, 0xef},
+        {0x2248, 0xf7}, {0x2261, 0xf0}, {0x2264, 0xf3}, {0x2265, 0xf2},
+        {0x2310, 0xa9}, {0x2320, 0xf4}, {0x2321, 0xf5}, {0x2500, 0xc4},
+        {0x2502, 0xb3}, {0x250c, 0xda}, {0x2510, 0xbf}, {0x2514, 0xc0},
+        {0x2518, 0xd9}, {0x251c, 0xc3}, {0x2524, 0xb4}, {0x252c, 0xc2},
+        {0x2534, 0xc1}, {0x253c, 0xc5}, {0x2550, 0xcd}, {0x2551, 0xba},
+        {0x2552, 0xd5}, {0x2553, 0xd6}, {0x2554, 0xc9}, {0x2555, 0xb8},
+        {0x2556, 0xb7}, {0x2557, 0xbb}, {0x2558, 0xd4}, {0x2559, 0xd3},
+        {0x255a, 0xc8}, {0x255b, 0xbe}, {0x255c, 0xbd}, {0x255d, 0xbc},
+        {0x255e, 0xc6}, {0x255f, 0xc7}, {0x2560, 0xcc}, {0x2561, 0xb5},
+        {0x2562, 0xb6}, {0x2563, 0xb9}, {0x2564, 0xd1}, {0x2565, 0xd2},
+        {0x2566, 0xcb}, {0x2567, 0xcf}, {0x2568, 0xd0}, {0x2569, 0xca},
+        {0x256a, 0xd8}, {0x256b, 0xd7}, {0x256c, 0xce}, {0x2580, 0xdf},
+        {0x2584, 0xdc}, {0x2588, 0xdb}, {0x258c, 0xdd}, {0x2590, 0xde},
+        {0x2591, 0xb0}, {0x2592, 0xb1}, {0x2593, 0xb2}, {0x25a0, 0xfe},
+    };
+
+    inline constexpr CodepageTable CODEPAGE_CP437 = {
+        {
+            0x00c7, 0x00fc, 0x00e9, 0x00e2, 0x00e4, 0x00e0, 0x00e5, 0x00e7,
+            0x00ea, 0x00eb, 0x00e8, 0x00ef, 0x00ee, 0x00ec, 0x00c4, 0x00c5,
+            0x00c9, 0x00e6, 0x00c6, 0x00f4, 0x00f6, 0x00f2, 0x00fb, 0x00f9,
+            0x00ff, 0x00d6, 0x00dc, 0x00a2, 0x00a3, 0x00a5, 0x20a7, 0x0192,
+            0x00e1, 0x00ed, 0x00f3, 0x00fa, 0x00f1, 0x00d1, 0x00aa, 0x00ba,
+            0x00bf, 0x2310, 0x00ac, 0x00bd, 0x00bc, 0x00a1, 0x00ab, 0x00bb,
+            0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556,
+            0x2555, 0x2563, 0x2551, 0x2557, 0x255d, 0x255c, 0x255b, 0x2510,
+            0x2514, 0x2534, 0x252c, 0x251c, 0x2500, 0x253c, 0x255e, 0x255f,
+            0x255a, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256c, 0x2567,
+            0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256b,
+            0x256a, 0x2518, 0x250c, 0x2588, 0x2584, 0x258c, 0x2590, 0x2580,
+            0x03b1, 0x00df, 0x0393, 0x03c0, 0x03a3, 0x03c3, 0x00b5, 0x03c4,
+            0x03a6, 0x0398, 0x03a9, 0x03b4, 0x221e, 0x03c6, 0x03b5, 0x2229,
+            0x2261, 0x00b1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00f7, 0x2248,
+            0x00b0, 0x2219, 0x00b7, 0x221a, 0x207f, 0x00b2, 0x25a0, 0x00a0,
+        },
+        CODEPAGE_CP437_INVERSE,
+        128
+    };
+} // namespace detail
+} // namespace gc
+
+#endif // __GENIUS_C_UTF8_CODEPAGE_TABLES__
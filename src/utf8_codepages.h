@@ -0,0 +1,231 @@
+#ifndef __GENIUS_C_UTF8_CODEPAGES__
+#define __GENIUS_C_UTF8_CODEPAGES__
+
+#include "utf8.h"
+#include "utf8_codepage_tables.h"
+
+namespace gc {
+    /*
+    ** @brief: The legacy single-byte codepages that can be converted to and
+    **    from utf8. All of them are ascii supersets.
+    ** @note: The tables are generated by 'tools/gen_codepages.py'.
+    */
+    enum class Codepage {
+        Windows1252,
+        Iso8859_2,
+        Iso8859_5,
+        Iso8859_15,
+        Koi8R,
+        Cp437
+    };
+
+namespace detail {
+    inline const CodepageTable& getCodepageTable(Codepage codepage) {
+        switch (codepage) {
+            case Codepage::Windows1252: return CODEPAGE_WINDOWS1252;
+            case Codepage::Iso8859_2: return CODEPAGE_ISO8859_2;
+            case Codepage::Iso8859_5: return CODEPAGE_ISO8859_5;
+            case Codepage::Iso8859_15: return CODEPAGE_ISO8859_15;
+            case Codepage::Koi8R: return CODEPAGE_KOI8R;
+            case Codepage::Cp437: return CODEPAGE_CP437;
+        }
+        return CODEPAGE_WINDOWS1252;
+    }
+
+    /*
+    ** @param lossy: Whether undefined bytes become U+FFFD instead of stopping
+    **    the conversion.
+    */
+    inline TranscodeResult convertCodepageToUtf8(
+        const CodepageTable& table,
+        const unsigned char* bytes,
+        std::size_t length,
+        char* out,
+        bool lossy
+    ) {
+        std::size_t pos = 0;
+        std::size_t written = 0;
+
+        while (pos < length) {
+            if (pos + 8 <= length && isAsciiWord(bytes + pos)) {
+                const std::size_t run = asciiPrefixLength(bytes + pos, length - pos);
+                std::memcpy(out + written, bytes + pos, run);
+                pos += run;
+                written += run;
+                continue;
+            }
+
+            const unsigned char byte = bytes[pos];
+            if (byte < 0x80) {
+                out[written++] = static_cast<char>(byte);
+                ++pos;
+                continue;
+            }
+
+            uint32_t codePoint = table.toUnicode[byte - 0x80];
+            if (codePoint == CODEPAGE_UNDEFINED) {
+                if (not lossy) {
+                    return {false, pos, written};
+                }
+                codePoint = 0xfffd;
+            }
+            written += scalar::encodeUtf8Sequence(codePoint, out + written);
+            ++pos;
+        }
+
+        return {true, pos, written};
+    }
+
+    /*
+    ** @returns: The byte that encodes 'codePoint' in the upper half of the
+    **    codepage, or -1 if there is none.
+    */
+    inline int findCodepageByte(const CodepageTable& table, uint32_t codePoint) {
+        int low = 0;
+        int high = table.fromUnicodeSize;
+
+        while (low < high) {
+            const int middle = (low + high) / 2;
+            if (table.fromUnicode[middle].codePoint < codePoint) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+
+        if (low < table.fromUnicodeSize &&
+            table.fromUnicode[low].codePoint == codePoint) {
+            return table.fromUnicode[low].byte;
+        }
+        return -1;
+    }
+
+    /*
+    ** @param lossy: Whether invalid utf8 and unmapped code points become '?'
+    **    instead of stopping the conversion.
+    */
+    inline TranscodeResult convertUtf8ToCodepage(
+        const CodepageTable& table,
+        const unsigned char* bytes,
+        std::size_t length,
+        char* out,
+        bool lossy
+    ) {
+        std::size_t pos = 0;
+        std::size_t written = 0;
+
+        while (pos < length) {
+            if (pos + 8 <= length && isAsciiWord(bytes + pos)) {
+                const std::size_t run = asciiPrefixLength(bytes + pos, length - pos);
+                std::memcpy(out + written, bytes + pos, run);
+                pos += run;
+                written += run;
+                continue;
+            }
+
+            uint32_t codePoint;
+            const int size = scalar::decodeUtf8Sequence(
+                bytes + pos, length - pos, codePoint
+            );
+            const int byte = (size == 0) ? -1
+                : (codePoint < 0x80) ? static_cast<int>(codePoint)
+                : findCodepageByte(table, codePoint);
+
+            if (byte < 0) {
+                if (not lossy) {
+                    return {false, pos, written};
+                }
+                out[written++] = '?';
+                pos += size != 0 ? size : 1;
+                continue;
+            }
+
+            out[written++] = static_cast<char>(byte);
+            pos += size;
+        }
+
+        return {true, pos, written};
+    }
+} // namespace detail
+
+    /*
+    ** @brief: Converts text in the given single-byte codepage into utf8.
+    ** @param policy: 'ConversionPolicy::Lossy' turns bytes that the codepage
+    **    leaves undefined into U+FFFD.
+    ** @throws InvalidUtf8: Under 'ConversionPolicy::Strict', if the input
+    **    holds a byte that the codepage leaves undefined.
+    */
+    inline std::string convertCodepageToUtf8(
+        std::string_view str,
+        Codepage codepage,
+        ConversionPolicy policy = ConversionPolicy::Strict
+    ) {
+        detail::ProbeScope probe("convertCodepageToUtf8", str.size());
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data());
+        std::string output(
+            str.size() + 2 * detail::countNonAscii(bytes, str.size()), '\0'
+        );
+        const auto result = detail::convertCodepageToUtf8(
+            detail::getCodepageTable(codepage),
+            bytes,
+            str.size(),
+            &output[0],
+            policy == ConversionPolicy::Lossy
+        );
+
+        if (not result.ok) {
+            Utf8Error error;
+            error.kind = Utf8ErrorKind::Unrepresentable;
+            error.offset = result.read;
+            error.bytes[0] = bytes[result.read];
+            error.length = 1;
+            detail::throwUtf8Error("byte is undefined in the codepage", error);
+        }
+
+        output.resize(result.written);
+        probe.finish(output.size());
+        return output;
+    }
+
+    /*
+    ** @brief: Converts utf8 text into the given single-byte codepage.
+    ** @param policy: 'ConversionPolicy::Lossy' writes '?' for invalid utf8
+    **    and for code points that the codepage cannot represent.
+    ** @throws InvalidUtf8: Under 'ConversionPolicy::Strict', if the input is
+    **    not valid utf8 or does not fit in the codepage.
+    */
+    inline std::string convertUtf8ToCodepage(
+        std::string_view str,
+        Codepage codepage,
+        ConversionPolicy policy = ConversionPolicy::Strict
+    ) {
+        detail::ProbeScope probe("convertUtf8ToCodepage", str.size());
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data());
+        std::string output(str.size(), '\0');
+        const auto result = detail::convertUtf8ToCodepage(
+            detail::getCodepageTable(codepage),
+            bytes,
+            str.size(),
+            &output[0],
+            policy == ConversionPolicy::Lossy
+        );
+
+        if (not result.ok) {
+            uint32_t codePoint;
+            if (detail::scalar::decodeUtf8Sequence(
+                    bytes + result.read, str.size() - result.read, codePoint)) {
+                detail::throwUtf8Error(
+                    "code point cannot be represented in the codepage",
+                    detail::describeUnrepresentable(bytes, str.size(), result.read)
+                );
+            }
+            detail::throwUtf8Error(bytes, str.size(), result.read);
+        }
+
+        output.resize(result.written);
+        probe.finish(output.size());
+        return output;
+    }
+} // namespace gc
+
+#endif // __GENIUS_C_UTF8_CODEPAGES__
@@ -0,0 +1,771 @@
+// Generated by tools/gen_graphemes.py from Unicode 15.0.0. Do not edit.
+#ifndef __GENIUS_C_UTF8_GRAPHEME_TABLES__
+#define __GENIUS_C_UTF8_GRAPHEME_TABLES__
+
+#include <cstdint>
+
+namespace gc {
+namespace detail {
+    enum GraphemeBreakProperty : uint8_t {
+        GRAPHEME_OTHER,
+        GRAPHEME_CR,
+        GRAPHEME_LF,
+        GRAPHEME_CONTROL,
+        GRAPHEME_EXTEND,
+        GRAPHEME_ZWJ,
+        GRAPHEME_REGIONAL_INDICATOR,
+        GRAPHEME_PREPEND,
+        GRAPHEME_SPACING_MARK,
+        GRAPHEME_L,
+        GRAPHEME_V,
+        GRAPHEME_T,
+        GRAPHEME_LV,
+        GRAPHEME_LVT,
+        GRAPHEME_EXTENDED_PICTOGRAPHIC,
+    };
+
+    inline constexpr int GRAPHEME_BREAK_SHIFT1 = 5;
+    inline constexpr int GRAPHEME_BREAK_SHIFT2 = 4;
+    inline constexpr uint8_t GRAPHEME_BREAK_INDEX[2176] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+        12, 13, 14, 10, 15, 16, 17, 18, 19, 20, 21, 10,
+        22, 23, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 24,
+        25, 26, 27, 28, 29, 30, 31, 32, 33, 27, 28, 29,
+        30, 31, 32, 33, 27, 28, 29, 30, 31, 32, 33, 34,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 35, 10, 36, 37, 38, 10, 10,
+        10, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 50, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 51, 10, 52, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 53, 10, 10, 10, 10, 10,
+        10, 10, 10, 54, 55, 56, 10, 10, 10, 57, 10, 10,
+        58, 59, 60, 10, 61, 10, 10, 10, 62, 63, 64, 65,
+        66, 67, 68, 69, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 70, 71, 71, 71, 71, 71, 71, 71,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10,
+    };
+    inline constexpr uint16_t GRAPHEME_BREAK_MIDDLE[2304] = {
+        0, 1, 2, 2, 2, 2, 2, 3, 1, 1, 4, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        5, 5, 5, 5, 5, 5, 5, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        6, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 7, 5, 8, 9, 2, 2, 2,
+        10, 11, 2, 2, 12, 5, 2, 13, 2, 2, 2, 2,
+        2, 14, 15, 2, 16, 17, 2, 5, 18, 2, 2, 2,
+        2, 2, 19, 13, 2, 2, 12, 20, 2, 21, 22, 2,
+        2, 23, 2, 2, 2, 24, 2, 2, 25, 5, 26, 5,
+        27, 2, 2, 28, 29, 30, 31, 2, 32, 2, 2, 33,
+        34, 35, 31, 36, 37, 2, 2, 38, 39, 17, 2, 40,
+        37, 2, 2, 38, 41, 2, 31, 25, 32, 2, 2, 42,
+        34, 43, 31, 2, 44, 2, 2, 45, 46, 35, 2, 2,
+        47, 2, 2, 42, 48, 49, 31, 2, 32, 2, 2, 50,
+        51, 49, 31, 52, 53, 2, 2, 54, 55, 35, 31, 2,
+        32, 2, 2, 2, 56, 57, 2, 58, 2, 2, 2, 59,
+        60, 2, 2, 2, 2, 2, 2, 61, 62, 2, 2, 2,
+        2, 63, 2, 64, 2, 2, 2, 65, 66, 67, 5, 68,
+        69, 2, 2, 2, 2, 2, 70, 71, 2, 72, 13, 73,
+        74, 75, 2, 2, 2, 2, 2, 2, 76, 76, 76, 76,
+        76, 76, 77, 77, 77, 77, 78, 79, 79, 79, 79, 79,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 70, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 80, 2, 81,
+        2, 31, 2, 31, 2, 2, 2, 82, 83, 20, 2, 2,
+        84, 2, 2, 2, 2, 2, 2, 2, 49, 2, 85, 2,
+        2, 2, 2, 2, 2, 2, 86, 87, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 88, 2, 2,
+        2, 89, 90, 91, 2, 2, 2, 5, 92, 2, 2, 2,
+        93, 2, 2, 94, 95, 2, 12, 96, 97, 2, 98, 2,
+        2, 2, 99, 53, 2, 2, 100, 101, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 102, 103, 104, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 5, 5, 5, 5,
+        105, 2, 106, 107, 108, 2, 1, 2, 2, 2, 2, 2,
+        2, 5, 5, 13, 2, 2, 109, 108, 2, 2, 2, 2,
+        2, 110, 111, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 112, 113, 2, 2, 2, 2, 2, 113, 2, 2, 2,
+        114, 2, 115, 116, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 109, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 112, 117, 118, 2, 2, 119,
+        120, 121, 122, 122, 122, 122, 122, 122, 123, 122, 122, 122,
+        122, 122, 122, 122, 124, 125, 126, 127, 128, 129, 130, 2,
+        2, 131, 132, 133, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 134, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 131, 135, 2, 2,
+        2, 136, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 137, 138, 2, 2, 2, 2, 2, 2, 2, 137,
+        2, 2, 2, 2, 2, 2, 5, 5, 2, 2, 25, 139,
+        2, 2, 2, 2, 2, 140, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 141, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 137, 142, 2, 143, 2, 2,
+        2, 2, 2, 138, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 144, 2, 145, 2,
+        2, 2, 2, 2, 146, 2, 2, 147, 148, 2, 5, 149,
+        2, 2, 150, 2, 151, 53, 76, 152, 27, 2, 2, 153,
+        154, 2, 155, 2, 2, 2, 156, 157, 158, 2, 2, 159,
+        2, 2, 2, 160, 17, 2, 161, 162, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 163, 2,
+        164, 165, 166, 167, 166, 168, 166, 164, 165, 166, 167, 166,
+        168, 166, 164, 165, 166, 167, 166, 168, 166, 164, 165, 166,
+        167, 166, 168, 166, 164, 165, 166, 167, 166, 168, 166, 164,
+        165, 166, 167, 166, 168, 166, 164, 165, 166, 167, 166, 168,
+        166, 164, 165, 166, 167, 166, 168, 166, 164, 165, 166, 167,
+        166, 168, 166, 164, 165, 166, 167, 166, 168, 166, 164, 165,
+        166, 167, 166, 168, 166, 164, 165, 166, 167, 166, 168, 166,
+        164, 165, 166, 167, 166, 168, 166, 164, 165, 166, 167, 166,
+        168, 166, 164, 165, 166, 167, 166, 168, 166, 164, 165, 166,
+        167, 166, 168, 166, 164, 165, 166, 167, 166, 168, 166, 164,
+        165, 166, 167, 166, 168, 166, 164, 165, 166, 167, 166, 168,
+        166, 164, 165, 166, 167, 166, 168, 166, 164, 165, 166, 167,
+        166, 168, 166, 164, 165, 166, 167, 166, 168, 166, 164, 165,
+        166, 167, 166, 168, 166, 164, 165, 166, 167, 166, 168, 166,
+        164, 165, 166, 167, 166, 168, 166, 164, 165, 166, 167, 166,
+        168, 166, 164, 165, 166, 167, 166, 168, 166, 164, 165, 166,
+        167, 166, 168, 166, 164, 165, 166, 167, 166, 168, 166, 164,
+        165, 166, 167, 166, 168, 166, 164, 165, 166, 167, 166, 168,
+        166, 164, 165, 166, 167, 166, 168, 166, 164, 165, 166, 167,
+        166, 168, 166, 164, 165, 166, 167, 166, 168, 166, 164, 165,
+        166, 167, 166, 168, 166, 164, 165, 166, 167, 166, 169, 77,
+        170, 79, 79, 171, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 36, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        5, 2, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 143, 2, 2, 2, 2, 2, 172, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 75, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 13, 2, 2, 2, 2, 2,
+        2, 2, 2, 173, 2, 2, 2, 2, 2, 2, 2, 2,
+        174, 2, 2, 175, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 49, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 176, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 177, 2, 2, 2, 2, 70, 2, 2, 2, 2,
+        19, 13, 2, 2, 178, 2, 2, 2, 2, 2, 2, 2,
+        179, 2, 2, 180, 181, 2, 2, 182, 97, 2, 2, 183,
+        184, 2, 2, 2, 185, 2, 186, 187, 188, 2, 2, 189,
+        97, 2, 2, 190, 191, 2, 2, 2, 2, 2, 192, 193,
+        17, 2, 2, 2, 2, 2, 2, 2, 2, 137, 194, 2,
+        53, 2, 2, 54, 195, 35, 196, 187, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 197, 198, 36, 2, 2,
+        2, 2, 2, 199, 200, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 137, 201, 13, 202, 2, 2,
+        2, 2, 2, 203, 13, 2, 2, 2, 2, 2, 204, 205,
+        2, 2, 2, 2, 2, 70, 206, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 192, 207,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 208, 209, 2, 2, 2, 2, 2, 2, 2,
+        2, 210, 211, 2, 212, 2, 2, 213, 35, 214, 2, 2,
+        215, 216, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 217, 218, 2, 2, 2, 2, 2, 219, 220, 221,
+        2, 2, 2, 2, 2, 2, 2, 222, 223, 2, 2, 2,
+        224, 225, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 226,
+        227, 2, 2, 228, 229, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 1, 230, 231, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 187, 2, 2, 2, 181, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 137, 232, 233, 233, 234, 185, 2, 2,
+        2, 2, 235, 146, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 236, 237, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 5, 5, 238, 5, 181, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 239, 240, 241, 2, 242, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 243, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        5, 5, 5, 244, 5, 5, 68, 155, 235, 12, 7, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 245, 246, 247, 2,
+        2, 2, 2, 2, 137, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 181, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 36, 2, 2, 2, 248, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 248, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 181, 2, 2,
+        2, 2, 2, 2, 249, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 122, 122, 122, 122, 122, 122, 122, 122,
+        122, 122, 122, 122, 122, 122, 122, 122, 250, 2, 114, 2,
+        2, 2, 251, 252, 253, 254, 250, 122, 122, 122, 255, 256,
+        257, 258, 114, 259, 115, 122, 122, 122, 122, 122, 122, 122,
+        122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+        122, 122, 122, 122, 122, 122, 122, 260, 122, 122, 122, 122,
+        122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+        122, 122, 122, 261, 262, 122, 122, 122, 122, 122, 122, 122,
+        122, 122, 122, 122, 122, 122, 122, 122, 122, 2, 2, 2,
+        122, 122, 122, 122, 122, 122, 122, 122, 2, 2, 2, 2,
+        2, 2, 2, 263, 2, 2, 2, 2, 2, 264, 122, 122,
+        251, 2, 2, 2, 265, 266, 2, 2, 265, 2, 267, 122,
+        122, 122, 122, 122, 251, 122, 122, 268, 120, 122, 122, 122,
+        122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+        122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 122, 122, 122, 122, 122, 122, 122, 122,
+        122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+        122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+        122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+        122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+        122, 122, 122, 122, 122, 122, 122, 261, 1, 1, 5, 5,
+        5, 5, 5, 5, 1, 1, 1, 1, 1, 1, 1, 1,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    };
+    inline constexpr uint8_t GRAPHEME_BREAK_BLOCKS[4304] = {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 3,
+        3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 14, 0, 0, 0, 3, 14, 0, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+        0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4,
+        0, 4, 4, 0, 4, 4, 0, 4, 0, 0, 0, 0,
+        0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 0, 3, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+        4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 4, 4, 4, 4, 4, 4, 4, 7, 0, 4,
+        4, 4, 4, 4, 4, 0, 0, 4, 4, 0, 4, 4,
+        4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 7, 0, 4, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+        0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4,
+        0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0,
+        7, 7, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+        4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 7, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 4, 8, 4, 0, 8, 8, 8, 4, 4, 4,
+        4, 4, 4, 4, 4, 8, 8, 8, 8, 4, 8, 8,
+        0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 8,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4, 0, 4, 8, 8, 4, 4, 4, 4, 0, 0, 8,
+        8, 0, 0, 8, 8, 4, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 4, 0, 0, 4, 4, 8, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 8, 8,
+        8, 4, 4, 0, 0, 0, 0, 4, 4, 0, 0, 4,
+        4, 4, 0, 0, 4, 4, 0, 0, 0, 4, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 8, 4, 4, 4,
+        4, 4, 0, 4, 4, 8, 0, 8, 8, 4, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4, 4,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 4, 8, 4, 8, 8, 0, 0, 0, 8, 8,
+        8, 0, 8, 8, 8, 4, 0, 0, 4, 8, 8, 8,
+        4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4, 8, 8, 8, 8, 0, 4, 4, 4, 0, 4, 4,
+        4, 4, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 8, 4,
+        8, 8, 4, 8, 8, 0, 4, 8, 8, 0, 8, 8,
+        4, 4, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 8, 8,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+        4, 0, 4, 8, 8, 4, 4, 4, 4, 0, 8, 8,
+        8, 0, 8, 8, 8, 4, 7, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 4,
+        8, 8, 4, 4, 4, 0, 4, 0, 8, 8, 8, 8,
+        8, 8, 8, 4, 0, 0, 8, 8, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 8,
+        4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+        4, 4, 4, 0, 0, 4, 0, 8, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4,
+        0, 4, 0, 0, 0, 0, 8, 8, 0, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8,
+        4, 4, 4, 4, 4, 0, 4, 4, 0, 0, 0, 0,
+        0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 4, 4, 4, 4, 8, 4, 4,
+        4, 4, 4, 4, 0, 4, 4, 8, 8, 4, 4, 0,
+        0, 0, 0, 0, 0, 0, 8, 8, 4, 4, 0, 0,
+        0, 0, 4, 4, 0, 4, 4, 4, 4, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+        8, 4, 4, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 4, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11,
+        11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+        11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 4, 4,
+        4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 8, 4,
+        4, 4, 4, 4, 4, 4, 8, 8, 8, 8, 8, 8,
+        8, 8, 4, 8, 8, 4, 4, 4, 4, 4, 4, 4,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+        4, 4, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 4, 0, 0, 0, 0, 0, 0, 4, 4, 4, 8,
+        8, 8, 8, 4, 4, 8, 8, 8, 0, 0, 0, 0,
+        8, 8, 4, 8, 8, 8, 8, 8, 8, 4, 4, 4,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+        4, 8, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 8, 4, 8, 4, 4, 4, 4, 4, 4, 4, 0,
+        4, 0, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4,
+        4, 8, 8, 8, 8, 8, 8, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+        4, 4, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+        4, 4, 4, 8, 4, 8, 8, 8, 8, 8, 4, 8,
+        8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4, 4, 8, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 4, 4,
+        4, 4, 8, 8, 4, 4, 8, 4, 4, 4, 0, 0,
+        0, 0, 0, 0, 0, 0, 4, 8, 4, 4, 8, 8,
+        8, 4, 8, 4, 0, 0, 0, 0, 8, 8, 8, 8,
+        8, 8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4,
+        8, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+        4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 8, 4, 4, 4, 4, 4, 4,
+        4, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0,
+        4, 0, 0, 8, 4, 4, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+        4, 5, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0,
+        0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        0, 0, 0, 0, 14, 14, 14, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 0,
+        14, 14, 14, 14, 14, 14, 0, 14, 14, 14, 14, 14,
+        14, 14, 14, 14, 14, 14, 14, 0, 14, 14, 14, 14,
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 0, 0,
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0,
+        14, 0, 14, 0, 0, 0, 0, 0, 0, 14, 0, 0,
+        0, 14, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 14, 14, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        14, 0, 0, 14, 0, 0, 0, 0, 14, 0, 14, 0,
+        0, 0, 0, 14, 14, 14, 0, 14, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0,
+        14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14,
+        14, 0, 0, 0, 14, 0, 0, 0, 0, 14, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+        4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 14, 0, 14, 0, 0,
+        0, 0, 0, 0, 4, 4, 4, 0, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+        0, 0, 4, 0, 0, 0, 4, 0, 0, 0, 0, 4,
+        0, 0, 0, 0, 0, 0, 0, 8, 8, 4, 4, 8,
+        0, 0, 0, 0, 4, 0, 0, 0, 8, 8, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 4, 4, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+        0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4,
+        4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0,
+        0, 0, 0, 4, 8, 8, 4, 4, 4, 4, 8, 8,
+        4, 4, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4,
+        4, 4, 4, 8, 8, 4, 4, 8, 8, 4, 4, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+        0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4, 0, 0, 0, 4, 0, 4, 4, 4, 0, 0, 4,
+        4, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 8, 4, 4, 8, 8,
+        0, 0, 0, 0, 0, 8, 4, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 8, 8, 4, 8, 8,
+        4, 8, 8, 0, 8, 4, 0, 0, 12, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10,
+        10, 10, 10, 0, 0, 0, 0, 11, 11, 11, 11, 11,
+        11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+        0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+        0, 4, 4, 4, 0, 4, 4, 0, 0, 0, 0, 0,
+        4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+        4, 4, 4, 0, 0, 0, 0, 4, 0, 0, 0, 0,
+        4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+        4, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 8, 4, 8, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 4,
+        4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+        8, 8, 8, 4, 4, 4, 4, 8, 8, 4, 4, 0,
+        0, 7, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 7, 0, 0, 4, 4, 4, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+        8, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 8, 8, 0, 7, 7,
+        0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 8, 4,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        8, 8, 8, 4, 4, 4, 8, 8, 4, 8, 4, 4,
+        0, 0, 0, 0, 0, 0, 4, 0, 8, 8, 8, 4,
+        4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+        4, 8, 8, 8, 8, 0, 0, 8, 8, 0, 0, 8,
+        8, 8, 0, 0, 0, 0, 8, 8, 0, 0, 4, 4,
+        4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0,
+        0, 8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4,
+        8, 8, 4, 4, 4, 8, 4, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4, 8, 8, 4, 4, 4, 4, 4,
+        4, 8, 4, 8, 8, 4, 8, 4, 4, 8, 4, 4,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        8, 8, 4, 4, 4, 4, 0, 0, 8, 8, 8, 8,
+        4, 4, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4, 4, 0, 0, 8, 8, 8, 4,
+        4, 4, 4, 4, 4, 4, 4, 8, 8, 4, 8, 4,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+        8, 4, 8, 8, 4, 4, 4, 4, 4, 4, 8, 4,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+        4, 4, 8, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+        4, 4, 4, 4, 4, 4, 4, 4, 8, 4, 4, 0,
+        0, 0, 0, 0, 4, 8, 8, 8, 8, 8, 0, 8,
+        8, 0, 0, 4, 4, 8, 4, 7, 8, 7, 8, 4,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 8, 8, 8, 4, 4, 4, 4, 0, 0, 4, 4,
+        8, 8, 8, 8, 4, 0, 0, 0, 8, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+        0, 0, 0, 4, 4, 4, 4, 4, 4, 8, 7, 4,
+        4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 8,
+        8, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+        7, 7, 7, 7, 7, 7, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 8, 4, 4, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 8, 4, 4, 4, 4,
+        4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 8, 4,
+        0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        0, 8, 4, 4, 4, 4, 4, 4, 4, 8, 4, 4,
+        8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 4, 4, 4, 4, 4, 4, 0, 0, 0, 4, 0,
+        4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 7, 4,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 0,
+        4, 4, 0, 8, 8, 4, 8, 4, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 4, 4, 8, 8, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 7, 8,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 8, 8, 4, 4, 4, 4, 4, 0,
+        0, 0, 8, 8, 4, 8, 4, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0,
+        0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0,
+        0, 0, 0, 4, 0, 0, 0, 0, 4, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0,
+        3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0,
+        0, 4, 8, 4, 4, 4, 0, 0, 0, 8, 4, 4,
+        4, 4, 4, 3, 3, 3, 3, 3, 3, 3, 3, 4,
+        4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4,
+        4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0,
+        0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0,
+        0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4,
+        4, 4, 4, 4, 4, 4, 0, 4, 4, 0, 4, 4,
+        4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+        0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 14, 14, 14, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14,
+        14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 14, 0, 0, 14, 14, 14,
+        14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0,
+        14, 14, 14, 14, 14, 14, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 0, 14, 14, 14,
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0,
+        0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 0, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14, 14, 14, 14, 4, 4, 4, 4, 4,
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14,
+        14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0,
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+        14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 0, 14, 14, 14, 14,
+    };
+} // namespace detail
+} // namespace gc
+
+#endif // __GENIUS_C_UTF8_GRAPHEME_TABLES__
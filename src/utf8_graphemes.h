@@ -0,0 +1,362 @@
+#ifndef __GENIUS_C_UTF8_GRAPHEMES__
+#define __GENIUS_C_UTF8_GRAPHEMES__
+
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+
+#include "utf8.h"
+#include "utf8_grapheme_tables.h"
+
+namespace gc {
+namespace detail {
+    inline GraphemeBreakProperty getGraphemeBreakProperty(uint32_t codePoint) {
+        const uint32_t middle = GRAPHEME_BREAK_INDEX[
+            codePoint >> (GRAPHEME_BREAK_SHIFT1 + GRAPHEME_BREAK_SHIFT2)
+        ];
+        const uint32_t block = GRAPHEME_BREAK_MIDDLE[
+            (middle << GRAPHEME_BREAK_SHIFT1) +
+            ((codePoint >> GRAPHEME_BREAK_SHIFT2) & ((1u << GRAPHEME_BREAK_SHIFT1) - 1))
+        ];
+        return static_cast<GraphemeBreakProperty>(GRAPHEME_BREAK_BLOCKS[
+            (block << GRAPHEME_BREAK_SHIFT2) +
+            (codePoint & ((1u << GRAPHEME_BREAK_SHIFT2) - 1))
+        ]);
+    }
+
+    inline bool isGraphemeControl(GraphemeBreakProperty property) {
+        return property == GRAPHEME_CR || property == GRAPHEME_LF ||
+            property == GRAPHEME_CONTROL;
+    }
+
+    /*
+    ** @brief: Rules GB3 to GB9b of UAX #29, which only look at the code points
+    **    on either side of the boundary.
+    */
+    inline bool isGraphemePairBoundary(
+        GraphemeBreakProperty previous,
+        GraphemeBreakProperty next
+    ) {
+        if (previous == GRAPHEME_CR && next == GRAPHEME_LF) {
+            return false;
+        }
+        if (isGraphemeControl(previous) || isGraphemeControl(next)) {
+            return true;
+        }
+
+        switch (previous) {
+            case GRAPHEME_L:
+                if (next == GRAPHEME_L || next == GRAPHEME_V ||
+                    next == GRAPHEME_LV || next == GRAPHEME_LVT) {
+                    return false;
+                }
+                break;
+            case GRAPHEME_LV:
+            case GRAPHEME_V:
+                if (next == GRAPHEME_V || next == GRAPHEME_T) {
+                    return false;
+                }
+                break;
+            case GRAPHEME_LVT:
+            case GRAPHEME_T:
+                if (next == GRAPHEME_T) {
+                    return false;
+                }
+                break;
+            case GRAPHEME_PREPEND:
+                return false;
+            default:
+                break;
+        }
+
+        return not (next == GRAPHEME_EXTEND || next == GRAPHEME_ZWJ ||
+            next == GRAPHEME_SPACING_MARK);
+    }
+
+    /*
+    ** @brief: Whether there is a boundary between the two code points
+    **    whatever precedes them.
+    */
+    inline bool isDefiniteGraphemeBoundary(
+        GraphemeBreakProperty previous,
+        GraphemeBreakProperty next
+    ) {
+        if (previous == GRAPHEME_ZWJ && next == GRAPHEME_EXTENDED_PICTOGRAPHIC) {
+            return false;
+        }
+        if (previous == GRAPHEME_REGIONAL_INDICATOR &&
+            next == GRAPHEME_REGIONAL_INDICATOR) {
+            return false;
+        }
+        return isGraphemePairBoundary(previous, next);
+    }
+
+    struct GraphemeBreakState {
+        GraphemeBreakProperty previous;
+        // Whether the text so far ends with an Extended_Pictographic code
+        // point followed by any Extend code points and at most one ZWJ.
+        bool pictographic;
+        // Whether 'previous' is the odd-numbered one of a run of regional
+        // indicators.
+        bool oddRegional;
+    };
+
+    inline GraphemeBreakState startGraphemeState(GraphemeBreakProperty first) {
+        return {
+            first,
+            first == GRAPHEME_EXTENDED_PICTOGRAPHIC,
+            first == GRAPHEME_REGIONAL_INDICATOR
+        };
+    }
+
+    /*
+    ** @brief: Moves the state past the next code point.
+    ** @returns: Whether there is a boundary before that code point.
+    */
+    inline bool advanceGraphemeState(
+        GraphemeBreakState& state,
+        GraphemeBreakProperty next
+    ) {
+        const GraphemeBreakProperty previous = state.previous;
+        bool boundary = isGraphemePairBoundary(previous, next);
+
+        // GB11: emoji zwj sequences.
+        if (previous == GRAPHEME_ZWJ && next == GRAPHEME_EXTENDED_PICTOGRAPHIC &&
+            state.pictographic) {
+            boundary = false;
+        }
+        // GB12 and GB13: regional indicators pair up into flags.
+        if (previous == GRAPHEME_REGIONAL_INDICATOR &&
+            next == GRAPHEME_REGIONAL_INDICATOR && state.oddRegional) {
+            boundary = false;
+        }
+
+        if (next == GRAPHEME_EXTENDED_PICTOGRAPHIC) {
+            state.pictographic = true;
+        } else if (next == GRAPHEME_EXTEND || next == GRAPHEME_ZWJ) {
+            state.pictographic = state.pictographic && previous != GRAPHEME_ZWJ;
+        } else {
+            state.pictographic = false;
+        }
+
+        state.oddRegional = next == GRAPHEME_REGIONAL_INDICATOR &&
+            not (previous == GRAPHEME_REGIONAL_INDICATOR && state.oddRegional);
+        state.previous = next;
+        return boundary;
+    }
+
+    /*
+    ** @returns: The offset of the first byte of the code point that ends
+    **    right before 'pos'.
+    */
+    inline std::size_t previousCodePointStart(
+        const unsigned char* bytes,
+        std::size_t pos
+    ) {
+        std::size_t start = pos - 1;
+        while (start > 0 && pos - start < 4 && (bytes[start] & 0xc0) == 0x80) {
+            --start;
+        }
+        return start;
+    }
+
+    /*
+    ** @returns: The grapheme break property of the code point at 'pos', or
+    **    'GRAPHEME_CONTROL' for an invalid sequence so that nothing joins it.
+    */
+    inline GraphemeBreakProperty getGraphemeBreakPropertyAt(
+        const unsigned char* bytes,
+        std::size_t length,
+        std::size_t pos
+    ) {
+        uint32_t codePoint;
+        if (scalar::decodeUtf8Sequence(bytes + pos, length - pos, codePoint) == 0) {
+            return GRAPHEME_CONTROL;
+        }
+        return getGraphemeBreakProperty(codePoint);
+    }
+} // namespace detail
+
+    /*
+    ** @brief: Finds where the grapheme cluster (user-perceived character, as
+    **    defined by UAX #29) that starts at 'pos' ends.
+    ** @param pos: The offset of a cluster boundary, eg. 0 or a value returned
+    **    by a previous call.
+    ** @returns: The offset of the next boundary, or the length of the text
+    **    if 'pos' is at or past its end.
+    ** @throws InvalidUtf8: If the cluster holds invalid utf8.
+    ** @note: Ascii other than CR is taken as a cluster of its own when the
+    **    next byte is ascii too, without a table lookup.
+    */
+    inline std::size_t nextGraphemeBreak(std::string_view str, std::size_t pos) {
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data());
+        const std::size_t length = str.size();
+
+        if (pos >= length) {
+            return length;
+        }
+        if (bytes[pos] < 0x80 && bytes[pos] != '\r' &&
+            (pos + 1 == length || bytes[pos + 1] < 0x80)) {
+            return pos + 1;
+        }
+
+        uint32_t codePoint;
+        int size = detail::scalar::decodeUtf8Sequence(bytes + pos, length - pos, codePoint);
+        if (size == 0) {
+            detail::throwUtf8Error(bytes, length, pos);
+        }
+
+        auto state = detail::startGraphemeState(detail::getGraphemeBreakProperty(codePoint));
+        pos += size;
+
+        while (pos < length) {
+            // Only LF after CR, or anything after Prepend, joins an ascii
+            // code point to what precedes it.
+            if (bytes[pos] < 0x80 && state.previous != detail::GRAPHEME_CR &&
+                state.previous != detail::GRAPHEME_PREPEND) {
+                return pos;
+            }
+
+            size = detail::scalar::decodeUtf8Sequence(bytes + pos, length - pos, codePoint);
+            if (size == 0) {
+                detail::throwUtf8Error(bytes, length, pos);
+            }
+            if (detail::advanceGraphemeState(state, detail::getGraphemeBreakProperty(codePoint))) {
+                return pos;
+            }
+            pos += size;
+        }
+
+        return length;
+    }
+
+    /*
+    ** @brief: Finds the start of the grapheme cluster that ends at, or
+    **    contains the byte before, 'pos'. This is where a cursor at 'pos'
+    **    moves to when moving one user-perceived character back.
+    ** @returns: The offset of the last boundary before 'pos', or 0.
+    ** @throws InvalidUtf8: If the text around 'pos' is invalid utf8.
+    ** @note: Backs up to a boundary that does not depend on earlier text,
+    **    then segments forward from there.
+    */
+    inline std::size_t previousGraphemeBreak(std::string_view str, std::size_t pos) {
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data());
+        const std::size_t length = str.size();
+
+        if (pos > length) {
+            pos = length;
+        }
+        if (pos == 0) {
+            return 0;
+        }
+
+        std::size_t boundary = detail::previousCodePointStart(bytes, pos);
+        while (boundary > 0) {
+            const std::size_t before = detail::previousCodePointStart(bytes, boundary);
+            if (detail::isDefiniteGraphemeBoundary(
+                    detail::getGraphemeBreakPropertyAt(bytes, length, before),
+                    detail::getGraphemeBreakPropertyAt(bytes, length, boundary))) {
+                break;
+            }
+            boundary = before;
+        }
+
+        while (true) {
+            const std::size_t next = nextGraphemeBreak(str, boundary);
+            if (next >= pos) {
+                return boundary;
+            }
+            boundary = next;
+        }
+    }
+
+    /*
+    ** @brief: A forward iterator over the grapheme clusters of utf8 text,
+    **    each given as a view into the text. It never allocates.
+    ** @throws InvalidUtf8: When it reaches invalid utf8.
+    */
+    class GraphemeIterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const std::string_view*;
+            using reference = std::string_view;
+
+            GraphemeIterator() = default;
+
+            GraphemeIterator(std::string_view str, std::size_t pos)
+                : str(str), start(pos), end(nextGraphemeBreak(str, pos)) {}
+
+            std::string_view operator*() const {
+                return str.substr(start, end - start);
+            }
+
+            GraphemeIterator& operator++() {
+                start = end;
+                end = nextGraphemeBreak(str, start);
+                return *this;
+            }
+
+            GraphemeIterator operator++(int) {
+                GraphemeIterator copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            bool operator==(const GraphemeIterator& other) const {
+                return start == other.start;
+            }
+
+            bool operator!=(const GraphemeIterator& other) const {
+                return start != other.start;
+            }
+
+            /*
+            ** @brief: The offset of the current cluster in the text.
+            */
+            std::size_t offset() const {
+                return start;
+            }
+
+        private:
+            std::string_view str;
+            std::size_t start = 0;
+            std::size_t end = 0;
+    };
+
+    /*
+    ** @brief: The grapheme clusters of utf8 text, as a range for
+    **    range-based for loops.
+    */
+    struct GraphemeClusters {
+        std::string_view str;
+
+        GraphemeIterator begin() const {
+            return GraphemeIterator(str, 0);
+        }
+
+        GraphemeIterator end() const {
+            return GraphemeIterator(str, str.size());
+        }
+    };
+
+    inline GraphemeClusters graphemeClusters(std::string_view str) {
+        return {str};
+    }
+
+    /*
+    ** @brief: Counts the grapheme clusters (user-perceived characters) in
+    **    the given utf8 text.
+    ** @throws InvalidUtf8: If the text is not strictly valid utf8.
+    */
+    inline std::size_t countGraphemes(std::string_view str) {
+        std::size_t count = 0;
+        for (std::size_t pos = 0; pos < str.size(); pos = nextGraphemeBreak(str, pos)) {
+            ++count;
+        }
+        return count;
+    }
+} // namespace gc
+
+#endif // __GENIUS_C_UTF8_GRAPHEMES__
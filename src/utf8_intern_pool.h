@@ -0,0 +1,239 @@
+#ifndef __GENIUS_C_UTF8_INTERN_POOL__
+#define __GENIUS_C_UTF8_INTERN_POOL__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "utf8.h"
+
+namespace gc {
+    /*
+    ** @brief: A set of distinct utf8 strings, each stored once and named by
+    **    a 32-bit handle.
+    ** @note: Strings are validated when they are first added and copied
+    **    into large arenas that never move, so handles and the views they
+    **    give stay valid for the life of the pool. Equal strings get equal
+    **    handles, so comparing interned strings is comparing integers.
+    ** @note: The code point count and hash of every string are kept next to
+    **    it. Lookups go through an open-addressing table that holds the
+    **    handle and part of the hash, so a probe only looks at the bytes of
+    **    strings that are likely to match.
+    */
+    class Utf8InternPool {
+        public:
+            using Handle = uint32_t;
+
+            Utf8InternPool() = default;
+            Utf8InternPool(const Utf8InternPool&) = delete;
+            Utf8InternPool& operator=(const Utf8InternPool&) = delete;
+            Utf8InternPool(Utf8InternPool&&) = default;
+            Utf8InternPool& operator=(Utf8InternPool&&) = default;
+
+            /*
+            ** @brief: Returns the handle of the given string, adding it to
+            **    the pool if it is not there yet.
+            ** @throws InvalidUtf8: If a new string is not strictly valid
+            **    utf8. Strings already in the pool are not validated again.
+            ** @throws std::length_error: If the string is 4 GiB or longer,
+            **    or the pool already holds 2^32 - 1 strings.
+            */
+            Handle intern(std::string_view str) {
+                const uint64_t hash = hashBytes(str);
+                std::size_t slot;
+                if (findSlot(str, hash, slot)) {
+                    return slots[slot].handle - 1;
+                }
+
+                const auto bytes = reinterpret_cast<const unsigned char*>(str.data());
+                const std::size_t invalid = detail::validateUtf8(bytes, str.size());
+                if (invalid != str.size()) {
+                    detail::throwUtf8Error(bytes, str.size(), invalid);
+                }
+                if (str.size() > UINT32_MAX || entries.size() == UINT32_MAX) {
+                    throw std::length_error("utf8 intern pool is full");
+                }
+
+                Entry entry;
+                entry.data = store(str);
+                entry.length = static_cast<uint32_t>(str.size());
+                entry.codePoints = static_cast<uint32_t>(
+                    detail::countCodePoints(bytes, str.size())
+                );
+                entry.hash = hash;
+                entries.push_back(entry);
+
+                const Handle handle = static_cast<Handle>(entries.size() - 1);
+                if (2 * entries.size() > slots.size()) {
+                    grow();
+                } else {
+                    slots[slot] = {handle + 1, static_cast<uint32_t>(hash >> 32)};
+                }
+                return handle;
+            }
+
+            /*
+            ** @brief: Looks the given string up without adding it.
+            ** @param handle: Receives the handle if the string is found.
+            */
+            bool find(std::string_view str, Handle& handle) const {
+                std::size_t slot;
+                if (not findSlot(str, hashBytes(str), slot)) {
+                    return false;
+                }
+                handle = slots[slot].handle - 1;
+                return true;
+            }
+
+            /*
+            ** @brief: The bytes of the string with the given handle.
+            */
+            std::string_view view(Handle handle) const {
+                const Entry& entry = entries[handle];
+                return std::string_view(entry.data, entry.length);
+            }
+
+            std::size_t codePointCount(Handle handle) const {
+                return entries[handle].codePoints;
+            }
+
+            /*
+            ** @brief: Whether the string is pure ascii, ie. has as many code
+            **    points as bytes.
+            */
+            bool isAscii(Handle handle) const {
+                return entries[handle].codePoints == entries[handle].length;
+            }
+
+            /*
+            ** @brief: The hash the pool keeps for the string, for use in
+            **    other hash tables. It is the one 'hashUtf8' gives.
+            */
+            uint64_t hash(Handle handle) const {
+                return entries[handle].hash;
+            }
+
+            /*
+            ** @brief: The number of distinct strings in the pool.
+            */
+            std::size_t size() const {
+                return entries.size();
+            }
+
+        private:
+            struct Entry {
+                const char* data;
+                uint32_t length;
+                uint32_t codePoints;
+                uint64_t hash;
+            };
+
+            struct Slot {
+                // One more than the handle, so that 0 marks an empty slot.
+                uint32_t handle;
+                // The high half of the hash; the low half picks the slot.
+                uint32_t tag;
+            };
+
+            static constexpr std::size_t ARENA_BYTES = std::size_t(1) << 20;
+
+            /*
+            ** @note: The same 64-bit hash on every target, so the tags in
+            **    the table filter probes even where size_t is 32 bits, and
+            **    the hashes the pool hands out do not change between
+            **    standard libraries.
+            */
+            static uint64_t hashBytes(std::string_view str) {
+                return detail::hashBytes(
+                    reinterpret_cast<const unsigned char*>(str.data()), str.size()
+                );
+            }
+
+            /*
+            ** @returns: Whether the string is in the table. 'slot' receives
+            **    its slot, or the empty slot where it would go.
+            */
+            bool findSlot(std::string_view str, uint64_t hash, std::size_t& slot) const {
+                if (slots.empty()) {
+                    slot = 0;
+                    return false;
+                }
+
+                const std::size_t mask = slots.size() - 1;
+                const uint32_t tag = static_cast<uint32_t>(hash >> 32);
+
+                for (slot = hash & mask; slots[slot].handle != 0; slot = (slot + 1) & mask) {
+                    if (slots[slot].tag != tag) {
+                        continue;
+                    }
+                    const Entry& entry = entries[slots[slot].handle - 1];
+                    if (entry.length == str.size() && (str.empty() ||
+                        std::memcmp(entry.data, str.data(), str.size()) == 0)) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            /*
+            ** @brief: Doubles the table, placing every string again from its
+            **    kept hash.
+            */
+            void grow() {
+                std::vector<Slot> larger(std::max<std::size_t>(16, 2 * slots.size()), Slot{0, 0});
+                const std::size_t mask = larger.size() - 1;
+
+                for (std::size_t index = 0; index < entries.size(); ++index) {
+                    const uint64_t hash = entries[index].hash;
+                    std::size_t slot = hash & mask;
+                    while (larger[slot].handle != 0) {
+                        slot = (slot + 1) & mask;
+                    }
+                    larger[slot] = {
+                        static_cast<uint32_t>(index + 1), static_cast<uint32_t>(hash >> 32)
+                    };
+                }
+                slots.swap(larger);
+            }
+
+            /*
+            ** @brief: Copies the bytes into the current arena, starting a new
+            **    one when they do not fit. Long strings get an arena of
+            **    their own so that they do not waste the rest of one.
+            */
+            const char* store(std::string_view str) {
+                if (str.size() > ARENA_BYTES / 4) {
+                    arenas.emplace_back(new char[str.size()]);
+                    std::memcpy(arenas.back().get(), str.data(), str.size());
+                    return arenas.back().get();
+                }
+
+                if (str.size() > arenaAvailable) {
+                    arenas.emplace_back(new char[ARENA_BYTES]);
+                    arenaNext = arenas.back().get();
+                    arenaAvailable = ARENA_BYTES;
+                }
+
+                char* data = arenaNext;
+                if (not str.empty()) {
+                    std::memcpy(data, str.data(), str.size());
+                }
+                arenaNext += str.size();
+                arenaAvailable -= str.size();
+                return data;
+            }
+
+            std::vector<Entry> entries;
+            std::vector<Slot> slots;
+            std::vector<std::unique_ptr<char[]>> arenas;
+            char* arenaNext = nullptr;
+            std::size_t arenaAvailable = 0;
+    };
+} // namespace gc
+
+#endif // __GENIUS_C_UTF8_INTERN_POOL__
@@ -0,0 +1,347 @@
+#ifndef __GENIUS_C_UTF8_JSON__
+#define __GENIUS_C_UTF8_JSON__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <string_view>
+
+#include "utf8.h"
+
+namespace gc {
+    /*
+    ** @brief: What 'jsonEscape' leaves unescaped.
+    */
+    enum class JsonEscapeMode {
+        // Only what JSON requires is escaped; other text is copied as utf8.
+        Utf8,
+        // Everything outside ascii is escaped too, as '\uXXXX' or a
+        // surrogate pair of them, so the output is pure ascii.
+        AsciiOnly
+    };
+
+    /*
+    ** @brief: Thrown by 'jsonUnescape' for text that is not the body of a
+    **    JSON string.
+    */
+    struct InvalidJsonString : public std::exception {
+        InvalidJsonString(const char* msg, std::size_t offset)
+            : msg(msg), position(offset) {}
+
+        const char* what() const noexcept {
+            return msg;
+        }
+
+        /*
+        ** @brief: The offset of the offending byte or escape sequence.
+        */
+        std::size_t offset() const noexcept {
+            return position;
+        }
+
+        private:
+            const char* msg;
+            std::size_t position;
+    };
+
+namespace detail {
+    // The longest escape that one code point can turn into: a surrogate
+    // pair of '\uXXXX' escapes.
+    constexpr std::size_t JSON_MAX_ESCAPE_BYTES = 12;
+
+    inline std::size_t writeJsonHexEscape(uint32_t unit, char* out) {
+        static const char digits[] = "0123456789abcdef";
+
+        out[0] = '\\';
+        out[1] = 'u';
+        out[2] = digits[(unit >> 12) & 0xf];
+        out[3] = digits[(unit >> 8) & 0xf];
+        out[4] = digits[(unit >> 4) & 0xf];
+        out[5] = digits[unit & 0xf];
+        return 6;
+    }
+
+    /*
+    ** @returns: The value of the four hex digits at 'bytes', or -1 if they
+    **    are not all hex digits.
+    */
+    inline int32_t readJsonHexEscape(const unsigned char* bytes) {
+        int32_t value = 0;
+        for (int index = 0; index < 4; ++index) {
+            const unsigned char byte = bytes[index];
+            int32_t digit;
+            if (static_cast<unsigned char>(byte - '0') < 10) {
+                digit = byte - '0';
+            } else if (static_cast<unsigned char>((byte | 0x20) - 'a') < 6) {
+                digit = (byte | 0x20) - 'a' + 10;
+            } else {
+                return -1;
+            }
+            value = (value << 4) | digit;
+        }
+        return value;
+    }
+
+    /*
+    ** @brief: Escapes the ascii byte or the utf8 sequence at 'bytes[pos]'.
+    ** @returns: The number of bytes written to 'out'.
+    ** @throws InvalidUtf8: If a utf8 sequence there is not strictly valid.
+    */
+    inline std::size_t escapeJsonCharacter(
+        const unsigned char* bytes,
+        std::size_t length,
+        std::size_t& pos,
+        char* out
+    ) {
+        const unsigned char byte = bytes[pos];
+
+        if (byte < 0x80) {
+            ++pos;
+            char shorthand = 0;
+            switch (byte) {
+                case '"': shorthand = '"'; break;
+                case '\\': shorthand = '\\'; break;
+                case '\b': shorthand = 'b'; break;
+                case '\f': shorthand = 'f'; break;
+                case '\n': shorthand = 'n'; break;
+                case '\r': shorthand = 'r'; break;
+                case '\t': shorthand = 't'; break;
+                default:
+                    return writeJsonHexEscape(byte, out);
+            }
+            out[0] = '\\';
+            out[1] = shorthand;
+            return 2;
+        }
+
+        uint32_t codePoint;
+        const int size = scalar::decodeUtf8Sequence(bytes + pos, length - pos, codePoint);
+        if (size == 0) {
+            throwUtf8Error(bytes, length, pos);
+        }
+        pos += size;
+
+        if (codePoint < 0x10000) {
+            return writeJsonHexEscape(codePoint, out);
+        }
+        codePoint -= 0x10000;
+        writeJsonHexEscape(0xd800 + (codePoint >> 10), out);
+        writeJsonHexEscape(0xdc00 + (codePoint & 0x3ff), out + 6);
+        return 12;
+    }
+
+    /*
+    ** @brief: Decodes the escape sequence that starts with the backslash at
+    **    'bytes[pos]' into utf8.
+    ** @returns: The number of bytes written to 'out'.
+    ** @throws InvalidJsonString: If the escape sequence is malformed.
+    ** @throws InvalidUtf8: If it encodes an unpaired surrogate.
+    */
+    inline std::size_t unescapeJsonSequence(
+        const unsigned char* bytes,
+        std::size_t length,
+        std::size_t& pos,
+        char* out
+    ) {
+        const std::size_t start = pos;
+        if (pos + 1 == length) {
+            throw InvalidJsonString("unterminated escape sequence", start);
+        }
+
+        if (bytes[pos + 1] != 'u') {
+            switch (bytes[pos + 1]) {
+                case '"': out[0] = '"'; break;
+                case '\\': out[0] = '\\'; break;
+                case '/': out[0] = '/'; break;
+                case 'b': out[0] = '\b'; break;
+                case 'f': out[0] = '\f'; break;
+                case 'n': out[0] = '\n'; break;
+                case 'r': out[0] = '\r'; break;
+                case 't': out[0] = '\t'; break;
+                default:
+                    throw InvalidJsonString("invalid escape sequence", start);
+            }
+            pos += 2;
+            return 1;
+        }
+
+        if (length - pos < 6) {
+            throw InvalidJsonString("unterminated escape sequence", start);
+        }
+        const int32_t unit = readJsonHexEscape(bytes + pos + 2);
+        if (unit < 0) {
+            throw InvalidJsonString("invalid hex digit in escape sequence", start);
+        }
+        pos += 6;
+
+        uint32_t codePoint = static_cast<uint32_t>(unit);
+        if (codePoint - 0xd800 < 0x800) {
+            int32_t low = -1;
+            if (codePoint < 0xdc00 && length - pos >= 6 &&
+                bytes[pos] == '\\' && bytes[pos + 1] == 'u') {
+                low = readJsonHexEscape(bytes + pos + 2);
+            }
+            if (low - 0xdc00 < 0 || low - 0xdc00 >= 0x400) {
+                Utf8Error error;
+                error.offset = start;
+                error.kind = Utf8ErrorKind::Surrogate;
+                throwUtf8Error("unpaired utf16 surrogate", error);
+            }
+            codePoint = 0x10000 + ((codePoint - 0xd800) << 10) + (low - 0xdc00);
+            pos += 6;
+        }
+
+        return scalar::encodeUtf8Sequence(codePoint, out);
+    }
+} // namespace detail
+
+    /*
+    ** @brief: Escapes the given utf8 text as the body of a JSON string (the
+    **    part between the quotes) into 'output', replacing its contents but
+    **    reusing its storage. 'str' may view 'output'.
+    ** @param mode: Whether text outside ascii is copied as utf8 or escaped.
+    ** @throws InvalidUtf8: If the text is not strictly valid utf8.
+    ** @note: Quotes, backslashes and control characters are escaped, using
+    **    the two-character forms where JSON has them. The runs between them
+    **    are found with SIMD, validated while they are still in cache and
+    **    copied in bulk, so the text is only read once.
+    */
+    inline void jsonEscape(
+        std::string_view str,
+        std::string& output,
+        JsonEscapeMode mode = JsonEscapeMode::Utf8
+    ) {
+        if (detail::isViewInto(str, output)) {
+            std::string escaped;
+            jsonEscape(str, escaped, mode);
+            output.swap(escaped);
+            return;
+        }
+
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data());
+        const std::size_t length = str.size();
+        const bool asciiOnly = mode == JsonEscapeMode::AsciiOnly;
+
+        output.resize(length + detail::JSON_MAX_ESCAPE_BYTES);
+        std::size_t pos = 0;
+        std::size_t written = 0;
+
+        while (pos < length) {
+            const std::size_t run = detail::jsonPlainPrefixLength(
+                bytes + pos, length - pos, asciiOnly
+            );
+            if (not asciiOnly) {
+                const std::size_t valid = detail::validateUtf8(bytes + pos, run);
+                if (valid != run) {
+                    detail::throwUtf8Error(bytes, length, pos + valid);
+                }
+            }
+
+            const std::size_t needed = written + run + detail::JSON_MAX_ESCAPE_BYTES;
+            if (output.size() < needed) {
+                output.resize(std::max(needed, 2 * output.size()));
+            }
+            char* out = &output[0];
+
+            std::memcpy(out + written, bytes + pos, run);
+            pos += run;
+            written += run;
+
+            if (pos < length) {
+                written += detail::escapeJsonCharacter(bytes, length, pos, out + written);
+            }
+        }
+
+        output.resize(written);
+    }
+
+    /*
+    ** @brief: Returns the given utf8 text escaped as the body of a JSON
+    **    string.
+    ** @throws InvalidUtf8: If the text is not strictly valid utf8.
+    */
+    inline std::string jsonEscape(
+        std::string_view str,
+        JsonEscapeMode mode = JsonEscapeMode::Utf8
+    ) {
+        std::string output;
+        jsonEscape(str, output, mode);
+        return output;
+    }
+
+    /*
+    ** @brief: Decodes the body of a JSON string (the part between the
+    **    quotes) into utf8 in 'output', replacing its contents but reusing
+    **    its storage. 'str' may view 'output'.
+    ** @throws InvalidJsonString: If the text holds a malformed escape
+    **    sequence, an unescaped '"' or a raw control character.
+    ** @throws InvalidUtf8: If the text is not strictly valid utf8, or an
+    **    escape sequence encodes an unpaired surrogate.
+    ** @note: Unescaping never makes text longer, so 'output' is sized once.
+    **    The runs between backslashes are found with SIMD, validated while
+    **    they are still in cache and copied in bulk.
+    */
+    inline void jsonUnescape(std::string_view str, std::string& output) {
+        if (detail::isViewInto(str, output)) {
+            std::string unescaped;
+            jsonUnescape(str, unescaped);
+            output.swap(unescaped);
+            return;
+        }
+
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data());
+        const std::size_t length = str.size();
+
+        output.resize(length);
+        char* out = &output[0];
+        std::size_t pos = 0;
+        std::size_t written = 0;
+
+        while (pos < length) {
+            const std::size_t run = detail::jsonPlainPrefixLength(
+                bytes + pos, length - pos, false
+            );
+            const std::size_t valid = detail::validateUtf8(bytes + pos, run);
+            if (valid != run) {
+                detail::throwUtf8Error(bytes, length, pos + valid);
+            }
+
+            std::memcpy(out + written, bytes + pos, run);
+            pos += run;
+            written += run;
+
+            if (pos == length) {
+                break;
+            }
+            if (bytes[pos] != '\\') {
+                throw InvalidJsonString(
+                    bytes[pos] == '"'
+                        ? "unescaped quote in JSON string"
+                        : "unescaped control character in JSON string",
+                    pos
+                );
+            }
+            written += detail::unescapeJsonSequence(bytes, length, pos, out + written);
+        }
+
+        output.resize(written);
+    }
+
+    /*
+    ** @brief: Returns the utf8 text that the given body of a JSON string
+    **    stands for.
+    ** @throws InvalidJsonString: If the text is not a valid JSON string body.
+    ** @throws InvalidUtf8: If the text is not strictly valid utf8, or an
+    **    escape sequence encodes an unpaired surrogate.
+    */
+    inline std::string jsonUnescape(std::string_view str) {
+        std::string output;
+        jsonUnescape(str, output);
+        return output;
+    }
+} // namespace gc
+
+#endif // __GENIUS_C_UTF8_JSON__
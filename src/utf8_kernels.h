@@ -0,0 +1,2417 @@
+#ifndef __GENIUS_C_UTF8_KERNELS__
+#define __GENIUS_C_UTF8_KERNELS__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "utf8_stats.h"
+
+/*
+** Bulk kernels used by the container-level API in "utf8.h". Every kernel has
+** a portable scalar version; the vectorised versions are selected at compile
+** time from the target flags (eg. '-march=native' or '-mavx512vbmi') and can
+** be switched off by defining GC_UTF8_NO_SIMD.
+**
+** The AVX-512 kernels need F, BW, VL and VBMI. When VBMI2 is also available
+** the encoders compact their output with 'vpcompressb'. Ascii scans fall
+** back to SSE2 on other x86-64 targets.
+*/
+#if !defined(GC_UTF8_NO_SIMD)
+#   if defined(__AVX512F__) && defined(__AVX512BW__) && \
+       defined(__AVX512VL__) && defined(__AVX512VBMI__)
+#       define GC_UTF8_AVX512 1
+#   endif
+#   if defined(__SSE2__) || defined(_M_X64)
+#       define GC_UTF8_SSE2 1
+#   endif
+#endif
+
+#if defined(GC_UTF8_AVX512)
+#   include <immintrin.h>
+#elif defined(GC_UTF8_SSE2)
+#   include <emmintrin.h>
+#endif
+
+namespace gc {
+namespace detail {
+    /*
+    ** @brief: The outcome of a bulk transcoding kernel.
+    ** @note: When 'ok' is false, 'read' is the offset of the first unit of the
+    **    offending sequence and 'written' is the number of units that were
+    **    produced for the input before it.
+    */
+    struct TranscodeResult {
+        bool ok;
+        std::size_t read;
+        std::size_t written;
+    };
+
+    /*
+    ** @brief: Checks whether eight bytes starting at 'bytes' are all ascii.
+    */
+    inline bool isAsciiWord(const unsigned char* bytes) {
+        uint64_t word;
+        std::memcpy(&word, bytes, sizeof(word));
+        return (word & 0x8080808080808080ull) == 0;
+    }
+
+    /*
+    ** @returns: The number of ascii bytes at the start of 'bytes'.
+    */
+    inline std::size_t asciiPrefixLength(
+        const unsigned char* bytes,
+        std::size_t length
+    ) {
+        std::size_t pos = 0;
+
+#if defined(GC_UTF8_AVX512)
+        for (; pos + 64 <= length; pos += 64) {
+            const uint64_t high = _mm512_movepi8_mask(_mm512_loadu_si512(bytes + pos));
+            if (high != 0) {
+                pos += __builtin_ctzll(high);
+                break;
+            }
+        }
+#elif defined(GC_UTF8_SSE2)
+        for (; pos + 16 <= length; pos += 16) {
+            const int high = _mm_movemask_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + pos))
+            );
+            if (high != 0) {
+                pos += __builtin_ctz(high);
+                break;
+            }
+        }
+#endif
+
+        // After a break these stop at once, on the byte that was found.
+        while (pos + 8 <= length && isAsciiWord(bytes + pos)) {
+            pos += 8;
+        }
+        while (pos < length && bytes[pos] < 0x80) {
+            ++pos;
+        }
+        recordAsciiFastPath(pos);
+        return pos;
+    }
+
+    /*
+    ** @returns: The number of bytes at or above 0x80.
+    */
+    inline std::size_t countNonAscii(
+        const unsigned char* bytes,
+        std::size_t length
+    ) {
+        std::size_t pos = 0;
+        std::size_t count = 0;
+
+#if defined(GC_UTF8_AVX512)
+        for (; pos + 64 <= length; pos += 64) {
+            count += __builtin_popcountll(
+                _mm512_movepi8_mask(_mm512_loadu_si512(bytes + pos))
+            );
+        }
+#elif defined(GC_UTF8_SSE2)
+        for (; pos + 16 <= length; pos += 16) {
+            count += __builtin_popcount(_mm_movemask_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + pos))
+            ));
+        }
+#endif
+
+        for (; pos < length; ++pos) {
+            count += bytes[pos] >> 7;
+        }
+        return count;
+    }
+
+    /*
+    ** @returns: The number of code points, ie. of bytes that are not trail
+    **    bytes (0x80 to 0xbf).
+    */
+    inline std::size_t countCodePoints(
+        const unsigned char* bytes,
+        std::size_t length
+    ) {
+        std::size_t pos = 0;
+        std::size_t trails = 0;
+
+#if defined(GC_UTF8_AVX512)
+        const __m512i lead = _mm512_set1_epi8(static_cast<char>(0xc0));
+        for (; pos + 64 <= length; pos += 64) {
+            trails += __builtin_popcountll(
+                _mm512_cmplt_epi8_mask(_mm512_loadu_si512(bytes + pos), lead)
+            );
+        }
+#elif defined(GC_UTF8_SSE2)
+        const __m128i lead = _mm_set1_epi8(static_cast<char>(0xc0));
+        for (; pos + 16 <= length; pos += 16) {
+            trails += __builtin_popcount(_mm_movemask_epi8(_mm_cmplt_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + pos)), lead
+            )));
+        }
+#endif
+
+        for (; pos < length; ++pos) {
+            trails += (bytes[pos] & 0xc0) == 0x80;
+        }
+        return length - trails;
+    }
+
+    /*
+    ** @brief: Skips 'count' code points, counting every byte that is not a
+    **    trail byte (0x80 to 0xbf) as the start of one.
+    ** @returns: The offset of the first byte after them, or 'length' if the
+    **    text holds no more than 'count' code points.
+    */
+    inline std::size_t skipCodePoints(
+        const unsigned char* bytes,
+        std::size_t length,
+        std::size_t count
+    ) {
+        std::size_t pos = 0;
+
+#if defined(GC_UTF8_AVX512)
+        const __m512i trail = _mm512_set1_epi8(static_cast<char>(0xc0));
+
+        for (; pos + 64 <= length; pos += 64) {
+            uint64_t leads = _mm512_cmpge_epi8_mask(_mm512_loadu_si512(bytes + pos), trail);
+            const std::size_t found = __builtin_popcountll(leads);
+            if (found > count) {
+                for (; count > 0; --count) {
+                    leads &= leads - 1;
+                }
+                return pos + __builtin_ctzll(leads);
+            }
+            count -= found;
+        }
+#elif defined(GC_UTF8_SSE2)
+        const __m128i trail = _mm_set1_epi8(static_cast<char>(0xc0));
+
+        for (; pos + 16 <= length; pos += 16) {
+            unsigned leads = ~_mm_movemask_epi8(_mm_cmplt_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + pos)), trail
+            )) & 0xffff;
+            const std::size_t found = __builtin_popcount(leads);
+            if (found > count) {
+                for (; count > 0; --count) {
+                    leads &= leads - 1;
+                }
+                return pos + __builtin_ctz(leads);
+            }
+            count -= found;
+        }
+#endif
+
+        for (; pos < length; ++pos) {
+            if ((bytes[pos] & 0xc0) != 0x80) {
+                if (count == 0) {
+                    return pos;
+                }
+                --count;
+            }
+        }
+        return length;
+    }
+
+    /*
+    ** @brief: Classifies up to 64 bytes at once: bit 'i' of each mask stands
+    **    for 'bytes[i]'.
+    ** @param newlines: Receives the mask of the '\n' bytes.
+    ** @returns: The mask of the bytes that start a code point, ie. that are
+    **    not trail bytes.
+    */
+    inline uint64_t classifyLineBlock(
+        const unsigned char* bytes,
+        std::size_t length,
+        uint64_t& newlines
+    ) {
+#if defined(GC_UTF8_AVX512)
+        if (length == 64) {
+            const __m512i input = _mm512_loadu_si512(bytes);
+            newlines = _mm512_cmpeq_epi8_mask(input, _mm512_set1_epi8('\n'));
+            return _mm512_cmpge_epi8_mask(input, _mm512_set1_epi8(static_cast<char>(0xc0)));
+        }
+#elif defined(GC_UTF8_SSE2)
+        if (length == 64) {
+            const __m128i newline = _mm_set1_epi8('\n');
+            const __m128i trail = _mm_set1_epi8(static_cast<char>(0xc0));
+            uint64_t trails = 0;
+            newlines = 0;
+
+            for (int part = 0; part < 4; ++part) {
+                const __m128i input = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(bytes + 16 * part)
+                );
+                newlines |= static_cast<uint64_t>(
+                    _mm_movemask_epi8(_mm_cmpeq_epi8(input, newline))
+                ) << (16 * part);
+                trails |= static_cast<uint64_t>(
+                    _mm_movemask_epi8(_mm_cmplt_epi8(input, trail))
+                ) << (16 * part);
+            }
+            return ~trails;
+        }
+#endif
+
+        uint64_t leads = 0;
+        newlines = 0;
+        for (std::size_t pos = 0; pos < length; ++pos) {
+            newlines |= static_cast<uint64_t>(bytes[pos] == '\n') << pos;
+            leads |= static_cast<uint64_t>((bytes[pos] & 0xc0) != 0x80) << pos;
+        }
+        return leads;
+    }
+
+    /*
+    ** @brief: Copies the leading ascii bytes to 'out', turning 'A'-'Z' into
+    **    'a'-'z' (or the reverse if 'upper' is set).
+    ** @returns: The number of bytes copied, ie. the length of the ascii
+    **    prefix.
+    */
+    inline std::size_t convertAsciiCase(
+        const unsigned char* bytes,
+        std::size_t length,
+        char* out,
+        bool upper
+    ) {
+        const unsigned char first = upper ? 'a' : 'A';
+        std::size_t pos = 0;
+
+#if defined(GC_UTF8_AVX512)
+        const __m512i base = _mm512_set1_epi8(static_cast<char>(first));
+        const __m512i letters = _mm512_set1_epi8(26);
+        const __m512i flip = _mm512_set1_epi8(0x20);
+
+        for (; pos + 64 <= length; pos += 64) {
+            const __m512i input = _mm512_loadu_si512(bytes + pos);
+            if (_mm512_movepi8_mask(input) != 0) {
+                break;
+            }
+            const __mmask64 letter = _mm512_cmplt_epu8_mask(
+                _mm512_sub_epi8(input, base), letters
+            );
+            _mm512_storeu_si512(
+                out + pos, _mm512_xor_si512(input, _mm512_maskz_mov_epi8(letter, flip))
+            );
+        }
+#elif defined(GC_UTF8_SSE2)
+        // Signed compares: bias the letters down to the bottom of the range.
+        const __m128i bias = _mm_set1_epi8(static_cast<char>(0x80 - first));
+        const __m128i limit = _mm_set1_epi8(static_cast<char>(0x80 + 26));
+        const __m128i flip = _mm_set1_epi8(0x20);
+
+        for (; pos + 16 <= length; pos += 16) {
+            const __m128i input = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(bytes + pos)
+            );
+            if (_mm_movemask_epi8(input) != 0) {
+                break;
+            }
+            const __m128i letter = _mm_cmplt_epi8(_mm_add_epi8(input, bias), limit);
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i*>(out + pos),
+                _mm_xor_si128(input, _mm_and_si128(letter, flip))
+            );
+        }
+#endif
+
+        for (; pos < length && bytes[pos] < 0x80; ++pos) {
+            const unsigned char byte = bytes[pos];
+            out[pos] = static_cast<char>(
+                static_cast<unsigned char>(byte - first) < 26 ? byte ^ 0x20 : byte
+            );
+        }
+        return pos;
+    }
+
+    /*
+    ** @brief: Counts the printable characters (0x20 to 0x7e) in the leading
+    **    ascii bytes, ie. the columns they take up on a terminal.
+    ** @param printable: Incremented by the count.
+    ** @returns: The length of the ascii prefix.
+    */
+    inline std::size_t countAsciiPrintable(
+        const unsigned char* bytes,
+        std::size_t length,
+        std::size_t& printable
+    ) {
+        std::size_t pos = 0;
+
+#if defined(GC_UTF8_AVX512)
+        const __m512i space = _mm512_set1_epi8(0x20);
+        const __m512i range = _mm512_set1_epi8(0x5f);
+
+        for (; pos + 64 <= length; pos += 64) {
+            const __m512i input = _mm512_loadu_si512(bytes + pos);
+            const uint64_t high = _mm512_movepi8_mask(input);
+            uint64_t visible = _mm512_cmplt_epu8_mask(_mm512_sub_epi8(input, space), range);
+            if (high != 0) {
+                visible &= (high & (0 - high)) - 1;
+                printable += __builtin_popcountll(visible);
+                return pos + __builtin_ctzll(high);
+            }
+            printable += __builtin_popcountll(visible);
+        }
+#elif defined(GC_UTF8_SSE2)
+        const __m128i bias = _mm_set1_epi8(static_cast<char>(0x80 - 0x20));
+        const __m128i limit = _mm_set1_epi8(static_cast<char>(0x80 + 0x5f));
+
+        for (; pos + 16 <= length; pos += 16) {
+            const __m128i input = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(bytes + pos)
+            );
+            const unsigned high = _mm_movemask_epi8(input);
+            unsigned visible = _mm_movemask_epi8(
+                _mm_cmplt_epi8(_mm_add_epi8(input, bias), limit)
+            );
+            if (high != 0) {
+                visible &= (high & (0 - high)) - 1;
+                printable += __builtin_popcount(visible);
+                return pos + __builtin_ctz(high);
+            }
+            printable += __builtin_popcount(visible);
+        }
+#endif
+
+        for (; pos < length && bytes[pos] < 0x80; ++pos) {
+            printable += static_cast<unsigned char>(bytes[pos] - 0x20) < 0x5f;
+        }
+        return pos;
+    }
+
+    /*
+    ** @returns: The number of leading bytes at which 'first' and 'second' are
+    **    equal.
+    */
+    inline std::size_t commonPrefixLength(
+        const unsigned char* first,
+        const unsigned char* second,
+        std::size_t length
+    ) {
+        std::size_t pos = 0;
+
+#if defined(GC_UTF8_AVX512)
+        for (; pos + 64 <= length; pos += 64) {
+            const uint64_t differ = _mm512_cmpneq_epi8_mask(
+                _mm512_loadu_si512(first + pos), _mm512_loadu_si512(second + pos)
+            );
+            if (differ != 0) {
+                return pos + __builtin_ctzll(differ);
+            }
+        }
+#elif defined(GC_UTF8_SSE2)
+        for (; pos + 16 <= length; pos += 16) {
+            const unsigned differ = ~_mm_movemask_epi8(_mm_cmpeq_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + pos)),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(second + pos))
+            )) & 0xffff;
+            if (differ != 0) {
+                return pos + __builtin_ctz(differ);
+            }
+        }
+#endif
+
+        for (; pos + 8 <= length; pos += 8) {
+            uint64_t left;
+            uint64_t right;
+            std::memcpy(&left, first + pos, sizeof(left));
+            std::memcpy(&right, second + pos, sizeof(right));
+            if (left != right) {
+                break;
+            }
+        }
+        while (pos < length && first[pos] == second[pos]) {
+            ++pos;
+        }
+        return pos;
+    }
+
+    /*
+    ** @returns: The number of leading bytes at which 'first' and 'second' are
+    **    both ascii and equal once 'A'-'Z' are turned into 'a'-'z'.
+    */
+    inline std::size_t asciiCaseInsensitivePrefix(
+        const unsigned char* first,
+        const unsigned char* second,
+        std::size_t length
+    ) {
+        std::size_t pos = 0;
+
+#if defined(GC_UTF8_AVX512)
+        const __m512i base = _mm512_set1_epi8('A');
+        const __m512i letters = _mm512_set1_epi8(26);
+        const __m512i flip = _mm512_set1_epi8(0x20);
+
+        for (; pos + 64 <= length; pos += 64) {
+            __m512i left = _mm512_loadu_si512(first + pos);
+            __m512i right = _mm512_loadu_si512(second + pos);
+            const uint64_t high = _mm512_movepi8_mask(_mm512_or_si512(left, right));
+
+            left = _mm512_or_si512(left, _mm512_maskz_mov_epi8(
+                _mm512_cmplt_epu8_mask(_mm512_sub_epi8(left, base), letters), flip
+            ));
+            right = _mm512_or_si512(right, _mm512_maskz_mov_epi8(
+                _mm512_cmplt_epu8_mask(_mm512_sub_epi8(right, base), letters), flip
+            ));
+
+            const uint64_t stop = high | _mm512_cmpneq_epi8_mask(left, right);
+            if (stop != 0) {
+                return pos + __builtin_ctzll(stop);
+            }
+        }
+#elif defined(GC_UTF8_SSE2)
+        const __m128i bias = _mm_set1_epi8(static_cast<char>(0x80 - 'A'));
+        const __m128i limit = _mm_set1_epi8(static_cast<char>(0x80 + 26));
+        const __m128i flip = _mm_set1_epi8(0x20);
+
+        for (; pos + 16 <= length; pos += 16) {
+            __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + pos));
+            __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(second + pos));
+            const unsigned high = _mm_movemask_epi8(_mm_or_si128(left, right));
+
+            left = _mm_or_si128(left, _mm_and_si128(
+                _mm_cmplt_epi8(_mm_add_epi8(left, bias), limit), flip
+            ));
+            right = _mm_or_si128(right, _mm_and_si128(
+                _mm_cmplt_epi8(_mm_add_epi8(right, bias), limit), flip
+            ));
+
+            const unsigned stop = high |
+                (~_mm_movemask_epi8(_mm_cmpeq_epi8(left, right)) & 0xffff);
+            if (stop != 0) {
+                return pos + __builtin_ctz(stop);
+            }
+        }
+#endif
+
+        for (; pos < length; ++pos) {
+            const unsigned char left = first[pos];
+            const unsigned char right = second[pos];
+            if ((left | right) >= 0x80) {
+                break;
+            }
+            const unsigned char foldedLeft =
+                static_cast<unsigned char>(left - 'A') < 26 ? left | 0x20 : left;
+            const unsigned char foldedRight =
+                static_cast<unsigned char>(right - 'A') < 26 ? right | 0x20 : right;
+            if (foldedLeft != foldedRight) {
+                break;
+            }
+        }
+        return pos;
+    }
+
+    /*
+    ** @brief: Finds the first occurrence of 'needle' in 'bytes'. Candidates
+    **    are positions where both the first and the last byte of the needle
+    **    match, so a whole block is filtered with two compares and only the
+    **    survivors are checked with 'memcmp'.
+    ** @param needleLength: Must be at least 1.
+    ** @returns: The offset of the occurrence, or 'length' if there is none.
+    */
+    inline std::size_t findByteSequence(
+        const unsigned char* bytes,
+        std::size_t length,
+        const unsigned char* needle,
+        std::size_t needleLength
+    ) {
+        if (needleLength > length) {
+            return length;
+        }
+
+        const std::size_t last = needleLength - 1;
+        const std::size_t end = length - last;
+        std::size_t pos = 0;
+
+#if defined(GC_UTF8_AVX512)
+        const __m512i head = _mm512_set1_epi8(static_cast<char>(needle[0]));
+        const __m512i tail = _mm512_set1_epi8(static_cast<char>(needle[last]));
+
+        for (; pos + 64 <= end; pos += 64) {
+            uint64_t candidates =
+                _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(bytes + pos), head) &
+                _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(bytes + pos + last), tail);
+
+            while (candidates != 0) {
+                const std::size_t offset = pos + __builtin_ctzll(candidates);
+                if (std::memcmp(bytes + offset, needle, needleLength) == 0) {
+                    return offset;
+                }
+                candidates &= candidates - 1;
+            }
+        }
+#elif defined(GC_UTF8_SSE2)
+        const __m128i head = _mm_set1_epi8(static_cast<char>(needle[0]));
+        const __m128i tail = _mm_set1_epi8(static_cast<char>(needle[last]));
+
+        for (; pos + 16 <= end; pos += 16) {
+            unsigned candidates = _mm_movemask_epi8(_mm_and_si128(
+                _mm_cmpeq_epi8(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + pos)), head
+                ),
+                _mm_cmpeq_epi8(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + pos + last)), tail
+                )
+            ));
+
+            while (candidates != 0) {
+                const std::size_t offset = pos + __builtin_ctz(candidates);
+                if (std::memcmp(bytes + offset, needle, needleLength) == 0) {
+                    return offset;
+                }
+                candidates &= candidates - 1;
+            }
+        }
+#endif
+
+        while (pos < end) {
+            const void* found = std::memchr(bytes + pos, needle[0], end - pos);
+            if (found == nullptr) {
+                break;
+            }
+            pos = static_cast<const unsigned char*>(found) - bytes;
+            if (bytes[pos + last] == needle[last] &&
+                std::memcmp(bytes + pos, needle, needleLength) == 0) {
+                return pos;
+            }
+            ++pos;
+        }
+        return length;
+    }
+
+    /*
+    ** @returns: The number of leading bytes that may appear as they are in a
+    **    JSON string, ie. that are neither control characters (below 0x20),
+    **    '"' nor '\\', and with 'asciiOnly' set, not above 0x7f either.
+    */
+    inline std::size_t jsonPlainPrefixLength(
+        const unsigned char* bytes,
+        std::size_t length,
+        bool asciiOnly
+    ) {
+        std::size_t pos = 0;
+
+#if defined(GC_UTF8_AVX512)
+        const __m512i control = _mm512_set1_epi8(0x20);
+        const __m512i quote = _mm512_set1_epi8('"');
+        const __m512i backslash = _mm512_set1_epi8('\\');
+        const uint64_t high = asciiOnly ? ~0ull : 0;
+
+        for (; pos + 64 <= length; pos += 64) {
+            const __m512i input = _mm512_loadu_si512(bytes + pos);
+            const uint64_t stop = _mm512_cmplt_epu8_mask(input, control) |
+                _mm512_cmpeq_epi8_mask(input, quote) |
+                _mm512_cmpeq_epi8_mask(input, backslash) |
+                (_mm512_movepi8_mask(input) & high);
+            if (stop != 0) {
+                return pos + __builtin_ctzll(stop);
+            }
+        }
+#elif defined(GC_UTF8_SSE2)
+        const __m128i control = _mm_set1_epi8(0x1f);
+        const __m128i quote = _mm_set1_epi8('"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        const unsigned high = asciiOnly ? 0xffff : 0;
+
+        for (; pos + 16 <= length; pos += 16) {
+            const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + pos));
+            const __m128i special = _mm_or_si128(
+                _mm_cmpeq_epi8(_mm_min_epu8(input, control), input),
+                _mm_or_si128(_mm_cmpeq_epi8(input, quote), _mm_cmpeq_epi8(input, backslash))
+            );
+            const unsigned stop = _mm_movemask_epi8(special) |
+                (_mm_movemask_epi8(input) & high);
+            if (stop != 0) {
+                return pos + __builtin_ctz(stop);
+            }
+        }
+#endif
+
+        for (; pos < length; ++pos) {
+            const unsigned char byte = bytes[pos];
+            if (byte < 0x20 || byte == '"' || byte == '\\' || (asciiOnly && byte >= 0x80)) {
+                break;
+            }
+        }
+        return pos;
+    }
+
+    /*
+    ** @returns: The number of leading bytes that are neither '%' nor, with
+    **    'plus' set, '+'.
+    */
+    inline std::size_t percentPlainPrefixLength(
+        const unsigned char* bytes,
+        std::size_t length,
+        bool plus
+    ) {
+        const unsigned char other = plus ? '+' : '%';
+        std::size_t pos = 0;
+
+#if defined(GC_UTF8_AVX512)
+        const __m512i percent = _mm512_set1_epi8('%');
+        const __m512i second = _mm512_set1_epi8(static_cast<char>(other));
+
+        for (; pos + 64 <= length; pos += 64) {
+            const __m512i input = _mm512_loadu_si512(bytes + pos);
+            const uint64_t stop = _mm512_cmpeq_epi8_mask(input, percent) |
+                _mm512_cmpeq_epi8_mask(input, second);
+            if (stop != 0) {
+                return pos + __builtin_ctzll(stop);
+            }
+        }
+#elif defined(GC_UTF8_SSE2)
+        const __m128i percent = _mm_set1_epi8('%');
+        const __m128i second = _mm_set1_epi8(static_cast<char>(other));
+
+        for (; pos + 16 <= length; pos += 16) {
+            const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + pos));
+            const unsigned stop = _mm_movemask_epi8(_mm_or_si128(
+                _mm_cmpeq_epi8(input, percent), _mm_cmpeq_epi8(input, second)
+            ));
+            if (stop != 0) {
+                return pos + __builtin_ctz(stop);
+            }
+        }
+#endif
+
+        while (pos < length && bytes[pos] != '%' && bytes[pos] != other) {
+            ++pos;
+        }
+        return pos;
+    }
+
+    /*
+    ** @returns: The number of leading bytes that are unreserved in URIs (RFC
+    **    3986): letters, digits, '-', '.', '_' and '~'.
+    */
+    inline std::size_t unreservedPrefixLength(
+        const unsigned char* bytes,
+        std::size_t length
+    ) {
+        std::size_t pos = 0;
+
+#if defined(GC_UTF8_AVX512)
+        const __m512i caseBit = _mm512_set1_epi8(0x20);
+        const __m512i letterBase = _mm512_set1_epi8('a');
+        const __m512i letters = _mm512_set1_epi8(26);
+        const __m512i digitBase = _mm512_set1_epi8('0');
+        const __m512i digits = _mm512_set1_epi8(10);
+
+        for (; pos + 64 <= length; pos += 64) {
+            const __m512i input = _mm512_loadu_si512(bytes + pos);
+            const uint64_t unreserved =
+                _mm512_cmplt_epu8_mask(
+                    _mm512_sub_epi8(_mm512_or_si512(input, caseBit), letterBase), letters
+                ) |
+                _mm512_cmplt_epu8_mask(_mm512_sub_epi8(input, digitBase), digits) |
+                _mm512_cmpeq_epi8_mask(input, _mm512_set1_epi8('-')) |
+                _mm512_cmpeq_epi8_mask(input, _mm512_set1_epi8('.')) |
+                _mm512_cmpeq_epi8_mask(input, _mm512_set1_epi8('_')) |
+                _mm512_cmpeq_epi8_mask(input, _mm512_set1_epi8('~'));
+            if (~unreserved != 0) {
+                return pos + __builtin_ctzll(~unreserved);
+            }
+        }
+#elif defined(GC_UTF8_SSE2)
+        const __m128i caseBit = _mm_set1_epi8(0x20);
+        const __m128i letterBias = _mm_set1_epi8(static_cast<char>(0x80 - 'a'));
+        const __m128i letterLimit = _mm_set1_epi8(static_cast<char>(0x80 + 26));
+        const __m128i digitBias = _mm_set1_epi8(static_cast<char>(0x80 - '0'));
+        const __m128i digitLimit = _mm_set1_epi8(static_cast<char>(0x80 + 10));
+
+        for (; pos + 16 <= length; pos += 16) {
+            const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + pos));
+            const __m128i letter = _mm_cmplt_epi8(
+                _mm_add_epi8(_mm_or_si128(input, caseBit), letterBias), letterLimit
+            );
+            const __m128i digit = _mm_cmplt_epi8(_mm_add_epi8(input, digitBias), digitLimit);
+            const __m128i mark = _mm_or_si128(
+                _mm_or_si128(
+                    _mm_cmpeq_epi8(input, _mm_set1_epi8('-')),
+                    _mm_cmpeq_epi8(input, _mm_set1_epi8('.'))
+                ),
+                _mm_or_si128(
+                    _mm_cmpeq_epi8(input, _mm_set1_epi8('_')),
+                    _mm_cmpeq_epi8(input, _mm_set1_epi8('~'))
+                )
+            );
+            const unsigned reserved = ~_mm_movemask_epi8(
+                _mm_or_si128(_mm_or_si128(letter, digit), mark)
+            ) & 0xffff;
+            if (reserved != 0) {
+                return pos + __builtin_ctz(reserved);
+            }
+        }
+#endif
+
+        for (; pos < length; ++pos) {
+            const unsigned char byte = bytes[pos];
+            const bool unreserved =
+                static_cast<unsigned char>((byte | 0x20) - 'a') < 26 ||
+                static_cast<unsigned char>(byte - '0') < 10 ||
+                byte == '-' || byte == '.' || byte == '_' || byte == '~';
+            if (not unreserved) {
+                break;
+            }
+        }
+        return pos;
+    }
+
+    /*
+    ** The 64-bit hash behind 'hashUtf8' and 'validateAndHashUtf8'. It is
+    ** built so that the validators can feed it the blocks they already have
+    ** loaded: the input is taken in 64-byte stripes, each one spread over
+    ** eight 64-bit lanes as in xxHash3 (every lane adds the product of the
+    ** two halves of its keyed word, and its neighbour adds the raw word).
+    ** The lanes are scrambled after every 16 full stripes, and a last
+    ** partial stripe is zero-padded. The length is mixed in at the end.
+    ** Every target computes the same value.
+    */
+    constexpr std::size_t HASH_STRIPE_BYTES = 64;
+    constexpr std::size_t HASH_STRIPES_PER_SCRAMBLE = 16;
+
+    constexpr uint64_t HASH_PRIME32 = 0x9e3779b1ull;
+    constexpr uint64_t HASH_PRIME64_1 = 0x9e3779b185ebca87ull;
+    constexpr uint64_t HASH_PRIME64_2 = 0xc2b2ae3d27d4eb4full;
+    constexpr uint64_t HASH_PRIME64_3 = 0x165667b19e3779f9ull;
+
+    constexpr uint64_t HASH_SEED[8] = {
+        0x7ecf3627004c2fd9ull, 0xa418cb27a1b5c420ull, 0xeb6eb4280c396ffcull, 0x1b55f44041a6457aull,
+        0x12af5d5e8e86d770ull, 0xf2f36b1cb08ff653ull, 0x0aad350a337e72f1ull, 0xdcad10c743f37228ull
+    };
+    constexpr uint64_t HASH_KEY[8] = {
+        0x408d01f31e82a8e5ull, 0xacada8a939da8f72ull, 0xff39eb753a927d82ull, 0xef6d87b7255503acull,
+        0x064998351855a5dfull, 0xe04a9d6ccbc1acb0ull, 0x2caa22678d134865ull, 0x6314bbd0ffbe6b07ull
+    };
+
+    inline void beginHash(uint64_t* lanes) {
+        std::memcpy(lanes, HASH_SEED, sizeof(HASH_SEED));
+    }
+
+    inline void hashStripe(uint64_t* lanes, const unsigned char* stripe) {
+        for (int lane = 0; lane < 8; ++lane) {
+            uint64_t word;
+            std::memcpy(&word, stripe + 8 * lane, sizeof(word));
+            const uint64_t keyed = word ^ HASH_KEY[lane];
+            lanes[lane ^ 1] += word;
+            lanes[lane] += (keyed & 0xffffffff) * (keyed >> 32);
+        }
+    }
+
+    inline void scrambleHash(uint64_t* lanes) {
+        for (int lane = 0; lane < 8; ++lane) {
+            const uint64_t value = lanes[lane];
+            lanes[lane] = (value ^ (value >> 47) ^ HASH_SEED[lane]) * HASH_PRIME32;
+        }
+    }
+
+    /*
+    ** @brief: Hashes 'count' full stripes. 'bytes' has to be a whole number
+    **    of scrambles into the input.
+    */
+    inline void hashStripes(
+        uint64_t* lanes,
+        const unsigned char* bytes,
+        std::size_t count
+    ) {
+        for (std::size_t stripe = 0; stripe < count; ++stripe) {
+            hashStripe(lanes, bytes + stripe * HASH_STRIPE_BYTES);
+            if ((stripe + 1) % HASH_STRIPES_PER_SCRAMBLE == 0) {
+                scrambleHash(lanes);
+            }
+        }
+    }
+
+    /*
+    ** @brief: Hashes the bytes after the last full stripe, if any, as one
+    **    zero-padded stripe.
+    */
+    inline void hashPartialStripe(
+        uint64_t* lanes,
+        const unsigned char* tail,
+        std::size_t remaining
+    ) {
+        if (remaining != 0) {
+            unsigned char stripe[HASH_STRIPE_BYTES] = {};
+            std::memcpy(stripe, tail, remaining);
+            hashStripe(lanes, stripe);
+        }
+    }
+
+    /*
+    ** @brief: Folds the lanes and the length of the input into the hash.
+    */
+    inline uint64_t finishHash(const uint64_t* lanes, std::size_t length) {
+        uint64_t hash = length * HASH_PRIME64_1;
+        for (int lane = 0; lane < 8; ++lane) {
+            hash ^= lanes[lane] * HASH_PRIME64_2;
+            hash = ((hash << 27) | (hash >> 37)) * HASH_PRIME64_1 + HASH_PRIME64_3;
+        }
+
+        hash ^= hash >> 33;
+        hash *= HASH_PRIME64_2;
+        hash ^= hash >> 29;
+        hash *= HASH_PRIME64_3;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+    /*
+    ** What 'classifyUtf8' has seen in the text. Each bit is set by the first
+    ** byte that shows it, so a clear bit is a property of the whole text.
+    */
+    constexpr uint32_t SEEN_NON_ASCII = 1 << 0;
+    constexpr uint32_t SEEN_NON_LATIN1 = 1 << 1;
+    constexpr uint32_t SEEN_SUPPLEMENTARY = 1 << 2;
+    constexpr uint32_t SEEN_CONTROL = 1 << 3;
+    constexpr uint32_t SEEN_NUL = 1 << 4;
+
+    /*
+    ** @brief: Notes which kinds of characters occur in valid utf8, and counts
+    **    its code points. Leads from 0xc4 up start characters beyond
+    **    U+00FF, leads from 0xf0 up start supplementary ones, and C1
+    **    controls are 0xc2 followed by 0x80 to 0x9f.
+    ** @param previous: The byte before 'bytes' (0 at the start), in case a
+    **    C1 control straddles the start.
+    ** @param codePoints: The count is added to it.
+    ** @returns: SEEN_* bits.
+    */
+    inline uint32_t classifyBytes(
+        const unsigned char* bytes,
+        std::size_t length,
+        unsigned char previous,
+        std::size_t& codePoints
+    ) {
+        uint32_t seen = 0;
+        std::size_t pos = 0;
+        std::size_t trails = 0;
+
+#if defined(GC_UTF8_SSE2)
+        const __m128i nonLatin1 = _mm_set1_epi8(static_cast<char>(0xc3));
+        const __m128i supplementary = _mm_set1_epi8(static_cast<char>(0xef));
+        const __m128i controlBias = _mm_set1_epi8(static_cast<char>(0x80));
+        const __m128i controlLimit = _mm_set1_epi8(static_cast<char>(0x80 + 0x20));
+        const __m128i c1Limit = _mm_set1_epi8(static_cast<char>(0xa0));
+        const __m128i trail = _mm_set1_epi8(static_cast<char>(0xc0));
+        unsigned int carry = previous == 0xc2;
+
+        for (; pos + 16 <= length; pos += 16) {
+            const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + pos));
+            const int high = _mm_movemask_epi8(input);
+            trails += __builtin_popcount(_mm_movemask_epi8(_mm_cmplt_epi8(input, trail)));
+
+            const unsigned int c2 = _mm_movemask_epi8(
+                _mm_cmpeq_epi8(input, _mm_set1_epi8(static_cast<char>(0xc2)))
+            );
+            const int c1 = ((c2 << 1) | carry) & _mm_movemask_epi8(_mm_cmplt_epi8(input, c1Limit));
+            carry = c2 >> 15;
+
+            const int control = _mm_movemask_epi8(_mm_or_si128(
+                _mm_cmplt_epi8(_mm_add_epi8(input, controlBias), controlLimit),
+                _mm_cmpeq_epi8(input, _mm_set1_epi8(0x7f))
+            ));
+            if (high != 0) {
+                seen |= SEEN_NON_ASCII;
+                // Signed, these leads are the negative bytes above the limit.
+                if (_mm_movemask_epi8(_mm_and_si128(_mm_cmpgt_epi8(input, nonLatin1), input))) {
+                    seen |= SEEN_NON_LATIN1;
+                }
+                if (_mm_movemask_epi8(_mm_and_si128(_mm_cmpgt_epi8(input, supplementary), input))) {
+                    seen |= SEEN_SUPPLEMENTARY;
+                }
+            }
+            if ((control | c1) != 0) {
+                seen |= SEEN_CONTROL;
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(input, _mm_setzero_si128()))) {
+                    seen |= SEEN_NUL;
+                }
+            }
+        }
+        if (pos != 0) {
+            previous = bytes[pos - 1];
+        }
+#endif
+
+        for (; pos < length; ++pos) {
+            const unsigned char byte = bytes[pos];
+            trails += (byte & 0xc0) == 0x80;
+            if (byte >= 0x80) {
+                seen |= SEEN_NON_ASCII;
+                seen |= byte >= 0xc4 ? SEEN_NON_LATIN1 : 0;
+                seen |= byte >= 0xf0 ? SEEN_SUPPLEMENTARY : 0;
+                seen |= previous == 0xc2 && byte < 0xa0 ? SEEN_CONTROL : 0;
+            } else if (byte < 0x20 || byte == 0x7f) {
+                seen |= SEEN_CONTROL;
+                seen |= byte == 0 ? SEEN_NUL : 0;
+            }
+            previous = byte;
+        }
+
+        codePoints += length - trails;
+        return seen;
+    }
+
+namespace scalar {
+    /*
+    ** @brief: Decodes one strictly valid (RFC 3629) utf8 sequence.
+    ** @param available: The number of bytes readable from 'bytes'.
+    ** @returns: The length of the sequence, or 0 if it is not valid utf8
+    **    (overlong forms, surrogates and values above U+10FFFF included).
+    */
+    inline int decodeUtf8Sequence(
+        const unsigned char* bytes,
+        std::size_t available,
+        uint32_t& codePoint
+    ) {
+        recordSlowDecode();
+        const uint32_t lead = bytes[0];
+
+        if (lead < 0x80) {
+            codePoint = lead;
+            return 1;
+        }
+
+        if (lead < 0xc2) {
+            return 0;
+        }
+
+        if (lead < 0xe0) {
+            if (available < 2 || (bytes[1] & 0xc0) != 0x80) {
+                return 0;
+            }
+            codePoint = ((lead & 0x1f) << 6) | (bytes[1] & 0x3f);
+            return 2;
+        }
+
+        if (lead < 0xf0) {
+            const uint32_t low = (lead == 0xe0) ? 0xa0 : 0x80;
+            const uint32_t high = (lead == 0xed) ? 0x9f : 0xbf;
+
+            if (available < 3 || bytes[1] < low || bytes[1] > high ||
+                (bytes[2] & 0xc0) != 0x80) {
+                return 0;
+            }
+            codePoint = ((lead & 0xf) << 12)
+                | (static_cast<uint32_t>(bytes[1] & 0x3f) << 6)
+                | (bytes[2] & 0x3f);
+            return 3;
+        }
+
+        if (lead < 0xf5) {
+            const uint32_t low = (lead == 0xf0) ? 0x90 : 0x80;
+            const uint32_t high = (lead == 0xf4) ? 0x8f : 0xbf;
+
+            if (available < 4 || bytes[1] < low || bytes[1] > high ||
+                (bytes[2] & 0xc0) != 0x80 || (bytes[3] & 0xc0) != 0x80) {
+                return 0;
+            }
+            codePoint = ((lead & 0x7) << 18)
+                | (static_cast<uint32_t>(bytes[1] & 0x3f) << 12)
+                | (static_cast<uint32_t>(bytes[2] & 0x3f) << 6)
+                | (bytes[3] & 0x3f);
+            return 4;
+        }
+
+        return 0;
+    }
+
+    /*
+    ** @brief: Encodes a scalar value (not a surrogate, at most U+10FFFF).
+    ** @returns: The number of bytes written to 'out'.
+    */
+    inline int encodeUtf8Sequence(uint32_t codePoint, char* out) {
+        if (codePoint < 0x80) {
+            out[0] = static_cast<char>(codePoint);
+            return 1;
+        }
+
+        if (codePoint < 0x800) {
+            out[0] = static_cast<char>(0xc0 | (codePoint >> 6));
+            out[1] = static_cast<char>(0x80 | (codePoint & 0x3f));
+            return 2;
+        }
+
+        if (codePoint < 0x10000) {
+            out[0] = static_cast<char>(0xe0 | (codePoint >> 12));
+            out[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+            out[2] = static_cast<char>(0x80 | (codePoint & 0x3f));
+            return 3;
+        }
+
+        out[0] = static_cast<char>(0xf0 | (codePoint >> 18));
+        out[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f));
+        out[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+        out[3] = static_cast<char>(0x80 | (codePoint & 0x3f));
+        return 4;
+    }
+
+    inline bool isScalarValue(uint32_t codePoint) {
+        return codePoint < 0x110000 && (codePoint & 0xfffff800) != 0xd800;
+    }
+
+    /*
+    ** @returns: The offset of the first invalid sequence, or 'length' if the
+    **    input is valid utf8.
+    */
+    inline std::size_t validateUtf8(
+        const unsigned char* bytes,
+        std::size_t length
+    ) {
+        std::size_t pos = 0;
+        std::size_t asciiBytes = 0;
+
+        while (pos < length) {
+            if (pos + 8 <= length && isAsciiWord(bytes + pos)) {
+                pos += 8;
+                asciiBytes += 8;
+                continue;
+            }
+
+            uint32_t codePoint;
+            const int size = decodeUtf8Sequence(
+                bytes + pos, length - pos, codePoint
+            );
+            if (size == 0) {
+                recordAsciiFastPath(asciiBytes);
+                return pos;
+            }
+            pos += size;
+        }
+
+        recordAsciiFastPath(asciiBytes);
+        return length;
+    }
+
+    /*
+    ** @brief: Validates and hashes the input in 1 KiB blocks, so that each
+    **    block is hashed while it is still in cache from being validated.
+    ** @param hash: Receives the hash if the input is valid.
+    ** @returns: The offset of the first invalid sequence, or 'length'.
+    */
+    inline std::size_t validateAndHashUtf8(
+        const unsigned char* bytes,
+        std::size_t length,
+        uint64_t& hash
+    ) {
+        constexpr std::size_t blockBytes = HASH_STRIPE_BYTES * HASH_STRIPES_PER_SCRAMBLE;
+
+        uint64_t lanes[8];
+        beginHash(lanes);
+        std::size_t pos = 0;
+        std::size_t checked = 0;
+
+        for (; length - pos >= blockBytes; pos += blockBytes) {
+            // A sequence may run up to three bytes past the block; one that
+            // only starts there is left for the next block.
+            const std::size_t end = pos + blockBytes;
+            const std::size_t window = length - end > 3 ? end + 3 : length;
+            checked += validateUtf8(bytes + checked, window - checked);
+            if (checked < end) {
+                return checked;
+            }
+            hashStripes(lanes, bytes + pos, HASH_STRIPES_PER_SCRAMBLE);
+        }
+
+        checked += validateUtf8(bytes + checked, length - checked);
+        if (checked != length) {
+            return checked;
+        }
+
+        const std::size_t stripes = (length - pos) / HASH_STRIPE_BYTES;
+        hashStripes(lanes, bytes + pos, stripes);
+        hashPartialStripe(lanes, bytes + pos + stripes * HASH_STRIPE_BYTES, length % HASH_STRIPE_BYTES);
+        hash = finishHash(lanes, length);
+        return length;
+    }
+
+    /*
+    ** @brief: Validates and classifies the input in 1 KiB blocks, so that
+    **    each block is classified while it is still in cache.
+    ** @param seen: Receives the SEEN_* bits of the input, or of its valid
+    **    part if it is invalid.
+    ** @param codePoints: Receives the number of code points, likewise.
+    ** @returns: The offset of the first invalid sequence, or 'length'.
+    */
+    inline std::size_t classifyUtf8(
+        const unsigned char* bytes,
+        std::size_t length,
+        uint32_t& seen,
+        std::size_t& codePoints
+    ) {
+        constexpr std::size_t blockBytes = 1024;
+
+        seen = 0;
+        codePoints = 0;
+        std::size_t pos = 0;
+        std::size_t checked = 0;
+
+        while (pos < length) {
+            const std::size_t end = length - pos > blockBytes ? pos + blockBytes : length;
+            const std::size_t window = length - end > 3 ? end + 3 : length;
+            checked += validateUtf8(bytes + checked, window - checked);
+
+            // A sequence that only starts past the block is left for the
+            // next one.
+            const std::size_t valid = checked < end ? checked : end;
+            seen |= classifyBytes(bytes + pos, valid - pos, pos != 0 ? bytes[pos - 1] : 0, codePoints);
+            if (checked < end) {
+                return checked;
+            }
+            pos = end;
+        }
+
+        return length;
+    }
+
+    template <typename Char32T>
+    TranscodeResult convertUtf8ToUtf32(
+        const unsigned char* bytes,
+        std::size_t length,
+        Char32T* out
+    ) {
+        std::size_t pos = 0;
+        std::size_t written = 0;
+
+        while (pos < length) {
+            uint32_t codePoint;
+            const int size = decodeUtf8Sequence(
+                bytes + pos, length - pos, codePoint
+            );
+            if (size == 0) {
+                return {false, pos, written};
+            }
+            out[written++] = static_cast<Char32T>(codePoint);
+            pos += size;
+        }
+
+        return {true, pos, written};
+    }
+
+    template <typename Char16T>
+    TranscodeResult convertUtf8ToUtf16(
+        const unsigned char* bytes,
+        std::size_t length,
+        Char16T* out
+    ) {
+        std::size_t pos = 0;
+        std::size_t written = 0;
+
+        while (pos < length) {
+            uint32_t codePoint;
+            const int size = decodeUtf8Sequence(
+                bytes + pos, length - pos, codePoint
+            );
+            if (size == 0) {
+                return {false, pos, written};
+            }
+
+            if (codePoint < 0x10000) {
+                out[written++] = static_cast<Char16T>(codePoint);
+            } else {
+                codePoint -= 0x10000;
+                out[written++] = static_cast<Char16T>(0xd800 | (codePoint >> 10));
+                out[written++] = static_cast<Char16T>(0xdc00 | (codePoint & 0x3ff));
+            }
+            pos += size;
+        }
+
+        return {true, pos, written};
+    }
+
+    template <typename Char32T>
+    TranscodeResult convertUtf32ToUtf8(
+        const Char32T* units,
+        std::size_t length,
+        char* out
+    ) {
+        std::size_t written = 0;
+
+        for (std::size_t pos = 0; pos < length; ++pos) {
+            const uint32_t codePoint = static_cast<uint32_t>(units[pos]);
+            if (not isScalarValue(codePoint)) {
+                return {false, pos, written};
+            }
+            written += encodeUtf8Sequence(codePoint, out + written);
+        }
+
+        return {true, length, written};
+    }
+
+    /*
+    ** @brief: Encodes the utf16 character starting at 'units[pos]'.
+    ** @returns: The number of units consumed (1 or 2), or 0 if 'units[pos]'
+    **    is an unpaired surrogate.
+    */
+    template <typename Char16T>
+    int encodeUtf16Unit(
+        const Char16T* units,
+        std::size_t pos,
+        std::size_t length,
+        char* out,
+        std::size_t& written
+    ) {
+        const uint32_t unit = static_cast<uint16_t>(units[pos]);
+
+        if ((unit & 0xf800) != 0xd800) {
+            written += encodeUtf8Sequence(unit, out + written);
+            return 1;
+        }
+
+        if (unit >= 0xdc00 || pos + 1 >= length) {
+            return 0;
+        }
+
+        const uint32_t next = static_cast<uint16_t>(units[pos + 1]);
+        if ((next & 0xfc00) != 0xdc00) {
+            return 0;
+        }
+
+        const uint32_t codePoint = 0x10000 + ((unit - 0xd800) << 10) + (next - 0xdc00);
+        written += encodeUtf8Sequence(codePoint, out + written);
+        return 2;
+    }
+
+    template <typename Char16T>
+    TranscodeResult convertUtf16ToUtf8(
+        const Char16T* units,
+        std::size_t length,
+        char* out
+    ) {
+        std::size_t pos = 0;
+        std::size_t written = 0;
+
+        while (pos < length) {
+            const int consumed = encodeUtf16Unit(units, pos, length, out, written);
+            if (consumed == 0) {
+                return {false, pos, written};
+            }
+            pos += consumed;
+        }
+
+        return {true, pos, written};
+    }
+    inline std::size_t convertLatin1ToUtf8(
+        const unsigned char* bytes,
+        std::size_t length,
+        char* out
+    ) {
+        std::size_t pos = 0;
+        std::size_t written = 0;
+
+        while (pos < length) {
+            if (pos + 8 <= length && isAsciiWord(bytes + pos)) {
+                const std::size_t run = asciiPrefixLength(bytes + pos, length - pos);
+                std::memcpy(out + written, bytes + pos, run);
+                pos += run;
+                written += run;
+                continue;
+            }
+
+            const unsigned char byte = bytes[pos++];
+            if (byte < 0x80) {
+                out[written++] = static_cast<char>(byte);
+            } else {
+                out[written++] = static_cast<char>(0xc0 | (byte >> 6));
+                out[written++] = static_cast<char>(0x80 | (byte & 0x3f));
+            }
+        }
+
+        return written;
+    }
+
+    /*
+    ** @brief: Converts the utf8 sequence at 'bytes[pos]' to a latin1 byte.
+    ** @param lossy: Whether sequences that are invalid, or that encode a value
+    **    above U+00FF, are replaced with '?' (skipping one byte of an invalid
+    **    sequence) instead of stopping the conversion.
+    ** @returns: false if the sequence cannot be converted.
+    */
+    inline bool convertUtf8ToLatin1Step(
+        const unsigned char* bytes,
+        std::size_t length,
+        std::size_t& pos,
+        char* out,
+        std::size_t& written,
+        bool lossy
+    ) {
+        uint32_t codePoint;
+        const int size = decodeUtf8Sequence(bytes + pos, length - pos, codePoint);
+
+        if (size != 0 && codePoint < 0x100) {
+            out[written++] = static_cast<char>(codePoint);
+            pos += size;
+            return true;
+        }
+
+        if (not lossy) {
+            return false;
+        }
+
+        out[written++] = '?';
+        pos += size != 0 ? size : 1;
+        return true;
+    }
+
+    inline TranscodeResult convertUtf8ToLatin1(
+        const unsigned char* bytes,
+        std::size_t length,
+        char* out,
+        bool lossy
+    ) {
+        std::size_t pos = 0;
+        std::size_t written = 0;
+
+        while (pos < length) {
+            if (pos + 8 <= length && isAsciiWord(bytes + pos)) {
+                const std::size_t run = asciiPrefixLength(bytes + pos, length - pos);
+                std::memcpy(out + written, bytes + pos, run);
+                pos += run;
+                written += run;
+                continue;
+            }
+
+            if (not convertUtf8ToLatin1Step(bytes, length, pos, out, written, lossy)) {
+                return {false, pos, written};
+            }
+        }
+
+        return {true, pos, written};
+    }
+} // namespace scalar
+
+#if defined(GC_UTF8_AVX512)
+// GCC 12's intrinsics fill unused lanes from a self-initialised variable,
+// which -Wmaybe-uninitialized (or -Wuninitialized, when building with
+// sanitizers) reports at every inlined call.
+#if defined(__GNUC__) && !defined(__clang__)
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#   pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+namespace avx512 {
+    /*
+    ** The validator is the lookup algorithm of Keiser and Lemire ("Validating
+    ** UTF-8 In Less Than One Instruction Per Byte"): three nibble lookups
+    ** classify every pair of adjacent bytes, and a saturating subtraction
+    ** checks that the third and fourth bytes of long sequences are
+    ** continuations. 64 bytes are checked per step.
+    */
+    inline __m512i lookup16(__m512i nibbles, __m128i table) {
+        return _mm512_shuffle_epi8(_mm512_maskz_broadcast_i32x4(0xffff, table), nibbles);
+    }
+
+    /*
+    ** @brief: Shifts 'input' up by 'count' bytes, filling in from the end of
+    **    'previous'.
+    */
+    inline __m512i prevBytes(__m512i input, __m512i previous, int count) {
+        const __m512i index = _mm512_add_epi8(
+            _mm512_set_epi8(
+                63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48,
+                47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32,
+                31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16,
+                15, 14, 13, 12, 11, 10,  9,  8,  7,  6,  5,  4,  3,  2,  1,  0
+            ),
+            _mm512_set1_epi8(static_cast<char>(64 - count))
+        );
+        return _mm512_permutex2var_epi8(previous, index, input);
+    }
+
+    struct Utf8Checker {
+        __m512i error = _mm512_setzero_si512();
+        __m512i previousInput = _mm512_setzero_si512();
+        __m512i previousIncomplete = _mm512_setzero_si512();
+
+        /*
+        ** @param inRange: One bit per byte of the block that is input rather
+        **    than padding.
+        */
+        void check(__m512i input, uint64_t inRange) {
+            if (_mm512_movepi8_mask(input) == 0) {
+                recordAsciiFastPath(__builtin_popcountll(inRange));
+                error = _mm512_or_si512(error, previousIncomplete);
+                previousIncomplete = _mm512_setzero_si512();
+                previousInput = input;
+                return;
+            }
+
+            const uint8_t TOO_SHORT = 1 << 0;
+            const uint8_t TOO_LONG = 1 << 1;
+            const uint8_t OVERLONG_3 = 1 << 2;
+            const uint8_t TOO_LARGE = 1 << 3;
+            const uint8_t SURROGATE = 1 << 4;
+            const uint8_t OVERLONG_2 = 1 << 5;
+            const uint8_t TOO_LARGE_1000 = 1 << 6;
+            const uint8_t OVERLONG_4 = 1 << 6;
+            const uint8_t TWO_CONTS = 1 << 7;
+            const uint8_t CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+            const __m512i lowNibble = _mm512_set1_epi8(0x0f);
+            const __m512i prev1 = prevBytes(input, previousInput, 1);
+
+            const __m512i byte1High = lookup16(
+                _mm512_and_si512(_mm512_srli_epi16(prev1, 4), lowNibble),
+                _mm_setr_epi8(
+                    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+                    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+                    TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+                    TOO_SHORT | OVERLONG_2,
+                    TOO_SHORT,
+                    TOO_SHORT | OVERLONG_3 | SURROGATE,
+                    static_cast<char>(TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4)
+                )
+            );
+
+            const __m512i byte1Low = lookup16(
+                _mm512_and_si512(prev1, lowNibble),
+                _mm_setr_epi8(
+                    static_cast<char>(CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4),
+                    static_cast<char>(CARRY | OVERLONG_2),
+                    static_cast<char>(CARRY),
+                    static_cast<char>(CARRY),
+                    static_cast<char>(CARRY | TOO_LARGE),
+                    static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+                    static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+                    static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+                    static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+                    static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+                    static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+                    static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+                    static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+                    static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE),
+                    static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000),
+                    static_cast<char>(CARRY | TOO_LARGE | TOO_LARGE_1000)
+                )
+            );
+
+            const __m512i byte2High = lookup16(
+                _mm512_and_si512(_mm512_srli_epi16(input, 4), lowNibble),
+                _mm_setr_epi8(
+                    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+                    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+                    static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4),
+                    static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE),
+                    static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE),
+                    static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE),
+                    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+                )
+            );
+
+            const __m512i special = _mm512_and_si512(
+                _mm512_and_si512(byte1High, byte1Low), byte2High
+            );
+
+            const __m512i prev2 = prevBytes(input, previousInput, 2);
+            const __m512i prev3 = prevBytes(input, previousInput, 3);
+            const __m512i mustBeContinuation = _mm512_and_si512(
+                _mm512_or_si512(
+                    _mm512_subs_epu8(prev2, _mm512_set1_epi8(static_cast<char>(0xe0 - 0x80))),
+                    _mm512_subs_epu8(prev3, _mm512_set1_epi8(static_cast<char>(0xf0 - 0x80)))
+                ),
+                _mm512_set1_epi8(static_cast<char>(0x80))
+            );
+
+            error = _mm512_or_si512(
+                error, _mm512_xor_si512(mustBeContinuation, special)
+            );
+
+            // Non-zero if one of the last three bytes leads a sequence that
+            // the next block has to finish: a lead of two or more bytes in
+            // byte 63, of three or more in byte 62, of four in byte 61.
+            previousIncomplete = _mm512_subs_epu8(
+                input,
+                _mm512_set_epi32(
+                    static_cast<int>(0xbfdfefff), -1, -1, -1, -1, -1, -1, -1,
+                    -1, -1, -1, -1, -1, -1, -1, -1
+                )
+            );
+            previousInput = input;
+        }
+
+        bool hasError() const {
+            return _mm512_test_epi8_mask(error, error) != 0;
+        }
+    };
+
+    inline uint64_t blockMask(std::size_t remaining) {
+        return remaining >= 64 ? ~0ull : ((1ull << remaining) - 1);
+    }
+
+    /*
+    ** @brief: Finds where a scalar rescan has to start after the block at
+    **    'blockStart' failed: the lead byte of a sequence that straddles the
+    **    block boundary, or the boundary itself.
+    ** @returns: The number of bytes to step back (0 to 3).
+    */
+    inline std::size_t straddlingLeadOffset(
+        const unsigned char* bytes,
+        std::size_t blockStart
+    ) {
+        for (std::size_t back = 1; back <= 3 && back <= blockStart; ++back) {
+            const unsigned char byte = bytes[blockStart - back];
+            if ((byte & 0xc0) == 0x80) {
+                continue;
+            }
+            if (byte >= 0xc0 && static_cast<std::size_t>(
+                    byte >= 0xf0 ? 4 : byte >= 0xe0 ? 3 : 2) > back) {
+                return back;
+            }
+            return 0;
+        }
+        return 0;
+    }
+
+    inline std::size_t validateUtf8(
+        const unsigned char* bytes,
+        std::size_t length
+    ) {
+        Utf8Checker checker;
+        std::size_t pos = 0;
+
+        // The final (possibly empty) block is zero-padded by the masked load,
+        // which flags any sequence truncated by the end of the input.
+        for (;;) {
+            const uint64_t inRange = blockMask(length - pos);
+            const __m512i input = _mm512_maskz_loadu_epi8(inRange, bytes + pos);
+            checker.check(input, inRange);
+            if (checker.hasError()) {
+                const std::size_t start = pos - straddlingLeadOffset(bytes, pos);
+                return start + scalar::validateUtf8(bytes + start, length - start);
+            }
+            if (length - pos < 64) {
+                return length;
+            }
+            pos += 64;
+        }
+    }
+
+    inline __m512i hashStripe(__m512i lanes, __m512i input, __m512i key) {
+        const __m512i keyed = _mm512_xor_si512(input, key);
+        const __m512i product = _mm512_mul_epu32(keyed, _mm512_srli_epi64(keyed, 32));
+        const __m512i swapped = _mm512_shuffle_epi32(input, _MM_PERM_BADC);
+        return _mm512_add_epi64(lanes, _mm512_add_epi64(product, swapped));
+    }
+
+    inline __m512i scrambleHash(__m512i lanes, __m512i seed) {
+        const __m512i prime = _mm512_set1_epi64(static_cast<long long>(HASH_PRIME32));
+        const __m512i value = _mm512_xor_si512(
+            _mm512_xor_si512(lanes, _mm512_srli_epi64(lanes, 47)), seed
+        );
+        // There is no 64-bit multiply without AVX512DQ, but the prime fits
+        // in 32 bits, so two 32x32 products make up the low 64 bits.
+        const __m512i low = _mm512_mul_epu32(value, prime);
+        const __m512i high = _mm512_mul_epu32(_mm512_srli_epi64(value, 32), prime);
+        return _mm512_add_epi64(low, _mm512_slli_epi64(high, 32));
+    }
+
+    /*
+    ** @brief: Validates the input and hashes the same blocks as they go
+    **    through the checker, so the bytes are read from memory once.
+    ** @param hash: Receives the hash if the input is valid.
+    ** @returns: The offset of the first invalid sequence, or 'length'.
+    */
+    inline std::size_t validateAndHashUtf8(
+        const unsigned char* bytes,
+        std::size_t length,
+        uint64_t& hash
+    ) {
+        const __m512i key = _mm512_loadu_si512(HASH_KEY);
+        const __m512i seed = _mm512_loadu_si512(HASH_SEED);
+        __m512i lanes = seed;
+        Utf8Checker checker;
+        std::size_t pos = 0;
+        std::size_t stripes = 0;
+
+        for (;;) {
+            const std::size_t remaining = length - pos;
+            const uint64_t inRange = blockMask(remaining);
+            const __m512i input = _mm512_maskz_loadu_epi8(inRange, bytes + pos);
+            checker.check(input, inRange);
+            if (checker.hasError()) {
+                const std::size_t start = pos - straddlingLeadOffset(bytes, pos);
+                return start + scalar::validateUtf8(bytes + start, length - start);
+            }
+            if (remaining != 0) {
+                lanes = hashStripe(lanes, input, key);
+            }
+            if (remaining < 64) {
+                break;
+            }
+            if (++stripes % HASH_STRIPES_PER_SCRAMBLE == 0) {
+                lanes = scrambleHash(lanes, seed);
+            }
+            pos += 64;
+        }
+
+        // The masked load has already hashed the partial stripe zero-padded.
+        uint64_t words[8];
+        _mm512_storeu_si512(words, lanes);
+        hash = finishHash(words, length);
+        return length;
+    }
+
+    /*
+    ** @brief: Validates and classifies the input in one pass, testing the
+    **    blocks the checker has loaded.
+    ** @param seen: Receives the SEEN_* bits of the input, or of its valid
+    **    part if it is invalid.
+    ** @param codePoints: Receives the number of code points, likewise.
+    ** @returns: The offset of the first invalid sequence, or 'length'.
+    */
+    inline std::size_t classifyUtf8(
+        const unsigned char* bytes,
+        std::size_t length,
+        uint32_t& seen,
+        std::size_t& codePoints
+    ) {
+        const __m512i c2 = _mm512_set1_epi8(static_cast<char>(0xc2));
+        const __m512i nonLatin1 = _mm512_set1_epi8(static_cast<char>(0xc4));
+        const __m512i supplementary = _mm512_set1_epi8(static_cast<char>(0xf0));
+        const __m512i controlLimit = _mm512_set1_epi8(0x20);
+        const __m512i c1Limit = _mm512_set1_epi8(static_cast<char>(0xa0));
+        const __m512i deleteControl = _mm512_set1_epi8(0x7f);
+        const __m512i trail = _mm512_set1_epi8(static_cast<char>(0xc0));
+
+        Utf8Checker checker;
+        std::size_t pos = 0;
+        std::size_t trails = 0;
+        uint64_t high = 0;
+        uint64_t beyondLatin1 = 0;
+        uint64_t beyondBmp = 0;
+        uint64_t controls = 0;
+        uint64_t nuls = 0;
+        uint64_t carry = 0;
+
+        for (;;) {
+            const std::size_t remaining = length - pos;
+            const uint64_t inRange = blockMask(remaining);
+            const __m512i input = _mm512_maskz_loadu_epi8(inRange, bytes + pos);
+            checker.check(input, inRange);
+            if (checker.hasError()) {
+                // Classify what comes before the error again, which is rare
+                // enough not to be worth tracking block by block.
+                const std::size_t start = pos - straddlingLeadOffset(bytes, pos);
+                const std::size_t offset = start + scalar::validateUtf8(bytes + start, length - start);
+                codePoints = 0;
+                seen = classifyBytes(bytes, offset, 0, codePoints);
+                return offset;
+            }
+
+            const uint64_t signs = _mm512_movepi8_mask(input);
+            high |= signs;
+            beyondLatin1 |= _mm512_cmpge_epu8_mask(input, nonLatin1);
+            beyondBmp |= _mm512_cmpge_epu8_mask(input, supplementary);
+            trails += __builtin_popcountll(_mm512_cmplt_epi8_mask(input, trail));
+
+            // The padding past the end reads as NULs, hence the mask.
+            const uint64_t leadC2 = _mm512_cmpeq_epi8_mask(input, c2);
+            nuls |= _mm512_cmpeq_epi8_mask(input, _mm512_setzero_si512()) & inRange;
+            controls |= (_mm512_cmplt_epu8_mask(input, controlLimit) & inRange) |
+                _mm512_cmpeq_epi8_mask(input, deleteControl) |
+                (((leadC2 << 1) | carry) & _mm512_cmplt_epu8_mask(input, c1Limit) & signs);
+            carry = leadC2 >> 63;
+
+            if (remaining < 64) {
+                break;
+            }
+            pos += 64;
+        }
+
+        seen = (high ? SEEN_NON_ASCII : 0) |
+            (beyondLatin1 ? SEEN_NON_LATIN1 : 0) |
+            (beyondBmp ? SEEN_SUPPLEMENTARY : 0) |
+            (controls ? SEEN_CONTROL : 0) |
+            (nuls ? SEEN_NUL : 0);
+        codePoints = length - trails;
+        return length;
+    }
+
+    /*
+    ** @brief: Decodes the sequences that start in the 16 bytes at 'bytes'.
+    ** @param leads: One bit per byte that starts a sequence.
+    ** @param available: The number of bytes readable from 'bytes'.
+    ** @returns: The code points, in the low lanes, in input order.
+    */
+    inline __m512i decodeWindow(
+        const unsigned char* bytes,
+        std::size_t available,
+        __mmask16 leads
+    ) {
+        const __m512i source = _mm512_maskz_loadu_epi8(
+            blockMask(available < 19 ? available : 19), bytes
+        );
+        // Lane i holds bytes i to i + 3.
+        const __m512i gathered = _mm512_permutexvar_epi8(
+            _mm512_set_epi8(
+                18, 17, 16, 15, 17, 16, 15, 14, 16, 15, 14, 13, 15, 14, 13, 12,
+                14, 13, 12, 11, 13, 12, 11, 10, 12, 11, 10,  9, 11, 10,  9,  8,
+                10,  9,  8,  7,  9,  8,  7,  6,  8,  7,  6,  5,  7,  6,  5,  4,
+                 6,  5,  4,  3,  5,  4,  3,  2,  4,  3,  2,  1,  3,  2,  1,  0
+            ),
+            source
+        );
+
+        const __m512i byteMask = _mm512_set1_epi32(0xff);
+        const __m512i payload = _mm512_set1_epi32(0x3f);
+        const __m512i b0 = _mm512_and_si512(gathered, byteMask);
+        const __m512i b1 = _mm512_and_si512(_mm512_srli_epi32(gathered, 8), payload);
+        const __m512i b2 = _mm512_and_si512(_mm512_srli_epi32(gathered, 16), payload);
+        const __m512i b3 = _mm512_and_si512(_mm512_srli_epi32(gathered, 24), payload);
+
+        const __m512i two = _mm512_or_si512(
+            _mm512_slli_epi32(_mm512_and_si512(b0, _mm512_set1_epi32(0x1f)), 6), b1
+        );
+        const __m512i three = _mm512_or_si512(
+            _mm512_or_si512(
+                _mm512_slli_epi32(_mm512_and_si512(b0, _mm512_set1_epi32(0x0f)), 12),
+                _mm512_slli_epi32(b1, 6)
+            ),
+            b2
+        );
+        const __m512i four = _mm512_or_si512(
+            _mm512_or_si512(
+                _mm512_slli_epi32(_mm512_and_si512(b0, _mm512_set1_epi32(0x07)), 18),
+                _mm512_slli_epi32(b1, 12)
+            ),
+            _mm512_or_si512(_mm512_slli_epi32(b2, 6), b3)
+        );
+
+        __m512i codePoints = b0;
+        codePoints = _mm512_mask_mov_epi32(
+            codePoints, _mm512_cmpge_epu32_mask(b0, _mm512_set1_epi32(0xc0)), two
+        );
+        codePoints = _mm512_mask_mov_epi32(
+            codePoints, _mm512_cmpge_epu32_mask(b0, _mm512_set1_epi32(0xe0)), three
+        );
+        codePoints = _mm512_mask_mov_epi32(
+            codePoints, _mm512_cmpge_epu32_mask(b0, _mm512_set1_epi32(0xf0)), four
+        );
+
+        return _mm512_maskz_compress_epi32(leads, codePoints);
+    }
+
+    inline uint64_t leadMask(__m512i input, uint64_t inRange) {
+        const uint64_t continuations = _mm512_cmpeq_epi8_mask(
+            _mm512_and_si512(input, _mm512_set1_epi8(static_cast<char>(0xc0))),
+            _mm512_set1_epi8(static_cast<char>(0x80))
+        );
+        return ~continuations & inRange;
+    }
+
+    /*
+    ** @brief: Restarts a failed block with the scalar kernel, from the lead
+    **    byte of any sequence that straddles the block boundary.
+    */
+    template <typename CharT, typename ScalarKernelT>
+    TranscodeResult rescanUtf8(
+        const unsigned char* bytes,
+        std::size_t length,
+        std::size_t pos,
+        CharT* out,
+        std::size_t written,
+        ScalarKernelT kernel
+    ) {
+        const std::size_t back = straddlingLeadOffset(bytes, pos);
+        const std::size_t start = pos - back;
+
+        if (back != 0) {
+            // Mirror 'decodeWindow': a four-byte lead produced a surrogate
+            // pair exactly when the value it decoded to is above U+FFFF.
+            const unsigned char lead = bytes[start];
+            const unsigned char next = (start + 1 < length) ? bytes[start + 1] : 0;
+            const bool pair = sizeof(CharT) == 2 && lead >= 0xf0 &&
+                ((lead & 0x7) != 0 || (next & 0x30) != 0);
+            written -= pair ? 2 : 1;
+        }
+
+        const TranscodeResult result = kernel(
+            bytes + start, length - start, out + written
+        );
+        return {result.ok, start + result.read, written + result.written};
+    }
+
+    template <typename Char32T>
+    TranscodeResult convertUtf8ToUtf32(
+        const unsigned char* bytes,
+        std::size_t length,
+        Char32T* out
+    ) {
+        static_assert(sizeof(Char32T) == 4, "expected 32-bit code units");
+
+        Utf8Checker checker;
+        std::size_t pos = 0;
+        std::size_t written = 0;
+
+        for (;;) {
+            const std::size_t remaining = length - pos;
+            const uint64_t inRange = blockMask(remaining);
+            const __m512i input = _mm512_maskz_loadu_epi8(inRange, bytes + pos);
+
+            checker.check(input, inRange);
+            if (checker.hasError()) {
+                return rescanUtf8(bytes, length, pos, out, written,
+                    scalar::convertUtf8ToUtf32<Char32T>);
+            }
+
+            if (_mm512_movepi8_mask(input) == 0) {
+                const __m128i parts[4] = {
+                    _mm512_extracti32x4_epi32(input, 0),
+                    _mm512_extracti32x4_epi32(input, 1),
+                    _mm512_extracti32x4_epi32(input, 2),
+                    _mm512_extracti32x4_epi32(input, 3)
+                };
+                for (int part = 0; part < 4; ++part) {
+                    _mm512_mask_storeu_epi32(
+                        out + written + 16 * part,
+                        static_cast<__mmask16>(inRange >> (16 * part)),
+                        _mm512_cvtepu8_epi32(parts[part])
+                    );
+                }
+                written += __builtin_popcountll(inRange);
+            } else {
+                const uint64_t leads = leadMask(input, inRange);
+                for (std::size_t window = 0; window < 64 && window < remaining; window += 16) {
+                    const __mmask16 windowLeads = static_cast<__mmask16>(leads >> window);
+                    _mm512_mask_storeu_epi32(
+                        out + written,
+                        static_cast<__mmask16>((1u << __builtin_popcount(windowLeads)) - 1),
+                        decodeWindow(bytes + pos + window, remaining - window, windowLeads)
+                    );
+                    written += __builtin_popcount(windowLeads);
+                }
+            }
+
+            // A full final block is followed by an empty one, so that a
+            // sequence cut off by the end of the input is reported.
+            if (remaining < 64) {
+                return {true, length, written};
+            }
+            pos += 64;
+        }
+    }
+
+    template <typename Char16T>
+    TranscodeResult convertUtf8ToUtf16(
+        const unsigned char* bytes,
+        std::size_t length,
+        Char16T* out
+    ) {
+        static_assert(sizeof(Char16T) == 2, "expected 16-bit code units");
+
+        Utf8Checker checker;
+        std::size_t pos = 0;
+        std::size_t written = 0;
+
+        for (;;) {
+            const std::size_t remaining = length - pos;
+            const uint64_t inRange = blockMask(remaining);
+            const __m512i input = _mm512_maskz_loadu_epi8(inRange, bytes + pos);
+
+            checker.check(input, inRange);
+            if (checker.hasError()) {
+                return rescanUtf8(bytes, length, pos, out, written,
+                    scalar::convertUtf8ToUtf16<Char16T>);
+            }
+
+            if (_mm512_movepi8_mask(input) == 0) {
+                _mm512_mask_storeu_epi16(
+                    out + written,
+                    static_cast<__mmask32>(inRange),
+                    _mm512_cvtepu8_epi16(_mm512_castsi512_si256(input))
+                );
+                _mm512_mask_storeu_epi16(
+                    out + written + 32,
+                    static_cast<__mmask32>(inRange >> 32),
+                    _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(input, 1))
+                );
+                written += __builtin_popcountll(inRange);
+            } else {
+                const uint64_t leads = leadMask(input, inRange);
+                for (std::size_t window = 0; window < 64 && window < remaining; window += 16) {
+                    const __mmask16 windowLeads = static_cast<__mmask16>(leads >> window);
+                    const int count = __builtin_popcount(windowLeads);
+                    const __mmask16 produced = static_cast<__mmask16>((1u << count) - 1);
+                    const __m512i codePoints = decodeWindow(
+                        bytes + pos + window, remaining - window, windowLeads
+                    );
+
+                    if ((_mm512_cmpge_epu32_mask(codePoints, _mm512_set1_epi32(0x10000)) & produced) == 0) {
+                        _mm256_mask_storeu_epi16(
+                            out + written, produced, _mm512_cvtepi32_epi16(codePoints)
+                        );
+                        written += count;
+                        continue;
+                    }
+
+                    uint32_t decoded[16];
+                    _mm512_storeu_si512(decoded, codePoints);
+                    for (int index = 0; index < count; ++index) {
+                        uint32_t codePoint = decoded[index];
+                        if (codePoint < 0x10000) {
+                            out[written++] = static_cast<Char16T>(codePoint);
+                        } else {
+                            codePoint -= 0x10000;
+                            out[written++] = static_cast<Char16T>(0xd800 | (codePoint >> 10));
+                            out[written++] = static_cast<Char16T>(0xdc00 | (codePoint & 0x3ff));
+                        }
+                    }
+                }
+            }
+
+            if (remaining < 64) {
+                return {true, length, written};
+            }
+            pos += 64;
+        }
+    }
+
+    /*
+    ** @brief: Encodes 16 scalar values (one per 32-bit lane) as utf8.
+    ** @param count: The number of lanes to encode.
+    ** @param last: Whether these are the final values of the input, in which
+    **    case nothing may be written past the encoded bytes.
+    ** @returns: The number of bytes written.
+    */
+    inline std::size_t encodeWindow(
+        __m512i codePoints,
+        int count,
+        bool last,
+        char* out
+    ) {
+        const __m512i payload = _mm512_set1_epi32(0x3f);
+        const __m512i marker = _mm512_set1_epi32(0x80);
+        const __m512i tail0 = _mm512_or_si512(marker, _mm512_and_si512(codePoints, payload));
+        const __m512i tail6 = _mm512_or_si512(
+            marker, _mm512_and_si512(_mm512_srli_epi32(codePoints, 6), payload)
+        );
+        const __m512i tail12 = _mm512_or_si512(
+            marker, _mm512_and_si512(_mm512_srli_epi32(codePoints, 12), payload)
+        );
+
+        // Byte 0 of a lane is the first byte of its sequence.
+        const __m512i two = _mm512_or_si512(
+            _mm512_or_si512(_mm512_set1_epi32(0xc0), _mm512_srli_epi32(codePoints, 6)),
+            _mm512_slli_epi32(tail0, 8)
+        );
+        const __m512i three = _mm512_or_si512(
+            _mm512_or_si512(_mm512_set1_epi32(0xe0), _mm512_srli_epi32(codePoints, 12)),
+            _mm512_or_si512(_mm512_slli_epi32(tail6, 8), _mm512_slli_epi32(tail0, 16))
+        );
+        const __m512i four = _mm512_or_si512(
+            _mm512_or_si512(
+                _mm512_or_si512(_mm512_set1_epi32(0xf0), _mm512_srli_epi32(codePoints, 18)),
+                _mm512_slli_epi32(tail12, 8)
+            ),
+            _mm512_or_si512(_mm512_slli_epi32(tail6, 16), _mm512_slli_epi32(tail0, 24))
+        );
+
+        const __mmask16 lanes = static_cast<__mmask16>((1u << count) - 1);
+        const __mmask16 atLeast2 = _mm512_mask_cmpge_epu32_mask(lanes, codePoints, _mm512_set1_epi32(0x80));
+        const __mmask16 atLeast3 = _mm512_mask_cmpge_epu32_mask(lanes, codePoints, _mm512_set1_epi32(0x800));
+        const __mmask16 atLeast4 = _mm512_mask_cmpge_epu32_mask(lanes, codePoints, _mm512_set1_epi32(0x10000));
+
+        __m512i encoded = codePoints;
+        encoded = _mm512_mask_mov_epi32(encoded, atLeast2, two);
+        encoded = _mm512_mask_mov_epi32(encoded, atLeast3, three);
+        encoded = _mm512_mask_mov_epi32(encoded, atLeast4, four);
+
+        const __m512i one = _mm512_set1_epi32(1);
+        __m512i lengths = _mm512_maskz_mov_epi32(lanes, one);
+        lengths = _mm512_mask_add_epi32(lengths, atLeast2, lengths, one);
+        lengths = _mm512_mask_add_epi32(lengths, atLeast3, lengths, one);
+        lengths = _mm512_mask_add_epi32(lengths, atLeast4, lengths, one);
+
+#if defined(__AVX512VBMI2__)
+        (void)last;
+        const __mmask64 keep = _mm512_cmplt_epu8_mask(
+            _mm512_set1_epi32(0x03020100),
+            _mm512_mullo_epi32(lengths, _mm512_set1_epi32(0x01010101))
+        );
+        _mm512_mask_compressstoreu_epi8(out, keep, encoded);
+        return __builtin_popcountll(keep);
+#else
+        uint32_t sequences[16];
+        uint32_t sizes[16];
+        _mm512_storeu_si512(sequences, encoded);
+        _mm512_storeu_si512(sizes, lengths);
+
+        // Each lane stores all four bytes; the surplus is overwritten by the
+        // next lane, which keeps the copies fixed-size.
+        std::size_t written = 0;
+        const int wide = last ? count - 1 : count;
+        for (int index = 0; index < wide; ++index) {
+            std::memcpy(out + written, &sequences[index], 4);
+            written += sizes[index];
+        }
+        if (wide != count) {
+            std::memcpy(out + written, &sequences[wide], sizes[wide]);
+            written += sizes[wide];
+        }
+        return written;
+#endif
+    }
+
+    template <typename Char32T>
+    TranscodeResult convertUtf32ToUtf8(
+        const Char32T* units,
+        std::size_t length,
+        char* out
+    ) {
+        static_assert(sizeof(Char32T) == 4, "expected 32-bit code units");
+
+        std::size_t pos = 0;
+        std::size_t written = 0;
+
+        while (pos < length) {
+            const std::size_t remaining = length - pos;
+            const int count = remaining < 16 ? static_cast<int>(remaining) : 16;
+            const __mmask16 inRange = static_cast<__mmask16>((1u << count) - 1);
+            const __m512i codePoints = _mm512_maskz_loadu_epi32(inRange, units + pos);
+
+            const __mmask16 invalid = inRange & (
+                _mm512_cmpgt_epu32_mask(codePoints, _mm512_set1_epi32(0x10ffff)) |
+                _mm512_cmpeq_epi32_mask(
+                    _mm512_and_si512(codePoints, _mm512_set1_epi32(static_cast<int>(0xfffff800))),
+                    _mm512_set1_epi32(0xd800)
+                )
+            );
+            if (invalid) {
+                const TranscodeResult result = scalar::convertUtf32ToUtf8(
+                    units + pos, remaining, out + written
+                );
+                return {result.ok, pos + result.read, written + result.written};
+            }
+
+            if ((_mm512_cmpge_epu32_mask(codePoints, _mm512_set1_epi32(0x80)) & inRange) == 0) {
+                _mm_mask_storeu_epi8(out + written, inRange, _mm512_cvtepi32_epi8(codePoints));
+                written += count;
+            } else {
+                written += encodeWindow(
+                    codePoints, count, remaining <= 16, out + written
+                );
+            }
+            pos += count;
+        }
+
+        return {true, length, written};
+    }
+
+    template <typename Char16T>
+    TranscodeResult convertUtf16ToUtf8(
+        const Char16T* units,
+        std::size_t length,
+        char* out
+    ) {
+        static_assert(sizeof(Char16T) == 2, "expected 16-bit code units");
+
+        std::size_t pos = 0;
+        std::size_t written = 0;
+
+        while (pos < length) {
+            const std::size_t remaining = length - pos;
+            const int count = remaining < 16 ? static_cast<int>(remaining) : 16;
+            const __mmask16 inRange = static_cast<__mmask16>((1u << count) - 1);
+            const __m512i codePoints = _mm512_cvtepu16_epi32(
+                _mm256_maskz_loadu_epi16(inRange, units + pos)
+            );
+
+            const __mmask16 surrogates = inRange & _mm512_cmpeq_epi32_mask(
+                _mm512_and_si512(codePoints, _mm512_set1_epi32(0xf800)),
+                _mm512_set1_epi32(0xd800)
+            );
+            if ((surrogates & 1) != 0) {
+                const int consumed = scalar::encodeUtf16Unit(
+                    units, pos, length, out, written
+                );
+                if (consumed == 0) {
+                    return {false, pos, written};
+                }
+                pos += consumed;
+                continue;
+            }
+
+            // Encode up to the first surrogate; the pair is handled above on
+            // the next pass.
+            const int prefix = surrogates ? __builtin_ctz(surrogates) : count;
+            const __mmask16 encode = static_cast<__mmask16>((1u << prefix) - 1);
+
+            if ((_mm512_cmpge_epu32_mask(codePoints, _mm512_set1_epi32(0x80)) & encode) == 0) {
+                _mm_mask_storeu_epi8(out + written, encode, _mm512_cvtepi32_epi8(codePoints));
+                written += prefix;
+            } else {
+                written += encodeWindow(
+                    codePoints, prefix, remaining <= 16 && prefix == count, out + written
+                );
+            }
+            pos += prefix;
+        }
+
+        return {true, length, written};
+    }
+#if defined(__AVX512VBMI2__)
+    inline std::size_t convertLatin1ToUtf8(
+        const unsigned char* bytes,
+        std::size_t length,
+        char* out
+    ) {
+        std::size_t pos = 0;
+        std::size_t written = 0;
+
+        while (pos < length) {
+            const std::size_t remaining = length - pos;
+
+            if (remaining >= 64) {
+                const __m512i input = _mm512_loadu_si512(bytes + pos);
+                if (_mm512_movepi8_mask(input) == 0) {
+                    _mm512_storeu_si512(out + written, input);
+                    pos += 64;
+                    written += 64;
+                    continue;
+                }
+            }
+
+            // Widen 32 bytes to 16-bit lanes holding one or two output bytes.
+            const int count = remaining < 32 ? static_cast<int>(remaining) : 32;
+            const __m512i wide = _mm512_cvtepu8_epi16(_mm256_maskz_loadu_epi8(
+                static_cast<__mmask32>(blockMask(count)), bytes + pos
+            ));
+            const __m512i twoBytes = _mm512_or_si512(
+                _mm512_or_si512(_mm512_set1_epi16(static_cast<short>(0x80c0)), _mm512_srli_epi16(wide, 6)),
+                _mm512_slli_epi16(_mm512_and_si512(wide, _mm512_set1_epi16(0x3f)), 8)
+            );
+            const __m512i encoded = _mm512_mask_mov_epi16(
+                wide, _mm512_cmpge_epu16_mask(wide, _mm512_set1_epi16(0x80)), twoBytes
+            );
+
+            // The first byte of every lane is kept; the second only when set.
+            const uint64_t keep = blockMask(2 * count) & (
+                0x5555555555555555ull |
+                _mm512_test_epi8_mask(encoded, _mm512_set1_epi16(static_cast<short>(0xff00)))
+            );
+            const int produced = __builtin_popcountll(keep);
+            _mm512_mask_storeu_epi8(
+                out + written, blockMask(produced), _mm512_maskz_compress_epi8(keep, encoded)
+            );
+            pos += count;
+            written += produced;
+        }
+
+        return written;
+    }
+
+    inline TranscodeResult convertUtf8ToLatin1(
+        const unsigned char* bytes,
+        std::size_t length,
+        char* out,
+        bool lossy
+    ) {
+        std::size_t pos = 0;
+        std::size_t written = 0;
+
+        while (pos < length) {
+            const std::size_t remaining = length - pos;
+            const uint64_t inRange = blockMask(remaining);
+            const __m512i input = _mm512_maskz_loadu_epi8(inRange, bytes + pos);
+
+            if (_mm512_movepi8_mask(input) == 0) {
+                const std::size_t count = remaining < 64 ? remaining : 64;
+                _mm512_mask_storeu_epi8(out + written, inRange, input);
+                pos += count;
+                written += count;
+                continue;
+            }
+
+            // The fast path takes blocks of ascii and two-byte sequences with
+            // a lead of 0xc2 or 0xc3; a lead in the last byte of a full block
+            // is left for the next one.
+            const uint64_t high = _mm512_movepi8_mask(input);
+            const uint64_t continuations = _mm512_cmpeq_epi8_mask(
+                _mm512_and_si512(input, _mm512_set1_epi8(static_cast<char>(0xc0))),
+                _mm512_set1_epi8(static_cast<char>(0x80))
+            );
+            uint64_t leads = _mm512_cmpeq_epi8_mask(
+                _mm512_and_si512(input, _mm512_set1_epi8(static_cast<char>(0xfe))),
+                _mm512_set1_epi8(static_cast<char>(0xc2))
+            );
+            std::size_t take = remaining < 64 ? remaining : 64;
+            if (take == 64 && remaining > 64 && (leads >> 63) != 0) {
+                take = 63;
+                leads &= blockMask(63);
+            }
+            const uint64_t taken = blockMask(take);
+
+            if ((high & taken) != ((leads | continuations) & taken) ||
+                (continuations & taken) != ((leads << 1) & taken) ||
+                (leads & (taken >> 1)) != leads) {
+                const std::size_t stop = pos + take;
+                while (pos < stop) {
+                    if (not scalar::convertUtf8ToLatin1Step(
+                            bytes, length, pos, out, written, lossy)) {
+                        return {false, pos, written};
+                    }
+                }
+                continue;
+            }
+
+            const __m512i next = _mm512_maskz_loadu_epi8(
+                blockMask(remaining - 1), bytes + pos + 1
+            );
+            const __m512i decoded = _mm512_or_si512(
+                _mm512_and_si512(
+                    _mm512_slli_epi16(input, 6), _mm512_set1_epi8(static_cast<char>(0xc0))
+                ),
+                _mm512_and_si512(next, _mm512_set1_epi8(0x3f))
+            );
+            const __m512i latin1 = _mm512_mask_mov_epi8(input, leads, decoded);
+            const uint64_t keep = taken & ~continuations;
+            const int produced = __builtin_popcountll(keep);
+
+            _mm512_mask_storeu_epi8(
+                out + written, blockMask(produced), _mm512_maskz_compress_epi8(keep, latin1)
+            );
+            pos += take;
+            written += produced;
+        }
+
+        return {true, pos, written};
+    }
+#endif
+} // namespace avx512
+#if defined(__GNUC__) && !defined(__clang__)
+#   pragma GCC diagnostic pop
+#endif
+#endif
+
+    inline std::size_t validateUtf8(
+        const unsigned char* bytes,
+        std::size_t length
+    ) {
+        recordBytesValidated(length);
+#if defined(GC_UTF8_AVX512)
+        return avx512::validateUtf8(bytes, length);
+#else
+        return scalar::validateUtf8(bytes, length);
+#endif
+    }
+
+    inline std::size_t validateAndHashUtf8(
+        const unsigned char* bytes,
+        std::size_t length,
+        uint64_t& hash
+    ) {
+        recordBytesValidated(length);
+#if defined(GC_UTF8_AVX512)
+        return avx512::validateAndHashUtf8(bytes, length, hash);
+#else
+        return scalar::validateAndHashUtf8(bytes, length, hash);
+#endif
+    }
+
+    /*
+    ** @brief: The hash 'validateAndHashUtf8' gives, without validating.
+    */
+    inline uint64_t hashBytes(const unsigned char* bytes, std::size_t length) {
+        uint64_t lanes[8];
+        beginHash(lanes);
+        const std::size_t stripes = length / HASH_STRIPE_BYTES;
+        hashStripes(lanes, bytes, stripes);
+        hashPartialStripe(lanes, bytes + stripes * HASH_STRIPE_BYTES, length % HASH_STRIPE_BYTES);
+        return finishHash(lanes, length);
+    }
+
+    inline std::size_t classifyUtf8(
+        const unsigned char* bytes,
+        std::size_t length,
+        uint32_t& seen,
+        std::size_t& codePoints
+    ) {
+        recordBytesValidated(length);
+#if defined(GC_UTF8_AVX512)
+        return avx512::classifyUtf8(bytes, length, seen, codePoints);
+#else
+        return scalar::classifyUtf8(bytes, length, seen, codePoints);
+#endif
+    }
+
+    template <typename Char32T>
+    TranscodeResult convertUtf8ToUtf32(
+        const unsigned char* bytes,
+        std::size_t length,
+        Char32T* out
+    ) {
+#if defined(GC_UTF8_AVX512)
+        return avx512::convertUtf8ToUtf32(bytes, length, out);
+#else
+        return scalar::convertUtf8ToUtf32(bytes, length, out);
+#endif
+    }
+
+    template <typename Char16T>
+    TranscodeResult convertUtf8ToUtf16(
+        const unsigned char* bytes,
+        std::size_t length,
+        Char16T* out
+    ) {
+#if defined(GC_UTF8_AVX512)
+        return avx512::convertUtf8ToUtf16(bytes, length, out);
+#else
+        return scalar::convertUtf8ToUtf16(bytes, length, out);
+#endif
+    }
+
+    template <typename Char32T>
+    TranscodeResult convertUtf32ToUtf8(
+        const Char32T* units,
+        std::size_t length,
+        char* out
+    ) {
+#if defined(GC_UTF8_AVX512)
+        return avx512::convertUtf32ToUtf8(units, length, out);
+#else
+        return scalar::convertUtf32ToUtf8(units, length, out);
+#endif
+    }
+
+    template <typename Char16T>
+    TranscodeResult convertUtf16ToUtf8(
+        const Char16T* units,
+        std::size_t length,
+        char* out
+    ) {
+#if defined(GC_UTF8_AVX512)
+        return avx512::convertUtf16ToUtf8(units, length, out);
+#else
+        return scalar::convertUtf16ToUtf8(units, length, out);
+#endif
+    }
+    inline std::size_t convertLatin1ToUtf8(
+        const unsigned char* bytes,
+        std::size_t length,
+        char* out
+    ) {
+#if defined(GC_UTF8_AVX512) && defined(__AVX512VBMI2__)
+        return avx512::convertLatin1ToUtf8(bytes, length, out);
+#else
+        return scalar::convertLatin1ToUtf8(bytes, length, out);
+#endif
+    }
+
+    inline TranscodeResult convertUtf8ToLatin1(
+        const unsigned char* bytes,
+        std::size_t length,
+        char* out,
+        bool lossy
+    ) {
+#if defined(GC_UTF8_AVX512) && defined(__AVX512VBMI2__)
+        return avx512::convertUtf8ToLatin1(bytes, length, out, lossy);
+#else
+        return scalar::convertUtf8ToLatin1(bytes, length, out, lossy);
+#endif
+    }
+} // namespace detail
+} // namespace gc
+
+#endif // __GENIUS_C_UTF8_KERNELS__
@@ -0,0 +1,316 @@
+#ifndef __GENIUS_C_UTF8_LINE_INDEX__
+#define __GENIUS_C_UTF8_LINE_INDEX__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "utf8.h"
+
+namespace gc {
+    /*
+    ** @brief: A position in text as a zero-based line and a zero-based
+    **    column counted in code points.
+    */
+    struct LineColumn {
+        std::size_t line;
+        std::size_t column;
+    };
+
+namespace detail {
+    // The index keeps the number of code points before every block of this
+    // many bytes, so a query never counts more than one block.
+    constexpr std::size_t LINE_INDEX_BLOCK_SHIFT = 10;
+    constexpr std::size_t LINE_INDEX_BLOCK = std::size_t(1) << LINE_INDEX_BLOCK_SHIFT;
+
+    // Texts are only split between threads in pieces at least this long.
+    constexpr std::size_t LINE_INDEX_MIN_CHUNK = std::size_t(1) << 20;
+
+    /*
+    ** @brief: What one thread finds in its part of the text. Code point
+    **    counts are relative to the start of that part.
+    */
+    struct LineIndexChunk {
+        std::vector<std::size_t> lineStarts;
+        std::vector<std::size_t> lineCodePoints;
+        std::vector<std::size_t> checkpoints;
+        std::size_t codePoints = 0;
+    };
+
+    /*
+    ** @brief: Records the lines that start in 'bytes[begin, end)', and the
+    **    code points before each of them and before each block.
+    ** @note: 'begin' must be a multiple of LINE_INDEX_BLOCK.
+    */
+    inline void scanLineIndexChunk(
+        const unsigned char* bytes,
+        std::size_t begin,
+        std::size_t end,
+        LineIndexChunk& chunk
+    ) {
+        std::size_t count = 0;
+
+        for (std::size_t pos = begin; pos < end; pos += 64) {
+            if ((pos & (LINE_INDEX_BLOCK - 1)) == 0) {
+                chunk.checkpoints.push_back(count);
+            }
+
+            uint64_t newlines;
+            const uint64_t leads = classifyLineBlock(
+                bytes + pos, std::min<std::size_t>(64, end - pos), newlines
+            );
+
+            while (newlines != 0) {
+                const int bit = __builtin_ctzll(newlines);
+                // The new line starts after the newline, which is counted
+                // with the line it ends.
+                chunk.lineStarts.push_back(pos + bit + 1);
+                chunk.lineCodePoints.push_back(
+                    count + __builtin_popcountll(leads & ((2ull << bit) - 1))
+                );
+                newlines &= newlines - 1;
+            }
+            count += __builtin_popcountll(leads);
+        }
+
+        chunk.codePoints = count;
+    }
+
+    /*
+    ** @brief: The number of bytes in 'bytes' that start a code point.
+    */
+    inline std::size_t countLineIndexCodePoints(
+        const unsigned char* bytes,
+        std::size_t length
+    ) {
+        std::size_t count = 0;
+        for (std::size_t pos = 0; pos < length; pos += 64) {
+            uint64_t newlines;
+            count += __builtin_popcountll(classifyLineBlock(
+                bytes + pos, std::min<std::size_t>(64, length - pos), newlines
+            ));
+        }
+        return count;
+    }
+
+    /*
+    ** @brief: Calls 'task(0)' to 'task(count - 1)', each but the first on a
+    **    thread of its own, and waits for them.
+    ** @throws: The first exception that a task threw.
+    */
+    template <typename TaskT>
+    void runLineIndexTasks(std::size_t count, const TaskT& task) {
+        std::vector<std::exception_ptr> errors(count);
+        std::vector<std::thread> workers;
+        workers.reserve(count - 1);
+
+        auto run = [&](std::size_t index) {
+            try {
+                task(index);
+            } catch (...) {
+                errors[index] = std::current_exception();
+            }
+        };
+
+        for (std::size_t index = 1; index < count; ++index) {
+            workers.emplace_back(run, index);
+        }
+        run(0);
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+} // namespace detail
+
+    /*
+    ** @brief: Maps between byte offsets in utf8 text and lines and columns,
+    **    in O(log n) per query.
+    ** @note: Lines end with '\n', which belongs to the line it ends; a
+    **    '\r' before it is an ordinary character. Columns count code points,
+    **    taking every byte that is not a trail byte as the start of one, so
+    **    invalid text is indexed rather than rejected.
+    ** @note: The index keeps a view of the text, which must outlive it.
+    */
+    class Utf8LineIndex {
+        public:
+            Utf8LineIndex() = default;
+
+            /*
+            ** @brief: Indexes the given text in one pass that finds newlines
+            **    and counts code points 64 bytes at a time.
+            ** @param threads: How many threads to split the work between,
+            **    or 0 for one per hardware thread. Texts shorter than a
+            **    megabyte per thread use fewer.
+            ** @note: Each thread indexes a part of the text on its own. The
+            **    parts are then joined by a prefix sum of their line and code
+            **    point counts, shifting every entry in parallel.
+            */
+            explicit Utf8LineIndex(std::string_view text, unsigned threads = 0)
+                : text(text) {
+                const auto bytes = reinterpret_cast<const unsigned char*>(text.data());
+                const std::size_t length = text.size();
+
+                if (threads == 0) {
+                    threads = std::max(1u, std::thread::hardware_concurrency());
+                }
+                const std::size_t blocks =
+                    (length + detail::LINE_INDEX_BLOCK - 1) >> detail::LINE_INDEX_BLOCK_SHIFT;
+                const std::size_t chunkCount = std::max<std::size_t>(1, std::min<std::size_t>(
+                    threads, length / detail::LINE_INDEX_MIN_CHUNK
+                ));
+                const std::size_t chunkBlocks = (blocks + chunkCount - 1) / chunkCount;
+
+                auto chunkBegin = [&](std::size_t index) {
+                    return std::min(length, (index * chunkBlocks) << detail::LINE_INDEX_BLOCK_SHIFT);
+                };
+
+                std::vector<detail::LineIndexChunk> chunks(chunkCount);
+                detail::runLineIndexTasks(chunkCount, [&](std::size_t index) {
+                    detail::scanLineIndexChunk(
+                        bytes, chunkBegin(index), chunkBegin(index + 1), chunks[index]
+                    );
+                });
+
+                // Prefix sums of the chunk totals give where each chunk's
+                // entries go and what to add to their code point counts.
+                std::vector<std::size_t> lineBase(chunkCount + 1, 1);
+                std::vector<std::size_t> checkpointBase(chunkCount + 1, 0);
+                std::vector<std::size_t> codePointBase(chunkCount + 1, 0);
+                for (std::size_t index = 0; index < chunkCount; ++index) {
+                    lineBase[index + 1] = lineBase[index] + chunks[index].lineStarts.size();
+                    checkpointBase[index + 1] =
+                        checkpointBase[index] + chunks[index].checkpoints.size();
+                    codePointBase[index + 1] = codePointBase[index] + chunks[index].codePoints;
+                }
+
+                starts.resize(lineBase[chunkCount]);
+                startCodePoints.resize(lineBase[chunkCount]);
+                checkpoints.resize(checkpointBase[chunkCount]);
+                codePoints = codePointBase[chunkCount];
+                starts[0] = 0;
+                startCodePoints[0] = 0;
+
+                detail::runLineIndexTasks(chunkCount, [&](std::size_t index) {
+                    const detail::LineIndexChunk& chunk = chunks[index];
+                    const std::size_t base = codePointBase[index];
+
+                    std::copy(
+                        chunk.lineStarts.begin(), chunk.lineStarts.end(),
+                        starts.begin() + lineBase[index]
+                    );
+                    for (std::size_t line = 0; line < chunk.lineCodePoints.size(); ++line) {
+                        startCodePoints[lineBase[index] + line] =
+                            base + chunk.lineCodePoints[line];
+                    }
+                    for (std::size_t block = 0; block < chunk.checkpoints.size(); ++block) {
+                        checkpoints[checkpointBase[index] + block] =
+                            base + chunk.checkpoints[block];
+                    }
+                });
+            }
+
+            /*
+            ** @brief: The number of lines. Text that ends with '\n' has an
+            **    empty last line after it.
+            */
+            std::size_t lineCount() const {
+                return starts.size();
+            }
+
+            /*
+            ** @brief: The number of code points in the text.
+            */
+            std::size_t codePointCount() const {
+                return codePoints;
+            }
+
+            /*
+            ** @brief: The byte offset at which the given line starts.
+            */
+            std::size_t lineStart(std::size_t line) const {
+                return starts[line];
+            }
+
+            /*
+            ** @brief: The number of code points in the given line, not
+            **    counting the '\n' that ends it.
+            */
+            std::size_t lineLength(std::size_t line) const {
+                if (line + 1 == starts.size()) {
+                    return codePoints - startCodePoints[line];
+                }
+                return startCodePoints[line + 1] - startCodePoints[line] - 1;
+            }
+
+            /*
+            ** @brief: The line and column of the given byte offset.
+            ** @note: An offset inside a multi-byte sequence is placed on the
+            **    code point after it. Offsets past the end are placed at the
+            **    end.
+            */
+            LineColumn locate(std::size_t offset) const {
+                offset = std::min(offset, text.size());
+                const std::size_t line = static_cast<std::size_t>(
+                    std::upper_bound(starts.begin(), starts.end(), offset) - starts.begin()
+                ) - 1;
+                return {line, codePointsBefore(offset) - startCodePoints[line]};
+            }
+
+            /*
+            ** @brief: The byte offset of the given line and column.
+            ** @note: Columns past the end of the line give the offset of the
+            **    '\n' that ends it (or of the end of the text).
+            */
+            std::size_t offsetOf(std::size_t line, std::size_t column) const {
+                if (column >= lineLength(line)) {
+                    return line + 1 == starts.size() ? text.size() : starts[line + 1] - 1;
+                }
+
+                const std::size_t target = startCodePoints[line] + column;
+                const std::size_t block = static_cast<std::size_t>(
+                    std::upper_bound(checkpoints.begin(), checkpoints.end(), target) -
+                    checkpoints.begin()
+                ) - 1;
+                const std::size_t begin = block << detail::LINE_INDEX_BLOCK_SHIFT;
+
+                return begin + detail::skipCodePoints(
+                    reinterpret_cast<const unsigned char*>(text.data()) + begin,
+                    text.size() - begin,
+                    target - checkpoints[block]
+                );
+            }
+
+        private:
+            std::size_t codePointsBefore(std::size_t offset) const {
+                const std::size_t block = offset >> detail::LINE_INDEX_BLOCK_SHIFT;
+                if (block == checkpoints.size()) {
+                    return codePoints;
+                }
+                const std::size_t begin = block << detail::LINE_INDEX_BLOCK_SHIFT;
+                return checkpoints[block] + detail::countLineIndexCodePoints(
+                    reinterpret_cast<const unsigned char*>(text.data()) + begin,
+                    offset - begin
+                );
+            }
+
+            std::string_view text;
+            // The byte offset and the number of code points before each line.
+            std::vector<std::size_t> starts{0};
+            std::vector<std::size_t> startCodePoints{0};
+            // The number of code points before each LINE_INDEX_BLOCK bytes.
+            std::vector<std::size_t> checkpoints;
+            std::size_t codePoints = 0;
+    };
+} // namespace gc
+
+#endif // __GENIUS_C_UTF8_LINE_INDEX__
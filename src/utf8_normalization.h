@@ -0,0 +1,468 @@
+#ifndef __GENIUS_C_UTF8_NORMALIZATION__
+#define __GENIUS_C_UTF8_NORMALIZATION__
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "utf8.h"
+#include "utf8_normalization_tables.h"
+
+namespace gc {
+    /*
+    ** @brief: The Unicode normalization forms (UAX #15).
+    ** @note: The tables are generated by 'tools/gen_normalization.py'.
+    */
+    enum class NormalizationForm {
+        NFC,
+        NFD,
+        NFKC,
+        NFKD
+    };
+
+    /*
+    ** @brief: The answer of a normalization quick check. 'Maybe' means that
+    **    only a full normalization can tell.
+    */
+    enum class QuickCheck {
+        Yes,
+        No,
+        Maybe
+    };
+
+namespace detail {
+    const uint32_t HANGUL_S_BASE = 0xac00;
+    const uint32_t HANGUL_L_BASE = 0x1100;
+    const uint32_t HANGUL_V_BASE = 0x1161;
+    const uint32_t HANGUL_T_BASE = 0x11a7;
+    const uint32_t HANGUL_L_COUNT = 19;
+    const uint32_t HANGUL_V_COUNT = 21;
+    const uint32_t HANGUL_T_COUNT = 28;
+    const uint32_t HANGUL_N_COUNT = HANGUL_V_COUNT * HANGUL_T_COUNT;
+    const uint32_t HANGUL_S_COUNT = HANGUL_L_COUNT * HANGUL_N_COUNT;
+
+    inline uint16_t getNormalizationProps(uint32_t codePoint) {
+        const uint32_t block = NORMALIZATION_PROPS_INDEX[
+            codePoint >> NORMALIZATION_PROPS_SHIFT
+        ];
+        return NORMALIZATION_PROPS_BLOCKS[
+            (block << NORMALIZATION_PROPS_SHIFT) +
+            (codePoint & ((1u << NORMALIZATION_PROPS_SHIFT) - 1))
+        ];
+    }
+
+    inline int getCombiningClass(uint32_t codePoint) {
+        return getNormalizationProps(codePoint) & 0xff;
+    }
+
+    inline uint16_t getQuickCheckNoFlag(NormalizationForm form) {
+        switch (form) {
+            case NormalizationForm::NFC: return NORMALIZATION_NFC_NO;
+            case NormalizationForm::NFD: return NORMALIZATION_NFD_NO;
+            case NormalizationForm::NFKC: return NORMALIZATION_NFKC_NO;
+            case NormalizationForm::NFKD: return NORMALIZATION_NFKD_NO;
+        }
+        return NORMALIZATION_NFC_NO;
+    }
+
+    inline uint16_t getQuickCheckMaybeFlag(NormalizationForm form) {
+        switch (form) {
+            case NormalizationForm::NFC: return NORMALIZATION_NFC_MAYBE;
+            case NormalizationForm::NFKC: return NORMALIZATION_NFKC_MAYBE;
+            default: return 0;
+        }
+    }
+
+    struct NormalizationScan {
+        QuickCheck result;
+        // Where the text stops being known to be normalized. Everything
+        // before it is left as is by normalization.
+        std::size_t stable;
+    };
+
+    /*
+    ** @brief: The NF*_Quick_Check algorithm of UAX #15, which also validates
+    **    the text up to where it stops.
+    ** @throws InvalidUtf8: If the scanned text is not strictly valid utf8.
+    */
+    inline NormalizationScan scanNormalization(
+        const unsigned char* bytes,
+        std::size_t length,
+        NormalizationForm form
+    ) {
+        const uint16_t no = getQuickCheckNoFlag(form);
+        const uint16_t maybe = getQuickCheckMaybeFlag(form);
+
+        NormalizationScan scan = {QuickCheck::Yes, 0};
+        int lastClass = 0;
+        std::size_t pos = 0;
+
+        while (pos < length) {
+            if (bytes[pos] < 0x80) {
+                // Ascii is in every form and never combines with anything.
+                const std::size_t run = asciiPrefixLength(bytes + pos, length - pos);
+                pos += run;
+                if (scan.result == QuickCheck::Yes) {
+                    scan.stable = pos - 1;
+                }
+                lastClass = 0;
+                continue;
+            }
+
+            uint32_t codePoint;
+            const int size = scalar::decodeUtf8Sequence(
+                bytes + pos, length - pos, codePoint
+            );
+            if (size == 0) {
+                throwUtf8Error(bytes, length, pos);
+            }
+
+            const uint16_t props = getNormalizationProps(codePoint);
+            const int combiningClass = props & 0xff;
+
+            if ((combiningClass != 0 && lastClass > combiningClass) || (props & no)) {
+                scan.result = QuickCheck::No;
+                return scan;
+            }
+
+            if (props & maybe) {
+                scan.result = QuickCheck::Maybe;
+            } else if (combiningClass == 0 && scan.result == QuickCheck::Yes) {
+                scan.stable = pos;
+            }
+
+            lastClass = combiningClass;
+            pos += size;
+        }
+
+        if (scan.result == QuickCheck::Yes) {
+            scan.stable = length;
+        }
+        return scan;
+    }
+
+    inline const DecompositionEntry* findDecomposition(
+        const DecompositionEntry* entries,
+        std::size_t count,
+        uint32_t codePoint
+    ) {
+        std::size_t low = 0;
+        std::size_t high = count;
+
+        while (low < high) {
+            const std::size_t middle = (low + high) / 2;
+            if (entries[middle].codePoint < codePoint) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+
+        if (low < count && entries[low].codePoint == codePoint) {
+            return entries + low;
+        }
+        return nullptr;
+    }
+
+    inline void decomposeCodePoint(
+        uint32_t codePoint,
+        bool compatibility,
+        std::vector<uint32_t>& output
+    ) {
+        const uint32_t index = codePoint - HANGUL_S_BASE;
+        if (index < HANGUL_S_COUNT) {
+            output.push_back(HANGUL_L_BASE + index / HANGUL_N_COUNT);
+            output.push_back(HANGUL_V_BASE + (index % HANGUL_N_COUNT) / HANGUL_T_COUNT);
+            if (index % HANGUL_T_COUNT != 0) {
+                output.push_back(HANGUL_T_BASE + index % HANGUL_T_COUNT);
+            }
+            return;
+        }
+
+        const uint16_t props = getNormalizationProps(codePoint);
+        const DecompositionEntry* entry = nullptr;
+
+        if (compatibility && (props & NORMALIZATION_NFKD_NO)) {
+            entry = findDecomposition(
+                COMPATIBILITY_DECOMPOSITIONS,
+                std::size(COMPATIBILITY_DECOMPOSITIONS),
+                codePoint
+            );
+        }
+        if (entry == nullptr && (props & NORMALIZATION_NFD_NO)) {
+            entry = findDecomposition(
+                CANONICAL_DECOMPOSITIONS,
+                std::size(CANONICAL_DECOMPOSITIONS),
+                codePoint
+            );
+        }
+
+        if (entry == nullptr) {
+            output.push_back(codePoint);
+            return;
+        }
+
+        output.insert(
+            output.end(),
+            DECOMPOSITION_POOL + entry->offset,
+            DECOMPOSITION_POOL + entry->offset + entry->length
+        );
+    }
+
+    /*
+    ** @brief: Puts every run of non-starters in order of combining class,
+    **    keeping the order of those with equal classes.
+    ** @note: Each run is sorted as a whole, with the class of every mark
+    **    looked up once, so a long run of marks (eg. in hostile input)
+    **    costs n log n rather than n squared.
+    */
+    inline void reorderCombiningMarks(std::vector<uint32_t>& codePoints) {
+        std::vector<std::pair<int, uint32_t>> run;
+        const std::size_t count = codePoints.size();
+
+        for (std::size_t index = 0; index <= count; ++index) {
+            const int combiningClass = index < count ? getCombiningClass(codePoints[index]) : 0;
+            if (combiningClass != 0) {
+                run.emplace_back(combiningClass, codePoints[index]);
+                continue;
+            }
+
+            if (run.size() > 1) {
+                std::stable_sort(run.begin(), run.end(),
+                    [](const std::pair<int, uint32_t>& first, const std::pair<int, uint32_t>& second) {
+                        return first.first < second.first;
+                    });
+                std::size_t target = index - run.size();
+                for (const auto& mark : run) {
+                    codePoints[target++] = mark.second;
+                }
+            }
+            run.clear();
+        }
+    }
+
+    /*
+    ** @returns: The primary composite of the two code points, or 0 if there
+    **    is none.
+    */
+    inline uint32_t composeCodePoints(uint32_t first, uint32_t second) {
+        const uint32_t leading = first - HANGUL_L_BASE;
+        const uint32_t vowel = second - HANGUL_V_BASE;
+        if (leading < HANGUL_L_COUNT && vowel < HANGUL_V_COUNT) {
+            return HANGUL_S_BASE + (leading * HANGUL_V_COUNT + vowel) * HANGUL_T_COUNT;
+        }
+
+        const uint32_t syllable = first - HANGUL_S_BASE;
+        const uint32_t trailing = second - HANGUL_T_BASE;
+        if (syllable < HANGUL_S_COUNT && syllable % HANGUL_T_COUNT == 0 &&
+            trailing > 0 && trailing < HANGUL_T_COUNT) {
+            return first + trailing;
+        }
+
+        std::size_t low = 0;
+        std::size_t high = std::size(COMPOSITIONS);
+
+        while (low < high) {
+            const std::size_t middle = (low + high) / 2;
+            const CompositionEntry& entry = COMPOSITIONS[middle];
+            if (entry.first < first || (entry.first == first && entry.second < second)) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+
+        if (low < std::size(COMPOSITIONS) &&
+            COMPOSITIONS[low].first == first && COMPOSITIONS[low].second == second) {
+            return COMPOSITIONS[low].composite;
+        }
+        return 0;
+    }
+
+    /*
+    ** @brief: Canonical composition of fully decomposed, reordered text.
+    */
+    inline void composeCodePoints(std::vector<uint32_t>& codePoints) {
+        if (codePoints.empty()) {
+            return;
+        }
+
+        std::size_t starter = 0;
+        // 256 blocks every composition until the first starter.
+        int lastClass = getCombiningClass(codePoints[0]) == 0 ? 0 : 256;
+        std::size_t written = 1;
+
+        for (std::size_t index = 1; index < codePoints.size(); ++index) {
+            const uint32_t codePoint = codePoints[index];
+            const uint16_t props = getNormalizationProps(codePoint);
+            const int combiningClass = props & 0xff;
+
+            // Only the code points that quick check flags as 'maybe' can be
+            // the second half of a composite.
+            if ((props & NORMALIZATION_NFC_MAYBE) &&
+                (lastClass < combiningClass || lastClass == 0)) {
+                const uint32_t composite = composeCodePoints(codePoints[starter], codePoint);
+                if (composite != 0) {
+                    codePoints[starter] = composite;
+                    continue;
+                }
+            }
+
+            if (combiningClass == 0) {
+                starter = written;
+            }
+            lastClass = combiningClass;
+            codePoints[written++] = codePoint;
+        }
+
+        codePoints.resize(written);
+    }
+
+    /*
+    ** @brief: Appends the normalized form of the given text to 'output'.
+    ** @param offset: Where the text starts in the caller's input, for error
+    **    reporting.
+    ** @throws InvalidUtf8: If the text is not strictly valid utf8.
+    */
+    inline void normalizeUtf8(
+        const unsigned char* bytes,
+        std::size_t length,
+        std::size_t offset,
+        NormalizationForm form,
+        std::string& output
+    ) {
+        const bool compatibility =
+            form == NormalizationForm::NFKC || form == NormalizationForm::NFKD;
+        std::vector<uint32_t> codePoints;
+        codePoints.reserve(length);
+
+        std::size_t pos = 0;
+        while (pos < length) {
+            uint32_t codePoint;
+            const int size = scalar::decodeUtf8Sequence(
+                bytes + pos, length - pos, codePoint
+            );
+            if (size == 0) {
+                Utf8Error error = describeUtf8Error(bytes, length, pos);
+                error.offset += offset;
+                throwUtf8Error(getUtf8ErrorMessage(error.kind), error);
+            }
+
+            decomposeCodePoint(codePoint, compatibility, codePoints);
+            pos += size;
+        }
+
+        reorderCombiningMarks(codePoints);
+        if (form == NormalizationForm::NFC || form == NormalizationForm::NFKC) {
+            composeCodePoints(codePoints);
+        }
+
+        auto it = std::back_inserter(output);
+        for (const uint32_t codePoint : codePoints) {
+            put_utf8_char(it, codePoint);
+        }
+    }
+} // namespace detail
+
+    /*
+    ** @brief: Runs the normalization quick check of UAX #15 over the given
+    **    utf8 text. It does not copy or allocate.
+    ** @returns: 'QuickCheck::Yes' if the text is in the given form,
+    **    'QuickCheck::No' if it is not and 'QuickCheck::Maybe' if it takes
+    **    'isNormalized' to tell.
+    ** @throws InvalidUtf8: If the text is not strictly valid utf8. The check
+    **    stops at the first code point that answers 'No', so invalid bytes
+    **    after it go unnoticed.
+    */
+    inline QuickCheck quickCheckNormalization(
+        std::string_view str,
+        NormalizationForm form
+    ) {
+        return detail::scanNormalization(
+            reinterpret_cast<const unsigned char*>(str.data()), str.size(), form
+        ).result;
+    }
+
+    /*
+    ** @brief: Normalizes the given utf8 text, reusing the caller's buffer.
+    ** @param buffer: Receives the normalized text when it differs from the
+    **    input. It is left untouched when the quick check answers 'Yes',
+    **    but overwritten when it answers 'Maybe', even if the text then
+    **    turns out to be normalized and 'str' is returned. 'str' may view
+    **    'buffer'; the text is then normalized into a new string that
+    **    replaces the buffer's contents only if they change.
+    ** @returns: A view of 'str' itself if it is already normalized, which is
+    **    found without copying it. Otherwise a view of 'buffer'.
+    ** @throws InvalidUtf8: If the text is not strictly valid utf8.
+    ** @note: Only the text from the last stable starter before the first
+    **    offending code point onwards gets decomposed and recomposed.
+    */
+    inline std::string_view normalizeUtf8(
+        std::string_view str,
+        NormalizationForm form,
+        std::string& buffer
+    ) {
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data());
+        const auto scan = detail::scanNormalization(bytes, str.size(), form);
+
+        if (scan.result == QuickCheck::Yes) {
+            return str;
+        }
+
+        if (detail::isViewInto(str, buffer)) {
+            std::string normalized(str.data(), scan.stable);
+            detail::normalizeUtf8(
+                bytes + scan.stable, str.size() - scan.stable, scan.stable, form, normalized
+            );
+            if (scan.result == QuickCheck::Maybe && normalized == str) {
+                return str;
+            }
+            buffer.swap(normalized);
+            return buffer;
+        }
+
+        buffer.assign(str.data(), scan.stable);
+        detail::normalizeUtf8(
+            bytes + scan.stable, str.size() - scan.stable, scan.stable, form, buffer
+        );
+
+        if (scan.result == QuickCheck::Maybe && buffer == str) {
+            return str;
+        }
+        return buffer;
+    }
+
+    /*
+    ** @brief: Returns the given utf8 text in the given normalization form.
+    ** @throws InvalidUtf8: If the text is not strictly valid utf8.
+    */
+    inline std::string normalizeUtf8(std::string_view str, NormalizationForm form) {
+        std::string buffer;
+        return std::string(normalizeUtf8(str, form, buffer));
+    }
+
+    /*
+    ** @brief: Checks whether the given utf8 text is in the given normalization
+    **    form. Only text that the quick check cannot decide is normalized.
+    ** @throws InvalidUtf8: If the text is not strictly valid utf8.
+    */
+    inline bool isNormalized(std::string_view str, NormalizationForm form) {
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data());
+        const auto scan = detail::scanNormalization(bytes, str.size(), form);
+
+        if (scan.result != QuickCheck::Maybe) {
+            return scan.result == QuickCheck::Yes;
+        }
+
+        std::string buffer(str.data(), scan.stable);
+        detail::normalizeUtf8(
+            bytes + scan.stable, str.size() - scan.stable, scan.stable, form, buffer
+        );
+        return buffer == str;
+    }
+} // namespace gc
+
+#endif // __GENIUS_C_UTF8_NORMALIZATION__
@@ -0,0 +1,5317 @@
+// Generated by tools/gen_normalization.py from Unicode 15.0.0. Do not edit.
+#ifndef __GENIUS_C_UTF8_NORMALIZATION_TABLES__
+#define __GENIUS_C_UTF8_NORMALIZATION_TABLES__
+
+#include <cstdint>
+
+namespace gc {
+namespace detail {
+    // Bits 0-7 hold the canonical combining class; the rest are quick
+    // check answers.
+    inline constexpr uint16_t NORMALIZATION_NFD_NO = 0x0100;
+    inline constexpr uint16_t NORMALIZATION_NFKD_NO = 0x0200;
+    inline constexpr uint16_t NORMALIZATION_NFC_NO = 0x0400;
+    inline constexpr uint16_t NORMALIZATION_NFC_MAYBE = 0x0800;
+    inline constexpr uint16_t NORMALIZATION_NFKC_NO = 0x1000;
+    inline constexpr uint16_t NORMALIZATION_NFKC_MAYBE = 0x2000;
+
+    inline constexpr int NORMALIZATION_PROPS_SHIFT = 6;
+    inline constexpr uint8_t NORMALIZATION_PROPS_INDEX[17408] = {
+        0, 0, 1, 2, 3, 4, 5, 6, 7, 0, 8, 9,
+        10, 11, 12, 13, 14, 15, 16, 17, 0, 0, 18, 19,
+        20, 21, 0, 22, 23, 24, 0, 25, 26, 27, 28, 29,
+        30, 31, 32, 33, 34, 35, 36, 37, 32, 38, 39, 40,
+        36, 41, 36, 42, 43, 40, 0, 44, 45, 46, 47, 48,
+        49, 50, 51, 52, 53, 0, 54, 55, 0, 56, 57, 58,
+        0, 0, 0, 0, 0, 59, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 61,
+        0, 0, 62, 0, 63, 0, 0, 0, 64, 65, 66, 67,
+        68, 69, 70, 71, 72, 0, 0, 73, 74, 75, 76, 77,
+        78, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88,
+        89, 90, 91, 92, 93, 94, 95, 96, 97, 0, 0, 0,
+        0, 98, 99, 100, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        101, 102, 0, 103, 0, 0, 0, 0, 0, 104, 0, 105,
+        0, 106, 0, 107, 0, 0, 108, 109, 99, 99, 99, 110,
+        111, 112, 113, 114, 115, 99, 116, 0, 117, 118, 99, 99,
+        99, 99, 99, 99, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 119, 120, 121, 0, 122, 0, 123,
+        124, 0, 0, 125, 126, 127, 128, 129, 0, 0, 130, 131,
+        0, 132, 0, 133, 78, 78, 78, 78, 78, 78, 78, 78,
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 134, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        135, 135, 135, 135, 136, 137, 135, 138, 139, 140, 141, 142,
+        99, 99, 99, 99, 143, 144, 145, 146, 147, 148, 99, 149,
+        150, 99, 151, 152, 0, 0, 0, 0, 0, 0, 0, 153,
+        0, 0, 0, 154, 0, 155, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 156, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 157, 0, 0, 158,
+        0, 0, 0, 0, 0, 0, 0, 0, 159, 0, 0, 0,
+        0, 0, 160, 161, 0, 162, 163, 0, 0, 164, 165, 0,
+        166, 128, 0, 167, 168, 0, 0, 169, 170, 171, 0, 0,
+        0, 172, 173, 174, 0, 0, 175, 176, 177, 0, 178, 0,
+        179, 0, 0, 0, 180, 0, 0, 0, 181, 182, 0, 183,
+        184, 185, 186, 0, 0, 0, 0, 0, 177, 0, 0, 0,
+        0, 187, 188, 0, 0, 0, 0, 0, 0, 189, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 190,
+        191, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 192, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 193, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 194, 195, 196, 0, 197, 0, 0, 0, 0, 0, 0,
+        99, 198, 199, 200, 201, 202, 99, 99, 99, 99, 203, 99,
+        99, 99, 99, 204, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        205, 206, 207, 0, 191, 0, 0, 0, 0, 0, 208, 209,
+        0, 0, 0, 0, 0, 0, 0, 210, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 211,
+        0, 212, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 213, 214, 215, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 216, 217, 218, 0,
+        219, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 221, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 135, 135, 135, 135, 135, 135, 135, 135,
+        222, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    };
+    inline constexpr uint16_t NORMALIZATION_PROPS_BLOCKS[14272] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4608, 0, 0, 0, 0, 0, 0, 0, 4608, 0, 4608, 0,
+        0, 0, 0, 4608, 0, 0, 4608, 4608, 4608, 4608, 0, 0,
+        4608, 4608, 4608, 0, 4608, 4608, 4608, 0, 768, 768, 768, 768,
+        768, 768, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        0, 768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 768,
+        768, 768, 0, 0, 768, 768, 768, 768, 768, 768, 0, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 0, 768, 768, 768,
+        768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 0, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 0, 4608, 4608, 768, 768, 768, 768, 0, 768, 768, 768,
+        768, 768, 768, 4608, 4608, 0, 0, 768, 768, 768, 768, 768,
+        768, 4608, 0, 0, 768, 768, 768, 768, 768, 768, 0, 0,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 4608, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 768, 768, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 768, 768, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 0, 768, 768, 768, 768, 768, 768,
+        0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 4608, 4608, 4608, 768, 768, 0, 0, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 768, 768,
+        0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 4608, 4608, 4608, 4608,
+        4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 10470, 10470, 10470, 10470, 10470, 230, 10470, 10470,
+        10470, 10470, 10470, 10470, 10470, 230, 230, 10470, 230, 10470, 230, 10470,
+        10470, 232, 220, 220, 220, 220, 232, 10456, 220, 220, 220, 220,
+        220, 202, 202, 10460, 10460, 10460, 10460, 10442, 10442, 220, 220, 220,
+        220, 10460, 10460, 220, 10460, 10460, 220, 220, 1, 1, 1, 1,
+        10241, 220, 220, 220, 220, 230, 230, 230, 6118, 6118, 10470, 6118,
+        6118, 10480, 230, 220, 220, 220, 230, 230, 230, 220, 220, 0,
+        230, 230, 230, 220, 220, 220, 220, 230, 232, 220, 220, 230,
+        233, 234, 234, 233, 234, 234, 233, 230, 230, 230, 230, 230,
+        230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0,
+        5888, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 5888, 0,
+        0, 0, 0, 0, 4608, 4864, 768, 5888, 768, 768, 768, 0,
+        768, 0, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 768,
+        768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 768, 768, 768, 768, 768, 0, 4608, 4608, 4608, 4864,
+        4864, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4608, 4608, 4608, 0, 4608, 4608, 0, 0,
+        0, 4608, 0, 0, 0, 0, 0, 0, 768, 768, 0, 768,
+        0, 0, 0, 768, 0, 0, 0, 0, 768, 768, 768, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 768, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 768, 768, 0, 768, 0, 0, 0, 768,
+        0, 0, 0, 0, 768, 768, 768, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 768, 768, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        768, 768, 768, 768, 0, 0, 768, 768, 0, 0, 768, 768,
+        768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768,
+        0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 0, 0, 768, 768, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 220, 230, 230, 230, 230, 220, 230,
+        230, 230, 222, 220, 230, 230, 230, 230, 230, 230, 220, 220,
+        220, 220, 220, 220, 230, 230, 220, 230, 230, 222, 228, 230,
+        10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 19, 20,
+        21, 22, 0, 23, 0, 24, 25, 0, 230, 220, 0, 18,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        230, 230, 230, 230, 230, 230, 230, 230, 30, 31, 32, 0,
+        0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27,
+        28, 29, 30, 31, 32, 33, 34, 10470, 10470, 10460, 220, 230,
+        230, 230, 230, 230, 220, 230, 230, 220, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        35, 0, 0, 0, 0, 4608, 4608, 4608, 4608, 0, 0, 0,
+        0, 0, 0, 0, 768, 0, 768, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768,
+        0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0, 230,
+        230, 230, 230, 220, 230, 0, 0, 230, 230, 0, 220, 230,
+        230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 230, 230,
+        220, 230, 230, 220, 220, 220, 230, 220, 220, 230, 220, 230,
+        230, 230, 220, 230, 220, 230, 220, 230, 220, 230, 230, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230,
+        230, 230, 230, 230, 230, 230, 220, 230, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 0, 230,
+        230, 230, 230, 230, 230, 230, 230, 230, 0, 230, 230, 230,
+        0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 220, 220, 220, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 230, 220, 220, 220, 230, 230, 230, 230,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 220,
+        220, 220, 220, 220, 230, 230, 230, 230, 230, 230, 230, 230,
+        230, 230, 230, 230, 230, 230, 0, 220, 230, 230, 220, 230,
+        230, 220, 230, 230, 230, 220, 220, 220, 27, 28, 29, 230,
+        230, 230, 220, 230, 230, 220, 220, 230, 230, 230, 230, 230,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 768, 0, 0, 0, 0, 0, 0,
+        0, 768, 0, 0, 768, 0, 0, 0, 0, 0, 0, 0,
+        10247, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 9, 0, 0, 0, 230, 220, 230,
+        230, 0, 0, 0, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 10240, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768,
+        768, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240,
+        0, 0, 0, 0, 5888, 5888, 0, 5888, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 5888, 0, 0, 5888, 0,
+        0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 5888, 5888,
+        0, 0, 5888, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 768, 0, 0, 768, 768, 9, 0, 0,
+        0, 0, 0, 0, 0, 0, 10240, 10240, 0, 0, 0, 0,
+        5888, 5888, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 768, 768, 768, 9, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 768, 0, 0, 0, 0, 9, 0, 0,
+        0, 0, 0, 0, 0, 84, 10331, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        768, 0, 10240, 0, 0, 0, 0, 768, 768, 0, 768, 768,
+        0, 9, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 9, 9, 0, 10240, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 10249, 0, 0, 0, 0, 10240,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0,
+        768, 768, 768, 10240, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 4608, 0, 0, 0, 0, 103, 103, 9, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        107, 107, 107, 107, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608,
+        0, 0, 0, 0, 118, 118, 9, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 122, 122, 122, 122,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4608, 4608, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4608, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 220, 220, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 220,
+        0, 216, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5888,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 0, 0,
+        0, 0, 5888, 0, 0, 0, 0, 5888, 0, 0, 0, 0,
+        5888, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 5888, 0, 0, 0, 0, 0, 0, 0, 129, 130, 5888,
+        132, 5888, 5888, 4608, 5888, 4608, 130, 130, 130, 130, 0, 0,
+        130, 5888, 230, 230, 9, 0, 230, 230, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 5888, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 5888, 0, 0, 0, 0, 5888, 0,
+        0, 0, 0, 5888, 0, 0, 0, 0, 5888, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0,
+        0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0,
+        0, 0, 0, 7, 0, 9, 9, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4608, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+        10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+        10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+        10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+        10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 228, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 230, 220,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 230, 220, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 220,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 230,
+        230, 220, 0, 220, 220, 230, 230, 220, 220, 230, 230, 230,
+        230, 230, 220, 230, 230, 230, 230, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 768, 0, 768, 0, 768, 0, 768, 0, 768, 0,
+        0, 0, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        7, 10240, 0, 0, 0, 0, 0, 768, 0, 768, 0, 0,
+        768, 768, 0, 768, 9, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 230, 220, 230, 230, 230,
+        230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 0,
+        1, 220, 220, 220, 220, 220, 230, 230, 220, 220, 220, 220,
+        230, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+        0, 220, 0, 0, 0, 0, 0, 0, 230, 0, 0, 0,
+        230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 230, 230, 220, 230,
+        230, 230, 230, 230, 230, 230, 220, 230, 230, 234, 214, 220,
+        202, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+        230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+        230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+        230, 230, 232, 228, 228, 220, 218, 230, 233, 220, 230, 220,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 4608, 4864, 0, 0, 0, 0,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0,
+        768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0,
+        768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768,
+        768, 768, 768, 768, 0, 768, 0, 768, 0, 768, 0, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 5888, 768, 5888, 768, 5888, 768, 5888,
+        768, 5888, 768, 5888, 768, 5888, 0, 0, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 0, 768, 768, 768, 768, 768, 5888, 768, 4608, 5888, 4608,
+        4608, 4864, 768, 768, 768, 0, 768, 768, 768, 5888, 768, 5888,
+        768, 4864, 4864, 4864, 768, 768, 768, 5888, 0, 0, 768, 768,
+        768, 768, 768, 5888, 0, 4864, 4864, 4864, 768, 768, 768, 5888,
+        768, 768, 768, 768, 768, 768, 768, 5888, 768, 4864, 5888, 5888,
+        0, 0, 768, 768, 768, 0, 768, 768, 768, 5888, 768, 5888,
+        768, 5888, 4608, 0, 5888, 5888, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 4608, 0, 0,
+        0, 0, 0, 4608, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4608, 4608, 4608, 0, 0, 0, 0, 0,
+        0, 0, 0, 4608, 0, 0, 0, 4608, 4608, 0, 4608, 4608,
+        0, 0, 0, 0, 4608, 0, 4608, 0, 0, 0, 0, 0,
+        0, 0, 0, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 0,
+        0, 0, 0, 4608, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 0, 0,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4608, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 1, 1,
+        230, 230, 230, 230, 1, 1, 1, 230, 230, 0, 0, 0,
+        0, 230, 0, 0, 0, 1, 1, 230, 220, 230, 1, 1,
+        220, 220, 220, 220, 230, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 4608, 4608,
+        0, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 0, 4608, 4608, 0, 0, 4608, 4608, 4608,
+        4608, 4608, 0, 0, 4608, 4608, 4608, 0, 4608, 0, 5888, 0,
+        4608, 0, 5888, 5888, 4608, 4608, 0, 4608, 4608, 4608, 0, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608,
+        4608, 0, 0, 0, 0, 4608, 4608, 4608, 4608, 4608, 0, 0,
+        0, 0, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 768, 768, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 768, 0, 0, 0, 0, 768, 0, 0,
+        768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        768, 0, 768, 0, 0, 0, 0, 0, 4608, 4608, 0, 4608,
+        4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 768, 0, 0, 768, 0, 0, 768,
+        0, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        768, 0, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 768, 768, 768, 768, 768, 0, 0, 768, 768, 0, 0,
+        768, 768, 0, 0, 0, 0, 0, 0, 768, 768, 0, 0,
+        768, 768, 0, 0, 768, 768, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 768, 768, 768, 768, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768,
+        0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 5888, 5888, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4608, 4608, 4608, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 5888, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230,
+        230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 4608, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230,
+        230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+        230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 218, 228, 232, 222, 224, 224,
+        0, 0, 0, 0, 0, 0, 4608, 0, 4608, 4608, 4608, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 768, 0, 768, 0, 768, 0, 768, 0,
+        768, 0, 768, 0, 768, 0, 768, 0, 768, 0, 768, 0,
+        768, 0, 768, 0, 0, 768, 0, 768, 0, 768, 0, 0,
+        0, 0, 0, 0, 768, 768, 0, 768, 768, 0, 768, 768,
+        0, 768, 768, 0, 768, 768, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 768, 0, 0, 0, 0, 10248, 10248, 4608,
+        4608, 0, 768, 4608, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 768, 0, 768, 0, 768, 0, 768, 0,
+        768, 0, 768, 0, 768, 0, 768, 0, 768, 0, 768, 0,
+        768, 0, 768, 0, 0, 768, 0, 768, 0, 768, 0, 0,
+        0, 0, 0, 0, 768, 768, 0, 768, 768, 0, 768, 768,
+        0, 768, 768, 0, 768, 768, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 768, 0, 0, 768, 768, 768, 768, 0,
+        0, 0, 768, 4608, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+        0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 230, 0, 0, 0, 0,
+        230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4608, 4608, 230, 230, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 230, 230, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4608, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 4608, 4608, 4608, 0, 0, 0, 4608, 4608, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230,
+        230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 230, 0, 230, 230, 220, 0, 0, 230,
+        230, 0, 0, 0, 0, 0, 230, 230, 0, 230, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4608, 4608, 4608, 4608, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 4608, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+        768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+        5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+        5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+        5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+        5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+        5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+        5888, 5888, 5888, 5888, 5888, 5888, 0, 0, 5888, 0, 5888, 0,
+        0, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 0,
+        5888, 0, 5888, 0, 0, 5888, 5888, 0, 0, 0, 5888, 5888,
+        5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+        5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+        5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+        5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+        5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+        5888, 5888, 5888, 5888, 5888, 5888, 0, 0, 5888, 5888, 5888, 5888,
+        5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+        5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+        5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+        5888, 5888, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608,
+        4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 5888, 26, 5888,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 5888, 5888,
+        5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 0,
+        5888, 5888, 5888, 5888, 5888, 0, 5888, 0, 5888, 5888, 0, 5888,
+        5888, 0, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230,
+        230, 230, 230, 220, 220, 220, 220, 220, 220, 220, 230, 230,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608,
+        0, 0, 0, 0, 4608, 4608, 4608, 0, 4608, 0, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0,
+        0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 4608, 4608,
+        4608, 4608, 4608, 4608, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608,
+        0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 4608, 4608,
+        4608, 0, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0,
+        0, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 220, 0, 230, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        230, 1, 220, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230,
+        230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220,
+        0, 0, 0, 0, 0, 0, 220, 220, 230, 230, 230, 220,
+        230, 220, 220, 220, 220, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 230, 220, 230, 220, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 768, 0, 768, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 10247, 0,
+        0, 0, 0, 0, 230, 230, 230, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0,
+        0, 0, 768, 768, 0, 0, 0, 9, 9, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 9, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 10240, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768,
+        768, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0,
+        230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 7, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 10240, 768, 768, 10240, 768, 0,
+        0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 768, 768, 0, 0, 0, 9, 7, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0,
+        768, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 7,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 7, 0, 9, 9, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230,
+        230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 216, 216, 1,
+        1, 1, 0, 0, 0, 226, 216, 216, 216, 216, 216, 0,
+        0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 220, 220,
+        220, 220, 220, 0, 0, 230, 230, 230, 230, 230, 220, 220,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5888,
+        5888, 5888, 5888, 5888, 5888, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230,
+        230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608,
+        0, 0, 4608, 0, 0, 4608, 4608, 0, 0, 4608, 4608, 4608,
+        4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 0, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 0,
+        0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608,
+        4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 0, 4608, 0,
+        0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 230, 230, 230, 230, 230, 230, 230, 0,
+        230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+        230, 230, 230, 230, 230, 0, 0, 230, 230, 230, 230, 230,
+        230, 230, 0, 230, 230, 0, 230, 230, 230, 230, 230, 0,
+        0, 0, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 230, 230, 230, 230, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 232, 232, 220, 230,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 220,
+        220, 220, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        230, 230, 230, 230, 230, 230, 7, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 0,
+        4608, 0, 0, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 0, 4608, 0, 4608,
+        0, 0, 0, 0, 0, 0, 4608, 0, 0, 0, 0, 4608,
+        0, 4608, 0, 4608, 0, 4608, 4608, 4608, 0, 4608, 4608, 0,
+        4608, 0, 0, 4608, 0, 4608, 0, 4608, 0, 4608, 0, 4608,
+        0, 4608, 4608, 0, 4608, 0, 0, 4608, 4608, 4608, 4608, 0,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608,
+        0, 4608, 4608, 4608, 4608, 0, 4608, 0, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 0, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        0, 0, 0, 0, 0, 4608, 4608, 4608, 0, 4608, 4608, 4608,
+        4608, 4608, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+        0, 0, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608,
+        4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4608, 4608, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        0, 0, 0, 0, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608,
+        4608, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4608, 4608, 4608, 4608,
+        4608, 4608, 4608, 4608, 4608, 4608, 0, 0, 0, 0, 0, 0,
+        5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+        5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5888,
+        5888, 5888, 5888, 5888, 5888, 5888, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+    };
+
+    struct DecompositionEntry {
+        uint32_t codePoint;
+        uint16_t offset;
+        uint8_t length;
+    };
+
+    // Full canonical decompositions, sorted by code point.
+    inline constexpr DecompositionEntry CANONICAL_DECOMPOSITIONS[2061] = {
+        {0x000c0, 0, 2}, {0x000c1, 2, 2}, {0x000c2, 4, 2}, {0x000c3, 6, 2},
+        {0x000c4, 8, 2}, {0x000c5, 10, 2}, {0x000c7, 12, 2}, {0x000c8, 14, 2},
+        {0x000c9, 16, 2}, {0x000ca, 18, 2}, {0x000cb, 20, 2}, {0x000cc, 22, 2},
+        {0x000cd, 24, 2}, {0x000ce, 26, 2}, {0x000cf, 28, 2}, {0x000d1, 30, 2},
+        {0x000d2, 32, 2}, {0x000d3, 34, 2}, {0x000d4, 36, 2}, {0x000d5, 38, 2},
+        {0x000d6, 40, 2}, {0x000d9, 42, 2}, {0x000da, 44, 2}, {0x000db, 46, 2},
+        {0x000dc, 48, 2}, {0x000dd, 50, 2}, {0x000e0, 52, 2}, {0x000e1, 54, 2},
+        {0x000e2, 56, 2}, {0x000e3, 58, 2}, {0x000e4, 60, 2}, {0x000e5, 62, 2},
+        {0x000e7, 64, 2}, {0x000e8, 66, 2}, {0x000e9, 68, 2}, {0x000ea, 70, 2},
+        {0x000eb, 72, 2}, {0x000ec, 74, 2}, {0x000ed, 76, 2}, {0x000ee, 78, 2},
+        {0x000ef, 80, 2}, {0x000f1, 82, 2}, {0x000f2, 84, 2}, {0x000f3, 86, 2},
+        {0x000f4, 88, 2}, {0x000f5, 90, 2}, {0x000f6, 92, 2}, {0x000f9, 94, 2},
+        {0x000fa, 96, 2}, {0x000fb, 98, 2}, {0x000fc, 100, 2}, {0x000fd, 102, 2},
+        {0x000ff, 104, 2}, {0x00100, 106, 2}, {0x00101, 108, 2}, {0x00102, 110, 2},
+        {0x00103, 112, 2}, {0x00104, 114, 2}, {0x00105, 116, 2}, {0x00106, 118, 2},
+        {0x00107, 120, 2}, {0x00108, 122, 2}, {0x00109, 124, 2}, {0x0010a, 126, 2},
+        {0x0010b, 128, 2}, {0x0010c, 130, 2}, {0x0010d, 132, 2}, {0x0010e, 134, 2},
+        {0x0010f, 136, 2}, {0x00112, 138, 2}, {0x00113, 140, 2}, {0x00114, 142, 2},
+        {0x00115, 144, 2}, {0x00116, 146, 2}, {0x00117, 148, 2}, {0x00118, 150, 2},
+        {0x00119, 152, 2}, {0x0011a, 154, 2}, {0x0011b, 156, 2}, {0x0011c, 158, 2},
+        {0x0011d, 160, 2}, {0x0011e, 162, 2}, {0x0011f, 164, 2}, {0x00120, 166, 2},
+        {0x00121, 168, 2}, {0x00122, 170, 2}, {0x00123, 172, 2}, {0x00124, 174, 2},
+        {0x00125, 176, 2}, {0x00128, 178, 2}, {0x00129, 180, 2}, {0x0012a, 182, 2},
+        {0x0012b, 184, 2}, {0x0012c, 186, 2}, {0x0012d, 188, 2}, {0x0012e, 190, 2},
+        {0x0012f, 192, 2}, {0x00130, 194, 2}, {0x00134, 196, 2}, {0x00135, 198, 2},
+        {0x00136, 200, 2}, {0x00137, 202, 2}, {0x00139, 204, 2}, {0x0013a, 206, 2},
+        {0x0013b, 208, 2}, {0x0013c, 210, 2}, {0x0013d, 212, 2}, {0x0013e, 214, 2},
+        {0x00143, 216, 2}, {0x00144, 218, 2}, {0x00145, 220, 2}, {0x00146, 222, 2},
+        {0x00147, 224, 2}, {0x00148, 226, 2}, {0x0014c, 228, 2}, {0x0014d, 230, 2},
+        {0x0014e, 232, 2}, {0x0014f, 234, 2}, {0x00150, 236, 2}, {0x00151, 238, 2},
+        {0x00154, 240, 2}, {0x00155, 242, 2}, {0x00156, 244, 2}, {0x00157, 246, 2},
+        {0x00158, 248, 2}, {0x00159, 250, 2}, {0x0015a, 252, 2}, {0x0015b, 254, 2},
+        {0x0015c, 256, 2}, {0x0015d, 258, 2}, {0x0015e, 260, 2}, {0x0015f, 262, 2},
+        {0x00160, 264, 2}, {0x00161, 266, 2}, {0x00162, 268, 2}, {0x00163, 270, 2},
+        {0x00164, 272, 2}, {0x00165, 274, 2}, {0x00168, 276, 2}, {0x00169, 278, 2},
+        {0x0016a, 280, 2}, {0x0016b, 282, 2}, {0x0016c, 284, 2}, {0x0016d, 286, 2},
+        {0x0016e, 288, 2}, {0x0016f, 290, 2}, {0x00170, 292, 2}, {0x00171, 294, 2},
+        {0x00172, 296, 2}, {0x00173, 298, 2}, {0x00174, 300, 2}, {0x00175, 302, 2},
+        {0x00176, 304, 2}, {0x00177, 306, 2}, {0x00178, 308, 2}, {0x00179, 310, 2},
+        {0x0017a, 312, 2}, {0x0017b, 314, 2}, {0x0017c, 316, 2}, {0x0017d, 318, 2},
+        {0x0017e, 320, 2}, {0x001a0, 322, 2}, {0x001a1, 324, 2}, {0x001af, 326, 2},
+        {0x001b0, 328, 2}, {0x001cd, 330, 2}, {0x001ce, 332, 2}, {0x001cf, 334, 2},
+        {0x001d0, 336, 2}, {0x001d1, 338, 2}, {0x001d2, 340, 2}, {0x001d3, 342, 2},
+        {0x001d4, 344, 2}, {0x001d5, 346, 3}, {0x001d6, 349, 3}, {0x001d7, 352, 3},
+        {0x001d8, 355, 3}, {0x001d9, 358, 3}, {0x001da, 361, 3}, {0x001db, 364, 3},
+        {0x001dc, 367, 3}, {0x001de, 370, 3}, {0x001df, 373, 3}, {0x001e0, 376, 3},
+        {0x001e1, 379, 3}, {0x001e2, 382, 2}, {0x001e3, 384, 2}, {0x001e6, 386, 2},
+        {0x001e7, 388, 2}, {0x001e8, 390, 2}, {0x001e9, 392, 2}, {0x001ea, 394, 2},
+        {0x001eb, 396, 2}, {0x001ec, 398, 3}, {0x001ed, 401, 3}, {0x001ee, 404, 2},
+        {0x001ef, 406, 2}, {0x001f0, 408, 2}, {0x001f4, 410, 2}, {0x001f5, 412, 2},
+        {0x001f8, 414, 2}, {0x001f9, 416, 2}, {0x001fa, 418, 3}, {0x001fb, 421, 3},
+        {0x001fc, 424, 2}, {0x001fd, 426, 2}, {0x001fe, 428, 2}, {0x001ff, 430, 2},
+        {0x00200, 432, 2}, {0x00201, 434, 2}, {0x00202, 436, 2}, {0x00203, 438, 2},
+        {0x00204, 440, 2}, {0x00205, 442, 2}, {0x00206, 444, 2}, {0x00207, 446, 2},
+        {0x00208, 448, 2}, {0x00209, 450, 2}, {0x0020a, 452, 2}, {0x0020b, 454, 2},
+        {0x0020c, 456, 2}, {0x0020d, 458, 2}, {0x0020e, 460, 2}, {0x0020f, 462, 2},
+        {0x00210, 464, 2}, {0x00211, 466, 2}, {0x00212, 468, 2}, {0x00213, 470, 2},
+        {0x00214, 472, 2}, {0x00215, 474, 2}, {0x00216, 476, 2}, {0x00217, 478, 2},
+        {0x00218, 480, 2}, {0x00219, 482, 2}, {0x0021a, 484, 2}, {0x0021b, 486, 2},
+        {0x0021e, 488, 2}, {0x0021f, 490, 2}, {0x00226, 492, 2}, {0x00227, 494, 2},
+        {0x00228, 496, 2}, {0x00229, 498, 2}, {0x0022a, 500, 3}, {0x0022b, 503, 3},
+        {0x0022c, 506, 3}, {0x0022d, 509, 3}, {0x0022e, 512, 2}, {0x0022f, 514, 2},
+        {0x00230, 516, 3}, {0x00231, 519, 3}, {0x00232, 522, 2}, {0x00233, 524, 2},
+        {0x00340, 526, 1}, {0x00341, 527, 1}, {0x00343, 528, 1}, {0x00344, 529, 2},
+        {0x00374, 531, 1}, {0x0037e, 532, 1}, {0x00385, 533, 2}, {0x00386, 535, 2},
+        {0x00387, 537, 1}, {0x00388, 538, 2}, {0x00389, 540, 2}, {0x0038a, 542, 2},
+        {0x0038c, 544, 2}, {0x0038e, 546, 2}, {0x0038f, 548, 2}, {0x00390, 550, 3},
+        {0x003aa, 553, 2}, {0x003ab, 555, 2}, {0x003ac, 557, 2}, {0x003ad, 559, 2},
+        {0x003ae, 561, 2}, {0x003af, 563, 2}, {0x003b0, 565, 3}, {0x003ca, 568, 2},
+        {0x003cb, 570, 2}, {0x003cc, 572, 2}, {0x003cd, 574, 2}, {0x003ce, 576, 2},
+        {0x003d3, 578, 2}, {0x003d4, 580, 2}, {0x00400, 582, 2}, {0x00401, 584, 2},
+        {0x00403, 586, 2}, {0x00407, 588, 2}, {0x0040c, 590, 2}, {0x0040d, 592, 2},
+        {0x0040e, 594, 2}, {0x00419, 596, 2}, {0x00439, 598, 2}, {0x00450, 600, 2},
+        {0x00451, 602, 2}, {0x00453, 604, 2}, {0x00457, 606, 2}, {0x0045c, 608, 2},
+        {0x0045d, 610, 2}, {0x0045e, 612, 2}, {0x00476, 614, 2}, {0x00477, 616, 2},
+        {0x004c1, 618, 2}, {0x004c2, 620, 2}, {0x004d0, 622, 2}, {0x004d1, 624, 2},
+        {0x004d2, 626, 2}, {0x004d3, 628, 2}, {0x004d6, 630, 2}, {0x004d7, 632, 2},
+        {0x004da, 634, 2}, {0x004db, 636, 2}, {0x004dc, 638, 2}, {0x004dd, 640, 2},
+        {0x004de, 642, 2}, {0x004df, 644, 2}, {0x004e2, 646, 2}, {0x004e3, 648, 2},
+        {0x004e4, 650, 2}, {0x004e5, 652, 2}, {0x004e6, 654, 2}, {0x004e7, 656, 2},
+        {0x004ea, 658, 2}, {0x004eb, 660, 2}, {0x004ec, 662, 2}, {0x004ed, 664, 2},
+        {0x004ee, 666, 2}, {0x004ef, 668, 2}, {0x004f0, 670, 2}, {0x004f1, 672, 2},
+        {0x004f2, 674, 2}, {0x004f3, 676, 2}, {0x004f4, 678, 2}, {0x004f5, 680, 2},
+        {0x004f8, 682, 2}, {0x004f9, 684, 2}, {0x00622, 686, 2}, {0x00623, 688, 2},
+        {0x00624, 690, 2}, {0x00625, 692, 2}, {0x00626, 694, 2}, {0x006c0, 696, 2},
+        {0x006c2, 698, 2}, {0x006d3, 700, 2}, {0x00929, 702, 2}, {0x00931, 704, 2},
+        {0x00934, 706, 2}, {0x00958, 708, 2}, {0x00959, 710, 2}, {0x0095a, 712, 2},
+        {0x0095b, 714, 2}, {0x0095c, 716, 2}, {0x0095d, 718, 2}, {0x0095e, 720, 2},
+        {0x0095f, 722, 2}, {0x009cb, 724, 2}, {0x009cc, 726, 2}, {0x009dc, 728, 2},
+        {0x009dd, 730, 2}, {0x009df, 732, 2}, {0x00a33, 734, 2}, {0x00a36, 736, 2},
+        {0x00a59, 738, 2}, {0x00a5a, 740, 2}, {0x00a5b, 742, 2}, {0x00a5e, 744, 2},
+        {0x00b48, 746, 2}, {0x00b4b, 748, 2}, {0x00b4c, 750, 2}, {0x00b5c, 752, 2},
+        {0x00b5d, 754, 2}, {0x00b94, 756, 2}, {0x00bca, 758, 2}, {0x00bcb, 760, 2},
+        {0x00bcc, 762, 2}, {0x00c48, 764, 2}, {0x00cc0, 766, 2}, {0x00cc7, 768, 2},
+        {0x00cc8, 770, 2}, {0x00cca, 772, 2}, {0x00ccb, 774, 3}, {0x00d4a, 777, 2},
+        {0x00d4b, 779, 2}, {0x00d4c, 781, 2}, {0x00dda, 783, 2}, {0x00ddc, 785, 2},
+        {0x00ddd, 787, 3}, {0x00dde, 790, 2}, {0x00f43, 792, 2}, {0x00f4d, 794, 2},
+        {0x00f52, 796, 2}, {0x00f57, 798, 2}, {0x00f5c, 800, 2}, {0x00f69, 802, 2},
+        {0x00f73, 804, 2}, {0x00f75, 806, 2}, {0x00f76, 808, 2}, {0x00f78, 810, 2},
+        {0x00f81, 812, 2}, {0x00f93, 814, 2}, {0x00f9d, 816, 2}, {0x00fa2, 818, 2},
+        {0x00fa7, 820, 2}, {0x00fac, 822, 2}, {0x00fb9, 824, 2}, {0x01026, 826, 2},
+        {0x01b06, 828, 2}, {0x01b08, 830, 2}, {0x01b0a, 832, 2}, {0x01b0c, 834, 2},
+        {0x01b0e, 836, 2}, {0x01b12, 838, 2}, {0x01b3b, 840, 2}, {0x01b3d, 842, 2},
+        {0x01b40, 844, 2}, {0x01b41, 846, 2}, {0x01b43, 848, 2}, {0x01e00, 850, 2},
+        {0x01e01, 852, 2}, {0x01e02, 854, 2}, {0x01e03, 856, 2}, {0x01e04, 858, 2},
+        {0x01e05, 860, 2}, {0x01e06, 862, 2}, {0x01e07, 864, 2}, {0x01e08, 866, 3},
+        {0x01e09, 869, 3}, {0x01e0a, 872, 2}, {0x01e0b, 874, 2}, {0x01e0c, 876, 2},
+        {0x01e0d, 878, 2}, {0x01e0e, 880, 2}, {0x01e0f, 882, 2}, {0x01e10, 884, 2},
+        {0x01e11, 886, 2}, {0x01e12, 888, 2}, {0x01e13, 890, 2}, {0x01e14, 892, 3},
+        {0x01e15, 895, 3}, {0x01e16, 898, 3}, {0x01e17, 901, 3}, {0x01e18, 904, 2},
+        {0x01e19, 906, 2}, {0x01e1a, 908, 2}, {0x01e1b, 910, 2}, {0x01e1c, 912, 3},
+        {0x01e1d, 915, 3}, {0x01e1e, 918, 2}, {0x01e1f, 920, 2}, {0x01e20, 922, 2},
+        {0x01e21, 924, 2}, {0x01e22, 926, 2}, {0x01e23, 928, 2}, {0x01e24, 930, 2},
+        {0x01e25, 932, 2}, {0x01e26, 934, 2}, {0x01e27, 936, 2}, {0x01e28, 938, 2},
+        {0x01e29, 940, 2}, {0x01e2a, 942, 2}, {0x01e2b, 944, 2}, {0x01e2c, 946, 2},
+        {0x01e2d, 948, 2}, {0x01e2e, 950, 3}, {0x01e2f, 953, 3}, {0x01e30, 956, 2},
+        {0x01e31, 958, 2}, {0x01e32, 960, 2}, {0x01e33, 962, 2}, {0x01e34, 964, 2},
+        {0x01e35, 966, 2}, {0x01e36, 968, 2}, {0x01e37, 970, 2}, {0x01e38, 972, 3},
+        {0x01e39, 975, 3}, {0x01e3a, 978, 2}, {0x01e3b, 980, 2}, {0x01e3c, 982, 2},
+        {0x01e3d, 984, 2}, {0x01e3e, 986, 2}, {0x01e3f, 988, 2}, {0x01e40, 990, 2},
+        {0x01e41, 992, 2}, {0x01e42, 994, 2}, {0x01e43, 996, 2}, {0x01e44, 998, 2},
+        {0x01e45, 1000, 2}, {0x01e46, 1002, 2}, {0x01e47, 1004, 2}, {0x01e48, 1006, 2},
+        {0x01e49, 1008, 2}, {0x01e4a, 1010, 2}, {0x01e4b, 1012, 2}, {0x01e4c, 1014, 3},
+        {0x01e4d, 1017, 3}, {0x01e4e, 1020, 3}, {0x01e4f, 1023, 3}, {0x01e50, 1026, 3},
+        {0x01e51, 1029, 3}, {0x01e52, 1032, 3}, {0x01e53, 1035, 3}, {0x01e54, 1038, 2},
+        {0x01e55, 1040, 2}, {0x01e56, 1042, 2}, {0x01e57, 1044, 2}, {0x01e58, 1046, 2},
+        {0x01e59, 1048, 2}, {0x01e5a, 1050, 2}, {0x01e5b, 1052, 2}, {0x01e5c, 1054, 3},
+        {0x01e5d, 1057, 3}, {0x01e5e, 1060, 2}, {0x01e5f, 1062, 2}, {0x01e60, 1064, 2},
+        {0x01e61, 1066, 2}, {0x01e62, 1068, 2}, {0x01e63, 1070, 2}, {0x01e64, 1072, 3},
+        {0x01e65, 1075, 3}, {0x01e66, 1078, 3}, {0x01e67, 1081, 3}, {0x01e68, 1084, 3},
+        {0x01e69, 1087, 3}, {0x01e6a, 1090, 2}, {0x01e6b, 1092, 2}, {0x01e6c, 1094, 2},
+        {0x01e6d, 1096, 2}, {0x01e6e, 1098, 2}, {0x01e6f, 1100, 2}, {0x01e70, 1102, 2},
+        {0x01e71, 1104, 2}, {0x01e72, 1106, 2}, {0x01e73, 1108, 2}, {0x01e74, 1110, 2},
+        {0x01e75, 1112, 2}, {0x01e76, 1114, 2}, {0x01e77, 1116, 2}, {0x01e78, 1118, 3},
+        {0x01e79, 1121, 3}, {0x01e7a, 1124, 3}, {0x01e7b, 1127, 3}, {0x01e7c, 1130, 2},
+        {0x01e7d, 1132, 2}, {0x01e7e, 1134, 2}, {0x01e7f, 1136, 2}, {0x01e80, 1138, 2},
+        {0x01e81, 1140, 2}, {0x01e82, 1142, 2}, {0x01e83, 1144, 2}, {0x01e84, 1146, 2},
+        {0x01e85, 1148, 2}, {0x01e86, 1150, 2}, {0x01e87, 1152, 2}, {0x01e88, 1154, 2},
+        {0x01e89, 1156, 2}, {0x01e8a, 1158, 2}, {0x01e8b, 1160, 2}, {0x01e8c, 1162, 2},
+        {0x01e8d, 1164, 2}, {0x01e8e, 1166, 2}, {0x01e8f, 1168, 2}, {0x01e90, 1170, 2},
+        {0x01e91, 1172, 2}, {0x01e92, 1174, 2}, {0x01e93, 1176, 2}, {0x01e94, 1178, 2},
+        {0x01e95, 1180, 2}, {0x01e96, 1182, 2}, {0x01e97, 1184, 2}, {0x01e98, 1186, 2},
+        {0x01e99, 1188, 2}, {0x01e9b, 1190, 2}, {0x01ea0, 1192, 2}, {0x01ea1, 1194, 2},
+        {0x01ea2, 1196, 2}, {0x01ea3, 1198, 2}, {0x01ea4, 1200, 3}, {0x01ea5, 1203, 3},
+        {0x01ea6, 1206, 3}, {0x01ea7, 1209, 3}, {0x01ea8, 1212, 3}, {0x01ea9, 1215, 3},
+        {0x01eaa, 1218, 3}, {0x01eab, 1221, 3}, {0x01eac, 1224, 3}, {0x01ead, 1227, 3},
+        {0x01eae, 1230, 3}, {0x01eaf, 1233, 3}, {0x01eb0, 1236, 3}, {0x01eb1, 1239, 3},
+        {0x01eb2, 1242, 3}, {0x01eb3, 1245, 3}, {0x01eb4, 1248, 3}, {0x01eb5, 1251, 3},
+        {0x01eb6, 1254, 3}, {0x01eb7, 1257, 3}, {0x01eb8, 1260, 2}, {0x01eb9, 1262, 2},
+        {0x01eba, 1264, 2}, {0x01ebb, 1266, 2}, {0x01ebc, 1268, 2}, {0x01ebd, 1270, 2},
+        {0x01ebe, 1272, 3}, {0x01ebf, 1275, 3}, {0x01ec0, 1278, 3}, {0x01ec1, 1281, 3},
+        {0x01ec2, 1284, 3}, {0x01ec3, 1287, 3}, {0x01ec4, 1290, 3}, {0x01ec5, 1293, 3},
+        {0x01ec6, 1296, 3}, {0x01ec7, 1299, 3}, {0x01ec8, 1302, 2}, {0x01ec9, 1304, 2},
+        {0x01eca, 1306, 2}, {0x01ecb, 1308, 2}, {0x01ecc, 1310, 2}, {0x01ecd, 1312, 2},
+        {0x01ece, 1314, 2}, {0x01ecf, 1316, 2}, {0x01ed0, 1318, 3}, {0x01ed1, 1321, 3},
+        {0x01ed2, 1324, 3}, {0x01ed3, 1327, 3}, {0x01ed4, 1330, 3}, {0x01ed5, 1333, 3},
+        {0x01ed6, 1336, 3}, {0x01ed7, 1339, 3}, {0x01ed8, 1342, 3}, {0x01ed9, 1345, 3},
+        {0x01eda, 1348, 3}, {0x01edb, 1351, 3}, {0x01edc, 1354, 3}, {0x01edd, 1357, 3},
+        {0x01ede, 1360, 3}, {0x01edf, 1363, 3}, {0x01ee0, 1366, 3}, {0x01ee1, 1369, 3},
+        {0x01ee2, 1372, 3}, {0x01ee3, 1375, 3}, {0x01ee4, 1378, 2}, {0x01ee5, 1380, 2},
+        {0x01ee6, 1382, 2}, {0x01ee7, 1384, 2}, {0x01ee8, 1386, 3}, {0x01ee9, 1389, 3},
+        {0x01eea, 1392, 3}, {0x01eeb, 1395, 3}, {0x01eec, 1398, 3}, {0x01eed, 1401, 3},
+        {0x01eee, 1404, 3}, {0x01eef, 1407, 3}, {0x01ef0, 1410, 3}, {0x01ef1, 1413, 3},
+        {0x01ef2, 1416, 2}, {0x01ef3, 1418, 2}, {0x01ef4, 1420, 2}, {0x01ef5, 1422, 2},
+        {0x01ef6, 1424, 2}, {0x01ef7, 1426, 2}, {0x01ef8, 1428, 2}, {0x01ef9, 1430, 2},
+        {0x01f00, 1432, 2}, {0x01f01, 1434, 2}, {0x01f02, 1436, 3}, {0x01f03, 1439, 3},
+        {0x01f04, 1442, 3}, {0x01f05, 1445, 3}, {0x01f06, 1448, 3}, {0x01f07, 1451, 3},
+        {0x01f08, 1454, 2}, {0x01f09, 1456, 2}, {0x01f0a, 1458, 3}, {0x01f0b, 1461, 3},
+        {0x01f0c, 1464, 3}, {0x01f0d, 1467, 3}, {0x01f0e, 1470, 3}, {0x01f0f, 1473, 3},
+        {0x01f10, 1476, 2}, {0x01f11, 1478, 2}, {0x01f12, 1480, 3}, {0x01f13, 1483, 3},
+        {0x01f14, 1486, 3}, {0x01f15, 1489, 3}, {0x01f18, 1492, 2}, {0x01f19, 1494, 2},
+        {0x01f1a, 1496, 3}, {0x01f1b, 1499, 3}, {0x01f1c, 1502, 3}, {0x01f1d, 1505, 3},
+        {0x01f20, 1508, 2}, {0x01f21, 1510, 2}, {0x01f22, 1512, 3}, {0x01f23, 1515, 3},
+        {0x01f24, 1518, 3}, {0x01f25, 1521, 3}, {0x01f26, 1524, 3}, {0x01f27, 1527, 3},
+        {0x01f28, 1530, 2}, {0x01f29, 1532, 2}, {0x01f2a, 1534, 3}, {0x01f2b, 1537, 3},
+        {0x01f2c, 1540, 3}, {0x01f2d, 1543, 3}, {0x01f2e, 1546, 3}, {0x01f2f, 1549, 3},
+        {0x01f30, 1552, 2}, {0x01f31, 1554, 2}, {0x01f32, 1556, 3}, {0x01f33, 1559, 3},
+        {0x01f34, 1562, 3}, {0x01f35, 1565, 3}, {0x01f36, 1568, 3}, {0x01f37, 1571, 3},
+        {0x01f38, 1574, 2}, {0x01f39, 1576, 2}, {0x01f3a, 1578, 3}, {0x01f3b, 1581, 3},
+        {0x01f3c, 1584, 3}, {0x01f3d, 1587, 3}, {0x01f3e, 1590, 3}, {0x01f3f, 1593, 3},
+        {0x01f40, 1596, 2}, {0x01f41, 1598, 2}, {0x01f42, 1600, 3}, {0x01f43, 1603, 3},
+        {0x01f44, 1606, 3}, {0x01f45, 1609, 3}, {0x01f48, 1612, 2}, {0x01f49, 1614, 2},
+        {0x01f4a, 1616, 3}, {0x01f4b, 1619, 3}, {0x01f4c, 1622, 3}, {0x01f4d, 1625, 3},
+        {0x01f50, 1628, 2}, {0x01f51, 1630, 2}, {0x01f52, 1632, 3}, {0x01f53, 1635, 3},
+        {0x01f54, 1638, 3}, {0x01f55, 1641, 3}, {0x01f56, 1644, 3}, {0x01f57, 1647, 3},
+        {0x01f59, 1650, 2}, {0x01f5b, 1652, 3}, {0x01f5d, 1655, 3}, {0x01f5f, 1658, 3},
+        {0x01f60, 1661, 2}, {0x01f61, 1663, 2}, {0x01f62, 1665, 3}, {0x01f63, 1668, 3},
+        {0x01f64, 1671, 3}, {0x01f65, 1674, 3}, {0x01f66, 1677, 3}, {0x01f67, 1680, 3},
+        {0x01f68, 1683, 2}, {0x01f69, 1685, 2}, {0x01f6a, 1687, 3}, {0x01f6b, 1690, 3},
+        {0x01f6c, 1693, 3}, {0x01f6d, 1696, 3}, {0x01f6e, 1699, 3}, {0x01f6f, 1702, 3},
+        {0x01f70, 1705, 2}, {0x01f71, 557, 2}, {0x01f72, 1707, 2}, {0x01f73, 559, 2},
+        {0x01f74, 1709, 2}, {0x01f75, 561, 2}, {0x01f76, 1711, 2}, {0x01f77, 563, 2},
+        {0x01f78, 1713, 2}, {0x01f79, 572, 2}, {0x01f7a, 1715, 2}, {0x01f7b, 574, 2},
+        {0x01f7c, 1717, 2}, {0x01f7d, 576, 2}, {0x01f80, 1719, 3}, {0x01f81, 1722, 3},
+        {0x01f82, 1725, 4}, {0x01f83, 1729, 4}, {0x01f84, 1733, 4}, {0x01f85, 1737, 4},
+        {0x01f86, 1741, 4}, {0x01f87, 1745, 4}, {0x01f88, 1749, 3}, {0x01f89, 1752, 3},
+        {0x01f8a, 1755, 4}, {0x01f8b, 1759, 4}, {0x01f8c, 1763, 4}, {0x01f8d, 1767, 4},
+        {0x01f8e, 1771, 4}, {0x01f8f, 1775, 4}, {0x01f90, 1779, 3}, {0x01f91, 1782, 3},
+        {0x01f92, 1785, 4}, {0x01f93, 1789, 4}, {0x01f94, 1793, 4}, {0x01f95, 1797, 4},
+        {0x01f96, 1801, 4}, {0x01f97, 1805, 4}, {0x01f98, 1809, 3}, {0x01f99, 1812, 3},
+        {0x01f9a, 1815, 4}, {0x01f9b, 1819, 4}, {0x01f9c, 1823, 4}, {0x01f9d, 1827, 4},
+        {0x01f9e, 1831, 4}, {0x01f9f, 1835, 4}, {0x01fa0, 1839, 3}, {0x01fa1, 1842, 3},
+        {0x01fa2, 1845, 4}, {0x01fa3, 1849, 4}, {0x01fa4, 1853, 4}, {0x01fa5, 1857, 4},
+        {0x01fa6, 1861, 4}, {0x01fa7, 1865, 4}, {0x01fa8, 1869, 3}, {0x01fa9, 1872, 3},
+        {0x01faa, 1875, 4}, {0x01fab, 1879, 4}, {0x01fac, 1883, 4}, {0x01fad, 1887, 4},
+        {0x01fae, 1891, 4}, {0x01faf, 1895, 4}, {0x01fb0, 1899, 2}, {0x01fb1, 1901, 2},
+        {0x01fb2, 1903, 3}, {0x01fb3, 1906, 2}, {0x01fb4, 1908, 3}, {0x01fb6, 1911, 2},
+        {0x01fb7, 1913, 3}, {0x01fb8, 1916, 2}, {0x01fb9, 1918, 2}, {0x01fba, 1920, 2},
+        {0x01fbb, 535, 2}, {0x01fbc, 1922, 2}, {0x01fbe, 1924, 1}, {0x01fc1, 1925, 2},
+        {0x01fc2, 1927, 3}, {0x01fc3, 1930, 2}, {0x01fc4, 1932, 3}, {0x01fc6, 1935, 2},
+        {0x01fc7, 1937, 3}, {0x01fc8, 1940, 2}, {0x01fc9, 538, 2}, {0x01fca, 1942, 2},
+        {0x01fcb, 540, 2}, {0x01fcc, 1944, 2}, {0x01fcd, 1946, 2}, {0x01fce, 1948, 2},
+        {0x01fcf, 1950, 2}, {0x01fd0, 1952, 2}, {0x01fd1, 1954, 2}, {0x01fd2, 1956, 3},
+        {0x01fd3, 550, 3}, {0x01fd6, 1959, 2}, {0x01fd7, 1961, 3}, {0x01fd8, 1964, 2},
+        {0x01fd9, 1966, 2}, {0x01fda, 1968, 2}, {0x01fdb, 542, 2}, {0x01fdd, 1970, 2},
+        {0x01fde, 1972, 2}, {0x01fdf, 1974, 2}, {0x01fe0, 1976, 2}, {0x01fe1, 1978, 2},
+        {0x01fe2, 1980, 3}, {0x01fe3, 565, 3}, {0x01fe4, 1983, 2}, {0x01fe5, 1985, 2},
+        {0x01fe6, 1987, 2}, {0x01fe7, 1989, 3}, {0x01fe8, 1992, 2}, {0x01fe9, 1994, 2},
+        {0x01fea, 1996, 2}, {0x01feb, 546, 2}, {0x01fec, 1998, 2}, {0x01fed, 2000, 2},
+        {0x01fee, 533, 2}, {0x01fef, 2002, 1}, {0x01ff2, 2003, 3}, {0x01ff3, 2006, 2},
+        {0x01ff4, 2008, 3}, {0x01ff6, 2011, 2}, {0x01ff7, 2013, 3}, {0x01ff8, 2016, 2},
+        {0x01ff9, 544, 2}, {0x01ffa, 2018, 2}, {0x01ffb, 548, 2}, {0x01ffc, 2020, 2},
+        {0x01ffd, 2022, 1}, {0x02000, 2023, 1}, {0x02001, 2024, 1}, {0x02126, 2025, 1},
+        {0x0212a, 2026, 1}, {0x0212b, 10, 2}, {0x0219a, 2027, 2}, {0x0219b, 2029, 2},
+        {0x021ae, 2031, 2}, {0x021cd, 2033, 2}, {0x021ce, 2035, 2}, {0x021cf, 2037, 2},
+        {0x02204, 2039, 2}, {0x02209, 2041, 2}, {0x0220c, 2043, 2}, {0x02224, 2045, 2},
+        {0x02226, 2047, 2}, {0x02241, 2049, 2}, {0x02244, 2051, 2}, {0x02247, 2053, 2},
+        {0x02249, 2055, 2}, {0x02260, 2057, 2}, {0x02262, 2059, 2}, {0x0226d, 2061, 2},
+        {0x0226e, 2063, 2}, {0x0226f, 2065, 2}, {0x02270, 2067, 2}, {0x02271, 2069, 2},
+        {0x02274, 2071, 2}, {0x02275, 2073, 2}, {0x02278, 2075, 2}, {0x02279, 2077, 2},
+        {0x02280, 2079, 2}, {0x02281, 2081, 2}, {0x02284, 2083, 2}, {0x02285, 2085, 2},
+        {0x02288, 2087, 2}, {0x02289, 2089, 2}, {0x022ac, 2091, 2}, {0x022ad, 2093, 2},
+        {0x022ae, 2095, 2}, {0x022af, 2097, 2}, {0x022e0, 2099, 2}, {0x022e1, 2101, 2},
+        {0x022e2, 2103, 2}, {0x022e3, 2105, 2}, {0x022ea, 2107, 2}, {0x022eb, 2109, 2},
+        {0x022ec, 2111, 2}, {0x022ed, 2113, 2}, {0x02329, 2115, 1}, {0x0232a, 2116, 1},
+        {0x02adc, 2117, 2}, {0x0304c, 2119, 2}, {0x0304e, 2121, 2}, {0x03050, 2123, 2},
+        {0x03052, 2125, 2}, {0x03054, 2127, 2}, {0x03056, 2129, 2}, {0x03058, 2131, 2},
+        {0x0305a, 2133, 2}, {0x0305c, 2135, 2}, {0x0305e, 2137, 2}, {0x03060, 2139, 2},
+        {0x03062, 2141, 2}, {0x03065, 2143, 2}, {0x03067, 2145, 2}, {0x03069, 2147, 2},
+        {0x03070, 2149, 2}, {0x03071, 2151, 2}, {0x03073, 2153, 2}, {0x03074, 2155, 2},
+        {0x03076, 2157, 2}, {0x03077, 2159, 2}, {0x03079, 2161, 2}, {0x0307a, 2163, 2},
+        {0x0307c, 2165, 2}, {0x0307d, 2167, 2}, {0x03094, 2169, 2}, {0x0309e, 2171, 2},
+        {0x030ac, 2173, 2}, {0x030ae, 2175, 2}, {0x030b0, 2177, 2}, {0x030b2, 2179, 2},
+        {0x030b4, 2181, 2}, {0x030b6, 2183, 2}, {0x030b8, 2185, 2}, {0x030ba, 2187, 2},
+        {0x030bc, 2189, 2}, {0x030be, 2191, 2}, {0x030c0, 2193, 2}, {0x030c2, 2195, 2},
+        {0x030c5, 2197, 2}, {0x030c7, 2199, 2}, {0x030c9, 2201, 2}, {0x030d0, 2203, 2},
+        {0x030d1, 2205, 2}, {0x030d3, 2207, 2}, {0x030d4, 2209, 2}, {0x030d6, 2211, 2},
+        {0x030d7, 2213, 2}, {0x030d9, 2215, 2}, {0x030da, 2217, 2}, {0x030dc, 2219, 2},
+        {0x030dd, 2221, 2}, {0x030f4, 2223, 2}, {0x030f7, 2225, 2}, {0x030f8, 2227, 2},
+        {0x030f9, 2229, 2}, {0x030fa, 2231, 2}, {0x030fe, 2233, 2}, {0x0f900, 2235, 1},
+        {0x0f901, 2236, 1}, {0x0f902, 2237, 1}, {0x0f903, 2238, 1}, {0x0f904, 2239, 1},
+        {0x0f905, 2240, 1}, {0x0f906, 2241, 1}, {0x0f907, 2242, 1}, {0x0f908, 2242, 1},
+        {0x0f909, 2243, 1}, {0x0f90a, 2244, 1}, {0x0f90b, 2245, 1}, {0x0f90c, 2246, 1},
+        {0x0f90d, 2247, 1}, {0x0f90e, 2248, 1}, {0x0f90f, 2249, 1}, {0x0f910, 2250, 1},
+        {0x0f911, 2251, 1}, {0x0f912, 2252, 1}, {0x0f913, 2253, 1}, {0x0f914, 2254, 1},
+        {0x0f915, 2255, 1}, {0x0f916, 2256, 1}, {0x0f917, 2257, 1}, {0x0f918, 2258, 1},
+        {0x0f919, 2259, 1}, {0x0f91a, 2260, 1}, {0x0f91b, 2261, 1}, {0x0f91c, 2262, 1},
+        {0x0f91d, 2263, 1}, {0x0f91e, 2264, 1}, {0x0f91f, 2265, 1}, {0x0f920, 2266, 1},
+        {0x0f921, 2267, 1}, {0x0f922, 2268, 1}, {0x0f923, 2269, 1}, {0x0f924, 2270, 1},
+        {0x0f925, 2271, 1}, {0x0f926, 2272, 1}, {0x0f927, 2273, 1}, {0x0f928, 2274, 1},
+        {0x0f929, 2275, 1}, {0x0f92a, 2276, 1}, {0x0f92b, 2277, 1}, {0x0f92c, 2278, 1},
+        {0x0f92d, 2279, 1}, {0x0f92e, 2280, 1}, {0x0f92f, 2281, 1}, {0x0f930, 2282, 1},
+        {0x0f931, 2283, 1}, {0x0f932, 2284, 1}, {0x0f933, 2285, 1}, {0x0f934, 2286, 1},
+        {0x0f935, 2287, 1}, {0x0f936, 2288, 1}, {0x0f937, 2289, 1}, {0x0f938, 2290, 1},
+        {0x0f939, 2291, 1}, {0x0f93a, 2292, 1}, {0x0f93b, 2293, 1}, {0x0f93c, 2294, 1},
+        {0x0f93d, 2295, 1}, {0x0f93e, 2296, 1}, {0x0f93f, 2297, 1}, {0x0f940, 2298, 1},
+        {0x0f941, 2299, 1}, {0x0f942, 2300, 1}, {0x0f943, 2301, 1}, {0x0f944, 2302, 1},
+        {0x0f945, 2303, 1}, {0x0f946, 2304, 1}, {0x0f947, 2305, 1}, {0x0f948, 2306, 1},
+        {0x0f949, 2307, 1}, {0x0f94a, 2308, 1}, {0x0f94b, 2309, 1}, {0x0f94c, 2310, 1},
+        {0x0f94d, 2311, 1}, {0x0f94e, 2312, 1}, {0x0f94f, 2313, 1}, {0x0f950, 2314, 1},
+        {0x0f951, 2315, 1}, {0x0f952, 2316, 1}, {0x0f953, 2317, 1}, {0x0f954, 2318, 1},
+        {0x0f955, 2319, 1}, {0x0f956, 2320, 1}, {0x0f957, 2321, 1}, {0x0f958, 2322, 1},
+        {0x0f959, 2323, 1}, {0x0f95a, 2324, 1}, {0x0f95b, 2325, 1}, {0x0f95c, 2254, 1},
+        {0x0f95d, 2326, 1}, {0x0f95e, 2327, 1}, {0x0f95f, 2328, 1}, {0x0f960, 2329, 1},
+        {0x0f961, 2330, 1}, {0x0f962, 2331, 1}, {0x0f963, 2332, 1}, {0x0f964, 2333, 1},
+        {0x0f965, 2334, 1}, {0x0f966, 2335, 1}, {0x0f967, 2336, 1}, {0x0f968, 2337, 1},
+        {0x0f969, 2338, 1}, {0x0f96a, 2339, 1}, {0x0f96b, 2340, 1}, {0x0f96c, 2341, 1},
+        {0x0f96d, 2342, 1}, {0x0f96e, 2343, 1}, {0x0f96f, 2344, 1}, {0x0f970, 2345, 1},
+        {0x0f971, 2346, 1}, {0x0f972, 2347, 1}, {0x0f973, 2348, 1}, {0x0f974, 2349, 1},
+        {0x0f975, 2350, 1}, {0x0f976, 2351, 1}, {0x0f977, 2352, 1}, {0x0f978, 2353, 1},
+        {0x0f979, 2354, 1}, {0x0f97a, 2355, 1}, {0x0f97b, 2356, 1}, {0x0f97c, 2357, 1},
+        {0x0f97d, 2358, 1}, {0x0f97e, 2359, 1}, {0x0f97f, 2360, 1}, {0x0f980, 2361, 1},
+        {0x0f981, 2362, 1}, {0x0f982, 2363, 1}, {0x0f983, 2364, 1}, {0x0f984, 2365, 1},
+        {0x0f985, 2366, 1}, {0x0f986, 2367, 1}, {0x0f987, 2368, 1}, {0x0f988, 2369, 1},
+        {0x0f989, 2370, 1}, {0x0f98a, 2371, 1}, {0x0f98b, 2372, 1}, {0x0f98c, 2373, 1},
+        {0x0f98d, 2374, 1}, {0x0f98e, 2375, 1}, {0x0f98f, 2376, 1}, {0x0f990, 2377, 1},
+        {0x0f991, 2378, 1}, {0x0f992, 2379, 1}, {0x0f993, 2380, 1}, {0x0f994, 2381, 1},
+        {0x0f995, 2382, 1}, {0x0f996, 2383, 1}, {0x0f997, 2384, 1}, {0x0f998, 2385, 1},
+        {0x0f999, 2386, 1}, {0x0f99a, 2387, 1}, {0x0f99b, 2388, 1}, {0x0f99c, 2389, 1},
+        {0x0f99d, 2390, 1}, {0x0f99e, 2391, 1}, {0x0f99f, 2392, 1}, {0x0f9a0, 2393, 1},
+        {0x0f9a1, 2344, 1}, {0x0f9a2, 2394, 1}, {0x0f9a3, 2395, 1}, {0x0f9a4, 2396, 1},
+        {0x0f9a5, 2397, 1}, {0x0f9a6, 2398, 1}, {0x0f9a7, 2399, 1}, {0x0f9a8, 2400, 1},
+        {0x0f9a9, 2401, 1}, {0x0f9aa, 2328, 1}, {0x0f9ab, 2402, 1}, {0x0f9ac, 2403, 1},
+        {0x0f9ad, 2404, 1}, {0x0f9ae, 2405, 1}, {0x0f9af, 2406, 1}, {0x0f9b0, 2407, 1},
+        {0x0f9b1, 2408, 1}, {0x0f9b2, 2409, 1}, {0x0f9b3, 2410, 1}, {0x0f9b4, 2411, 1},
+        {0x0f9b5, 2412, 1}, {0x0f9b6, 2413, 1}, {0x0f9b7, 2414, 1}, {0x0f9b8, 2415, 1},
+        {0x0f9b9, 2416, 1}, {0x0f9ba, 2417, 1}, {0x0f9bb, 2418, 1}, {0x0f9bc, 2419, 1},
+        {0x0f9bd, 2420, 1}, {0x0f9be, 2421, 1}, {0x0f9bf, 2254, 1}, {0x0f9c0, 2422, 1},
+        {0x0f9c1, 2423, 1}, {0x0f9c2, 2424, 1}, {0x0f9c3, 2425, 1}, {0x0f9c4, 2426, 1},
+        {0x0f9c5, 2427, 1}, {0x0f9c6, 2428, 1}, {0x0f9c7, 2429, 1}, {0x0f9c8, 2430, 1},
+        {0x0f9c9, 2431, 1}, {0x0f9ca, 2432, 1}, {0x0f9cb, 2433, 1}, {0x0f9cc, 2434, 1},
+        {0x0f9cd, 2435, 1}, {0x0f9ce, 2436, 1}, {0x0f9cf, 2437, 1}, {0x0f9d0, 2438, 1},
+        {0x0f9d1, 2439, 1}, {0x0f9d2, 2440, 1}, {0x0f9d3, 2441, 1}, {0x0f9d4, 2442, 1},
+        {0x0f9d5, 2443, 1}, {0x0f9d6, 2444, 1}, {0x0f9d7, 2445, 1}, {0x0f9d8, 2446, 1},
+        {0x0f9d9, 2447, 1}, {0x0f9da, 2448, 1}, {0x0f9db, 2330, 1}, {0x0f9dc, 2449, 1},
+        {0x0f9dd, 2450, 1}, {0x0f9de, 2451, 1}, {0x0f9df, 2452, 1}, {0x0f9e0, 2453, 1},
+        {0x0f9e1, 2454, 1}, {0x0f9e2, 2455, 1}, {0x0f9e3, 2456, 1}, {0x0f9e4, 2457, 1},
+        {0x0f9e5, 2458, 1}, {0x0f9e6, 2459, 1}, {0x0f9e7, 2460, 1}, {0x0f9e8, 2461, 1},
+        {0x0f9e9, 2462, 1}, {0x0f9ea, 2463, 1}, {0x0f9eb, 2464, 1}, {0x0f9ec, 2465, 1},
+        {0x0f9ed, 2466, 1}, {0x0f9ee, 2467, 1}, {0x0f9ef, 2468, 1}, {0x0f9f0, 2469, 1},
+        {0x0f9f1, 2470, 1}, {0x0f9f2, 2471, 1}, {0x0f9f3, 2472, 1}, {0x0f9f4, 2473, 1},
+        {0x0f9f5, 2474, 1}, {0x0f9f6, 2475, 1}, {0x0f9f7, 2476, 1}, {0x0f9f8, 2477, 1},
+        {0x0f9f9, 2478, 1}, {0x0f9fa, 2479, 1}, {0x0f9fb, 2480, 1}, {0x0f9fc, 2481, 1},
+        {0x0f9fd, 2482, 1}, {0x0f9fe, 2483, 1}, {0x0f9ff, 2484, 1}, {0x0fa00, 2485, 1},
+        {0x0fa01, 2486, 1}, {0x0fa02, 2487, 1}, {0x0fa03, 2488, 1}, {0x0fa04, 2489, 1},
+        {0x0fa05, 2490, 1}, {0x0fa06, 2491, 1}, {0x0fa07, 2492, 1}, {0x0fa08, 2493, 1},
+        {0x0fa09, 2494, 1}, {0x0fa0a, 2495, 1}, {0x0fa0b, 2496, 1}, {0x0fa0c, 2497, 1},
+        {0x0fa0d, 2498, 1}, {0x0fa10, 2499, 1}, {0x0fa12, 2500, 1}, {0x0fa15, 2501, 1},
+        {0x0fa16, 2502, 1}, {0x0fa17, 2503, 1}, {0x0fa18, 2504, 1}, {0x0fa19, 2505, 1},
+        {0x0fa1a, 2506, 1}, {0x0fa1b, 2507, 1}, {0x0fa1c, 2508, 1}, {0x0fa1d, 2509, 1},
+        {0x0fa1e, 2510, 1}, {0x0fa20, 2511, 1}, {0x0fa22, 2512, 1}, {0x0fa25, 2513, 1},
+        {0x0fa26, 2514, 1}, {0x0fa2a, 2515, 1}, {0x0fa2b, 2516, 1}, {0x0fa2c, 2517, 1},
+        {0x0fa2d, 2518, 1}, {0x0fa2e, 2519, 1}, {0x0fa2f, 2520, 1}, {0x0fa30, 2521, 1},
+        {0x0fa31, 2522, 1}, {0x0fa32, 2523, 1}, {0x0fa33, 2524, 1}, {0x0fa34, 2525, 1},
+        {0x0fa35, 2526, 1}, {0x0fa36, 2527, 1}, {0x0fa37, 2528, 1}, {0x0fa38, 2529, 1},
+        {0x0fa39, 2530, 1}, {0x0fa3a, 2531, 1}, {0x0fa3b, 2532, 1}, {0x0fa3c, 2533, 1},
+        {0x0fa3d, 2534, 1}, {0x0fa3e, 2535, 1}, {0x0fa3f, 2536, 1}, {0x0fa40, 2537, 1},
+        {0x0fa41, 2538, 1}, {0x0fa42, 2539, 1}, {0x0fa43, 2540, 1}, {0x0fa44, 2541, 1},
+        {0x0fa45, 2542, 1}, {0x0fa46, 2543, 1}, {0x0fa47, 2544, 1}, {0x0fa48, 2545, 1},
+        {0x0fa49, 2546, 1}, {0x0fa4a, 2547, 1}, {0x0fa4b, 2548, 1}, {0x0fa4c, 2549, 1},
+        {0x0fa4d, 2550, 1}, {0x0fa4e, 2551, 1}, {0x0fa4f, 2552, 1}, {0x0fa50, 2553, 1},
+        {0x0fa51, 2554, 1}, {0x0fa52, 2555, 1}, {0x0fa53, 2556, 1}, {0x0fa54, 2557, 1},
+        {0x0fa55, 2558, 1}, {0x0fa56, 2559, 1}, {0x0fa57, 2383, 1}, {0x0fa58, 2560, 1},
+        {0x0fa59, 2561, 1}, {0x0fa5a, 2562, 1}, {0x0fa5b, 2563, 1}, {0x0fa5c, 2564, 1},
+        {0x0fa5d, 2565, 1}, {0x0fa5e, 2565, 1}, {0x0fa5f, 2566, 1}, {0x0fa60, 2567, 1},
+        {0x0fa61, 2568, 1}, {0x0fa62, 2569, 1}, {0x0fa63, 2570, 1}, {0x0fa64, 2571, 1},
+        {0x0fa65, 2572, 1}, {0x0fa66, 2573, 1}, {0x0fa67, 2513, 1}, {0x0fa68, 2574, 1},
+        {0x0fa69, 2575, 1}, {0x0fa6a, 2576, 1}, {0x0fa6b, 2577, 1}, {0x0fa6c, 2578, 1},
+        {0x0fa6d, 2579, 1}, {0x0fa70, 2580, 1}, {0x0fa71, 2581, 1}, {0x0fa72, 2582, 1},
+        {0x0fa73, 2583, 1}, {0x0fa74, 2584, 1}, {0x0fa75, 2585, 1}, {0x0fa76, 2586, 1},
+        {0x0fa77, 2587, 1}, {0x0fa78, 2527, 1}, {0x0fa79, 2588, 1}, {0x0fa7a, 2589, 1},
+        {0x0fa7b, 2590, 1}, {0x0fa7c, 2499, 1}, {0x0fa7d, 2591, 1}, {0x0fa7e, 2592, 1},
+        {0x0fa7f, 2593, 1}, {0x0fa80, 2594, 1}, {0x0fa81, 2595, 1}, {0x0fa82, 2596, 1},
+        {0x0fa83, 2597, 1}, {0x0fa84, 2598, 1}, {0x0fa85, 2599, 1}, {0x0fa86, 2600, 1},
+        {0x0fa87, 2601, 1}, {0x0fa88, 2602, 1}, {0x0fa89, 2536, 1}, {0x0fa8a, 2603, 1},
+        {0x0fa8b, 2537, 1}, {0x0fa8c, 2604, 1}, {0x0fa8d, 2605, 1}, {0x0fa8e, 2606, 1},
+        {0x0fa8f, 2607, 1}, {0x0fa90, 2608, 1}, {0x0fa91, 2500, 1}, {0x0fa92, 2275, 1},
+        {0x0fa93, 2609, 1}, {0x0fa94, 2610, 1}, {0x0fa95, 2611, 1}, {0x0fa96, 2345, 1},
+        {0x0fa97, 2432, 1}, {0x0fa98, 2612, 1}, {0x0fa99, 2613, 1}, {0x0fa9a, 2544, 1},
+        {0x0fa9b, 2614, 1}, {0x0fa9c, 2545, 1}, {0x0fa9d, 2615, 1}, {0x0fa9e, 2616, 1},
+        {0x0fa9f, 2617, 1}, {0x0faa0, 2502, 1}, {0x0faa1, 2618, 1}, {0x0faa2, 2619, 1},
+        {0x0faa3, 2620, 1}, {0x0faa4, 2621, 1}, {0x0faa5, 2622, 1}, {0x0faa6, 2503, 1},
+        {0x0faa7, 2623, 1}, {0x0faa8, 2624, 1}, {0x0faa9, 2625, 1}, {0x0faaa, 2626, 1},
+        {0x0faab, 2627, 1}, {0x0faac, 2628, 1}, {0x0faad, 2559, 1}, {0x0faae, 2629, 1},
+        {0x0faaf, 2630, 1}, {0x0fab0, 2383, 1}, {0x0fab1, 2631, 1}, {0x0fab2, 2563, 1},
+        {0x0fab3, 2632, 1}, {0x0fab4, 2633, 1}, {0x0fab5, 2634, 1}, {0x0fab6, 2635, 1},
+        {0x0fab7, 2636, 1}, {0x0fab8, 2568, 1}, {0x0fab9, 2637, 1}, {0x0faba, 2512, 1},
+        {0x0fabb, 2638, 1}, {0x0fabc, 2569, 1}, {0x0fabd, 2326, 1}, {0x0fabe, 2639, 1},
+        {0x0fabf, 2570, 1}, {0x0fac0, 2640, 1}, {0x0fac1, 2572, 1}, {0x0fac2, 2641, 1},
+        {0x0fac3, 2642, 1}, {0x0fac4, 2643, 1}, {0x0fac5, 2644, 1}, {0x0fac6, 2645, 1},
+        {0x0fac7, 2574, 1}, {0x0fac8, 2508, 1}, {0x0fac9, 2646, 1}, {0x0faca, 2575, 1},
+        {0x0facb, 2647, 1}, {0x0facc, 2576, 1}, {0x0facd, 2648, 1}, {0x0face, 2242, 1},
+        {0x0facf, 2649, 1}, {0x0fad0, 2650, 1}, {0x0fad1, 2651, 1}, {0x0fad2, 2652, 1},
+        {0x0fad3, 2653, 1}, {0x0fad4, 2654, 1}, {0x0fad5, 2655, 1}, {0x0fad6, 2656, 1},
+        {0x0fad7, 2657, 1}, {0x0fad8, 2658, 1}, {0x0fad9, 2659, 1}, {0x0fb1d, 2660, 2},
+        {0x0fb1f, 2662, 2}, {0x0fb2a, 2664, 2}, {0x0fb2b, 2666, 2}, {0x0fb2c, 2668, 3},
+        {0x0fb2d, 2671, 3}, {0x0fb2e, 2674, 2}, {0x0fb2f, 2676, 2}, {0x0fb30, 2678, 2},
+        {0x0fb31, 2680, 2}, {0x0fb32, 2682, 2}, {0x0fb33, 2684, 2}, {0x0fb34, 2686, 2},
+        {0x0fb35, 2688, 2}, {0x0fb36, 2690, 2}, {0x0fb38, 2692, 2}, {0x0fb39, 2694, 2},
+        {0x0fb3a, 2696, 2}, {0x0fb3b, 2698, 2}, {0x0fb3c, 2700, 2}, {0x0fb3e, 2702, 2},
+        {0x0fb40, 2704, 2}, {0x0fb41, 2706, 2}, {0x0fb43, 2708, 2}, {0x0fb44, 2710, 2},
+        {0x0fb46, 2712, 2}, {0x0fb47, 2714, 2}, {0x0fb48, 2716, 2}, {0x0fb49, 2718, 2},
+        {0x0fb4a, 2720, 2}, {0x0fb4b, 2722, 2}, {0x0fb4c, 2724, 2}, {0x0fb4d, 2726, 2},
+        {0x0fb4e, 2728, 2}, {0x1109a, 2730, 2}, {0x1109c, 2732, 2}, {0x110ab, 2734, 2},
+        {0x1112e, 2736, 2}, {0x1112f, 2738, 2}, {0x1134b, 2740, 2}, {0x1134c, 2742, 2},
+        {0x114bb, 2744, 2}, {0x114bc, 2746, 2}, {0x114be, 2748, 2}, {0x115ba, 2750, 2},
+        {0x115bb, 2752, 2}, {0x11938, 2754, 2}, {0x1d15e, 2756, 2}, {0x1d15f, 2758, 2},
+        {0x1d160, 2760, 3}, {0x1d161, 2763, 3}, {0x1d162, 2766, 3}, {0x1d163, 2769, 3},
+        {0x1d164, 2772, 3}, {0x1d1bb, 2775, 2}, {0x1d1bc, 2777, 2}, {0x1d1bd, 2779, 3},
+        {0x1d1be, 2782, 3}, {0x1d1bf, 2785, 3}, {0x1d1c0, 2788, 3}, {0x2f800, 2791, 1},
+        {0x2f801, 2792, 1}, {0x2f802, 2793, 1}, {0x2f803, 2794, 1}, {0x2f804, 2795, 1},
+        {0x2f805, 2521, 1}, {0x2f806, 2796, 1}, {0x2f807, 2797, 1}, {0x2f808, 2798, 1},
+        {0x2f809, 2799, 1}, {0x2f80a, 2522, 1}, {0x2f80b, 2800, 1}, {0x2f80c, 2801, 1},
+        {0x2f80d, 2802, 1}, {0x2f80e, 2523, 1}, {0x2f80f, 2803, 1}, {0x2f810, 2804, 1},
+        {0x2f811, 2805, 1}, {0x2f812, 2806, 1}, {0x2f813, 2807, 1}, {0x2f814, 2808, 1},
+        {0x2f815, 2809, 1}, {0x2f816, 2810, 1}, {0x2f817, 2811, 1}, {0x2f818, 2812, 1},
+        {0x2f819, 2813, 1}, {0x2f81a, 2814, 1}, {0x2f81b, 2581, 1}, {0x2f81c, 2815, 1},
+        {0x2f81d, 2816, 1}, {0x2f81e, 2817, 1}, {0x2f81f, 2818, 1}, {0x2f820, 2819, 1},
+        {0x2f821, 2820, 1}, {0x2f822, 2821, 1}, {0x2f823, 2822, 1}, {0x2f824, 2823, 1},
+        {0x2f825, 2586, 1}, {0x2f826, 2524, 1}, {0x2f827, 2525, 1}, {0x2f828, 2587, 1},
+        {0x2f829, 2824, 1}, {0x2f82a, 2825, 1}, {0x2f82b, 2332, 1}, {0x2f82c, 2826, 1},
+        {0x2f82d, 2526, 1}, {0x2f82e, 2827, 1}, {0x2f82f, 2828, 1}, {0x2f830, 2829, 1},
+        {0x2f831, 2830, 1}, {0x2f832, 2830, 1}, {0x2f833, 2830, 1}, {0x2f834, 2831, 1},
+        {0x2f835, 2832, 1}, {0x2f836, 2833, 1}, {0x2f837, 2834, 1}, {0x2f838, 2835, 1},
+        {0x2f839, 2836, 1}, {0x2f83a, 2837, 1}, {0x2f83b, 2838, 1}, {0x2f83c, 2839, 1},
+        {0x2f83d, 2840, 1}, {0x2f83e, 2841, 1}, {0x2f83f, 2842, 1}, {0x2f840, 2843, 1},
+        {0x2f841, 2844, 1}, {0x2f842, 2845, 1}, {0x2f843, 2846, 1}, {0x2f844, 2847, 1},
+        {0x2f845, 2848, 1}, {0x2f846, 2848, 1}, {0x2f847, 2589, 1}, {0x2f848, 2849, 1},
+        {0x2f849, 2850, 1}, {0x2f84a, 2851, 1}, {0x2f84b, 2852, 1}, {0x2f84c, 2528, 1},
+        {0x2f84d, 2853, 1}, {0x2f84e, 2854, 1}, {0x2f84f, 2855, 1}, {0x2f850, 2485, 1},
+        {0x2f851, 2856, 1}, {0x2f852, 2857, 1}, {0x2f853, 2858, 1}, {0x2f854, 2859, 1},
+        {0x2f855, 2860, 1}, {0x2f856, 2861, 1}, {0x2f857, 2862, 1}, {0x2f858, 2863, 1},
+        {0x2f859, 2864, 1}, {0x2f85a, 2865, 1}, {0x2f85b, 2866, 1}, {0x2f85c, 2867, 1},
+        {0x2f85d, 2868, 1}, {0x2f85e, 2869, 1}, {0x2f85f, 2870, 1}, {0x2f860, 2871, 1},
+        {0x2f861, 2872, 1}, {0x2f862, 2873, 1}, {0x2f863, 2874, 1}, {0x2f864, 2875, 1},
+        {0x2f865, 2876, 1}, {0x2f866, 2877, 1}, {0x2f867, 2878, 1}, {0x2f868, 2879, 1},
+        {0x2f869, 2880, 1}, {0x2f86a, 2881, 1}, {0x2f86b, 2881, 1}, {0x2f86c, 2882, 1},
+        {0x2f86d, 2883, 1}, {0x2f86e, 2884, 1}, {0x2f86f, 2328, 1}, {0x2f870, 2885, 1},
+        {0x2f871, 2886, 1}, {0x2f872, 2887, 1}, {0x2f873, 2888, 1}, {0x2f874, 2889, 1},
+        {0x2f875, 2890, 1}, {0x2f876, 2891, 1}, {0x2f877, 2892, 1}, {0x2f878, 2533, 1},
+        {0x2f879, 2893, 1}, {0x2f87a, 2894, 1}, {0x2f87b, 2895, 1}, {0x2f87c, 2896, 1},
+        {0x2f87d, 2897, 1}, {0x2f87e, 2898, 1}, {0x2f87f, 2899, 1}, {0x2f880, 2900, 1},
+        {0x2f881, 2901, 1}, {0x2f882, 2902, 1}, {0x2f883, 2903, 1}, {0x2f884, 2904, 1},
+        {0x2f885, 2905, 1}, {0x2f886, 2906, 1}, {0x2f887, 2907, 1}, {0x2f888, 2908, 1},
+        {0x2f889, 2909, 1}, {0x2f88a, 2910, 1}, {0x2f88b, 2911, 1}, {0x2f88c, 2912, 1},
+        {0x2f88d, 2913, 1}, {0x2f88e, 2274, 1}, {0x2f88f, 2914, 1}, {0x2f890, 2915, 1},
+        {0x2f891, 2916, 1}, {0x2f892, 2916, 1}, {0x2f893, 2917, 1}, {0x2f894, 2918, 1},
+        {0x2f895, 2918, 1}, {0x2f896, 2919, 1}, {0x2f897, 2920, 1}, {0x2f898, 2921, 1},
+        {0x2f899, 2922, 1}, {0x2f89a, 2923, 1}, {0x2f89b, 2924, 1}, {0x2f89c, 2925, 1},
+        {0x2f89d, 2926, 1}, {0x2f89e, 2927, 1}, {0x2f89f, 2928, 1}, {0x2f8a0, 2929, 1},
+        {0x2f8a1, 2930, 1}, {0x2f8a2, 2931, 1}, {0x2f8a3, 2534, 1}, {0x2f8a4, 2932, 1},
+        {0x2f8a5, 2933, 1}, {0x2f8a6, 2934, 1}, {0x2f8a7, 2935, 1}, {0x2f8a8, 2601, 1},
+        {0x2f8a9, 2935, 1}, {0x2f8aa, 2936, 1}, {0x2f8ab, 2536, 1}, {0x2f8ac, 2937, 1},
+        {0x2f8ad, 2938, 1}, {0x2f8ae, 2939, 1}, {0x2f8af, 2940, 1}, {0x2f8b0, 2537, 1},
+        {0x2f8b1, 2247, 1}, {0x2f8b2, 2941, 1}, {0x2f8b3, 2942, 1}, {0x2f8b4, 2943, 1},
+        {0x2f8b5, 2944, 1}, {0x2f8b6, 2945, 1}, {0x2f8b7, 2946, 1}, {0x2f8b8, 2947, 1},
+        {0x2f8b9, 2948, 1}, {0x2f8ba, 2949, 1}, {0x2f8bb, 2950, 1}, {0x2f8bc, 2951, 1},
+        {0x2f8bd, 2952, 1}, {0x2f8be, 2953, 1}, {0x2f8bf, 2954, 1}, {0x2f8c0, 2955, 1},
+        {0x2f8c1, 2956, 1}, {0x2f8c2, 2957, 1}, {0x2f8c3, 2958, 1}, {0x2f8c4, 2959, 1},
+        {0x2f8c5, 2960, 1}, {0x2f8c6, 2961, 1}, {0x2f8c7, 2962, 1}, {0x2f8c8, 2538, 1},
+        {0x2f8c9, 2963, 1}, {0x2f8ca, 2964, 1}, {0x2f8cb, 2965, 1}, {0x2f8cc, 2966, 1},
+        {0x2f8cd, 2967, 1}, {0x2f8ce, 2968, 1}, {0x2f8cf, 2540, 1}, {0x2f8d0, 2969, 1},
+        {0x2f8d1, 2970, 1}, {0x2f8d2, 2971, 1}, {0x2f8d3, 2972, 1}, {0x2f8d4, 2973, 1},
+        {0x2f8d5, 2974, 1}, {0x2f8d6, 2975, 1}, {0x2f8d7, 2976, 1}, {0x2f8d8, 2275, 1},
+        {0x2f8d9, 2609, 1}, {0x2f8da, 2977, 1}, {0x2f8db, 2978, 1}, {0x2f8dc, 2979, 1},
+        {0x2f8dd, 2980, 1}, {0x2f8de, 2981, 1}, {0x2f8df, 2982, 1}, {0x2f8e0, 2983, 1},
+        {0x2f8e1, 2984, 1}, {0x2f8e2, 2541, 1}, {0x2f8e3, 2985, 1}, {0x2f8e4, 2986, 1},
+        {0x2f8e5, 2987, 1}, {0x2f8e6, 2988, 1}, {0x2f8e7, 2652, 1}, {0x2f8e8, 2989, 1},
+        {0x2f8e9, 2990, 1}, {0x2f8ea, 2991, 1}, {0x2f8eb, 2992, 1}, {0x2f8ec, 2993, 1},
+        {0x2f8ed, 2994, 1}, {0x2f8ee, 2995, 1}, {0x2f8ef, 2996, 1}, {0x2f8f0, 2997, 1},
+        {0x2f8f1, 2998, 1}, {0x2f8f2, 2999, 1}, {0x2f8f3, 3000, 1}, {0x2f8f4, 3001, 1},
+        {0x2f8f5, 2345, 1}, {0x2f8f6, 3002, 1}, {0x2f8f7, 3003, 1}, {0x2f8f8, 3004, 1},
+        {0x2f8f9, 3005, 1}, {0x2f8fa, 3006, 1}, {0x2f8fb, 3007, 1}, {0x2f8fc, 3008, 1},
+        {0x2f8fd, 3009, 1}, {0x2f8fe, 3010, 1}, {0x2f8ff, 3011, 1}, {0x2f900, 3012, 1},
+        {0x2f901, 2542, 1}, {0x2f902, 2432, 1}, {0x2f903, 3013, 1}, {0x2f904, 3014, 1},
+        {0x2f905, 3015, 1}, {0x2f906, 3016, 1}, {0x2f907, 3017, 1}, {0x2f908, 3018, 1},
+        {0x2f909, 3019, 1}, {0x2f90a, 3020, 1}, {0x2f90b, 2613, 1}, {0x2f90c, 3021, 1},
+        {0x2f90d, 3022, 1}, {0x2f90e, 3023, 1}, {0x2f90f, 3024, 1}, {0x2f910, 3025, 1},
+        {0x2f911, 3026, 1}, {0x2f912, 3027, 1}, {0x2f913, 3028, 1}, {0x2f914, 2614, 1},
+        {0x2f915, 3029, 1}, {0x2f916, 3030, 1}, {0x2f917, 3031, 1}, {0x2f918, 3032, 1},
+        {0x2f919, 3033, 1}, {0x2f91a, 3034, 1}, {0x2f91b, 3035, 1}, {0x2f91c, 3036, 1},
+        {0x2f91d, 3037, 1}, {0x2f91e, 3038, 1}, {0x2f91f, 3039, 1}, {0x2f920, 3040, 1},
+        {0x2f921, 2616, 1}, {0x2f922, 3041, 1}, {0x2f923, 3042, 1}, {0x2f924, 3043, 1},
+        {0x2f925, 3044, 1}, {0x2f926, 3045, 1}, {0x2f927, 3046, 1}, {0x2f928, 3047, 1},
+        {0x2f929, 3048, 1}, {0x2f92a, 3049, 1}, {0x2f92b, 3050, 1}, {0x2f92c, 3051, 1},
+        {0x2f92d, 3051, 1}, {0x2f92e, 3052, 1}, {0x2f92f, 3053, 1}, {0x2f930, 2618, 1},
+        {0x2f931, 3054, 1}, {0x2f932, 3055, 1}, {0x2f933, 3056, 1}, {0x2f934, 3057, 1},
+        {0x2f935, 3058, 1}, {0x2f936, 3059, 1}, {0x2f937, 3060, 1}, {0x2f938, 2331, 1},
+        {0x2f939, 3061, 1}, {0x2f93a, 3062, 1}, {0x2f93b, 3063, 1}, {0x2f93c, 3064, 1},
+        {0x2f93d, 3065, 1}, {0x2f93e, 3066, 1}, {0x2f93f, 3067, 1}, {0x2f940, 2624, 1},
+        {0x2f941, 3068, 1}, {0x2f942, 3069, 1}, {0x2f943, 3070, 1}, {0x2f944, 3071, 1},
+        {0x2f945, 3072, 1}, {0x2f946, 3073, 1}, {0x2f947, 3073, 1}, {0x2f948, 2625, 1},
+        {0x2f949, 2654, 1}, {0x2f94a, 3074, 1}, {0x2f94b, 3075, 1}, {0x2f94c, 3076, 1},
+        {0x2f94d, 3077, 1}, {0x2f94e, 3078, 1}, {0x2f94f, 2293, 1}, {0x2f950, 2627, 1},
+        {0x2f951, 3079, 1}, {0x2f952, 3080, 1}, {0x2f953, 2553, 1}, {0x2f954, 3081, 1},
+        {0x2f955, 3082, 1}, {0x2f956, 2507, 1}, {0x2f957, 3083, 1}, {0x2f958, 3084, 1},
+        {0x2f959, 2557, 1}, {0x2f95a, 3085, 1}, {0x2f95b, 3086, 1}, {0x2f95c, 3087, 1},
+        {0x2f95d, 3088, 1}, {0x2f95e, 3088, 1}, {0x2f95f, 3089, 1}, {0x2f960, 3090, 1},
+        {0x2f961, 3091, 1}, {0x2f962, 3092, 1}, {0x2f963, 3093, 1}, {0x2f964, 3094, 1},
+        {0x2f965, 3095, 1}, {0x2f966, 3096, 1}, {0x2f967, 3097, 1}, {0x2f968, 3098, 1},
+        {0x2f969, 3099, 1}, {0x2f96a, 3100, 1}, {0x2f96b, 3101, 1}, {0x2f96c, 3102, 1},
+        {0x2f96d, 3103, 1}, {0x2f96e, 3104, 1}, {0x2f96f, 3105, 1}, {0x2f970, 3106, 1},
+        {0x2f971, 3107, 1}, {0x2f972, 3108, 1}, {0x2f973, 3109, 1}, {0x2f974, 3110, 1},
+        {0x2f975, 3111, 1}, {0x2f976, 3112, 1}, {0x2f977, 3113, 1}, {0x2f978, 3114, 1},
+        {0x2f979, 3115, 1}, {0x2f97a, 2563, 1}, {0x2f97b, 3116, 1}, {0x2f97c, 3117, 1},
+        {0x2f97d, 3118, 1}, {0x2f97e, 3119, 1}, {0x2f97f, 3120, 1}, {0x2f980, 3121, 1},
+        {0x2f981, 3122, 1}, {0x2f982, 3123, 1}, {0x2f983, 3124, 1}, {0x2f984, 3125, 1},
+        {0x2f985, 3126, 1}, {0x2f986, 3127, 1}, {0x2f987, 3128, 1}, {0x2f988, 3129, 1},
+        {0x2f989, 3130, 1}, {0x2f98a, 3131, 1}, {0x2f98b, 2917, 1}, {0x2f98c, 3132, 1},
+        {0x2f98d, 3133, 1}, {0x2f98e, 3134, 1}, {0x2f98f, 3135, 1}, {0x2f990, 3136, 1},
+        {0x2f991, 3137, 1}, {0x2f992, 3138, 1}, {0x2f993, 3139, 1}, {0x2f994, 3140, 1},
+        {0x2f995, 3141, 1}, {0x2f996, 3142, 1}, {0x2f997, 3143, 1}, {0x2f998, 2349, 1},
+        {0x2f999, 3144, 1}, {0x2f99a, 3145, 1}, {0x2f99b, 3146, 1}, {0x2f99c, 3147, 1},
+        {0x2f99d, 3148, 1}, {0x2f99e, 3149, 1}, {0x2f99f, 2566, 1}, {0x2f9a0, 3150, 1},
+        {0x2f9a1, 3151, 1}, {0x2f9a2, 3152, 1}, {0x2f9a3, 3153, 1}, {0x2f9a4, 3154, 1},
+        {0x2f9a5, 3155, 1}, {0x2f9a6, 3156, 1}, {0x2f9a7, 3157, 1}, {0x2f9a8, 3158, 1},
+        {0x2f9a9, 3159, 1}, {0x2f9aa, 3160, 1}, {0x2f9ab, 3161, 1}, {0x2f9ac, 3162, 1},
+        {0x2f9ad, 3163, 1}, {0x2f9ae, 3164, 1}, {0x2f9af, 3165, 1}, {0x2f9b0, 3166, 1},
+        {0x2f9b1, 3167, 1}, {0x2f9b2, 3168, 1}, {0x2f9b3, 3169, 1}, {0x2f9b4, 2288, 1},
+        {0x2f9b5, 3170, 1}, {0x2f9b6, 3171, 1}, {0x2f9b7, 3172, 1}, {0x2f9b8, 3173, 1},
+        {0x2f9b9, 3174, 1}, {0x2f9ba, 3175, 1}, {0x2f9bb, 2634, 1}, {0x2f9bc, 3176, 1},
+        {0x2f9bd, 3177, 1}, {0x2f9be, 3178, 1}, {0x2f9bf, 3179, 1}, {0x2f9c0, 3180, 1},
+        {0x2f9c1, 3181, 1}, {0x2f9c2, 3182, 1}, {0x2f9c3, 3183, 1}, {0x2f9c4, 3184, 1},
+        {0x2f9c5, 3185, 1}, {0x2f9c6, 3186, 1}, {0x2f9c7, 3187, 1}, {0x2f9c8, 3188, 1},
+        {0x2f9c9, 3189, 1}, {0x2f9ca, 3190, 1}, {0x2f9cb, 3191, 1}, {0x2f9cc, 3192, 1},
+        {0x2f9cd, 3193, 1}, {0x2f9ce, 3194, 1}, {0x2f9cf, 3195, 1}, {0x2f9d0, 2639, 1},
+        {0x2f9d1, 2640, 1}, {0x2f9d2, 3196, 1}, {0x2f9d3, 3197, 1}, {0x2f9d4, 3198, 1},
+        {0x2f9d5, 3199, 1}, {0x2f9d6, 3200, 1}, {0x2f9d7, 3201, 1}, {0x2f9d8, 3202, 1},
+        {0x2f9d9, 3203, 1}, {0x2f9da, 3204, 1}, {0x2f9db, 3205, 1}, {0x2f9dc, 3206, 1},
+        {0x2f9dd, 3207, 1}, {0x2f9de, 3208, 1}, {0x2f9df, 2641, 1}, {0x2f9e0, 3209, 1},
+        {0x2f9e1, 3210, 1}, {0x2f9e2, 3211, 1}, {0x2f9e3, 3212, 1}, {0x2f9e4, 3213, 1},
+        {0x2f9e5, 3214, 1}, {0x2f9e6, 3215, 1}, {0x2f9e7, 3216, 1}, {0x2f9e8, 3217, 1},
+        {0x2f9e9, 3218, 1}, {0x2f9ea, 3219, 1}, {0x2f9eb, 3220, 1}, {0x2f9ec, 3221, 1},
+        {0x2f9ed, 3222, 1}, {0x2f9ee, 3223, 1}, {0x2f9ef, 3224, 1}, {0x2f9f0, 3225, 1},
+        {0x2f9f1, 3226, 1}, {0x2f9f2, 3227, 1}, {0x2f9f3, 3228, 1}, {0x2f9f4, 3229, 1},
+        {0x2f9f5, 3230, 1}, {0x2f9f6, 3231, 1}, {0x2f9f7, 3232, 1}, {0x2f9f8, 3233, 1},
+        {0x2f9f9, 3234, 1}, {0x2f9fa, 3235, 1}, {0x2f9fb, 3236, 1}, {0x2f9fc, 3237, 1},
+        {0x2f9fd, 3238, 1}, {0x2f9fe, 2647, 1}, {0x2f9ff, 2647, 1}, {0x2fa00, 3239, 1},
+        {0x2fa01, 3240, 1}, {0x2fa02, 3241, 1}, {0x2fa03, 3242, 1}, {0x2fa04, 3243, 1},
+        {0x2fa05, 3244, 1}, {0x2fa06, 3245, 1}, {0x2fa07, 3246, 1}, {0x2fa08, 3247, 1},
+        {0x2fa09, 3248, 1}, {0x2fa0a, 2648, 1}, {0x2fa0b, 3249, 1}, {0x2fa0c, 3250, 1},
+        {0x2fa0d, 3251, 1}, {0x2fa0e, 3252, 1}, {0x2fa0f, 3253, 1}, {0x2fa10, 3254, 1},
+        {0x2fa11, 3255, 1}, {0x2fa12, 3256, 1}, {0x2fa13, 3257, 1}, {0x2fa14, 3258, 1},
+        {0x2fa15, 3259, 1}, {0x2fa16, 3260, 1}, {0x2fa17, 3261, 1}, {0x2fa18, 3262, 1},
+        {0x2fa19, 3263, 1}, {0x2fa1a, 3264, 1}, {0x2fa1b, 3265, 1}, {0x2fa1c, 3266, 1},
+        {0x2fa1d, 3267, 1},
+    };
+
+    // Full compatibility decompositions, sorted by code point.
+    inline constexpr DecompositionEntry COMPATIBILITY_DECOMPOSITIONS[3812] = {
+        {0x000a0, 3268, 1}, {0x000a8, 3269, 2}, {0x000aa, 3271, 1}, {0x000af, 3272, 2},
+        {0x000b2, 3274, 1}, {0x000b3, 3275, 1}, {0x000b4, 3276, 2}, {0x000b5, 3278, 1},
+        {0x000b8, 3279, 2}, {0x000b9, 3281, 1}, {0x000ba, 3282, 1}, {0x000bc, 3283, 3},
+        {0x000bd, 3286, 3}, {0x000be, 3289, 3}, {0x00132, 3292, 2}, {0x00133, 3294, 2},
+        {0x0013f, 3296, 2}, {0x00140, 3298, 2}, {0x00149, 3300, 2}, {0x0017f, 3302, 1},
+        {0x001c4, 3303, 3}, {0x001c5, 3306, 3}, {0x001c6, 3309, 3}, {0x001c7, 3312, 2},
+        {0x001c8, 3314, 2}, {0x001c9, 3316, 2}, {0x001ca, 3318, 2}, {0x001cb, 3320, 2},
+        {0x001cc, 3322, 2}, {0x001f1, 3324, 2}, {0x001f2, 3326, 2}, {0x001f3, 3328, 2},
+        {0x002b0, 3330, 1}, {0x002b1, 3331, 1}, {0x002b2, 3332, 1}, {0x002b3, 3333, 1},
+        {0x002b4, 3334, 1}, {0x002b5, 3335, 1}, {0x002b6, 3336, 1}, {0x002b7, 3337, 1},
+        {0x002b8, 3338, 1}, {0x002d8, 3339, 2}, {0x002d9, 3341, 2}, {0x002da, 3343, 2},
+        {0x002db, 3345, 2}, {0x002dc, 3347, 2}, {0x002dd, 3349, 2}, {0x002e0, 3351, 1},
+        {0x002e1, 3352, 1}, {0x002e2, 3302, 1}, {0x002e3, 3353, 1}, {0x002e4, 3354, 1},
+        {0x0037a, 3355, 2}, {0x00384, 3276, 2}, {0x00385, 3357, 3}, {0x003d0, 3360, 1},
+        {0x003d1, 3361, 1}, {0x003d2, 3362, 1}, {0x003d3, 546, 2}, {0x003d4, 555, 2},
+        {0x003d5, 3363, 1}, {0x003d6, 3364, 1}, {0x003f0, 3365, 1}, {0x003f1, 3366, 1},
+        {0x003f2, 3367, 1}, {0x003f4, 3368, 1}, {0x003f5, 3369, 1}, {0x003f9, 3370, 1},
+        {0x00587, 3371, 2}, {0x00675, 3373, 2}, {0x00676, 3375, 2}, {0x00677, 3377, 2},
+        {0x00678, 3379, 2}, {0x00e33, 3381, 2}, {0x00eb3, 3383, 2}, {0x00edc, 3385, 2},
+        {0x00edd, 3387, 2}, {0x00f0c, 3389, 1}, {0x00f77, 3390, 3}, {0x00f79, 3393, 3},
+        {0x010fc, 3396, 1}, {0x01d2c, 3397, 1}, {0x01d2d, 3398, 1}, {0x01d2e, 3399, 1},
+        {0x01d30, 3400, 1}, {0x01d31, 3401, 1}, {0x01d32, 3402, 1}, {0x01d33, 3403, 1},
+        {0x01d34, 3404, 1}, {0x01d35, 3405, 1}, {0x01d36, 3406, 1}, {0x01d37, 2026, 1},
+        {0x01d38, 3407, 1}, {0x01d39, 3408, 1}, {0x01d3a, 3409, 1}, {0x01d3c, 3410, 1},
+        {0x01d3d, 3411, 1}, {0x01d3e, 3412, 1}, {0x01d3f, 3413, 1}, {0x01d40, 3414, 1},
+        {0x01d41, 3415, 1}, {0x01d42, 3416, 1}, {0x01d43, 3271, 1}, {0x01d44, 3417, 1},
+        {0x01d45, 3418, 1}, {0x01d46, 3419, 1}, {0x01d47, 3420, 1}, {0x01d48, 3421, 1},
+        {0x01d49, 3422, 1}, {0x01d4a, 3423, 1}, {0x01d4b, 3424, 1}, {0x01d4c, 3425, 1},
+        {0x01d4d, 3426, 1}, {0x01d4f, 3427, 1}, {0x01d50, 3428, 1}, {0x01d51, 3429, 1},
+        {0x01d52, 3282, 1}, {0x01d53, 3430, 1}, {0x01d54, 3431, 1}, {0x01d55, 3432, 1},
+        {0x01d56, 3433, 1}, {0x01d57, 3434, 1}, {0x01d58, 3435, 1}, {0x01d59, 3436, 1},
+        {0x01d5a, 3437, 1}, {0x01d5b, 3438, 1}, {0x01d5c, 3439, 1}, {0x01d5d, 3360, 1},
+        {0x01d5e, 3440, 1}, {0x01d5f, 3441, 1}, {0x01d60, 3363, 1}, {0x01d61, 3442, 1},
+        {0x01d62, 3443, 1}, {0x01d63, 3333, 1}, {0x01d64, 3435, 1}, {0x01d65, 3438, 1},
+        {0x01d66, 3360, 1}, {0x01d67, 3440, 1}, {0x01d68, 3366, 1}, {0x01d69, 3363, 1},
+        {0x01d6a, 3442, 1}, {0x01d78, 3444, 1}, {0x01d9b, 3445, 1}, {0x01d9c, 3446, 1},
+        {0x01d9d, 3447, 1}, {0x01d9e, 3448, 1}, {0x01d9f, 3425, 1}, {0x01da0, 3449, 1},
+        {0x01da1, 3450, 1}, {0x01da2, 3451, 1}, {0x01da3, 3452, 1}, {0x01da4, 3453, 1},
+        {0x01da5, 3454, 1}, {0x01da6, 3455, 1}, {0x01da7, 3456, 1}, {0x01da8, 3457, 1},
+        {0x01da9, 3458, 1}, {0x01daa, 3459, 1}, {0x01dab, 3460, 1}, {0x01dac, 3461, 1},
+        {0x01dad, 3462, 1}, {0x01dae, 3463, 1}, {0x01daf, 3464, 1}, {0x01db0, 3465, 1},
+        {0x01db1, 3466, 1}, {0x01db2, 3467, 1}, {0x01db3, 3468, 1}, {0x01db4, 3469, 1},
+        {0x01db5, 3470, 1}, {0x01db6, 3471, 1}, {0x01db7, 3472, 1}, {0x01db8, 3473, 1},
+        {0x01db9, 3474, 1}, {0x01dba, 3475, 1}, {0x01dbb, 3476, 1}, {0x01dbc, 3477, 1},
+        {0x01dbd, 3478, 1}, {0x01dbe, 3479, 1}, {0x01dbf, 3361, 1}, {0x01e9a, 3480, 2},
+        {0x01e9b, 1066, 2}, {0x01fbd, 3482, 2}, {0x01fbf, 3482, 2}, {0x01fc0, 3484, 2},
+        {0x01fc1, 3486, 3}, {0x01fcd, 3489, 3}, {0x01fce, 3492, 3}, {0x01fcf, 3495, 3},
+        {0x01fdd, 3498, 3}, {0x01fde, 3501, 3}, {0x01fdf, 3504, 3}, {0x01fed, 3507, 3},
+        {0x01fee, 3357, 3}, {0x01ffd, 3276, 2}, {0x01ffe, 3510, 2}, {0x02000, 3268, 1},
+        {0x02001, 3268, 1}, {0x02002, 3268, 1}, {0x02003, 3268, 1}, {0x02004, 3268, 1},
+        {0x02005, 3268, 1}, {0x02006, 3268, 1}, {0x02007, 3268, 1}, {0x02008, 3268, 1},
+        {0x02009, 3268, 1}, {0x0200a, 3268, 1}, {0x02011, 3512, 1}, {0x02017, 3513, 2},
+        {0x02024, 3515, 1}, {0x02025, 3516, 2}, {0x02026, 3518, 3}, {0x0202f, 3268, 1},
+        {0x02033, 3521, 2}, {0x02034, 3523, 3}, {0x02036, 3526, 2}, {0x02037, 3528, 3},
+        {0x0203c, 3531, 2}, {0x0203e, 3533, 2}, {0x02047, 3535, 2}, {0x02048, 3537, 2},
+        {0x02049, 3539, 2}, {0x02057, 3541, 4}, {0x0205f, 3268, 1}, {0x02070, 3545, 1},
+        {0x02071, 3443, 1}, {0x02074, 3546, 1}, {0x02075, 3547, 1}, {0x02076, 3548, 1},
+        {0x02077, 3549, 1}, {0x02078, 3550, 1}, {0x02079, 3551, 1}, {0x0207a, 3552, 1},
+        {0x0207b, 3553, 1}, {0x0207c, 3554, 1}, {0x0207d, 3555, 1}, {0x0207e, 3556, 1},
+        {0x0207f, 3557, 1}, {0x02080, 3545, 1}, {0x02081, 3281, 1}, {0x02082, 3274, 1},
+        {0x02083, 3275, 1}, {0x02084, 3546, 1}, {0x02085, 3547, 1}, {0x02086, 3548, 1},
+        {0x02087, 3549, 1}, {0x02088, 3550, 1}, {0x02089, 3551, 1}, {0x0208a, 3552, 1},
+        {0x0208b, 3553, 1}, {0x0208c, 3554, 1}, {0x0208d, 3555, 1}, {0x0208e, 3556, 1},
+        {0x02090, 3271, 1}, {0x02091, 3422, 1}, {0x02092, 3282, 1}, {0x02093, 3353, 1},
+        {0x02094, 3423, 1}, {0x02095, 3330, 1}, {0x02096, 3427, 1}, {0x02097, 3352, 1},
+        {0x02098, 3428, 1}, {0x02099, 3557, 1}, {0x0209a, 3433, 1}, {0x0209b, 3302, 1},
+        {0x0209c, 3434, 1}, {0x020a8, 3558, 2}, {0x02100, 3560, 3}, {0x02101, 3563, 3},
+        {0x02102, 3566, 1}, {0x02103, 3567, 2}, {0x02105, 3569, 3}, {0x02106, 3572, 3},
+        {0x02107, 3575, 1}, {0x02109, 3576, 2}, {0x0210a, 3426, 1}, {0x0210b, 3404, 1},
+        {0x0210c, 3404, 1}, {0x0210d, 3404, 1}, {0x0210e, 3330, 1}, {0x0210f, 3578, 1},
+        {0x02110, 3405, 1}, {0x02111, 3405, 1}, {0x02112, 3407, 1}, {0x02113, 3352, 1},
+        {0x02115, 3409, 1}, {0x02116, 3579, 2}, {0x02119, 3412, 1}, {0x0211a, 3581, 1},
+        {0x0211b, 3413, 1}, {0x0211c, 3413, 1}, {0x0211d, 3413, 1}, {0x02120, 3582, 2},
+        {0x02121, 3584, 3}, {0x02122, 3587, 2}, {0x02124, 3589, 1}, {0x02128, 3589, 1},
+        {0x0212c, 3399, 1}, {0x0212d, 3566, 1}, {0x0212f, 3422, 1}, {0x02130, 3401, 1},
+        {0x02131, 3590, 1}, {0x02133, 3408, 1}, {0x02134, 3282, 1}, {0x02135, 3591, 1},
+        {0x02136, 3592, 1}, {0x02137, 3593, 1}, {0x02138, 3594, 1}, {0x02139, 3443, 1},
+        {0x0213b, 3595, 3}, {0x0213c, 3364, 1}, {0x0213d, 3440, 1}, {0x0213e, 3598, 1},
+        {0x0213f, 3599, 1}, {0x02140, 3600, 1}, {0x02145, 3400, 1}, {0x02146, 3421, 1},
+        {0x02147, 3422, 1}, {0x02148, 3443, 1}, {0x02149, 3332, 1}, {0x02150, 3601, 3},
+        {0x02151, 3604, 3}, {0x02152, 3607, 4}, {0x02153, 3611, 3}, {0x02154, 3614, 3},
+        {0x02155, 3617, 3}, {0x02156, 3620, 3}, {0x02157, 3623, 3}, {0x02158, 3626, 3},
+        {0x02159, 3629, 3}, {0x0215a, 3632, 3}, {0x0215b, 3635, 3}, {0x0215c, 3638, 3},
+        {0x0215d, 3641, 3}, {0x0215e, 3644, 3}, {0x0215f, 3647, 2}, {0x02160, 3405, 1},
+        {0x02161, 3649, 2}, {0x02162, 3651, 3}, {0x02163, 3654, 2}, {0x02164, 3656, 1},
+        {0x02165, 3657, 2}, {0x02166, 3659, 3}, {0x02167, 3662, 4}, {0x02168, 3666, 2},
+        {0x02169, 3668, 1}, {0x0216a, 3669, 2}, {0x0216b, 3671, 3}, {0x0216c, 3407, 1},
+        {0x0216d, 3566, 1}, {0x0216e, 3400, 1}, {0x0216f, 3408, 1}, {0x02170, 3443, 1},
+        {0x02171, 3674, 2}, {0x02172, 3676, 3}, {0x02173, 3679, 2}, {0x02174, 3438, 1},
+        {0x02175, 3681, 2}, {0x02176, 3683, 3}, {0x02177, 3686, 4}, {0x02178, 3690, 2},
+        {0x02179, 3353, 1}, {0x0217a, 3692, 2}, {0x0217b, 3694, 3}, {0x0217c, 3352, 1},
+        {0x0217d, 3446, 1}, {0x0217e, 3421, 1}, {0x0217f, 3428, 1}, {0x02189, 3697, 3},
+        {0x0222c, 3700, 2}, {0x0222d, 3702, 3}, {0x0222f, 3705, 2}, {0x02230, 3707, 3},
+        {0x02460, 3281, 1}, {0x02461, 3274, 1}, {0x02462, 3275, 1}, {0x02463, 3546, 1},
+        {0x02464, 3547, 1}, {0x02465, 3548, 1}, {0x02466, 3549, 1}, {0x02467, 3550, 1},
+        {0x02468, 3551, 1}, {0x02469, 3710, 2}, {0x0246a, 3712, 2}, {0x0246b, 3714, 2},
+        {0x0246c, 3716, 2}, {0x0246d, 3718, 2}, {0x0246e, 3720, 2}, {0x0246f, 3722, 2},
+        {0x02470, 3724, 2}, {0x02471, 3726, 2}, {0x02472, 3728, 2}, {0x02473, 3730, 2},
+        {0x02474, 3732, 3}, {0x02475, 3735, 3}, {0x02476, 3738, 3}, {0x02477, 3741, 3},
+        {0x02478, 3744, 3}, {0x02479, 3747, 3}, {0x0247a, 3750, 3}, {0x0247b, 3753, 3},
+        {0x0247c, 3756, 3}, {0x0247d, 3759, 4}, {0x0247e, 3763, 4}, {0x0247f, 3767, 4},
+        {0x02480, 3771, 4}, {0x02481, 3775, 4}, {0x02482, 3779, 4}, {0x02483, 3783, 4},
+        {0x02484, 3787, 4}, {0x02485, 3791, 4}, {0x02486, 3795, 4}, {0x02487, 3799, 4},
+        {0x02488, 3803, 2}, {0x02489, 3805, 2}, {0x0248a, 3807, 2}, {0x0248b, 3809, 2},
+        {0x0248c, 3811, 2}, {0x0248d, 3813, 2}, {0x0248e, 3815, 2}, {0x0248f, 3817, 2},
+        {0x02490, 3819, 2}, {0x02491, 3821, 3}, {0x02492, 3824, 3}, {0x02493, 3827, 3},
+        {0x02494, 3830, 3}, {0x02495, 3833, 3}, {0x02496, 3836, 3}, {0x02497, 3839, 3},
+        {0x02498, 3842, 3}, {0x02499, 3845, 3}, {0x0249a, 3848, 3}, {0x0249b, 3851, 3},
+        {0x0249c, 3854, 3}, {0x0249d, 3857, 3}, {0x0249e, 3860, 3}, {0x0249f, 3863, 3},
+        {0x024a0, 3866, 3}, {0x024a1, 3869, 3}, {0x024a2, 3872, 3}, {0x024a3, 3875, 3},
+        {0x024a4, 3878, 3}, {0x024a5, 3881, 3}, {0x024a6, 3884, 3}, {0x024a7, 3887, 3},
+        {0x024a8, 3890, 3}, {0x024a9, 3893, 3}, {0x024aa, 3896, 3}, {0x024ab, 3899, 3},
+        {0x024ac, 3902, 3}, {0x024ad, 3905, 3}, {0x024ae, 3908, 3}, {0x024af, 3911, 3},
+        {0x024b0, 3914, 3}, {0x024b1, 3917, 3}, {0x024b2, 3920, 3}, {0x024b3, 3923, 3},
+        {0x024b4, 3926, 3}, {0x024b5, 3929, 3}, {0x024b6, 3397, 1}, {0x024b7, 3399, 1},
+        {0x024b8, 3566, 1}, {0x024b9, 3400, 1}, {0x024ba, 3401, 1}, {0x024bb, 3590, 1},
+        {0x024bc, 3403, 1}, {0x024bd, 3404, 1}, {0x024be, 3405, 1}, {0x024bf, 3406, 1},
+        {0x024c0, 2026, 1}, {0x024c1, 3407, 1}, {0x024c2, 3408, 1}, {0x024c3, 3409, 1},
+        {0x024c4, 3410, 1}, {0x024c5, 3412, 1}, {0x024c6, 3581, 1}, {0x024c7, 3413, 1},
+        {0x024c8, 3932, 1}, {0x024c9, 3414, 1}, {0x024ca, 3415, 1}, {0x024cb, 3656, 1},
+        {0x024cc, 3416, 1}, {0x024cd, 3668, 1}, {0x024ce, 3933, 1}, {0x024cf, 3589, 1},
+        {0x024d0, 3271, 1}, {0x024d1, 3420, 1}, {0x024d2, 3446, 1}, {0x024d3, 3421, 1},
+        {0x024d4, 3422, 1}, {0x024d5, 3449, 1}, {0x024d6, 3426, 1}, {0x024d7, 3330, 1},
+        {0x024d8, 3443, 1}, {0x024d9, 3332, 1}, {0x024da, 3427, 1}, {0x024db, 3352, 1},
+        {0x024dc, 3428, 1}, {0x024dd, 3557, 1}, {0x024de, 3282, 1}, {0x024df, 3433, 1},
+        {0x024e0, 3934, 1}, {0x024e1, 3333, 1}, {0x024e2, 3302, 1}, {0x024e3, 3434, 1},
+        {0x024e4, 3435, 1}, {0x024e5, 3438, 1}, {0x024e6, 3337, 1}, {0x024e7, 3353, 1},
+        {0x024e8, 3338, 1}, {0x024e9, 3476, 1}, {0x024ea, 3545, 1}, {0x02a0c, 3935, 4},
+        {0x02a74, 3939, 3}, {0x02a75, 3942, 2}, {0x02a76, 3944, 3}, {0x02c7c, 3332, 1},
+        {0x02c7d, 3656, 1}, {0x02d6f, 3947, 1}, {0x02e9f, 3948, 1}, {0x02ef3, 3949, 1},
+        {0x02f00, 3950, 1}, {0x02f01, 3951, 1}, {0x02f02, 3952, 1}, {0x02f03, 3953, 1},
+        {0x02f04, 3954, 1}, {0x02f05, 3955, 1}, {0x02f06, 3956, 1}, {0x02f07, 3957, 1},
+        {0x02f08, 3958, 1}, {0x02f09, 3959, 1}, {0x02f0a, 3960, 1}, {0x02f0b, 3961, 1},
+        {0x02f0c, 3962, 1}, {0x02f0d, 3963, 1}, {0x02f0e, 3964, 1}, {0x02f0f, 3965, 1},
+        {0x02f10, 2816, 1}, {0x02f11, 3966, 1}, {0x02f12, 2371, 1}, {0x02f13, 3967, 1},
+        {0x02f14, 3968, 1}, {0x02f15, 3969, 1}, {0x02f16, 3970, 1}, {0x02f17, 3971, 1},
+        {0x02f18, 3972, 1}, {0x02f19, 3973, 1}, {0x02f1a, 3974, 1}, {0x02f1b, 3975, 1},
+        {0x02f1c, 3976, 1}, {0x02f1d, 3977, 1}, {0x02f1e, 3978, 1}, {0x02f1f, 3979, 1},
+        {0x02f20, 3980, 1}, {0x02f21, 3981, 1}, {0x02f22, 3982, 1}, {0x02f23, 3983, 1},
+        {0x02f24, 3984, 1}, {0x02f25, 2362, 1}, {0x02f26, 3985, 1}, {0x02f27, 3986, 1},
+        {0x02f28, 3987, 1}, {0x02f29, 3988, 1}, {0x02f2a, 2890, 1}, {0x02f2b, 3989, 1},
+        {0x02f2c, 2533, 1}, {0x02f2d, 3990, 1}, {0x02f2e, 3991, 1}, {0x02f2f, 3992, 1},
+        {0x02f30, 3993, 1}, {0x02f31, 3994, 1}, {0x02f32, 3995, 1}, {0x02f33, 3996, 1},
+        {0x02f34, 3997, 1}, {0x02f35, 3998, 1}, {0x02f36, 2915, 1}, {0x02f37, 3999, 1},
+        {0x02f38, 4000, 1}, {0x02f39, 4001, 1}, {0x02f3a, 4002, 1}, {0x02f3b, 4003, 1},
+        {0x02f3c, 4004, 1}, {0x02f3d, 4005, 1}, {0x02f3e, 4006, 1}, {0x02f3f, 4007, 1},
+        {0x02f40, 4008, 1}, {0x02f41, 4009, 1}, {0x02f42, 4010, 1}, {0x02f43, 4011, 1},
+        {0x02f44, 4012, 1}, {0x02f45, 4013, 1}, {0x02f46, 4014, 1}, {0x02f47, 4015, 1},
+        {0x02f48, 4016, 1}, {0x02f49, 4017, 1}, {0x02f4a, 4018, 1}, {0x02f4b, 4019, 1},
+        {0x02f4c, 4020, 1}, {0x02f4d, 2611, 1}, {0x02f4e, 4021, 1}, {0x02f4f, 4022, 1},
+        {0x02f50, 4023, 1}, {0x02f51, 4024, 1}, {0x02f52, 4025, 1}, {0x02f53, 4026, 1},
+        {0x02f54, 4027, 1}, {0x02f55, 4028, 1}, {0x02f56, 4029, 1}, {0x02f57, 4030, 1},
+        {0x02f58, 4031, 1}, {0x02f59, 4032, 1}, {0x02f5a, 4033, 1}, {0x02f5b, 4034, 1},
+        {0x02f5c, 4035, 1}, {0x02f5d, 4036, 1}, {0x02f5e, 4037, 1}, {0x02f5f, 4038, 1},
+        {0x02f60, 4039, 1}, {0x02f61, 4040, 1}, {0x02f62, 4041, 1}, {0x02f63, 4042, 1},
+        {0x02f64, 4043, 1}, {0x02f65, 4044, 1}, {0x02f66, 4045, 1}, {0x02f67, 4046, 1},
+        {0x02f68, 4047, 1}, {0x02f69, 4048, 1}, {0x02f6a, 4049, 1}, {0x02f6b, 4050, 1},
+        {0x02f6c, 4051, 1}, {0x02f6d, 4052, 1}, {0x02f6e, 4053, 1}, {0x02f6f, 4054, 1},
+        {0x02f70, 4055, 1}, {0x02f71, 4056, 1}, {0x02f72, 4057, 1}, {0x02f73, 4058, 1},
+        {0x02f74, 2476, 1}, {0x02f75, 4059, 1}, {0x02f76, 4060, 1}, {0x02f77, 4061, 1},
+        {0x02f78, 4062, 1}, {0x02f79, 4063, 1}, {0x02f7a, 4064, 1}, {0x02f7b, 2510, 1},
+        {0x02f7c, 2286, 1}, {0x02f7d, 4065, 1}, {0x02f7e, 4066, 1}, {0x02f7f, 4067, 1},
+        {0x02f80, 4068, 1}, {0x02f81, 4069, 1}, {0x02f82, 4070, 1}, {0x02f83, 4071, 1},
+        {0x02f84, 4072, 1}, {0x02f85, 4073, 1}, {0x02f86, 4074, 1}, {0x02f87, 4075, 1},
+        {0x02f88, 4076, 1}, {0x02f89, 4077, 1}, {0x02f8a, 4078, 1}, {0x02f8b, 4079, 1},
+        {0x02f8c, 4080, 1}, {0x02f8d, 4081, 1}, {0x02f8e, 4082, 1}, {0x02f8f, 2493, 1},
+        {0x02f90, 3184, 1}, {0x02f91, 4083, 1}, {0x02f92, 2495, 1}, {0x02f93, 4084, 1},
+        {0x02f94, 4085, 1}, {0x02f95, 4086, 1}, {0x02f96, 4087, 1}, {0x02f97, 3196, 1},
+        {0x02f98, 4088, 1}, {0x02f99, 4089, 1}, {0x02f9a, 4090, 1}, {0x02f9b, 4091, 1},
+        {0x02f9c, 4092, 1}, {0x02f9d, 4093, 1}, {0x02f9e, 2237, 1}, {0x02f9f, 4094, 1},
+        {0x02fa0, 2346, 1}, {0x02fa1, 4095, 1}, {0x02fa2, 4096, 1}, {0x02fa3, 4097, 1},
+        {0x02fa4, 4098, 1}, {0x02fa5, 2462, 1}, {0x02fa6, 2244, 1}, {0x02fa7, 4099, 1},
+        {0x02fa8, 4100, 1}, {0x02fa9, 4101, 1}, {0x02faa, 4102, 1}, {0x02fab, 4103, 1},
+        {0x02fac, 4104, 1}, {0x02fad, 4105, 1}, {0x02fae, 4106, 1}, {0x02faf, 4107, 1},
+        {0x02fb0, 4108, 1}, {0x02fb1, 4109, 1}, {0x02fb2, 4110, 1}, {0x02fb3, 4111, 1},
+        {0x02fb4, 4112, 1}, {0x02fb5, 4113, 1}, {0x02fb6, 4114, 1}, {0x02fb7, 4115, 1},
+        {0x02fb8, 4116, 1}, {0x02fb9, 4117, 1}, {0x02fba, 4118, 1}, {0x02fbb, 4119, 1},
+        {0x02fbc, 4120, 1}, {0x02fbd, 4121, 1}, {0x02fbe, 4122, 1}, {0x02fbf, 4123, 1},
+        {0x02fc0, 4124, 1}, {0x02fc1, 4125, 1}, {0x02fc2, 4126, 1}, {0x02fc3, 4127, 1},
+        {0x02fc4, 4128, 1}, {0x02fc5, 2298, 1}, {0x02fc6, 4129, 1}, {0x02fc7, 3259, 1},
+        {0x02fc8, 4130, 1}, {0x02fc9, 4131, 1}, {0x02fca, 4132, 1}, {0x02fcb, 3261, 1},
+        {0x02fcc, 4133, 1}, {0x02fcd, 4134, 1}, {0x02fce, 4135, 1}, {0x02fcf, 4136, 1},
+        {0x02fd0, 3266, 1}, {0x02fd1, 4137, 1}, {0x02fd2, 4138, 1}, {0x02fd3, 2426, 1},
+        {0x02fd4, 2242, 1}, {0x02fd5, 4139, 1}, {0x03000, 3268, 1}, {0x03036, 4140, 1},
+        {0x03038, 3971, 1}, {0x03039, 4141, 1}, {0x0303a, 4142, 1}, {0x0309b, 4143, 2},
+        {0x0309c, 4145, 2}, {0x0309f, 4147, 2}, {0x030ff, 4149, 2}, {0x03131, 4151, 1},
+        {0x03132, 4152, 1}, {0x03133, 4153, 1}, {0x03134, 4154, 1}, {0x03135, 4155, 1},
+        {0x03136, 4156, 1}, {0x03137, 4157, 1}, {0x03138, 4158, 1}, {0x03139, 4159, 1},
+        {0x0313a, 4160, 1}, {0x0313b, 4161, 1}, {0x0313c, 4162, 1}, {0x0313d, 4163, 1},
+        {0x0313e, 4164, 1}, {0x0313f, 4165, 1}, {0x03140, 4166, 1}, {0x03141, 4167, 1},
+        {0x03142, 4168, 1}, {0x03143, 4169, 1}, {0x03144, 4170, 1}, {0x03145, 4171, 1},
+        {0x03146, 4172, 1}, {0x03147, 4173, 1}, {0x03148, 4174, 1}, {0x03149, 4175, 1},
+        {0x0314a, 4176, 1}, {0x0314b, 4177, 1}, {0x0314c, 4178, 1}, {0x0314d, 4179, 1},
+        {0x0314e, 4180, 1}, {0x0314f, 4181, 1}, {0x03150, 4182, 1}, {0x03151, 4183, 1},
+        {0x03152, 4184, 1}, {0x03153, 4185, 1}, {0x03154, 4186, 1}, {0x03155, 4187, 1},
+        {0x03156, 4188, 1}, {0x03157, 4189, 1}, {0x03158, 4190, 1}, {0x03159, 4191, 1},
+        {0x0315a, 4192, 1}, {0x0315b, 4193, 1}, {0x0315c, 4194, 1}, {0x0315d, 4195, 1},
+        {0x0315e, 4196, 1}, {0x0315f, 4197, 1}, {0x03160, 4198, 1}, {0x03161, 4199, 1},
+        {0x03162, 4200, 1}, {0x03163, 4201, 1}, {0x03164, 4202, 1}, {0x03165, 4203, 1},
+        {0x03166, 4204, 1}, {0x03167, 4205, 1}, {0x03168, 4206, 1}, {0x03169, 4207, 1},
+        {0x0316a, 4208, 1}, {0x0316b, 4209, 1}, {0x0316c, 4210, 1}, {0x0316d, 4211, 1},
+        {0x0316e, 4212, 1}, {0x0316f, 4213, 1}, {0x03170, 4214, 1}, {0x03171, 4215, 1},
+        {0x03172, 4216, 1}, {0x03173, 4217, 1}, {0x03174, 4218, 1}, {0x03175, 4219, 1},
+        {0x03176, 4220, 1}, {0x03177, 4221, 1}, {0x03178, 4222, 1}, {0x03179, 4223, 1},
+        {0x0317a, 4224, 1}, {0x0317b, 4225, 1}, {0x0317c, 4226, 1}, {0x0317d, 4227, 1},
+        {0x0317e, 4228, 1}, {0x0317f, 4229, 1}, {0x03180, 4230, 1}, {0x03181, 4231, 1},
+        {0x03182, 4232, 1}, {0x03183, 4233, 1}, {0x03184, 4234, 1}, {0x03185, 4235, 1},
+        {0x03186, 4236, 1}, {0x03187, 4237, 1}, {0x03188, 4238, 1}, {0x03189, 4239, 1},
+        {0x0318a, 4240, 1}, {0x0318b, 4241, 1}, {0x0318c, 4242, 1}, {0x0318d, 4243, 1},
+        {0x0318e, 4244, 1}, {0x03192, 3950, 1}, {0x03193, 3956, 1}, {0x03194, 4245, 1},
+        {0x03195, 4246, 1}, {0x03196, 4247, 1}, {0x03197, 4248, 1}, {0x03198, 4249, 1},
+        {0x03199, 4250, 1}, {0x0319a, 3954, 1}, {0x0319b, 4251, 1}, {0x0319c, 4252, 1},
+        {0x0319d, 4253, 1}, {0x0319e, 4254, 1}, {0x0319f, 3958, 1}, {0x03200, 4255, 3},
+        {0x03201, 4258, 3}, {0x03202, 4261, 3}, {0x03203, 4264, 3}, {0x03204, 4267, 3},
+        {0x03205, 4270, 3}, {0x03206, 4273, 3}, {0x03207, 4276, 3}, {0x03208, 4279, 3},
+        {0x03209, 4282, 3}, {0x0320a, 4285, 3}, {0x0320b, 4288, 3}, {0x0320c, 4291, 3},
+        {0x0320d, 4294, 3}, {0x0320e, 4297, 4}, {0x0320f, 4301, 4}, {0x03210, 4305, 4},
+        {0x03211, 4309, 4}, {0x03212, 4313, 4}, {0x03213, 4317, 4}, {0x03214, 4321, 4},
+        {0x03215, 4325, 4}, {0x03216, 4329, 4}, {0x03217, 4333, 4}, {0x03218, 4337, 4},
+        {0x03219, 4341, 4}, {0x0321a, 4345, 4}, {0x0321b, 4349, 4}, {0x0321c, 4353, 4},
+        {0x0321d, 4357, 7}, {0x0321e, 4364, 6}, {0x03220, 4370, 3}, {0x03221, 4373, 3},
+        {0x03222, 4376, 3}, {0x03223, 4379, 3}, {0x03224, 4382, 3}, {0x03225, 4385, 3},
+        {0x03226, 4388, 3}, {0x03227, 4391, 3}, {0x03228, 4394, 3}, {0x03229, 4397, 3},
+        {0x0322a, 4400, 3}, {0x0322b, 4403, 3}, {0x0322c, 4406, 3}, {0x0322d, 4409, 3},
+        {0x0322e, 4412, 3}, {0x0322f, 4415, 3}, {0x03230, 4418, 3}, {0x03231, 4421, 3},
+        {0x03232, 4424, 3}, {0x03233, 4427, 3}, {0x03234, 4430, 3}, {0x03235, 4433, 3},
+        {0x03236, 4436, 3}, {0x03237, 4439, 3}, {0x03238, 4442, 3}, {0x03239, 4445, 3},
+        {0x0323a, 4448, 3}, {0x0323b, 4451, 3}, {0x0323c, 4454, 3}, {0x0323d, 4457, 3},
+        {0x0323e, 4460, 3}, {0x0323f, 4463, 3}, {0x03240, 4466, 3}, {0x03241, 4469, 3},
+        {0x03242, 4472, 3}, {0x03243, 4475, 3}, {0x03244, 4478, 1}, {0x03245, 4479, 1},
+        {0x03246, 4010, 1}, {0x03247, 4480, 1}, {0x03250, 4481, 3}, {0x03251, 4484, 2},
+        {0x03252, 4486, 2}, {0x03253, 4488, 2}, {0x03254, 4490, 2}, {0x03255, 4492, 2},
+        {0x03256, 4494, 2}, {0x03257, 4496, 2}, {0x03258, 4498, 2}, {0x03259, 4500, 2},
+        {0x0325a, 4502, 2}, {0x0325b, 4504, 2}, {0x0325c, 4506, 2}, {0x0325d, 4508, 2},
+        {0x0325e, 4510, 2}, {0x0325f, 4512, 2}, {0x03260, 4151, 1}, {0x03261, 4154, 1},
+        {0x03262, 4157, 1}, {0x03263, 4159, 1}, {0x03264, 4167, 1}, {0x03265, 4168, 1},
+        {0x03266, 4171, 1}, {0x03267, 4173, 1}, {0x03268, 4174, 1}, {0x03269, 4176, 1},
+        {0x0326a, 4177, 1}, {0x0326b, 4178, 1}, {0x0326c, 4179, 1}, {0x0326d, 4180, 1},
+        {0x0326e, 4514, 2}, {0x0326f, 4516, 2}, {0x03270, 4518, 2}, {0x03271, 4520, 2},
+        {0x03272, 4522, 2}, {0x03273, 4524, 2}, {0x03274, 4526, 2}, {0x03275, 4528, 2},
+        {0x03276, 4530, 2}, {0x03277, 4532, 2}, {0x03278, 4534, 2}, {0x03279, 4536, 2},
+        {0x0327a, 4538, 2}, {0x0327b, 4540, 2}, {0x0327c, 4542, 5}, {0x0327d, 4547, 4},
+        {0x0327e, 4551, 2}, {0x03280, 3950, 1}, {0x03281, 3956, 1}, {0x03282, 4245, 1},
+        {0x03283, 4246, 1}, {0x03284, 4553, 1}, {0x03285, 2439, 1}, {0x03286, 4554, 1},
+        {0x03287, 3961, 1}, {0x03288, 4555, 1}, {0x03289, 3971, 1}, {0x0328a, 4017, 1},
+        {0x0328b, 4028, 1}, {0x0328c, 4027, 1}, {0x0328d, 4018, 1}, {0x0328e, 2244, 1},
+        {0x0328f, 3979, 1}, {0x03290, 4015, 1}, {0x03291, 4556, 1}, {0x03292, 4557, 1},
+        {0x03293, 2549, 1}, {0x03294, 4558, 1}, {0x03295, 4559, 1}, {0x03296, 4560, 1},
+        {0x03297, 2554, 1}, {0x03298, 4561, 1}, {0x03299, 4562, 1}, {0x0329a, 4563, 1},
+        {0x0329b, 2362, 1}, {0x0329c, 4564, 1}, {0x0329d, 4565, 1}, {0x0329e, 4566, 1},
+        {0x0329f, 4567, 1}, {0x032a0, 4568, 1}, {0x032a1, 4569, 1}, {0x032a2, 4570, 1},
+        {0x032a3, 4571, 1}, {0x032a4, 4247, 1}, {0x032a5, 4248, 1}, {0x032a6, 4249, 1},
+        {0x032a7, 4572, 1}, {0x032a8, 4573, 1}, {0x032a9, 4574, 1}, {0x032aa, 4575, 1},
+        {0x032ab, 4576, 1}, {0x032ac, 4577, 1}, {0x032ad, 4578, 1}, {0x032ae, 4579, 1},
+        {0x032af, 4580, 1}, {0x032b0, 4581, 1}, {0x032b1, 4582, 2}, {0x032b2, 4584, 2},
+        {0x032b3, 4586, 2}, {0x032b4, 4588, 2}, {0x032b5, 4590, 2}, {0x032b6, 4592, 2},
+        {0x032b7, 4594, 2}, {0x032b8, 4596, 2}, {0x032b9, 4598, 2}, {0x032ba, 4600, 2},
+        {0x032bb, 4602, 2}, {0x032bc, 4604, 2}, {0x032bd, 4606, 2}, {0x032be, 4608, 2},
+        {0x032bf, 4610, 2}, {0x032c0, 4612, 2}, {0x032c1, 4614, 2}, {0x032c2, 4616, 2},
+        {0x032c3, 4618, 2}, {0x032c4, 4620, 2}, {0x032c5, 4622, 2}, {0x032c6, 4624, 2},
+        {0x032c7, 4626, 2}, {0x032c8, 4628, 2}, {0x032c9, 4630, 3}, {0x032ca, 4633, 3},
+        {0x032cb, 4636, 3}, {0x032cc, 4639, 2}, {0x032cd, 4641, 3}, {0x032ce, 4644, 2},
+        {0x032cf, 4646, 3}, {0x032d0, 4649, 1}, {0x032d1, 4650, 1}, {0x032d2, 4651, 1},
+        {0x032d3, 4652, 1}, {0x032d4, 4653, 1}, {0x032d5, 4654, 1}, {0x032d6, 4655, 1},
+        {0x032d7, 4656, 1}, {0x032d8, 4657, 1}, {0x032d9, 4658, 1}, {0x032da, 4659, 1},
+        {0x032db, 4660, 1}, {0x032dc, 4661, 1}, {0x032dd, 4662, 1}, {0x032de, 4663, 1},
+        {0x032df, 4664, 1}, {0x032e0, 4665, 1}, {0x032e1, 4666, 1}, {0x032e2, 4667, 1},
+        {0x032e3, 4668, 1}, {0x032e4, 4669, 1}, {0x032e5, 4670, 1}, {0x032e6, 4671, 1},
+        {0x032e7, 4672, 1}, {0x032e8, 4673, 1}, {0x032e9, 4674, 1}, {0x032ea, 4675, 1},
+        {0x032eb, 4676, 1}, {0x032ec, 4677, 1}, {0x032ed, 4678, 1}, {0x032ee, 4679, 1},
+        {0x032ef, 4680, 1}, {0x032f0, 4681, 1}, {0x032f1, 4682, 1}, {0x032f2, 4683, 1},
+        {0x032f3, 4684, 1}, {0x032f4, 4685, 1}, {0x032f5, 4686, 1}, {0x032f6, 4687, 1},
+        {0x032f7, 4688, 1}, {0x032f8, 4689, 1}, {0x032f9, 4690, 1}, {0x032fa, 4691, 1},
+        {0x032fb, 4692, 1}, {0x032fc, 4693, 1}, {0x032fd, 4694, 1}, {0x032fe, 4695, 1},
+        {0x032ff, 4696, 2}, {0x03300, 4698, 5}, {0x03301, 4703, 4}, {0x03302, 4707, 5},
+        {0x03303, 4712, 3}, {0x03304, 4715, 5}, {0x03305, 4720, 3}, {0x03306, 4723, 3},
+        {0x03307, 4726, 6}, {0x03308, 4732, 4}, {0x03309, 4736, 3}, {0x0330a, 4739, 3},
+        {0x0330b, 4742, 3}, {0x0330c, 4745, 4}, {0x0330d, 4749, 4}, {0x0330e, 4753, 4},
+        {0x0330f, 4757, 4}, {0x03310, 4761, 4}, {0x03311, 4765, 4}, {0x03312, 4769, 4},
+        {0x03313, 4773, 6}, {0x03314, 4779, 2}, {0x03315, 4781, 6}, {0x03316, 4787, 6},
+        {0x03317, 4793, 5}, {0x03318, 4798, 4}, {0x03319, 4802, 6}, {0x0331a, 4808, 6},
+        {0x0331b, 4814, 4}, {0x0331c, 4818, 3}, {0x0331d, 4821, 3}, {0x0331e, 4824, 4},
+        {0x0331f, 4828, 4}, {0x03320, 4832, 5}, {0x03321, 4837, 5}, {0x03322, 4842, 3},
+        {0x03323, 4845, 3}, {0x03324, 4848, 4}, {0x03325, 4852, 3}, {0x03326, 4855, 3},
+        {0x03327, 4858, 2}, {0x03328, 4860, 2}, {0x03329, 4862, 3}, {0x0332a, 4865, 3},
+        {0x0332b, 4868, 6}, {0x0332c, 4874, 4}, {0x0332d, 4878, 5}, {0x0332e, 4883, 6},
+        {0x0332f, 4889, 4}, {0x03330, 4893, 3}, {0x03331, 4896, 3}, {0x03332, 4899, 6},
+        {0x03333, 4905, 4}, {0x03334, 4909, 6}, {0x03335, 4915, 3}, {0x03336, 4918, 5},
+        {0x03337, 4923, 3}, {0x03338, 4926, 4}, {0x03339, 4930, 3}, {0x0333a, 4933, 4},
+        {0x0333b, 4937, 5}, {0x0333c, 4942, 4}, {0x0333d, 4946, 5}, {0x0333e, 4951, 4},
+        {0x0333f, 4955, 2}, {0x03340, 4957, 5}, {0x03341, 4962, 3}, {0x03342, 4965, 3},
+        {0x03343, 4968, 4}, {0x03344, 4972, 3}, {0x03345, 4975, 3}, {0x03346, 4978, 3},
+        {0x03347, 4981, 5}, {0x03348, 4986, 4}, {0x03349, 4990, 2}, {0x0334a, 4992, 6},
+        {0x0334b, 4998, 3}, {0x0334c, 5001, 5}, {0x0334d, 5006, 4}, {0x0334e, 5010, 4},
+        {0x0334f, 5014, 3}, {0x03350, 5017, 3}, {0x03351, 5020, 4}, {0x03352, 5024, 2},
+        {0x03353, 5026, 4}, {0x03354, 5030, 5}, {0x03355, 5035, 2}, {0x03356, 5037, 6},
+        {0x03357, 5043, 3}, {0x03358, 5046, 2}, {0x03359, 5048, 2}, {0x0335a, 5050, 2},
+        {0x0335b, 5052, 2}, {0x0335c, 5054, 2}, {0x0335d, 5056, 2}, {0x0335e, 5058, 2},
+        {0x0335f, 5060, 2}, {0x03360, 5062, 2}, {0x03361, 5064, 2}, {0x03362, 5066, 3},
+        {0x03363, 5069, 3}, {0x03364, 5072, 3}, {0x03365, 5075, 3}, {0x03366, 5078, 3},
+        {0x03367, 5081, 3}, {0x03368, 5084, 3}, {0x03369, 5087, 3}, {0x0336a, 5090, 3},
+        {0x0336b, 5093, 3}, {0x0336c, 5096, 3}, {0x0336d, 5099, 3}, {0x0336e, 5102, 3},
+        {0x0336f, 5105, 3}, {0x03370, 5108, 3}, {0x03371, 5111, 3}, {0x03372, 5114, 2},
+        {0x03373, 5116, 2}, {0x03374, 5118, 3}, {0x03375, 5121, 2}, {0x03376, 5123, 2},
+        {0x03377, 5125, 2}, {0x03378, 5127, 3}, {0x03379, 5130, 3}, {0x0337a, 5133, 2},
+        {0x0337b, 5135, 2}, {0x0337c, 5137, 2}, {0x0337d, 5139, 2}, {0x0337e, 5141, 2},
+        {0x0337f, 5143, 4}, {0x03380, 5147, 2}, {0x03381, 5149, 2}, {0x03382, 5151, 2},
+        {0x03383, 5153, 2}, {0x03384, 5155, 2}, {0x03385, 5157, 2}, {0x03386, 5159, 2},
+        {0x03387, 5161, 2}, {0x03388, 5163, 3}, {0x03389, 5166, 4}, {0x0338a, 5170, 2},
+        {0x0338b, 5172, 2}, {0x0338c, 5174, 2}, {0x0338d, 5176, 2}, {0x0338e, 5178, 2},
+        {0x0338f, 5180, 2}, {0x03390, 5182, 2}, {0x03391, 5184, 3}, {0x03392, 5187, 3},
+        {0x03393, 5190, 3}, {0x03394, 5193, 3}, {0x03395, 5196, 2}, {0x03396, 5198, 2},
+        {0x03397, 5200, 2}, {0x03398, 5202, 2}, {0x03399, 5204, 2}, {0x0339a, 5206, 2},
+        {0x0339b, 5208, 2}, {0x0339c, 5210, 2}, {0x0339d, 5212, 2}, {0x0339e, 5214, 2},
+        {0x0339f, 5216, 3}, {0x033a0, 5219, 3}, {0x033a1, 5222, 2}, {0x033a2, 5224, 3},
+        {0x033a3, 5227, 3}, {0x033a4, 5230, 3}, {0x033a5, 5233, 2}, {0x033a6, 5235, 3},
+        {0x033a7, 5238, 3}, {0x033a8, 5241, 4}, {0x033a9, 5245, 2}, {0x033aa, 5247, 3},
+        {0x033ab, 5250, 3}, {0x033ac, 5253, 3}, {0x033ad, 5256, 3}, {0x033ae, 5259, 5},
+        {0x033af, 5264, 6}, {0x033b0, 5270, 2}, {0x033b1, 5272, 2}, {0x033b2, 5274, 2},
+        {0x033b3, 5276, 2}, {0x033b4, 5278, 2}, {0x033b5, 5280, 2}, {0x033b6, 5282, 2},
+        {0x033b7, 5284, 2}, {0x033b8, 5286, 2}, {0x033b9, 5288, 2}, {0x033ba, 5290, 2},
+        {0x033bb, 5292, 2}, {0x033bc, 5294, 2}, {0x033bd, 5296, 2}, {0x033be, 5298, 2},
+        {0x033bf, 5300, 2}, {0x033c0, 5302, 2}, {0x033c1, 5304, 2}, {0x033c2, 5306, 4},
+        {0x033c3, 5310, 2}, {0x033c4, 5312, 2}, {0x033c5, 5314, 2}, {0x033c6, 5316, 4},
+        {0x033c7, 5320, 3}, {0x033c8, 5323, 2}, {0x033c9, 5325, 2}, {0x033ca, 5327, 2},
+        {0x033cb, 5329, 2}, {0x033cc, 5331, 2}, {0x033cd, 5333, 2}, {0x033ce, 5335, 2},
+        {0x033cf, 5337, 2}, {0x033d0, 5339, 2}, {0x033d1, 5341, 2}, {0x033d2, 5343, 3},
+        {0x033d3, 5346, 2}, {0x033d4, 5348, 2}, {0x033d5, 5350, 3}, {0x033d6, 5353, 3},
+        {0x033d7, 5356, 2}, {0x033d8, 5358, 4}, {0x033d9, 5362, 3}, {0x033da, 5365, 2},
+        {0x033db, 5367, 2}, {0x033dc, 5369, 2}, {0x033dd, 5371, 2}, {0x033de, 5373, 3},
+        {0x033df, 5376, 3}, {0x033e0, 5379, 2}, {0x033e1, 5381, 2}, {0x033e2, 5383, 2},
+        {0x033e3, 5385, 2}, {0x033e4, 5387, 2}, {0x033e5, 5389, 2}, {0x033e6, 5391, 2},
+        {0x033e7, 5393, 2}, {0x033e8, 5395, 2}, {0x033e9, 5397, 3}, {0x033ea, 5400, 3},
+        {0x033eb, 5403, 3}, {0x033ec, 5406, 3}, {0x033ed, 5409, 3}, {0x033ee, 5412, 3},
+        {0x033ef, 5415, 3}, {0x033f0, 5418, 3}, {0x033f1, 5421, 3}, {0x033f2, 5424, 3},
+        {0x033f3, 5427, 3}, {0x033f4, 5430, 3}, {0x033f5, 5433, 3}, {0x033f6, 5436, 3},
+        {0x033f7, 5439, 3}, {0x033f8, 5442, 3}, {0x033f9, 5445, 3}, {0x033fa, 5448, 3},
+        {0x033fb, 5451, 3}, {0x033fc, 5454, 3}, {0x033fd, 5457, 3}, {0x033fe, 5460, 3},
+        {0x033ff, 5463, 3}, {0x0a69c, 5466, 1}, {0x0a69d, 5467, 1}, {0x0a770, 5468, 1},
+        {0x0a7f2, 3566, 1}, {0x0a7f3, 3590, 1}, {0x0a7f4, 3581, 1}, {0x0a7f8, 5469, 1},
+        {0x0a7f9, 5470, 1}, {0x0ab5c, 5471, 1}, {0x0ab5d, 5472, 1}, {0x0ab5e, 5473, 1},
+        {0x0ab5f, 5474, 1}, {0x0ab69, 5475, 1}, {0x0fb00, 5476, 2}, {0x0fb01, 5478, 2},
+        {0x0fb02, 5480, 2}, {0x0fb03, 5482, 3}, {0x0fb04, 5485, 3}, {0x0fb05, 5488, 2},
+        {0x0fb06, 5488, 2}, {0x0fb13, 5490, 2}, {0x0fb14, 5492, 2}, {0x0fb15, 5494, 2},
+        {0x0fb16, 5496, 2}, {0x0fb17, 5498, 2}, {0x0fb20, 5500, 1}, {0x0fb21, 3591, 1},
+        {0x0fb22, 3594, 1}, {0x0fb23, 5501, 1}, {0x0fb24, 5502, 1}, {0x0fb25, 5503, 1},
+        {0x0fb26, 5504, 1}, {0x0fb27, 5505, 1}, {0x0fb28, 5506, 1}, {0x0fb29, 3552, 1},
+        {0x0fb4f, 5507, 2}, {0x0fb50, 5509, 1}, {0x0fb51, 5509, 1}, {0x0fb52, 5510, 1},
+        {0x0fb53, 5510, 1}, {0x0fb54, 5510, 1}, {0x0fb55, 5510, 1}, {0x0fb56, 5511, 1},
+        {0x0fb57, 5511, 1}, {0x0fb58, 5511, 1}, {0x0fb59, 5511, 1}, {0x0fb5a, 5512, 1},
+        {0x0fb5b, 5512, 1}, {0x0fb5c, 5512, 1}, {0x0fb5d, 5512, 1}, {0x0fb5e, 5513, 1},
+        {0x0fb5f, 5513, 1}, {0x0fb60, 5513, 1}, {0x0fb61, 5513, 1}, {0x0fb62, 5514, 1},
+        {0x0fb63, 5514, 1}, {0x0fb64, 5514, 1}, {0x0fb65, 5514, 1}, {0x0fb66, 5515, 1},
+        {0x0fb67, 5515, 1}, {0x0fb68, 5515, 1}, {0x0fb69, 5515, 1}, {0x0fb6a, 5516, 1},
+        {0x0fb6b, 5516, 1}, {0x0fb6c, 5516, 1}, {0x0fb6d, 5516, 1}, {0x0fb6e, 5517, 1},
+        {0x0fb6f, 5517, 1}, {0x0fb70, 5517, 1}, {0x0fb71, 5517, 1}, {0x0fb72, 5518, 1},
+        {0x0fb73, 5518, 1}, {0x0fb74, 5518, 1}, {0x0fb75, 5518, 1}, {0x0fb76, 5519, 1},
+        {0x0fb77, 5519, 1}, {0x0fb78, 5519, 1}, {0x0fb79, 5519, 1}, {0x0fb7a, 5520, 1},
+        {0x0fb7b, 5520, 1}, {0x0fb7c, 5520, 1}, {0x0fb7d, 5520, 1}, {0x0fb7e, 5521, 1},
+        {0x0fb7f, 5521, 1}, {0x0fb80, 5521, 1}, {0x0fb81, 5521, 1}, {0x0fb82, 5522, 1},
+        {0x0fb83, 5522, 1}, {0x0fb84, 5523, 1}, {0x0fb85, 5523, 1}, {0x0fb86, 5524, 1},
+        {0x0fb87, 5524, 1}, {0x0fb88, 5525, 1}, {0x0fb89, 5525, 1}, {0x0fb8a, 5526, 1},
+        {0x0fb8b, 5526, 1}, {0x0fb8c, 5527, 1}, {0x0fb8d, 5527, 1}, {0x0fb8e, 5528, 1},
+        {0x0fb8f, 5528, 1}, {0x0fb90, 5528, 1}, {0x0fb91, 5528, 1}, {0x0fb92, 5529, 1},
+        {0x0fb93, 5529, 1}, {0x0fb94, 5529, 1}, {0x0fb95, 5529, 1}, {0x0fb96, 5530, 1},
+        {0x0fb97, 5530, 1}, {0x0fb98, 5530, 1}, {0x0fb99, 5530, 1}, {0x0fb9a, 5531, 1},
+        {0x0fb9b, 5531, 1}, {0x0fb9c, 5531, 1}, {0x0fb9d, 5531, 1}, {0x0fb9e, 5532, 1},
+        {0x0fb9f, 5532, 1}, {0x0fba0, 5533, 1}, {0x0fba1, 5533, 1}, {0x0fba2, 5533, 1},
+        {0x0fba3, 5533, 1}, {0x0fba4, 696, 2}, {0x0fba5, 696, 2}, {0x0fba6, 5534, 1},
+        {0x0fba7, 5534, 1}, {0x0fba8, 5534, 1}, {0x0fba9, 5534, 1}, {0x0fbaa, 5535, 1},
+        {0x0fbab, 5535, 1}, {0x0fbac, 5535, 1}, {0x0fbad, 5535, 1}, {0x0fbae, 5536, 1},
+        {0x0fbaf, 5536, 1}, {0x0fbb0, 700, 2}, {0x0fbb1, 700, 2}, {0x0fbd3, 5537, 1},
+        {0x0fbd4, 5537, 1}, {0x0fbd5, 5537, 1}, {0x0fbd6, 5537, 1}, {0x0fbd7, 5538, 1},
+        {0x0fbd8, 5538, 1}, {0x0fbd9, 5539, 1}, {0x0fbda, 5539, 1}, {0x0fbdb, 5540, 1},
+        {0x0fbdc, 5540, 1}, {0x0fbdd, 3377, 2}, {0x0fbde, 5541, 1}, {0x0fbdf, 5541, 1},
+        {0x0fbe0, 5542, 1}, {0x0fbe1, 5542, 1}, {0x0fbe2, 5543, 1}, {0x0fbe3, 5543, 1},
+        {0x0fbe4, 5544, 1}, {0x0fbe5, 5544, 1}, {0x0fbe6, 5544, 1}, {0x0fbe7, 5544, 1},
+        {0x0fbe8, 5545, 1}, {0x0fbe9, 5545, 1}, {0x0fbea, 5546, 3}, {0x0fbeb, 5546, 3},
+        {0x0fbec, 5549, 3}, {0x0fbed, 5549, 3}, {0x0fbee, 5552, 3}, {0x0fbef, 5552, 3},
+        {0x0fbf0, 5555, 3}, {0x0fbf1, 5555, 3}, {0x0fbf2, 5558, 3}, {0x0fbf3, 5558, 3},
+        {0x0fbf4, 5561, 3}, {0x0fbf5, 5561, 3}, {0x0fbf6, 5564, 3}, {0x0fbf7, 5564, 3},
+        {0x0fbf8, 5564, 3}, {0x0fbf9, 5567, 3}, {0x0fbfa, 5567, 3}, {0x0fbfb, 5567, 3},
+        {0x0fbfc, 5570, 1}, {0x0fbfd, 5570, 1}, {0x0fbfe, 5570, 1}, {0x0fbff, 5570, 1},
+        {0x0fc00, 5571, 3}, {0x0fc01, 5574, 3}, {0x0fc02, 5577, 3}, {0x0fc03, 5567, 3},
+        {0x0fc04, 5580, 3}, {0x0fc05, 5583, 2}, {0x0fc06, 5585, 2}, {0x0fc07, 5587, 2},
+        {0x0fc08, 5589, 2}, {0x0fc09, 5591, 2}, {0x0fc0a, 5593, 2}, {0x0fc0b, 5595, 2},
+        {0x0fc0c, 5597, 2}, {0x0fc0d, 5599, 2}, {0x0fc0e, 5601, 2}, {0x0fc0f, 5603, 2},
+        {0x0fc10, 5605, 2}, {0x0fc11, 5607, 2}, {0x0fc12, 5609, 2}, {0x0fc13, 5611, 2},
+        {0x0fc14, 5613, 2}, {0x0fc15, 5615, 2}, {0x0fc16, 5617, 2}, {0x0fc17, 5619, 2},
+        {0x0fc18, 5621, 2}, {0x0fc19, 5623, 2}, {0x0fc1a, 5625, 2}, {0x0fc1b, 5627, 2},
+        {0x0fc1c, 5629, 2}, {0x0fc1d, 5631, 2}, {0x0fc1e, 5633, 2}, {0x0fc1f, 5635, 2},
+        {0x0fc20, 5637, 2}, {0x0fc21, 5639, 2}, {0x0fc22, 5641, 2}, {0x0fc23, 5643, 2},
+        {0x0fc24, 5645, 2}, {0x0fc25, 5647, 2}, {0x0fc26, 5649, 2}, {0x0fc27, 5651, 2},
+        {0x0fc28, 5653, 2}, {0x0fc29, 5655, 2}, {0x0fc2a, 5657, 2}, {0x0fc2b, 5659, 2},
+        {0x0fc2c, 5661, 2}, {0x0fc2d, 5663, 2}, {0x0fc2e, 5665, 2}, {0x0fc2f, 5667, 2},
+        {0x0fc30, 5669, 2}, {0x0fc31, 5671, 2}, {0x0fc32, 5673, 2}, {0x0fc33, 5675, 2},
+        {0x0fc34, 5677, 2}, {0x0fc35, 5679, 2}, {0x0fc36, 5681, 2}, {0x0fc37, 5683, 2},
+        {0x0fc38, 5685, 2}, {0x0fc39, 5687, 2}, {0x0fc3a, 5689, 2}, {0x0fc3b, 5691, 2},
+        {0x0fc3c, 5693, 2}, {0x0fc3d, 5695, 2}, {0x0fc3e, 5697, 2}, {0x0fc3f, 5699, 2},
+        {0x0fc40, 5701, 2}, {0x0fc41, 5703, 2}, {0x0fc42, 5705, 2}, {0x0fc43, 5707, 2},
+        {0x0fc44, 5709, 2}, {0x0fc45, 5711, 2}, {0x0fc46, 5713, 2}, {0x0fc47, 5715, 2},
+        {0x0fc48, 5717, 2}, {0x0fc49, 5719, 2}, {0x0fc4a, 5721, 2}, {0x0fc4b, 5723, 2},
+        {0x0fc4c, 5725, 2}, {0x0fc4d, 5727, 2}, {0x0fc4e, 5729, 2}, {0x0fc4f, 5731, 2},
+        {0x0fc50, 5733, 2}, {0x0fc51, 5735, 2}, {0x0fc52, 5737, 2}, {0x0fc53, 5739, 2},
+        {0x0fc54, 5741, 2}, {0x0fc55, 5743, 2}, {0x0fc56, 5745, 2}, {0x0fc57, 5747, 2},
+        {0x0fc58, 5749, 2}, {0x0fc59, 5751, 2}, {0x0fc5a, 5753, 2}, {0x0fc5b, 5755, 2},
+        {0x0fc5c, 5757, 2}, {0x0fc5d, 5759, 2}, {0x0fc5e, 5761, 3}, {0x0fc5f, 5764, 3},
+        {0x0fc60, 5767, 3}, {0x0fc61, 5770, 3}, {0x0fc62, 5773, 3}, {0x0fc63, 5776, 3},
+        {0x0fc64, 5779, 3}, {0x0fc65, 5782, 3}, {0x0fc66, 5577, 3}, {0x0fc67, 5785, 3},
+        {0x0fc68, 5567, 3}, {0x0fc69, 5580, 3}, {0x0fc6a, 5788, 2}, {0x0fc6b, 5790, 2},
+        {0x0fc6c, 5589, 2}, {0x0fc6d, 5792, 2}, {0x0fc6e, 5591, 2}, {0x0fc6f, 5593, 2},
+        {0x0fc70, 5794, 2}, {0x0fc71, 5796, 2}, {0x0fc72, 5601, 2}, {0x0fc73, 5798, 2},
+        {0x0fc74, 5603, 2}, {0x0fc75, 5605, 2}, {0x0fc76, 5800, 2}, {0x0fc77, 5802, 2},
+        {0x0fc78, 5609, 2}, {0x0fc79, 5804, 2}, {0x0fc7a, 5611, 2}, {0x0fc7b, 5613, 2},
+        {0x0fc7c, 5671, 2}, {0x0fc7d, 5673, 2}, {0x0fc7e, 5679, 2}, {0x0fc7f, 5681, 2},
+        {0x0fc80, 5683, 2}, {0x0fc81, 5691, 2}, {0x0fc82, 5693, 2}, {0x0fc83, 5695, 2},
+        {0x0fc84, 5697, 2}, {0x0fc85, 5705, 2}, {0x0fc86, 5707, 2}, {0x0fc87, 5709, 2},
+        {0x0fc88, 5806, 2}, {0x0fc89, 5717, 2}, {0x0fc8a, 5808, 2}, {0x0fc8b, 5810, 2},
+        {0x0fc8c, 5729, 2}, {0x0fc8d, 5812, 2}, {0x0fc8e, 5731, 2}, {0x0fc8f, 5733, 2},
+        {0x0fc90, 5759, 2}, {0x0fc91, 5814, 2}, {0x0fc92, 5816, 2}, {0x0fc93, 5749, 2},
+        {0x0fc94, 5818, 2}, {0x0fc95, 5751, 2}, {0x0fc96, 5753, 2}, {0x0fc97, 5571, 3},
+        {0x0fc98, 5574, 3}, {0x0fc99, 5820, 3}, {0x0fc9a, 5577, 3}, {0x0fc9b, 5823, 3},
+        {0x0fc9c, 5583, 2}, {0x0fc9d, 5585, 2}, {0x0fc9e, 5587, 2}, {0x0fc9f, 5589, 2},
+        {0x0fca0, 5826, 2}, {0x0fca1, 5595, 2}, {0x0fca2, 5597, 2}, {0x0fca3, 5599, 2},
+        {0x0fca4, 5601, 2}, {0x0fca5, 5828, 2}, {0x0fca6, 5609, 2}, {0x0fca7, 5615, 2},
+        {0x0fca8, 5617, 2}, {0x0fca9, 5619, 2}, {0x0fcaa, 5621, 2}, {0x0fcab, 5623, 2},
+        {0x0fcac, 5627, 2}, {0x0fcad, 5629, 2}, {0x0fcae, 5631, 2}, {0x0fcaf, 5633, 2},
+        {0x0fcb0, 5635, 2}, {0x0fcb1, 5637, 2}, {0x0fcb2, 5830, 2}, {0x0fcb3, 5639, 2},
+        {0x0fcb4, 5641, 2}, {0x0fcb5, 5643, 2}, {0x0fcb6, 5645, 2}, {0x0fcb7, 5647, 2},
+        {0x0fcb8, 5649, 2}, {0x0fcb9, 5653, 2}, {0x0fcba, 5655, 2}, {0x0fcbb, 5657, 2},
+        {0x0fcbc, 5659, 2}, {0x0fcbd, 5661, 2}, {0x0fcbe, 5663, 2}, {0x0fcbf, 5665, 2},
+        {0x0fcc0, 5667, 2}, {0x0fcc1, 5669, 2}, {0x0fcc2, 5675, 2}, {0x0fcc3, 5677, 2},
+        {0x0fcc4, 5685, 2}, {0x0fcc5, 5687, 2}, {0x0fcc6, 5689, 2}, {0x0fcc7, 5691, 2},
+        {0x0fcc8, 5693, 2}, {0x0fcc9, 5699, 2}, {0x0fcca, 5701, 2}, {0x0fccb, 5703, 2},
+        {0x0fccc, 5705, 2}, {0x0fccd, 5832, 2}, {0x0fcce, 5711, 2}, {0x0fccf, 5713, 2},
+        {0x0fcd0, 5715, 2}, {0x0fcd1, 5717, 2}, {0x0fcd2, 5723, 2}, {0x0fcd3, 5725, 2},
+        {0x0fcd4, 5727, 2}, {0x0fcd5, 5729, 2}, {0x0fcd6, 5834, 2}, {0x0fcd7, 5735, 2},
+        {0x0fcd8, 5737, 2}, {0x0fcd9, 5836, 2}, {0x0fcda, 5743, 2}, {0x0fcdb, 5745, 2},
+        {0x0fcdc, 5747, 2}, {0x0fcdd, 5749, 2}, {0x0fcde, 5838, 2}, {0x0fcdf, 5577, 3},
+        {0x0fce0, 5823, 3}, {0x0fce1, 5589, 2}, {0x0fce2, 5826, 2}, {0x0fce3, 5601, 2},
+        {0x0fce4, 5828, 2}, {0x0fce5, 5609, 2}, {0x0fce6, 5840, 2}, {0x0fce7, 5635, 2},
+        {0x0fce8, 5842, 2}, {0x0fce9, 5844, 2}, {0x0fcea, 5846, 2}, {0x0fceb, 5691, 2},
+        {0x0fcec, 5693, 2}, {0x0fced, 5705, 2}, {0x0fcee, 5729, 2}, {0x0fcef, 5834, 2},
+        {0x0fcf0, 5749, 2}, {0x0fcf1, 5838, 2}, {0x0fcf2, 5848, 3}, {0x0fcf3, 5851, 3},
+        {0x0fcf4, 5854, 3}, {0x0fcf5, 5857, 2}, {0x0fcf6, 5859, 2}, {0x0fcf7, 5861, 2},
+        {0x0fcf8, 5863, 2}, {0x0fcf9, 5865, 2}, {0x0fcfa, 5867, 2}, {0x0fcfb, 5869, 2},
+        {0x0fcfc, 5871, 2}, {0x0fcfd, 5873, 2}, {0x0fcfe, 5875, 2}, {0x0fcff, 5877, 2},
+        {0x0fd00, 5879, 2}, {0x0fd01, 5881, 2}, {0x0fd02, 5883, 2}, {0x0fd03, 5885, 2},
+        {0x0fd04, 5887, 2}, {0x0fd05, 5889, 2}, {0x0fd06, 5891, 2}, {0x0fd07, 5893, 2},
+        {0x0fd08, 5895, 2}, {0x0fd09, 5897, 2}, {0x0fd0a, 5899, 2}, {0x0fd0b, 5901, 2},
+        {0x0fd0c, 5844, 2}, {0x0fd0d, 5903, 2}, {0x0fd0e, 5905, 2}, {0x0fd0f, 5907, 2},
+        {0x0fd10, 5909, 2}, {0x0fd11, 5857, 2}, {0x0fd12, 5859, 2}, {0x0fd13, 5861, 2},
+        {0x0fd14, 5863, 2}, {0x0fd15, 5865, 2}, {0x0fd16, 5867, 2}, {0x0fd17, 5869, 2},
+        {0x0fd18, 5871, 2}, {0x0fd19, 5873, 2}, {0x0fd1a, 5875, 2}, {0x0fd1b, 5877, 2},
+        {0x0fd1c, 5879, 2}, {0x0fd1d, 5881, 2}, {0x0fd1e, 5883, 2}, {0x0fd1f, 5885, 2},
+        {0x0fd20, 5887, 2}, {0x0fd21, 5889, 2}, {0x0fd22, 5891, 2}, {0x0fd23, 5893, 2},
+        {0x0fd24, 5895, 2}, {0x0fd25, 5897, 2}, {0x0fd26, 5899, 2}, {0x0fd27, 5901, 2},
+        {0x0fd28, 5844, 2}, {0x0fd29, 5903, 2}, {0x0fd2a, 5905, 2}, {0x0fd2b, 5907, 2},
+        {0x0fd2c, 5909, 2}, {0x0fd2d, 5897, 2}, {0x0fd2e, 5899, 2}, {0x0fd2f, 5901, 2},
+        {0x0fd30, 5844, 2}, {0x0fd31, 5842, 2}, {0x0fd32, 5846, 2}, {0x0fd33, 5651, 2},
+        {0x0fd34, 5629, 2}, {0x0fd35, 5631, 2}, {0x0fd36, 5633, 2}, {0x0fd37, 5897, 2},
+        {0x0fd38, 5899, 2}, {0x0fd39, 5901, 2}, {0x0fd3a, 5651, 2}, {0x0fd3b, 5653, 2},
+        {0x0fd3c, 5911, 2}, {0x0fd3d, 5911, 2}, {0x0fd50, 5913, 3}, {0x0fd51, 5916, 3},
+        {0x0fd52, 5916, 3}, {0x0fd53, 5919, 3}, {0x0fd54, 5922, 3}, {0x0fd55, 5925, 3},
+        {0x0fd56, 5928, 3}, {0x0fd57, 5931, 3}, {0x0fd58, 5934, 3}, {0x0fd59, 5934, 3},
+        {0x0fd5a, 5937, 3}, {0x0fd5b, 5940, 3}, {0x0fd5c, 5943, 3}, {0x0fd5d, 5946, 3},
+        {0x0fd5e, 5949, 3}, {0x0fd5f, 5952, 3}, {0x0fd60, 5952, 3}, {0x0fd61, 5955, 3},
+        {0x0fd62, 5958, 3}, {0x0fd63, 5958, 3}, {0x0fd64, 5961, 3}, {0x0fd65, 5961, 3},
+        {0x0fd66, 5964, 3}, {0x0fd67, 5967, 3}, {0x0fd68, 5967, 3}, {0x0fd69, 5970, 3},
+        {0x0fd6a, 5973, 3}, {0x0fd6b, 5973, 3}, {0x0fd6c, 5976, 3}, {0x0fd6d, 5976, 3},
+        {0x0fd6e, 5979, 3}, {0x0fd6f, 5982, 3}, {0x0fd70, 5982, 3}, {0x0fd71, 5985, 3},
+        {0x0fd72, 5985, 3}, {0x0fd73, 5988, 3}, {0x0fd74, 5991, 3}, {0x0fd75, 5994, 3},
+        {0x0fd76, 5997, 3}, {0x0fd77, 5997, 3}, {0x0fd78, 6000, 3}, {0x0fd79, 6003, 3},
+        {0x0fd7a, 6006, 3}, {0x0fd7b, 6009, 3}, {0x0fd7c, 6012, 3}, {0x0fd7d, 6012, 3},
+        {0x0fd7e, 6015, 3}, {0x0fd7f, 6018, 3}, {0x0fd80, 6021, 3}, {0x0fd81, 6024, 3},
+        {0x0fd82, 6027, 3}, {0x0fd83, 6030, 3}, {0x0fd84, 6030, 3}, {0x0fd85, 6033, 3},
+        {0x0fd86, 6033, 3}, {0x0fd87, 6036, 3}, {0x0fd88, 6036, 3}, {0x0fd89, 6039, 3},
+        {0x0fd8a, 6042, 3}, {0x0fd8b, 6045, 3}, {0x0fd8c, 6048, 3}, {0x0fd8d, 6051, 3},
+        {0x0fd8e, 6054, 3}, {0x0fd8f, 6057, 3}, {0x0fd92, 6060, 3}, {0x0fd93, 6063, 3},
+        {0x0fd94, 6066, 3}, {0x0fd95, 6069, 3}, {0x0fd96, 6072, 3}, {0x0fd97, 6075, 3},
+        {0x0fd98, 6075, 3}, {0x0fd99, 6078, 3}, {0x0fd9a, 6081, 3}, {0x0fd9b, 6084, 3},
+        {0x0fd9c, 6087, 3}, {0x0fd9d, 6087, 3}, {0x0fd9e, 6090, 3}, {0x0fd9f, 6093, 3},
+        {0x0fda0, 6096, 3}, {0x0fda1, 6099, 3}, {0x0fda2, 6102, 3}, {0x0fda3, 6105, 3},
+        {0x0fda4, 6108, 3}, {0x0fda5, 6111, 3}, {0x0fda6, 6114, 3}, {0x0fda7, 6117, 3},
+        {0x0fda8, 6120, 3}, {0x0fda9, 6123, 3}, {0x0fdaa, 6126, 3}, {0x0fdab, 6129, 3},
+        {0x0fdac, 6132, 3}, {0x0fdad, 6135, 3}, {0x0fdae, 6138, 3}, {0x0fdaf, 6141, 3},
+        {0x0fdb0, 6144, 3}, {0x0fdb1, 6147, 3}, {0x0fdb2, 6150, 3}, {0x0fdb3, 6153, 3},
+        {0x0fdb4, 6015, 3}, {0x0fdb5, 6021, 3}, {0x0fdb6, 6156, 3}, {0x0fdb7, 6159, 3},
+        {0x0fdb8, 6162, 3}, {0x0fdb9, 6165, 3}, {0x0fdba, 6168, 3}, {0x0fdbb, 6171, 3},
+        {0x0fdbc, 6168, 3}, {0x0fdbd, 6162, 3}, {0x0fdbe, 6174, 3}, {0x0fdbf, 6177, 3},
+        {0x0fdc0, 6180, 3}, {0x0fdc1, 6183, 3}, {0x0fdc2, 6186, 3}, {0x0fdc3, 6171, 3},
+        {0x0fdc4, 5994, 3}, {0x0fdc5, 5964, 3}, {0x0fdc6, 6189, 3}, {0x0fdc7, 6192, 3},
+        {0x0fdf0, 6195, 3}, {0x0fdf1, 6198, 3}, {0x0fdf2, 6201, 4}, {0x0fdf3, 6205, 4},
+        {0x0fdf4, 6209, 4}, {0x0fdf5, 6213, 4}, {0x0fdf6, 6217, 4}, {0x0fdf7, 6221, 4},
+        {0x0fdf8, 6225, 4}, {0x0fdf9, 6229, 3}, {0x0fdfa, 6232, 18}, {0x0fdfb, 6250, 8},
+        {0x0fdfc, 6258, 4}, {0x0fe10, 6262, 1}, {0x0fe11, 6263, 1}, {0x0fe12, 6264, 1},
+        {0x0fe13, 6265, 1}, {0x0fe14, 532, 1}, {0x0fe15, 6266, 1}, {0x0fe16, 6267, 1},
+        {0x0fe17, 6268, 1}, {0x0fe18, 6269, 1}, {0x0fe19, 3518, 3}, {0x0fe30, 3516, 2},
+        {0x0fe31, 6270, 1}, {0x0fe32, 6271, 1}, {0x0fe33, 6272, 1}, {0x0fe34, 6272, 1},
+        {0x0fe35, 3555, 1}, {0x0fe36, 3556, 1}, {0x0fe37, 6273, 1}, {0x0fe38, 6274, 1},
+        {0x0fe39, 6275, 1}, {0x0fe3a, 6276, 1}, {0x0fe3b, 6277, 1}, {0x0fe3c, 6278, 1},
+        {0x0fe3d, 6279, 1}, {0x0fe3e, 6280, 1}, {0x0fe3f, 2115, 1}, {0x0fe40, 2116, 1},
+        {0x0fe41, 6281, 1}, {0x0fe42, 6282, 1}, {0x0fe43, 6283, 1}, {0x0fe44, 6284, 1},
+        {0x0fe47, 6285, 1}, {0x0fe48, 6286, 1}, {0x0fe49, 3533, 2}, {0x0fe4a, 3533, 2},
+        {0x0fe4b, 3533, 2}, {0x0fe4c, 3533, 2}, {0x0fe4d, 6272, 1}, {0x0fe4e, 6272, 1},
+        {0x0fe4f, 6272, 1}, {0x0fe50, 6262, 1}, {0x0fe51, 6263, 1}, {0x0fe52, 3515, 1},
+        {0x0fe54, 532, 1}, {0x0fe55, 6265, 1}, {0x0fe56, 6267, 1}, {0x0fe57, 6266, 1},
+        {0x0fe58, 6270, 1}, {0x0fe59, 3555, 1}, {0x0fe5a, 3556, 1}, {0x0fe5b, 6273, 1},
+        {0x0fe5c, 6274, 1}, {0x0fe5d, 6275, 1}, {0x0fe5e, 6276, 1}, {0x0fe5f, 6287, 1},
+        {0x0fe60, 6288, 1}, {0x0fe61, 6289, 1}, {0x0fe62, 3552, 1}, {0x0fe63, 6290, 1},
+        {0x0fe64, 6291, 1}, {0x0fe65, 6292, 1}, {0x0fe66, 3554, 1}, {0x0fe68, 6293, 1},
+        {0x0fe69, 6294, 1}, {0x0fe6a, 6295, 1}, {0x0fe6b, 6296, 1}, {0x0fe70, 6297, 2},
+        {0x0fe71, 6299, 2}, {0x0fe72, 6301, 2}, {0x0fe74, 6303, 2}, {0x0fe76, 6305, 2},
+        {0x0fe77, 6307, 2}, {0x0fe78, 6309, 2}, {0x0fe79, 6311, 2}, {0x0fe7a, 6313, 2},
+        {0x0fe7b, 6315, 2}, {0x0fe7c, 6317, 2}, {0x0fe7d, 6319, 2}, {0x0fe7e, 6321, 2},
+        {0x0fe7f, 6323, 2}, {0x0fe80, 6325, 1}, {0x0fe81, 686, 2}, {0x0fe82, 686, 2},
+        {0x0fe83, 688, 2}, {0x0fe84, 688, 2}, {0x0fe85, 690, 2}, {0x0fe86, 690, 2},
+        {0x0fe87, 692, 2}, {0x0fe88, 692, 2}, {0x0fe89, 694, 2}, {0x0fe8a, 694, 2},
+        {0x0fe8b, 694, 2}, {0x0fe8c, 694, 2}, {0x0fe8d, 6326, 1}, {0x0fe8e, 6326, 1},
+        {0x0fe8f, 6327, 1}, {0x0fe90, 6327, 1}, {0x0fe91, 6327, 1}, {0x0fe92, 6327, 1},
+        {0x0fe93, 6328, 1}, {0x0fe94, 6328, 1}, {0x0fe95, 6329, 1}, {0x0fe96, 6329, 1},
+        {0x0fe97, 6329, 1}, {0x0fe98, 6329, 1}, {0x0fe99, 6330, 1}, {0x0fe9a, 6330, 1},
+        {0x0fe9b, 6330, 1}, {0x0fe9c, 6330, 1}, {0x0fe9d, 6331, 1}, {0x0fe9e, 6331, 1},
+        {0x0fe9f, 6331, 1}, {0x0fea0, 6331, 1}, {0x0fea1, 6332, 1}, {0x0fea2, 6332, 1},
+        {0x0fea3, 6332, 1}, {0x0fea4, 6332, 1}, {0x0fea5, 6333, 1}, {0x0fea6, 6333, 1},
+        {0x0fea7, 6333, 1}, {0x0fea8, 6333, 1}, {0x0fea9, 6334, 1}, {0x0feaa, 6334, 1},
+        {0x0feab, 6335, 1}, {0x0feac, 6335, 1}, {0x0fead, 6336, 1}, {0x0feae, 6336, 1},
+        {0x0feaf, 6337, 1}, {0x0feb0, 6337, 1}, {0x0feb1, 6338, 1}, {0x0feb2, 6338, 1},
+        {0x0feb3, 6338, 1}, {0x0feb4, 6338, 1}, {0x0feb5, 6339, 1}, {0x0feb6, 6339, 1},
+        {0x0feb7, 6339, 1}, {0x0feb8, 6339, 1}, {0x0feb9, 6340, 1}, {0x0feba, 6340, 1},
+        {0x0febb, 6340, 1}, {0x0febc, 6340, 1}, {0x0febd, 6341, 1}, {0x0febe, 6341, 1},
+        {0x0febf, 6341, 1}, {0x0fec0, 6341, 1}, {0x0fec1, 6342, 1}, {0x0fec2, 6342, 1},
+        {0x0fec3, 6342, 1}, {0x0fec4, 6342, 1}, {0x0fec5, 6343, 1}, {0x0fec6, 6343, 1},
+        {0x0fec7, 6343, 1}, {0x0fec8, 6343, 1}, {0x0fec9, 6344, 1}, {0x0feca, 6344, 1},
+        {0x0fecb, 6344, 1}, {0x0fecc, 6344, 1}, {0x0fecd, 6345, 1}, {0x0fece, 6345, 1},
+        {0x0fecf, 6345, 1}, {0x0fed0, 6345, 1}, {0x0fed1, 6346, 1}, {0x0fed2, 6346, 1},
+        {0x0fed3, 6346, 1}, {0x0fed4, 6346, 1}, {0x0fed5, 6347, 1}, {0x0fed6, 6347, 1},
+        {0x0fed7, 6347, 1}, {0x0fed8, 6347, 1}, {0x0fed9, 6348, 1}, {0x0feda, 6348, 1},
+        {0x0fedb, 6348, 1}, {0x0fedc, 6348, 1}, {0x0fedd, 6349, 1}, {0x0fede, 6349, 1},
+        {0x0fedf, 6349, 1}, {0x0fee0, 6349, 1}, {0x0fee1, 6350, 1}, {0x0fee2, 6350, 1},
+        {0x0fee3, 6350, 1}, {0x0fee4, 6350, 1}, {0x0fee5, 6351, 1}, {0x0fee6, 6351, 1},
+        {0x0fee7, 6351, 1}, {0x0fee8, 6351, 1}, {0x0fee9, 6352, 1}, {0x0feea, 6352, 1},
+        {0x0feeb, 6352, 1}, {0x0feec, 6352, 1}, {0x0feed, 6353, 1}, {0x0feee, 6353, 1},
+        {0x0feef, 5545, 1}, {0x0fef0, 5545, 1}, {0x0fef1, 6354, 1}, {0x0fef2, 6354, 1},
+        {0x0fef3, 6354, 1}, {0x0fef4, 6354, 1}, {0x0fef5, 6355, 3}, {0x0fef6, 6355, 3},
+        {0x0fef7, 6358, 3}, {0x0fef8, 6358, 3}, {0x0fef9, 6361, 3}, {0x0fefa, 6361, 3},
+        {0x0fefb, 6364, 2}, {0x0fefc, 6364, 2}, {0x0ff01, 6266, 1}, {0x0ff02, 6366, 1},
+        {0x0ff03, 6287, 1}, {0x0ff04, 6294, 1}, {0x0ff05, 6295, 1}, {0x0ff06, 6288, 1},
+        {0x0ff07, 6367, 1}, {0x0ff08, 3555, 1}, {0x0ff09, 3556, 1}, {0x0ff0a, 6289, 1},
+        {0x0ff0b, 3552, 1}, {0x0ff0c, 6262, 1}, {0x0ff0d, 6290, 1}, {0x0ff0e, 3515, 1},
+        {0x0ff0f, 6368, 1}, {0x0ff10, 3545, 1}, {0x0ff11, 3281, 1}, {0x0ff12, 3274, 1},
+        {0x0ff13, 3275, 1}, {0x0ff14, 3546, 1}, {0x0ff15, 3547, 1}, {0x0ff16, 3548, 1},
+        {0x0ff17, 3549, 1}, {0x0ff18, 3550, 1}, {0x0ff19, 3551, 1}, {0x0ff1a, 6265, 1},
+        {0x0ff1b, 532, 1}, {0x0ff1c, 6291, 1}, {0x0ff1d, 3554, 1}, {0x0ff1e, 6292, 1},
+        {0x0ff1f, 6267, 1}, {0x0ff20, 6296, 1}, {0x0ff21, 3397, 1}, {0x0ff22, 3399, 1},
+        {0x0ff23, 3566, 1}, {0x0ff24, 3400, 1}, {0x0ff25, 3401, 1}, {0x0ff26, 3590, 1},
+        {0x0ff27, 3403, 1}, {0x0ff28, 3404, 1}, {0x0ff29, 3405, 1}, {0x0ff2a, 3406, 1},
+        {0x0ff2b, 2026, 1}, {0x0ff2c, 3407, 1}, {0x0ff2d, 3408, 1}, {0x0ff2e, 3409, 1},
+        {0x0ff2f, 3410, 1}, {0x0ff30, 3412, 1}, {0x0ff31, 3581, 1}, {0x0ff32, 3413, 1},
+        {0x0ff33, 3932, 1}, {0x0ff34, 3414, 1}, {0x0ff35, 3415, 1}, {0x0ff36, 3656, 1},
+        {0x0ff37, 3416, 1}, {0x0ff38, 3668, 1}, {0x0ff39, 3933, 1}, {0x0ff3a, 3589, 1},
+        {0x0ff3b, 6285, 1}, {0x0ff3c, 6293, 1}, {0x0ff3d, 6286, 1}, {0x0ff3e, 6369, 1},
+        {0x0ff3f, 6272, 1}, {0x0ff40, 2002, 1}, {0x0ff41, 3271, 1}, {0x0ff42, 3420, 1},
+        {0x0ff43, 3446, 1}, {0x0ff44, 3421, 1}, {0x0ff45, 3422, 1}, {0x0ff46, 3449, 1},
+        {0x0ff47, 3426, 1}, {0x0ff48, 3330, 1}, {0x0ff49, 3443, 1}, {0x0ff4a, 3332, 1},
+        {0x0ff4b, 3427, 1}, {0x0ff4c, 3352, 1}, {0x0ff4d, 3428, 1}, {0x0ff4e, 3557, 1},
+        {0x0ff4f, 3282, 1}, {0x0ff50, 3433, 1}, {0x0ff51, 3934, 1}, {0x0ff52, 3333, 1},
+        {0x0ff53, 3302, 1}, {0x0ff54, 3434, 1}, {0x0ff55, 3435, 1}, {0x0ff56, 3438, 1},
+        {0x0ff57, 3337, 1}, {0x0ff58, 3353, 1}, {0x0ff59, 3338, 1}, {0x0ff5a, 3476, 1},
+        {0x0ff5b, 6273, 1}, {0x0ff5c, 6370, 1}, {0x0ff5d, 6274, 1}, {0x0ff5e, 6371, 1},
+        {0x0ff5f, 6372, 1}, {0x0ff60, 6373, 1}, {0x0ff61, 6264, 1}, {0x0ff62, 6281, 1},
+        {0x0ff63, 6282, 1}, {0x0ff64, 6263, 1}, {0x0ff65, 6374, 1}, {0x0ff66, 4695, 1},
+        {0x0ff67, 6375, 1}, {0x0ff68, 6376, 1}, {0x0ff69, 6377, 1}, {0x0ff6a, 6378, 1},
+        {0x0ff6b, 6379, 1}, {0x0ff6c, 6380, 1}, {0x0ff6d, 6381, 1}, {0x0ff6e, 6382, 1},
+        {0x0ff6f, 6383, 1}, {0x0ff70, 6384, 1}, {0x0ff71, 4649, 1}, {0x0ff72, 4650, 1},
+        {0x0ff73, 4651, 1}, {0x0ff74, 4652, 1}, {0x0ff75, 4653, 1}, {0x0ff76, 4654, 1},
+        {0x0ff77, 4655, 1}, {0x0ff78, 4656, 1}, {0x0ff79, 4657, 1}, {0x0ff7a, 4658, 1},
+        {0x0ff7b, 4659, 1}, {0x0ff7c, 4660, 1}, {0x0ff7d, 4661, 1}, {0x0ff7e, 4662, 1},
+        {0x0ff7f, 4663, 1}, {0x0ff80, 4664, 1}, {0x0ff81, 4665, 1}, {0x0ff82, 4666, 1},
+        {0x0ff83, 4667, 1}, {0x0ff84, 4668, 1}, {0x0ff85, 4669, 1}, {0x0ff86, 4670, 1},
+        {0x0ff87, 4671, 1}, {0x0ff88, 4672, 1}, {0x0ff89, 4673, 1}, {0x0ff8a, 4674, 1},
+        {0x0ff8b, 4675, 1}, {0x0ff8c, 4676, 1}, {0x0ff8d, 4677, 1}, {0x0ff8e, 4678, 1},
+        {0x0ff8f, 4679, 1}, {0x0ff90, 4680, 1}, {0x0ff91, 4681, 1}, {0x0ff92, 4682, 1},
+        {0x0ff93, 4683, 1}, {0x0ff94, 4684, 1}, {0x0ff95, 4685, 1}, {0x0ff96, 4686, 1},
+        {0x0ff97, 4687, 1}, {0x0ff98, 4688, 1}, {0x0ff99, 4689, 1}, {0x0ff9a, 4690, 1},
+        {0x0ff9b, 4691, 1}, {0x0ff9c, 4692, 1}, {0x0ff9d, 6385, 1}, {0x0ff9e, 6386, 1},
+        {0x0ff9f, 6387, 1}, {0x0ffa0, 4202, 1}, {0x0ffa1, 4151, 1}, {0x0ffa2, 4152, 1},
+        {0x0ffa3, 4153, 1}, {0x0ffa4, 4154, 1}, {0x0ffa5, 4155, 1}, {0x0ffa6, 4156, 1},
+        {0x0ffa7, 4157, 1}, {0x0ffa8, 4158, 1}, {0x0ffa9, 4159, 1}, {0x0ffaa, 4160, 1},
+        {0x0ffab, 4161, 1}, {0x0ffac, 4162, 1}, {0x0ffad, 4163, 1}, {0x0ffae, 4164, 1},
+        {0x0ffaf, 4165, 1}, {0x0ffb0, 4166, 1}, {0x0ffb1, 4167, 1}, {0x0ffb2, 4168, 1},
+        {0x0ffb3, 4169, 1}, {0x0ffb4, 4170, 1}, {0x0ffb5, 4171, 1}, {0x0ffb6, 4172, 1},
+        {0x0ffb7, 4173, 1}, {0x0ffb8, 4174, 1}, {0x0ffb9, 4175, 1}, {0x0ffba, 4176, 1},
+        {0x0ffbb, 4177, 1}, {0x0ffbc, 4178, 1}, {0x0ffbd, 4179, 1}, {0x0ffbe, 4180, 1},
+        {0x0ffc2, 4181, 1}, {0x0ffc3, 4182, 1}, {0x0ffc4, 4183, 1}, {0x0ffc5, 4184, 1},
+        {0x0ffc6, 4185, 1}, {0x0ffc7, 4186, 1}, {0x0ffca, 4187, 1}, {0x0ffcb, 4188, 1},
+        {0x0ffcc, 4189, 1}, {0x0ffcd, 4190, 1}, {0x0ffce, 4191, 1}, {0x0ffcf, 4192, 1},
+        {0x0ffd2, 4193, 1}, {0x0ffd3, 4194, 1}, {0x0ffd4, 4195, 1}, {0x0ffd5, 4196, 1},
+        {0x0ffd6, 4197, 1}, {0x0ffd7, 4198, 1}, {0x0ffda, 4199, 1}, {0x0ffdb, 4200, 1},
+        {0x0ffdc, 4201, 1}, {0x0ffe0, 6388, 1}, {0x0ffe1, 6389, 1}, {0x0ffe2, 6390, 1},
+        {0x0ffe3, 3272, 2}, {0x0ffe4, 6391, 1}, {0x0ffe5, 6392, 1}, {0x0ffe6, 6393, 1},
+        {0x0ffe8, 6394, 1}, {0x0ffe9, 6395, 1}, {0x0ffea, 6396, 1}, {0x0ffeb, 6397, 1},
+        {0x0ffec, 6398, 1}, {0x0ffed, 6399, 1}, {0x0ffee, 6400, 1}, {0x10781, 6401, 1},
+        {0x10782, 6402, 1}, {0x10783, 6403, 1}, {0x10784, 6404, 1}, {0x10785, 6405, 1},
+        {0x10787, 6406, 1}, {0x10788, 6407, 1}, {0x10789, 6408, 1}, {0x1078a, 6409, 1},
+        {0x1078b, 6410, 1}, {0x1078c, 6411, 1}, {0x1078d, 6412, 1}, {0x1078e, 6413, 1},
+        {0x1078f, 6414, 1}, {0x10790, 6415, 1}, {0x10791, 6416, 1}, {0x10792, 6417, 1},
+        {0x10793, 6418, 1}, {0x10794, 6419, 1}, {0x10795, 3578, 1}, {0x10796, 6420, 1},
+        {0x10797, 6421, 1}, {0x10798, 6422, 1}, {0x10799, 6423, 1}, {0x1079a, 6424, 1},
+        {0x1079b, 6425, 1}, {0x1079c, 6426, 1}, {0x1079d, 6427, 1}, {0x1079e, 6428, 1},
+        {0x1079f, 6429, 1}, {0x107a0, 6430, 1}, {0x107a1, 6431, 1}, {0x107a2, 6432, 1},
+        {0x107a3, 6433, 1}, {0x107a4, 6434, 1}, {0x107a5, 3934, 1}, {0x107a6, 6435, 1},
+        {0x107a7, 6436, 1}, {0x107a8, 6437, 1}, {0x107a9, 6438, 1}, {0x107aa, 6439, 1},
+        {0x107ab, 6440, 1}, {0x107ac, 6441, 1}, {0x107ad, 6442, 1}, {0x107ae, 6443, 1},
+        {0x107af, 6444, 1}, {0x107b0, 6445, 1}, {0x107b2, 6446, 1}, {0x107b3, 6447, 1},
+        {0x107b4, 6448, 1}, {0x107b5, 6449, 1}, {0x107b6, 6450, 1}, {0x107b7, 6451, 1},
+        {0x107b8, 6452, 1}, {0x107b9, 6453, 1}, {0x107ba, 6454, 1}, {0x1d400, 3397, 1},
+        {0x1d401, 3399, 1}, {0x1d402, 3566, 1}, {0x1d403, 3400, 1}, {0x1d404, 3401, 1},
+        {0x1d405, 3590, 1}, {0x1d406, 3403, 1}, {0x1d407, 3404, 1}, {0x1d408, 3405, 1},
+        {0x1d409, 3406, 1}, {0x1d40a, 2026, 1}, {0x1d40b, 3407, 1}, {0x1d40c, 3408, 1},
+        {0x1d40d, 3409, 1}, {0x1d40e, 3410, 1}, {0x1d40f, 3412, 1}, {0x1d410, 3581, 1},
+        {0x1d411, 3413, 1}, {0x1d412, 3932, 1}, {0x1d413, 3414, 1}, {0x1d414, 3415, 1},
+        {0x1d415, 3656, 1}, {0x1d416, 3416, 1}, {0x1d417, 3668, 1}, {0x1d418, 3933, 1},
+        {0x1d419, 3589, 1}, {0x1d41a, 3271, 1}, {0x1d41b, 3420, 1}, {0x1d41c, 3446, 1},
+        {0x1d41d, 3421, 1}, {0x1d41e, 3422, 1}, {0x1d41f, 3449, 1}, {0x1d420, 3426, 1},
+        {0x1d421, 3330, 1}, {0x1d422, 3443, 1}, {0x1d423, 3332, 1}, {0x1d424, 3427, 1},
+        {0x1d425, 3352, 1}, {0x1d426, 3428, 1}, {0x1d427, 3557, 1}, {0x1d428, 3282, 1},
+        {0x1d429, 3433, 1}, {0x1d42a, 3934, 1}, {0x1d42b, 3333, 1}, {0x1d42c, 3302, 1},
+        {0x1d42d, 3434, 1}, {0x1d42e, 3435, 1}, {0x1d42f, 3438, 1}, {0x1d430, 3337, 1},
+        {0x1d431, 3353, 1}, {0x1d432, 3338, 1}, {0x1d433, 3476, 1}, {0x1d434, 3397, 1},
+        {0x1d435, 3399, 1}, {0x1d436, 3566, 1}, {0x1d437, 3400, 1}, {0x1d438, 3401, 1},
+        {0x1d439, 3590, 1}, {0x1d43a, 3403, 1}, {0x1d43b, 3404, 1}, {0x1d43c, 3405, 1},
+        {0x1d43d, 3406, 1}, {0x1d43e, 2026, 1}, {0x1d43f, 3407, 1}, {0x1d440, 3408, 1},
+        {0x1d441, 3409, 1}, {0x1d442, 3410, 1}, {0x1d443, 3412, 1}, {0x1d444, 3581, 1},
+        {0x1d445, 3413, 1}, {0x1d446, 3932, 1}, {0x1d447, 3414, 1}, {0x1d448, 3415, 1},
+        {0x1d449, 3656, 1}, {0x1d44a, 3416, 1}, {0x1d44b, 3668, 1}, {0x1d44c, 3933, 1},
+        {0x1d44d, 3589, 1}, {0x1d44e, 3271, 1}, {0x1d44f, 3420, 1}, {0x1d450, 3446, 1},
+        {0x1d451, 3421, 1}, {0x1d452, 3422, 1}, {0x1d453, 3449, 1}, {0x1d454, 3426, 1},
+        {0x1d456, 3443, 1}, {0x1d457, 3332, 1}, {0x1d458, 3427, 1}, {0x1d459, 3352, 1},
+        {0x1d45a, 3428, 1}, {0x1d45b, 3557, 1}, {0x1d45c, 3282, 1}, {0x1d45d, 3433, 1},
+        {0x1d45e, 3934, 1}, {0x1d45f, 3333, 1}, {0x1d460, 3302, 1}, {0x1d461, 3434, 1},
+        {0x1d462, 3435, 1}, {0x1d463, 3438, 1}, {0x1d464, 3337, 1}, {0x1d465, 3353, 1},
+        {0x1d466, 3338, 1}, {0x1d467, 3476, 1}, {0x1d468, 3397, 1}, {0x1d469, 3399, 1},
+        {0x1d46a, 3566, 1}, {0x1d46b, 3400, 1}, {0x1d46c, 3401, 1}, {0x1d46d, 3590, 1},
+        {0x1d46e, 3403, 1}, {0x1d46f, 3404, 1}, {0x1d470, 3405, 1}, {0x1d471, 3406, 1},
+        {0x1d472, 2026, 1}, {0x1d473, 3407, 1}, {0x1d474, 3408, 1}, {0x1d475, 3409, 1},
+        {0x1d476, 3410, 1}, {0x1d477, 3412, 1}, {0x1d478, 3581, 1}, {0x1d479, 3413, 1},
+        {0x1d47a, 3932, 1}, {0x1d47b, 3414, 1}, {0x1d47c, 3415, 1}, {0x1d47d, 3656, 1},
+        {0x1d47e, 3416, 1}, {0x1d47f, 3668, 1}, {0x1d480, 3933, 1}, {0x1d481, 3589, 1},
+        {0x1d482, 3271, 1}, {0x1d483, 3420, 1}, {0x1d484, 3446, 1}, {0x1d485, 3421, 1},
+        {0x1d486, 3422, 1}, {0x1d487, 3449, 1}, {0x1d488, 3426, 1}, {0x1d489, 3330, 1},
+        {0x1d48a, 3443, 1}, {0x1d48b, 3332, 1}, {0x1d48c, 3427, 1}, {0x1d48d, 3352, 1},
+        {0x1d48e, 3428, 1}, {0x1d48f, 3557, 1}, {0x1d490, 3282, 1}, {0x1d491, 3433, 1},
+        {0x1d492, 3934, 1}, {0x1d493, 3333, 1}, {0x1d494, 3302, 1}, {0x1d495, 3434, 1},
+        {0x1d496, 3435, 1}, {0x1d497, 3438, 1}, {0x1d498, 3337, 1}, {0x1d499, 3353, 1},
+        {0x1d49a, 3338, 1}, {0x1d49b, 3476, 1}, {0x1d49c, 3397, 1}, {0x1d49e, 3566, 1},
+        {0x1d49f, 3400, 1}, {0x1d4a2, 3403, 1}, {0x1d4a5, 3406, 1}, {0x1d4a6, 2026, 1},
+        {0x1d4a9, 3409, 1}, {0x1d4aa, 3410, 1}, {0x1d4ab, 3412, 1}, {0x1d4ac, 3581, 1},
+        {0x1d4ae, 3932, 1}, {0x1d4af, 3414, 1}, {0x1d4b0, 3415, 1}, {0x1d4b1, 3656, 1},
+        {0x1d4b2, 3416, 1}, {0x1d4b3, 3668, 1}, {0x1d4b4, 3933, 1}, {0x1d4b5, 3589, 1},
+        {0x1d4b6, 3271, 1}, {0x1d4b7, 3420, 1}, {0x1d4b8, 3446, 1}, {0x1d4b9, 3421, 1},
+        {0x1d4bb, 3449, 1}, {0x1d4bd, 3330, 1}, {0x1d4be, 3443, 1}, {0x1d4bf, 3332, 1},
+        {0x1d4c0, 3427, 1}, {0x1d4c1, 3352, 1}, {0x1d4c2, 3428, 1}, {0x1d4c3, 3557, 1},
+        {0x1d4c5, 3433, 1}, {0x1d4c6, 3934, 1}, {0x1d4c7, 3333, 1}, {0x1d4c8, 3302, 1},
+        {0x1d4c9, 3434, 1}, {0x1d4ca, 3435, 1}, {0x1d4cb, 3438, 1}, {0x1d4cc, 3337, 1},
+        {0x1d4cd, 3353, 1}, {0x1d4ce, 3338, 1}, {0x1d4cf, 3476, 1}, {0x1d4d0, 3397, 1},
+        {0x1d4d1, 3399, 1}, {0x1d4d2, 3566, 1}, {0x1d4d3, 3400, 1}, {0x1d4d4, 3401, 1},
+        {0x1d4d5, 3590, 1}, {0x1d4d6, 3403, 1}, {0x1d4d7, 3404, 1}, {0x1d4d8, 3405, 1},
+        {0x1d4d9, 3406, 1}, {0x1d4da, 2026, 1}, {0x1d4db, 3407, 1}, {0x1d4dc, 3408, 1},
+        {0x1d4dd, 3409, 1}, {0x1d4de, 3410, 1}, {0x1d4df, 3412, 1}, {0x1d4e0, 3581, 1},
+        {0x1d4e1, 3413, 1}, {0x1d4e2, 3932, 1}, {0x1d4e3, 3414, 1}, {0x1d4e4, 3415, 1},
+        {0x1d4e5, 3656, 1}, {0x1d4e6, 3416, 1}, {0x1d4e7, 3668, 1}, {0x1d4e8, 3933, 1},
+        {0x1d4e9, 3589, 1}, {0x1d4ea, 3271, 1}, {0x1d4eb, 3420, 1}, {0x1d4ec, 3446, 1},
+        {0x1d4ed, 3421, 1}, {0x1d4ee, 3422, 1}, {0x1d4ef, 3449, 1}, {0x1d4f0, 3426, 1},
+        {0x1d4f1, 3330, 1}, {0x1d4f2, 3443, 1}, {0x1d4f3, 3332, 1}, {0x1d4f4, 3427, 1},
+        {0x1d4f5, 3352, 1}, {0x1d4f6, 3428, 1}, {0x1d4f7, 3557, 1}, {0x1d4f8, 3282, 1},
+        {0x1d4f9, 3433, 1}, {0x1d4fa, 3934, 1}, {0x1d4fb, 3333, 1}, {0x1d4fc, 3302, 1},
+        {0x1d4fd, 3434, 1}, {0x1d4fe, 3435, 1}, {0x1d4ff, 3438, 1}, {0x1d500, 3337, 1},
+        {0x1d501, 3353, 1}, {0x1d502, 3338, 1}, {0x1d503, 3476, 1}, {0x1d504, 3397, 1},
+        {0x1d505, 3399, 1}, {0x1d507, 3400, 1}, {0x1d508, 3401, 1}, {0x1d509, 3590, 1},
+        {0x1d50a, 3403, 1}, {0x1d50d, 3406, 1}, {0x1d50e, 2026, 1}, {0x1d50f, 3407, 1},
+        {0x1d510, 3408, 1}, {0x1d511, 3409, 1}, {0x1d512, 3410, 1}, {0x1d513, 3412, 1},
+        {0x1d514, 3581, 1}, {0x1d516, 3932, 1}, {0x1d517, 3414, 1}, {0x1d518, 3415, 1},
+        {0x1d519, 3656, 1}, {0x1d51a, 3416, 1}, {0x1d51b, 3668, 1}, {0x1d51c, 3933, 1},
+        {0x1d51e, 3271, 1}, {0x1d51f, 3420, 1}, {0x1d520, 3446, 1}, {0x1d521, 3421, 1},
+        {0x1d522, 3422, 1}, {0x1d523, 3449, 1}, {0x1d524, 3426, 1}, {0x1d525, 3330, 1},
+        {0x1d526, 3443, 1}, {0x1d527, 3332, 1}, {0x1d528, 3427, 1}, {0x1d529, 3352, 1},
+        {0x1d52a, 3428, 1}, {0x1d52b, 3557, 1}, {0x1d52c, 3282, 1}, {0x1d52d, 3433, 1},
+        {0x1d52e, 3934, 1}, {0x1d52f, 3333, 1}, {0x1d530, 3302, 1}, {0x1d531, 3434, 1},
+        {0x1d532, 3435, 1}, {0x1d533, 3438, 1}, {0x1d534, 3337, 1}, {0x1d535, 3353, 1},
+        {0x1d536, 3338, 1}, {0x1d537, 3476, 1}, {0x1d538, 3397, 1}, {0x1d539, 3399, 1},
+        {0x1d53b, 3400, 1}, {0x1d53c, 3401, 1}, {0x1d53d, 3590, 1}, {0x1d53e, 3403, 1},
+        {0x1d540, 3405, 1}, {0x1d541, 3406, 1}, {0x1d542, 2026, 1}, {0x1d543, 3407, 1},
+        {0x1d544, 3408, 1}, {0x1d546, 3410, 1}, {0x1d54a, 3932, 1}, {0x1d54b, 3414, 1},
+        {0x1d54c, 3415, 1}, {0x1d54d, 3656, 1}, {0x1d54e, 3416, 1}, {0x1d54f, 3668, 1},
+        {0x1d550, 3933, 1}, {0x1d552, 3271, 1}, {0x1d553, 3420, 1}, {0x1d554, 3446, 1},
+        {0x1d555, 3421, 1}, {0x1d556, 3422, 1}, {0x1d557, 3449, 1}, {0x1d558, 3426, 1},
+        {0x1d559, 3330, 1}, {0x1d55a, 3443, 1}, {0x1d55b, 3332, 1}, {0x1d55c, 3427, 1},
+        {0x1d55d, 3352, 1}, {0x1d55e, 3428, 1}, {0x1d55f, 3557, 1}, {0x1d560, 3282, 1},
+        {0x1d561, 3433, 1}, {0x1d562, 3934, 1}, {0x1d563, 3333, 1}, {0x1d564, 3302, 1},
+        {0x1d565, 3434, 1}, {0x1d566, 3435, 1}, {0x1d567, 3438, 1}, {0x1d568, 3337, 1},
+        {0x1d569, 3353, 1}, {0x1d56a, 3338, 1}, {0x1d56b, 3476, 1}, {0x1d56c, 3397, 1},
+        {0x1d56d, 3399, 1}, {0x1d56e, 3566, 1}, {0x1d56f, 3400, 1}, {0x1d570, 3401, 1},
+        {0x1d571, 3590, 1}, {0x1d572, 3403, 1}, {0x1d573, 3404, 1}, {0x1d574, 3405, 1},
+        {0x1d575, 3406, 1}, {0x1d576, 2026, 1}, {0x1d577, 3407, 1}, {0x1d578, 3408, 1},
+        {0x1d579, 3409, 1}, {0x1d57a, 3410, 1}, {0x1d57b, 3412, 1}, {0x1d57c, 3581, 1},
+        {0x1d57d, 3413, 1}, {0x1d57e, 3932, 1}, {0x1d57f, 3414, 1}, {0x1d580, 3415, 1},
+        {0x1d581, 3656, 1}, {0x1d582, 3416, 1}, {0x1d583, 3668, 1}, {0x1d584, 3933, 1},
+        {0x1d585, 3589, 1}, {0x1d586, 3271, 1}, {0x1d587, 3420, 1}, {0x1d588, 3446, 1},
+        {0x1d589, 3421, 1}, {0x1d58a, 3422, 1}, {0x1d58b, 3449, 1}, {0x1d58c, 3426, 1},
+        {0x1d58d, 3330, 1}, {0x1d58e, 3443, 1}, {0x1d58f, 3332, 1}, {0x1d590, 3427, 1},
+        {0x1d591, 3352, 1}, {0x1d592, 3428, 1}, {0x1d593, 3557, 1}, {0x1d594, 3282, 1},
+        {0x1d595, 3433, 1}, {0x1d596, 3934, 1}, {0x1d597, 3333, 1}, {0x1d598, 3302, 1},
+        {0x1d599, 3434, 1}, {0x1d59a, 3435, 1}, {0x1d59b, 3438, 1}, {0x1d59c, 3337, 1},
+        {0x1d59d, 3353, 1}, {0x1d59e, 3338, 1}, {0x1d59f, 3476, 1}, {0x1d5a0, 3397, 1},
+        {0x1d5a1, 3399, 1}, {0x1d5a2, 3566, 1}, {0x1d5a3, 3400, 1}, {0x1d5a4, 3401, 1},
+        {0x1d5a5, 3590, 1}, {0x1d5a6, 3403, 1}, {0x1d5a7, 3404, 1}, {0x1d5a8, 3405, 1},
+        {0x1d5a9, 3406, 1}, {0x1d5aa, 2026, 1}, {0x1d5ab, 3407, 1}, {0x1d5ac, 3408, 1},
+        {0x1d5ad, 3409, 1}, {0x1d5ae, 3410, 1}, {0x1d5af, 3412, 1}, {0x1d5b0, 3581, 1},
+        {0x1d5b1, 3413, 1}, {0x1d5b2, 3932, 1}, {0x1d5b3, 3414, 1}, {0x1d5b4, 3415, 1},
+        {0x1d5b5, 3656, 1}, {0x1d5b6, 3416, 1}, {0x1d5b7, 3668, 1}, {0x1d5b8, 3933, 1},
+        {0x1d5b9, 3589, 1}, {0x1d5ba, 3271, 1}, {0x1d5bb, 3420, 1}, {0x1d5bc, 3446, 1},
+        {0x1d5bd, 3421, 1}, {0x1d5be, 3422, 1}, {0x1d5bf, 3449, 1}, {0x1d5c0, 3426, 1},
+        {0x1d5c1, 3330, 1}, {0x1d5c2, 3443, 1}, {0x1d5c3, 3332, 1}, {0x1d5c4, 3427, 1},
+        {0x1d5c5, 3352, 1}, {0x1d5c6, 3428, 1}, {0x1d5c7, 3557, 1}, {0x1d5c8, 3282, 1},
+        {0x1d5c9, 3433, 1}, {0x1d5ca, 3934, 1}, {0x1d5cb, 3333, 1}, {0x1d5cc, 3302, 1},
+        {0x1d5cd, 3434, 1}, {0x1d5ce, 3435, 1}, {0x1d5cf, 3438, 1}, {0x1d5d0, 3337, 1},
+        {0x1d5d1, 3353, 1}, {0x1d5d2, 3338, 1}, {0x1d5d3, 3476, 1}, {0x1d5d4, 3397, 1},
+        {0x1d5d5, 3399, 1}, {0x1d5d6, 3566, 1}, {0x1d5d7, 3400, 1}, {0x1d5d8, 3401, 1},
+        {0x1d5d9, 3590, 1}, {0x1d5da, 3403, 1}, {0x1d5db, 3404, 1}, {0x1d5dc, 3405, 1},
+        {0x1d5dd, 3406, 1}, {0x1d5de, 2026, 1}, {0x1d5df, 3407, 1}, {0x1d5e0, 3408, 1},
+        {0x1d5e1, 3409, 1}, {0x1d5e2, 3410, 1}, {0x1d5e3, 3412, 1}, {0x1d5e4, 3581, 1},
+        {0x1d5e5, 3413, 1}, {0x1d5e6, 3932, 1}, {0x1d5e7, 3414, 1}, {0x1d5e8, 3415, 1},
+        {0x1d5e9, 3656, 1}, {0x1d5ea, 3416, 1}, {0x1d5eb, 3668, 1}, {0x1d5ec, 3933, 1},
+        {0x1d5ed, 3589, 1}, {0x1d5ee, 3271, 1}, {0x1d5ef, 3420, 1}, {0x1d5f0, 3446, 1},
+        {0x1d5f1, 3421, 1}, {0x1d5f2, 3422, 1}, {0x1d5f3, 3449, 1}, {0x1d5f4, 3426, 1},
+        {0x1d5f5, 3330, 1}, {0x1d5f6, 3443, 1}, {0x1d5f7, 3332, 1}, {0x1d5f8, 3427, 1},
+        {0x1d5f9, 3352, 1}, {0x1d5fa, 3428, 1}, {0x1d5fb, 3557, 1}, {0x1d5fc, 3282, 1},
+        {0x1d5fd, 3433, 1}, {0x1d5fe, 3934, 1}, {0x1d5ff, 3333, 1}, {0x1d600, 3302, 1},
+        {0x1d601, 3434, 1}, {0x1d602, 3435, 1}, {0x1d603, 3438, 1}, {0x1d604, 3337, 1},
+        {0x1d605, 3353, 1}, {0x1d606, 3338, 1}, {0x1d607, 3476, 1}, {0x1d608, 3397, 1},
+        {0x1d609, 3399, 1}, {0x1d60a, 3566, 1}, {0x1d60b, 3400, 1}, {0x1d60c, 3401, 1},
+        {0x1d60d, 3590, 1}, {0x1d60e, 3403, 1}, {0x1d60f, 3404, 1}, {0x1d610, 3405, 1},
+        {0x1d611, 3406, 1}, {0x1d612, 2026, 1}, {0x1d613, 3407, 1}, {0x1d614, 3408, 1},
+        {0x1d615, 3409, 1}, {0x1d616, 3410, 1}, {0x1d617, 3412, 1}, {0x1d618, 3581, 1},
+        {0x1d619, 3413, 1}, {0x1d61a, 3932, 1}, {0x1d61b, 3414, 1}, {0x1d61c, 3415, 1},
+        {0x1d61d, 3656, 1}, {0x1d61e, 3416, 1}, {0x1d61f, 3668, 1}, {0x1d620, 3933, 1},
+        {0x1d621, 3589, 1}, {0x1d622, 3271, 1}, {0x1d623, 3420, 1}, {0x1d624, 3446, 1},
+        {0x1d625, 3421, 1}, {0x1d626, 3422, 1}, {0x1d627, 3449, 1}, {0x1d628, 3426, 1},
+        {0x1d629, 3330, 1}, {0x1d62a, 3443, 1}, {0x1d62b, 3332, 1}, {0x1d62c, 3427, 1},
+        {0x1d62d, 3352, 1}, {0x1d62e, 3428, 1}, {0x1d62f, 3557, 1}, {0x1d630, 3282, 1},
+        {0x1d631, 3433, 1}, {0x1d632, 3934, 1}, {0x1d633, 3333, 1}, {0x1d634, 3302, 1},
+        {0x1d635, 3434, 1}, {0x1d636, 3435, 1}, {0x1d637, 3438, 1}, {0x1d638, 3337, 1},
+        {0x1d639, 3353, 1}, {0x1d63a, 3338, 1}, {0x1d63b, 3476, 1}, {0x1d63c, 3397, 1},
+        {0x1d63d, 3399, 1}, {0x1d63e, 3566, 1}, {0x1d63f, 3400, 1}, {0x1d640, 3401, 1},
+        {0x1d641, 3590, 1}, {0x1d642, 3403, 1}, {0x1d643, 3404, 1}, {0x1d644, 3405, 1},
+        {0x1d645, 3406, 1}, {0x1d646, 2026, 1}, {0x1d647, 3407, 1}, {0x1d648, 3408, 1},
+        {0x1d649, 3409, 1}, {0x1d64a, 3410, 1}, {0x1d64b, 3412, 1}, {0x1d64c, 3581, 1},
+        {0x1d64d, 3413, 1}, {0x1d64e, 3932, 1}, {0x1d64f, 3414, 1}, {0x1d650, 3415, 1},
+        {0x1d651, 3656, 1}, {0x1d652, 3416, 1}, {0x1d653, 3668, 1}, {0x1d654, 3933, 1},
+        {0x1d655, 3589, 1}, {0x1d656, 3271, 1}, {0x1d657, 3420, 1}, {0x1d658, 3446, 1},
+        {0x1d659, 3421, 1}, {0x1d65a, 3422, 1}, {0x1d65b, 3449, 1}, {0x1d65c, 3426, 1},
+        {0x1d65d, 3330, 1}, {0x1d65e, 3443, 1}, {0x1d65f, 3332, 1}, {0x1d660, 3427, 1},
+        {0x1d661, 3352, 1}, {0x1d662, 3428, 1}, {0x1d663, 3557, 1}, {0x1d664, 3282, 1},
+        {0x1d665, 3433, 1}, {0x1d666, 3934, 1}, {0x1d667, 3333, 1}, {0x1d668, 3302, 1},
+        {0x1d669, 3434, 1}, {0x1d66a, 3435, 1}, {0x1d66b, 3438, 1}, {0x1d66c, 3337, 1},
+        {0x1d66d, 3353, 1}, {0x1d66e, 3338, 1}, {0x1d66f, 3476, 1}, {0x1d670, 3397, 1},
+        {0x1d671, 3399, 1}, {0x1d672, 3566, 1}, {0x1d673, 3400, 1}, {0x1d674, 3401, 1},
+        {0x1d675, 3590, 1}, {0x1d676, 3403, 1}, {0x1d677, 3404, 1}, {0x1d678, 3405, 1},
+        {0x1d679, 3406, 1}, {0x1d67a, 2026, 1}, {0x1d67b, 3407, 1}, {0x1d67c, 3408, 1},
+        {0x1d67d, 3409, 1}, {0x1d67e, 3410, 1}, {0x1d67f, 3412, 1}, {0x1d680, 3581, 1},
+        {0x1d681, 3413, 1}, {0x1d682, 3932, 1}, {0x1d683, 3414, 1}, {0x1d684, 3415, 1},
+        {0x1d685, 3656, 1}, {0x1d686, 3416, 1}, {0x1d687, 3668, 1}, {0x1d688, 3933, 1},
+        {0x1d689, 3589, 1}, {0x1d68a, 3271, 1}, {0x1d68b, 3420, 1}, {0x1d68c, 3446, 1},
+        {0x1d68d, 3421, 1}, {0x1d68e, 3422, 1}, {0x1d68f, 3449, 1}, {0x1d690, 3426, 1},
+        {0x1d691, 3330, 1}, {0x1d692, 3443, 1}, {0x1d693, 3332, 1}, {0x1d694, 3427, 1},
+        {0x1d695, 3352, 1}, {0x1d696, 3428, 1}, {0x1d697, 3557, 1}, {0x1d698, 3282, 1},
+        {0x1d699, 3433, 1}, {0x1d69a, 3934, 1}, {0x1d69b, 3333, 1}, {0x1d69c, 3302, 1},
+        {0x1d69d, 3434, 1}, {0x1d69e, 3435, 1}, {0x1d69f, 3438, 1}, {0x1d6a0, 3337, 1},
+        {0x1d6a1, 3353, 1}, {0x1d6a2, 3338, 1}, {0x1d6a3, 3476, 1}, {0x1d6a4, 6455, 1},
+        {0x1d6a5, 6456, 1}, {0x1d6a8, 6457, 1}, {0x1d6a9, 6458, 1}, {0x1d6aa, 3598, 1},
+        {0x1d6ab, 6459, 1}, {0x1d6ac, 6460, 1}, {0x1d6ad, 6461, 1}, {0x1d6ae, 6462, 1},
+        {0x1d6af, 3368, 1}, {0x1d6b0, 6463, 1}, {0x1d6b1, 6464, 1}, {0x1d6b2, 6465, 1},
+        {0x1d6b3, 6466, 1}, {0x1d6b4, 6467, 1}, {0x1d6b5, 6468, 1}, {0x1d6b6, 6469, 1},
+        {0x1d6b7, 3599, 1}, {0x1d6b8, 6470, 1}, {0x1d6b9, 3368, 1}, {0x1d6ba, 3370, 1},
+        {0x1d6bb, 6471, 1}, {0x1d6bc, 3362, 1}, {0x1d6bd, 6472, 1}, {0x1d6be, 6473, 1},
+        {0x1d6bf, 6474, 1}, {0x1d6c0, 2025, 1}, {0x1d6c1, 6475, 1}, {0x1d6c2, 6476, 1},
+        {0x1d6c3, 3360, 1}, {0x1d6c4, 3440, 1}, {0x1d6c5, 3441, 1}, {0x1d6c6, 3369, 1},
+        {0x1d6c7, 6477, 1}, {0x1d6c8, 6478, 1}, {0x1d6c9, 3361, 1}, {0x1d6ca, 1924, 1},
+        {0x1d6cb, 3365, 1}, {0x1d6cc, 6479, 1}, {0x1d6cd, 3278, 1}, {0x1d6ce, 6480, 1},
+        {0x1d6cf, 6481, 1}, {0x1d6d0, 6482, 1}, {0x1d6d1, 3364, 1}, {0x1d6d2, 3366, 1},
+        {0x1d6d3, 3367, 1}, {0x1d6d4, 6483, 1}, {0x1d6d5, 6484, 1}, {0x1d6d6, 6485, 1},
+        {0x1d6d7, 3363, 1}, {0x1d6d8, 3442, 1}, {0x1d6d9, 6486, 1}, {0x1d6da, 6487, 1},
+        {0x1d6db, 6488, 1}, {0x1d6dc, 3369, 1}, {0x1d6dd, 3361, 1}, {0x1d6de, 3365, 1},
+        {0x1d6df, 3363, 1}, {0x1d6e0, 3366, 1}, {0x1d6e1, 3364, 1}, {0x1d6e2, 6457, 1},
+        {0x1d6e3, 6458, 1}, {0x1d6e4, 3598, 1}, {0x1d6e5, 6459, 1}, {0x1d6e6, 6460, 1},
+        {0x1d6e7, 6461, 1}, {0x1d6e8, 6462, 1}, {0x1d6e9, 3368, 1}, {0x1d6ea, 6463, 1},
+        {0x1d6eb, 6464, 1}, {0x1d6ec, 6465, 1}, {0x1d6ed, 6466, 1}, {0x1d6ee, 6467, 1},
+        {0x1d6ef, 6468, 1}, {0x1d6f0, 6469, 1}, {0x1d6f1, 3599, 1}, {0x1d6f2, 6470, 1},
+        {0x1d6f3, 3368, 1}, {0x1d6f4, 3370, 1}, {0x1d6f5, 6471, 1}, {0x1d6f6, 3362, 1},
+        {0x1d6f7, 6472, 1}, {0x1d6f8, 6473, 1}, {0x1d6f9, 6474, 1}, {0x1d6fa, 2025, 1},
+        {0x1d6fb, 6475, 1}, {0x1d6fc, 6476, 1}, {0x1d6fd, 3360, 1}, {0x1d6fe, 3440, 1},
+        {0x1d6ff, 3441, 1}, {0x1d700, 3369, 1}, {0x1d701, 6477, 1}, {0x1d702, 6478, 1},
+        {0x1d703, 3361, 1}, {0x1d704, 1924, 1}, {0x1d705, 3365, 1}, {0x1d706, 6479, 1},
+        {0x1d707, 3278, 1}, {0x1d708, 6480, 1}, {0x1d709, 6481, 1}, {0x1d70a, 6482, 1},
+        {0x1d70b, 3364, 1}, {0x1d70c, 3366, 1}, {0x1d70d, 3367, 1}, {0x1d70e, 6483, 1},
+        {0x1d70f, 6484, 1}, {0x1d710, 6485, 1}, {0x1d711, 3363, 1}, {0x1d712, 3442, 1},
+        {0x1d713, 6486, 1}, {0x1d714, 6487, 1}, {0x1d715, 6488, 1}, {0x1d716, 3369, 1},
+        {0x1d717, 3361, 1}, {0x1d718, 3365, 1}, {0x1d719, 3363, 1}, {0x1d71a, 3366, 1},
+        {0x1d71b, 3364, 1}, {0x1d71c, 6457, 1}, {0x1d71d, 6458, 1}, {0x1d71e, 3598, 1},
+        {0x1d71f, 6459, 1}, {0x1d720, 6460, 1}, {0x1d721, 6461, 1}, {0x1d722, 6462, 1},
+        {0x1d723, 3368, 1}, {0x1d724, 6463, 1}, {0x1d725, 6464, 1}, {0x1d726, 6465, 1},
+        {0x1d727, 6466, 1}, {0x1d728, 6467, 1}, {0x1d729, 6468, 1}, {0x1d72a, 6469, 1},
+        {0x1d72b, 3599, 1}, {0x1d72c, 6470, 1}, {0x1d72d, 3368, 1}, {0x1d72e, 3370, 1},
+        {0x1d72f, 6471, 1}, {0x1d730, 3362, 1}, {0x1d731, 6472, 1}, {0x1d732, 6473, 1},
+        {0x1d733, 6474, 1}, {0x1d734, 2025, 1}, {0x1d735, 6475, 1}, {0x1d736, 6476, 1},
+        {0x1d737, 3360, 1}, {0x1d738, 3440, 1}, {0x1d739, 3441, 1}, {0x1d73a, 3369, 1},
+        {0x1d73b, 6477, 1}, {0x1d73c, 6478, 1}, {0x1d73d, 3361, 1}, {0x1d73e, 1924, 1},
+        {0x1d73f, 3365, 1}, {0x1d740, 6479, 1}, {0x1d741, 3278, 1}, {0x1d742, 6480, 1},
+        {0x1d743, 6481, 1}, {0x1d744, 6482, 1}, {0x1d745, 3364, 1}, {0x1d746, 3366, 1},
+        {0x1d747, 3367, 1}, {0x1d748, 6483, 1}, {0x1d749, 6484, 1}, {0x1d74a, 6485, 1},
+        {0x1d74b, 3363, 1}, {0x1d74c, 3442, 1}, {0x1d74d, 6486, 1}, {0x1d74e, 6487, 1},
+        {0x1d74f, 6488, 1}, {0x1d750, 3369, 1}, {0x1d751, 3361, 1}, {0x1d752, 3365, 1},
+        {0x1d753, 3363, 1}, {0x1d754, 3366, 1}, {0x1d755, 3364, 1}, {0x1d756, 6457, 1},
+        {0x1d757, 6458, 1}, {0x1d758, 3598, 1}, {0x1d759, 6459, 1}, {0x1d75a, 6460, 1},
+        {0x1d75b, 6461, 1}, {0x1d75c, 6462, 1}, {0x1d75d, 3368, 1}, {0x1d75e, 6463, 1},
+        {0x1d75f, 6464, 1}, {0x1d760, 6465, 1}, {0x1d761, 6466, 1}, {0x1d762, 6467, 1},
+        {0x1d763, 6468, 1}, {0x1d764, 6469, 1}, {0x1d765, 3599, 1}, {0x1d766, 6470, 1},
+        {0x1d767, 3368, 1}, {0x1d768, 3370, 1}, {0x1d769, 6471, 1}, {0x1d76a, 3362, 1},
+        {0x1d76b, 6472, 1}, {0x1d76c, 6473, 1}, {0x1d76d, 6474, 1}, {0x1d76e, 2025, 1},
+        {0x1d76f, 6475, 1}, {0x1d770, 6476, 1}, {0x1d771, 3360, 1}, {0x1d772, 3440, 1},
+        {0x1d773, 3441, 1}, {0x1d774, 3369, 1}, {0x1d775, 6477, 1}, {0x1d776, 6478, 1},
+        {0x1d777, 3361, 1}, {0x1d778, 1924, 1}, {0x1d779, 3365, 1}, {0x1d77a, 6479, 1},
+        {0x1d77b, 3278, 1}, {0x1d77c, 6480, 1}, {0x1d77d, 6481, 1}, {0x1d77e, 6482, 1},
+        {0x1d77f, 3364, 1}, {0x1d780, 3366, 1}, {0x1d781, 3367, 1}, {0x1d782, 6483, 1},
+        {0x1d783, 6484, 1}, {0x1d784, 6485, 1}, {0x1d785, 3363, 1}, {0x1d786, 3442, 1},
+        {0x1d787, 6486, 1}, {0x1d788, 6487, 1}, {0x1d789, 6488, 1}, {0x1d78a, 3369, 1},
+        {0x1d78b, 3361, 1}, {0x1d78c, 3365, 1}, {0x1d78d, 3363, 1}, {0x1d78e, 3366, 1},
+        {0x1d78f, 3364, 1}, {0x1d790, 6457, 1}, {0x1d791, 6458, 1}, {0x1d792, 3598, 1},
+        {0x1d793, 6459, 1}, {0x1d794, 6460, 1}, {0x1d795, 6461, 1}, {0x1d796, 6462, 1},
+        {0x1d797, 3368, 1}, {0x1d798, 6463, 1}, {0x1d799, 6464, 1}, {0x1d79a, 6465, 1},
+        {0x1d79b, 6466, 1}, {0x1d79c, 6467, 1}, {0x1d79d, 6468, 1}, {0x1d79e, 6469, 1},
+        {0x1d79f, 3599, 1}, {0x1d7a0, 6470, 1}, {0x1d7a1, 3368, 1}, {0x1d7a2, 3370, 1},
+        {0x1d7a3, 6471, 1}, {0x1d7a4, 3362, 1}, {0x1d7a5, 6472, 1}, {0x1d7a6, 6473, 1},
+        {0x1d7a7, 6474, 1}, {0x1d7a8, 2025, 1}, {0x1d7a9, 6475, 1}, {0x1d7aa, 6476, 1},
+        {0x1d7ab, 3360, 1}, {0x1d7ac, 3440, 1}, {0x1d7ad, 3441, 1}, {0x1d7ae, 3369, 1},
+        {0x1d7af, 6477, 1}, {0x1d7b0, 6478, 1}, {0x1d7b1, 3361, 1}, {0x1d7b2, 1924, 1},
+        {0x1d7b3, 3365, 1}, {0x1d7b4, 6479, 1}, {0x1d7b5, 3278, 1}, {0x1d7b6, 6480, 1},
+        {0x1d7b7, 6481, 1}, {0x1d7b8, 6482, 1}, {0x1d7b9, 3364, 1}, {0x1d7ba, 3366, 1},
+        {0x1d7bb, 3367, 1}, {0x1d7bc, 6483, 1}, {0x1d7bd, 6484, 1}, {0x1d7be, 6485, 1},
+        {0x1d7bf, 3363, 1}, {0x1d7c0, 3442, 1}, {0x1d7c1, 6486, 1}, {0x1d7c2, 6487, 1},
+        {0x1d7c3, 6488, 1}, {0x1d7c4, 3369, 1}, {0x1d7c5, 3361, 1}, {0x1d7c6, 3365, 1},
+        {0x1d7c7, 3363, 1}, {0x1d7c8, 3366, 1}, {0x1d7c9, 3364, 1}, {0x1d7ca, 6489, 1},
+        {0x1d7cb, 6490, 1}, {0x1d7ce, 3545, 1}, {0x1d7cf, 3281, 1}, {0x1d7d0, 3274, 1},
+        {0x1d7d1, 3275, 1}, {0x1d7d2, 3546, 1}, {0x1d7d3, 3547, 1}, {0x1d7d4, 3548, 1},
+        {0x1d7d5, 3549, 1}, {0x1d7d6, 3550, 1}, {0x1d7d7, 3551, 1}, {0x1d7d8, 3545, 1},
+        {0x1d7d9, 3281, 1}, {0x1d7da, 3274, 1}, {0x1d7db, 3275, 1}, {0x1d7dc, 3546, 1},
+        {0x1d7dd, 3547, 1}, {0x1d7de, 3548, 1}, {0x1d7df, 3549, 1}, {0x1d7e0, 3550, 1},
+        {0x1d7e1, 3551, 1}, {0x1d7e2, 3545, 1}, {0x1d7e3, 3281, 1}, {0x1d7e4, 3274, 1},
+        {0x1d7e5, 3275, 1}, {0x1d7e6, 3546, 1}, {0x1d7e7, 3547, 1}, {0x1d7e8, 3548, 1},
+        {0x1d7e9, 3549, 1}, {0x1d7ea, 3550, 1}, {0x1d7eb, 3551, 1}, {0x1d7ec, 3545, 1},
+        {0x1d7ed, 3281, 1}, {0x1d7ee, 3274, 1}, {0x1d7ef, 3275, 1}, {0x1d7f0, 3546, 1},
+        {0x1d7f1, 3547, 1}, {0x1d7f2, 3548, 1}, {0x1d7f3, 3549, 1}, {0x1d7f4, 3550, 1},
+        {0x1d7f5, 3551, 1}, {0x1d7f6, 3545, 1}, {0x1d7f7, 3281, 1}, {0x1d7f8, 3274, 1},
+        {0x1d7f9, 3275, 1}, {0x1d7fa, 3546, 1}, {0x1d7fb, 3547, 1}, {0x1d7fc, 3548, 1},
+        {0x1d7fd, 3549, 1}, {0x1d7fe, 3550, 1}, {0x1d7ff, 3551, 1}, {0x1e030, 6491, 1},
+        {0x1e031, 6492, 1}, {0x1e032, 6493, 1}, {0x1e033, 6494, 1}, {0x1e034, 6495, 1},
+        {0x1e035, 6496, 1}, {0x1e036, 6497, 1}, {0x1e037, 6498, 1}, {0x1e038, 6499, 1},
+        {0x1e039, 6500, 1}, {0x1e03a, 6501, 1}, {0x1e03b, 6502, 1}, {0x1e03c, 6503, 1},
+        {0x1e03d, 6504, 1}, {0x1e03e, 6505, 1}, {0x1e03f, 6506, 1}, {0x1e040, 6507, 1},
+        {0x1e041, 6508, 1}, {0x1e042, 6509, 1}, {0x1e043, 6510, 1}, {0x1e044, 6511, 1},
+        {0x1e045, 6512, 1}, {0x1e046, 6513, 1}, {0x1e047, 6514, 1}, {0x1e048, 6515, 1},
+        {0x1e049, 6516, 1}, {0x1e04a, 6517, 1}, {0x1e04b, 6518, 1}, {0x1e04c, 6519, 1},
+        {0x1e04d, 6520, 1}, {0x1e04e, 6521, 1}, {0x1e04f, 6522, 1}, {0x1e050, 6523, 1},
+        {0x1e051, 6491, 1}, {0x1e052, 6492, 1}, {0x1e053, 6493, 1}, {0x1e054, 6494, 1},
+        {0x1e055, 6495, 1}, {0x1e056, 6496, 1}, {0x1e057, 6497, 1}, {0x1e058, 6498, 1},
+        {0x1e059, 6499, 1}, {0x1e05a, 6500, 1}, {0x1e05b, 6501, 1}, {0x1e05c, 6503, 1},
+        {0x1e05d, 6504, 1}, {0x1e05e, 6506, 1}, {0x1e05f, 6508, 1}, {0x1e060, 6509, 1},
+        {0x1e061, 6510, 1}, {0x1e062, 6511, 1}, {0x1e063, 6512, 1}, {0x1e064, 6513, 1},
+        {0x1e065, 5466, 1}, {0x1e066, 6514, 1}, {0x1e067, 6524, 1}, {0x1e068, 6519, 1},
+        {0x1e069, 6525, 1}, {0x1e06a, 6526, 1}, {0x1e06b, 6527, 1}, {0x1e06c, 6528, 1},
+        {0x1e06d, 6529, 1}, {0x1ee00, 6326, 1}, {0x1ee01, 6327, 1}, {0x1ee02, 6331, 1},
+        {0x1ee03, 6334, 1}, {0x1ee05, 6353, 1}, {0x1ee06, 6337, 1}, {0x1ee07, 6332, 1},
+        {0x1ee08, 6342, 1}, {0x1ee09, 6354, 1}, {0x1ee0a, 6348, 1}, {0x1ee0b, 6349, 1},
+        {0x1ee0c, 6350, 1}, {0x1ee0d, 6351, 1}, {0x1ee0e, 6338, 1}, {0x1ee0f, 6344, 1},
+        {0x1ee10, 6346, 1}, {0x1ee11, 6340, 1}, {0x1ee12, 6347, 1}, {0x1ee13, 6336, 1},
+        {0x1ee14, 6339, 1}, {0x1ee15, 6329, 1}, {0x1ee16, 6330, 1}, {0x1ee17, 6333, 1},
+        {0x1ee18, 6335, 1}, {0x1ee19, 6341, 1}, {0x1ee1a, 6343, 1}, {0x1ee1b, 6345, 1},
+        {0x1ee1c, 6530, 1}, {0x1ee1d, 5532, 1}, {0x1ee1e, 6531, 1}, {0x1ee1f, 6532, 1},
+        {0x1ee21, 6327, 1}, {0x1ee22, 6331, 1}, {0x1ee24, 6352, 1}, {0x1ee27, 6332, 1},
+        {0x1ee29, 6354, 1}, {0x1ee2a, 6348, 1}, {0x1ee2b, 6349, 1}, {0x1ee2c, 6350, 1},
+        {0x1ee2d, 6351, 1}, {0x1ee2e, 6338, 1}, {0x1ee2f, 6344, 1}, {0x1ee30, 6346, 1},
+        {0x1ee31, 6340, 1}, {0x1ee32, 6347, 1}, {0x1ee34, 6339, 1}, {0x1ee35, 6329, 1},
+        {0x1ee36, 6330, 1}, {0x1ee37, 6333, 1}, {0x1ee39, 6341, 1}, {0x1ee3b, 6345, 1},
+        {0x1ee42, 6331, 1}, {0x1ee47, 6332, 1}, {0x1ee49, 6354, 1}, {0x1ee4b, 6349, 1},
+        {0x1ee4d, 6351, 1}, {0x1ee4e, 6338, 1}, {0x1ee4f, 6344, 1}, {0x1ee51, 6340, 1},
+        {0x1ee52, 6347, 1}, {0x1ee54, 6339, 1}, {0x1ee57, 6333, 1}, {0x1ee59, 6341, 1},
+        {0x1ee5b, 6345, 1}, {0x1ee5d, 5532, 1}, {0x1ee5f, 6532, 1}, {0x1ee61, 6327, 1},
+        {0x1ee62, 6331, 1}, {0x1ee64, 6352, 1}, {0x1ee67, 6332, 1}, {0x1ee68, 6342, 1},
+        {0x1ee69, 6354, 1}, {0x1ee6a, 6348, 1}, {0x1ee6c, 6350, 1}, {0x1ee6d, 6351, 1},
+        {0x1ee6e, 6338, 1}, {0x1ee6f, 6344, 1}, {0x1ee70, 6346, 1}, {0x1ee71, 6340, 1},
+        {0x1ee72, 6347, 1}, {0x1ee74, 6339, 1}, {0x1ee75, 6329, 1}, {0x1ee76, 6330, 1},
+        {0x1ee77, 6333, 1}, {0x1ee79, 6341, 1}, {0x1ee7a, 6343, 1}, {0x1ee7b, 6345, 1},
+        {0x1ee7c, 6530, 1}, {0x1ee7e, 6531, 1}, {0x1ee80, 6326, 1}, {0x1ee81, 6327, 1},
+        {0x1ee82, 6331, 1}, {0x1ee83, 6334, 1}, {0x1ee84, 6352, 1}, {0x1ee85, 6353, 1},
+        {0x1ee86, 6337, 1}, {0x1ee87, 6332, 1}, {0x1ee88, 6342, 1}, {0x1ee89, 6354, 1},
+        {0x1ee8b, 6349, 1}, {0x1ee8c, 6350, 1}, {0x1ee8d, 6351, 1}, {0x1ee8e, 6338, 1},
+        {0x1ee8f, 6344, 1}, {0x1ee90, 6346, 1}, {0x1ee91, 6340, 1}, {0x1ee92, 6347, 1},
+        {0x1ee93, 6336, 1}, {0x1ee94, 6339, 1}, {0x1ee95, 6329, 1}, {0x1ee96, 6330, 1},
+        {0x1ee97, 6333, 1}, {0x1ee98, 6335, 1}, {0x1ee99, 6341, 1}, {0x1ee9a, 6343, 1},
+        {0x1ee9b, 6345, 1}, {0x1eea1, 6327, 1}, {0x1eea2, 6331, 1}, {0x1eea3, 6334, 1},
+        {0x1eea5, 6353, 1}, {0x1eea6, 6337, 1}, {0x1eea7, 6332, 1}, {0x1eea8, 6342, 1},
+        {0x1eea9, 6354, 1}, {0x1eeab, 6349, 1}, {0x1eeac, 6350, 1}, {0x1eead, 6351, 1},
+        {0x1eeae, 6338, 1}, {0x1eeaf, 6344, 1}, {0x1eeb0, 6346, 1}, {0x1eeb1, 6340, 1},
+        {0x1eeb2, 6347, 1}, {0x1eeb3, 6336, 1}, {0x1eeb4, 6339, 1}, {0x1eeb5, 6329, 1},
+        {0x1eeb6, 6330, 1}, {0x1eeb7, 6333, 1}, {0x1eeb8, 6335, 1}, {0x1eeb9, 6341, 1},
+        {0x1eeba, 6343, 1}, {0x1eebb, 6345, 1}, {0x1f100, 6533, 2}, {0x1f101, 6535, 2},
+        {0x1f102, 6537, 2}, {0x1f103, 6539, 2}, {0x1f104, 6541, 2}, {0x1f105, 6543, 2},
+        {0x1f106, 6545, 2}, {0x1f107, 6547, 2}, {0x1f108, 6549, 2}, {0x1f109, 6551, 2},
+        {0x1f10a, 6553, 2}, {0x1f110, 6555, 3}, {0x1f111, 6558, 3}, {0x1f112, 6561, 3},
+        {0x1f113, 6564, 3}, {0x1f114, 6567, 3}, {0x1f115, 6570, 3}, {0x1f116, 6573, 3},
+        {0x1f117, 6576, 3}, {0x1f118, 6579, 3}, {0x1f119, 6582, 3}, {0x1f11a, 6585, 3},
+        {0x1f11b, 6588, 3}, {0x1f11c, 6591, 3}, {0x1f11d, 6594, 3}, {0x1f11e, 6597, 3},
+        {0x1f11f, 6600, 3}, {0x1f120, 6603, 3}, {0x1f121, 6606, 3}, {0x1f122, 6609, 3},
+        {0x1f123, 6612, 3}, {0x1f124, 6615, 3}, {0x1f125, 6618, 3}, {0x1f126, 6621, 3},
+        {0x1f127, 6624, 3}, {0x1f128, 6627, 3}, {0x1f129, 6630, 3}, {0x1f12a, 6633, 3},
+        {0x1f12b, 3566, 1}, {0x1f12c, 3413, 1}, {0x1f12d, 6636, 2}, {0x1f12e, 6638, 2},
+        {0x1f130, 3397, 1}, {0x1f131, 3399, 1}, {0x1f132, 3566, 1}, {0x1f133, 3400, 1},
+        {0x1f134, 3401, 1}, {0x1f135, 3590, 1}, {0x1f136, 3403, 1}, {0x1f137, 3404, 1},
+        {0x1f138, 3405, 1}, {0x1f139, 3406, 1}, {0x1f13a, 2026, 1}, {0x1f13b, 3407, 1},
+        {0x1f13c, 3408, 1}, {0x1f13d, 3409, 1}, {0x1f13e, 3410, 1}, {0x1f13f, 3412, 1},
+        {0x1f140, 3581, 1}, {0x1f141, 3413, 1}, {0x1f142, 3932, 1}, {0x1f143, 3414, 1},
+        {0x1f144, 3415, 1}, {0x1f145, 3656, 1}, {0x1f146, 3416, 1}, {0x1f147, 3668, 1},
+        {0x1f148, 3933, 1}, {0x1f149, 3589, 1}, {0x1f14a, 6640, 2}, {0x1f14b, 5288, 2},
+        {0x1f14c, 6642, 2}, {0x1f14d, 6644, 2}, {0x1f14e, 6646, 3}, {0x1f14f, 6649, 2},
+        {0x1f16a, 6651, 2}, {0x1f16b, 6653, 2}, {0x1f16c, 6655, 2}, {0x1f190, 6657, 2},
+        {0x1f200, 6659, 2}, {0x1f201, 6661, 2}, {0x1f202, 4659, 1}, {0x1f210, 4007, 1},
+        {0x1f211, 6663, 1}, {0x1f212, 6664, 1}, {0x1f213, 2199, 2}, {0x1f214, 3956, 1},
+        {0x1f215, 2868, 1}, {0x1f216, 6665, 1}, {0x1f217, 4253, 1}, {0x1f218, 6666, 1},
+        {0x1f219, 6667, 1}, {0x1f21a, 6668, 1}, {0x1f21b, 2421, 1}, {0x1f21c, 6669, 1},
+        {0x1f21d, 6670, 1}, {0x1f21e, 2809, 1}, {0x1f21f, 6671, 1}, {0x1f220, 6672, 1},
+        {0x1f221, 6673, 1}, {0x1f222, 4042, 1}, {0x1f223, 6674, 1}, {0x1f224, 6675, 1},
+        {0x1f225, 6676, 1}, {0x1f226, 6677, 1}, {0x1f227, 6678, 1}, {0x1f228, 6679, 1},
+        {0x1f229, 3950, 1}, {0x1f22a, 4245, 1}, {0x1f22b, 6680, 1}, {0x1f22c, 4572, 1},
+        {0x1f22d, 4248, 1}, {0x1f22e, 4573, 1}, {0x1f22f, 6681, 1}, {0x1f230, 4091, 1},
+        {0x1f231, 6682, 1}, {0x1f232, 6683, 1}, {0x1f233, 6684, 1}, {0x1f234, 6685, 1},
+        {0x1f235, 6686, 1}, {0x1f236, 4557, 1}, {0x1f237, 4017, 1}, {0x1f238, 6687, 1},
+        {0x1f239, 2821, 1}, {0x1f23a, 6688, 1}, {0x1f23b, 6689, 1}, {0x1f240, 6690, 3},
+        {0x1f241, 6693, 3}, {0x1f242, 6696, 3}, {0x1f243, 6699, 3}, {0x1f244, 6702, 3},
+        {0x1f245, 6705, 3}, {0x1f246, 6708, 3}, {0x1f247, 6711, 3}, {0x1f248, 6714, 3},
+        {0x1f250, 6717, 1}, {0x1f251, 6718, 1}, {0x1fbf0, 3545, 1}, {0x1fbf1, 3281, 1},
+        {0x1fbf2, 3274, 1}, {0x1fbf3, 3275, 1}, {0x1fbf4, 3546, 1}, {0x1fbf5, 3547, 1},
+        {0x1fbf6, 3548, 1}, {0x1fbf7, 3549, 1}, {0x1fbf8, 3550, 1}, {0x1fbf9, 3551, 1},
+    };
+
+    inline constexpr uint32_t DECOMPOSITION_POOL[6719] = {
+        0x00041, 0x00300, 0x00041, 0x00301, 0x00041, 0x00302, 0x00041, 0x00303,
+        0x00041, 0x00308, 0x00041, 0x0030a, 0x00043, 0x00327, 0x00045, 0x00300,
+        0x00045, 0x00301, 0x00045, 0x00302, 0x00045, 0x00308, 0x00049, 0x00300,
+        0x00049, 0x00301, 0x00049, 0x00302, 0x00049, 0x00308, 0x0004e, 0x00303,
+        0x0004f, 0x00300, 0x0004f, 0x00301, 0x0004f, 0x00302, 0x0004f, 0x00303,
+        0x0004f, 0x00308, 0x00055, 0x00300, 0x00055, 0x00301, 0x00055, 0x00302,
+        0x00055, 0x00308, 0x00059, 0x00301, 0x00061, 0x00300, 0x00061, 0x00301,
+        0x00061, 0x00302, 0x00061, 0x00303, 0x00061, 0x00308, 0x00061, 0x0030a,
+        0x00063, 0x00327, 0x00065, 0x00300, 0x00065, 0x00301, 0x00065, 0x00302,
+        0x00065, 0x00308, 0x00069, 0x00300, 0x00069, 0x00301, 0x00069, 0x00302,
+        0x00069, 0x00308, 0x0006e, 0x00303, 0x0006f, 0x00300, 0x0006f, 0x00301,
+        0x0006f, 0x00302, 0x0006f, 0x00303, 0x0006f, 0x00308, 0x00075, 0x00300,
+        0x00075, 0x00301, 0x00075, 0x00302, 0x00075, 0x00308, 0x00079, 0x00301,
+        0x00079, 0x00308, 0x00041, 0x00304, 0x00061, 0x00304, 0x00041, 0x00306,
+        0x00061, 0x00306, 0x00041, 0x00328, 0x00061, 0x00328, 0x00043, 0x00301,
+        0x00063, 0x00301, 0x00043, 0x00302, 0x00063, 0x00302, 0x00043, 0x00307,
+        0x00063, 0x00307, 0x00043, 0x0030c, 0x00063, 0x0030c, 0x00044, 0x0030c,
+        0x00064, 0x0030c, 0x00045, 0x00304, 0x00065, 0x00304, 0x00045, 0x00306,
+        0x00065, 0x00306, 0x00045, 0x00307, 0x00065, 0x00307, 0x00045, 0x00328,
+        0x00065, 0x00328, 0x00045, 0x0030c, 0x00065, 0x0030c, 0x00047, 0x00302,
+        0x00067, 0x00302, 0x00047, 0x00306, 0x00067, 0x00306, 0x00047, 0x00307,
+        0x00067, 0x00307, 0x00047, 0x00327, 0x00067, 0x00327, 0x00048, 0x00302,
+        0x00068, 0x00302, 0x00049, 0x00303, 0x00069, 0x00303, 0x00049, 0x00304,
+        0x00069, 0x00304, 0x00049, 0x00306, 0x00069, 0x00306, 0x00049, 0x00328,
+        0x00069, 0x00328, 0x00049, 0x00307, 0x0004a, 0x00302, 0x0006a, 0x00302,
+        0x0004b, 0x00327, 0x0006b, 0x00327, 0x0004c, 0x00301, 0x0006c, 0x00301,
+        0x0004c, 0x00327, 0x0006c, 0x00327, 0x0004c, 0x0030c, 0x0006c, 0x0030c,
+        0x0004e, 0x00301, 0x0006e, 0x00301, 0x0004e, 0x00327, 0x0006e, 0x00327,
+        0x0004e, 0x0030c, 0x0006e, 0x0030c, 0x0004f, 0x00304, 0x0006f, 0x00304,
+        0x0004f, 0x00306, 0x0006f, 0x00306, 0x0004f, 0x0030b, 0x0006f, 0x0030b,
+        0x00052, 0x00301, 0x00072, 0x00301, 0x00052, 0x00327, 0x00072, 0x00327,
+        0x00052, 0x0030c, 0x00072, 0x0030c, 0x00053, 0x00301, 0x00073, 0x00301,
+        0x00053, 0x00302, 0x00073, 0x00302, 0x00053, 0x00327, 0x00073, 0x00327,
+        0x00053, 0x0030c, 0x00073, 0x0030c, 0x00054, 0x00327, 0x00074, 0x00327,
+        0x00054, 0x0030c, 0x00074, 0x0030c, 0x00055, 0x00303, 0x00075, 0x00303,
+        0x00055, 0x00304, 0x00075, 0x00304, 0x00055, 0x00306, 0x00075, 0x00306,
+        0x00055, 0x0030a, 0x00075, 0x0030a, 0x00055, 0x0030b, 0x00075, 0x0030b,
+        0x00055, 0x00328, 0x00075, 0x00328, 0x00057, 0x00302, 0x00077, 0x00302,
+        0x00059, 0x00302, 0x00079, 0x00302, 0x00059, 0x00308, 0x0005a, 0x00301,
+        0x0007a, 0x00301, 0x0005a, 0x00307, 0x0007a, 0x00307, 0x0005a, 0x0030c,
+        0x0007a, 0x0030c, 0x0004f, 0x0031b, 0x0006f, 0x0031b, 0x00055, 0x0031b,
+        0x00075, 0x0031b, 0x00041, 0x0030c, 0x00061, 0x0030c, 0x00049, 0x0030c,
+        0x00069, 0x0030c, 0x0004f, 0x0030c, 0x0006f, 0x0030c, 0x00055, 0x0030c,
+        0x00075, 0x0030c, 0x00055, 0x00308, 0x00304, 0x00075, 0x00308, 0x00304,
+        0x00055, 0x00308, 0x00301, 0x00075, 0x00308, 0x00301, 0x00055, 0x00308,
+        0x0030c, 0x00075, 0x00308, 0x0030c, 0x00055, 0x00308, 0x00300, 0x00075,
+        0x00308, 0x00300, 0x00041, 0x00308, 0x00304, 0x00061, 0x00308, 0x00304,
+        0x00041, 0x00307, 0x00304, 0x00061, 0x00307, 0x00304, 0x000c6, 0x00304,
+        0x000e6, 0x00304, 0x00047, 0x0030c, 0x00067, 0x0030c, 0x0004b, 0x0030c,
+        0x0006b, 0x0030c, 0x0004f, 0x00328, 0x0006f, 0x00328, 0x0004f, 0x00328,
+        0x00304, 0x0006f, 0x00328, 0x00304, 0x001b7, 0x0030c, 0x00292, 0x0030c,
+        0x0006a, 0x0030c, 0x00047, 0x00301, 0x00067, 0x00301, 0x0004e, 0x00300,
+        0x0006e, 0x00300, 0x00041, 0x0030a, 0x00301, 0x00061, 0x0030a, 0x00301,
+        0x000c6, 0x00301, 0x000e6, 0x00301, 0x000d8, 0x00301, 0x000f8, 0x00301,
+        0x00041, 0x0030f, 0x00061, 0x0030f, 0x00041, 0x00311, 0x00061, 0x00311,
+        0x00045, 0x0030f, 0x00065, 0x0030f, 0x00045, 0x00311, 0x00065, 0x00311,
+        0x00049, 0x0030f, 0x00069, 0x0030f, 0x00049, 0x00311, 0x00069, 0x00311,
+        0x0004f, 0x0030f, 0x0006f, 0x0030f, 0x0004f, 0x00311, 0x0006f, 0x00311,
+        0x00052, 0x0030f, 0x00072, 0x0030f, 0x00052, 0x00311, 0x00072, 0x00311,
+        0x00055, 0x0030f, 0x00075, 0x0030f, 0x00055, 0x00311, 0x00075, 0x00311,
+        0x00053, 0x00326, 0x00073, 0x00326, 0x00054, 0x00326, 0x00074, 0x00326,
+        0x00048, 0x0030c, 0x00068, 0x0030c, 0x00041, 0x00307, 0x00061, 0x00307,
+        0x00045, 0x00327, 0x00065, 0x00327, 0x0004f, 0x00308, 0x00304, 0x0006f,
+        0x00308, 0x00304, 0x0004f, 0x00303, 0x00304, 0x0006f, 0x00303, 0x00304,
+        0x0004f, 0x00307, 0x0006f, 0x00307, 0x0004f, 0x00307, 0x00304, 0x0006f,
+        0x00307, 0x00304, 0x00059, 0x00304, 0x00079, 0x00304, 0x00300, 0x00301,
+        0x00313, 0x00308, 0x00301, 0x002b9, 0x0003b, 0x000a8, 0x00301, 0x00391,
+        0x00301, 0x000b7, 0x00395, 0x00301, 0x00397, 0x00301, 0x00399, 0x00301,
+        0x0039f, 0x00301, 0x003a5, 0x00301, 0x003a9, 0x00301, 0x003b9, 0x00308,
+        0x00301, 0x00399, 0x00308, 0x003a5, 0x00308, 0x003b1, 0x00301, 0x003b5,
+        0x00301, 0x003b7, 0x00301, 0x003b9, 0x00301, 0x003c5, 0x00308, 0x00301,
+        0x003b9, 0x00308, 0x003c5, 0x00308, 0x003bf, 0x00301, 0x003c5, 0x00301,
+        0x003c9, 0x00301, 0x003d2, 0x00301, 0x003d2, 0x00308, 0x00415, 0x00300,
+        0x00415, 0x00308, 0x00413, 0x00301, 0x00406, 0x00308, 0x0041a, 0x00301,
+        0x00418, 0x00300, 0x00423, 0x00306, 0x00418, 0x00306, 0x00438, 0x00306,
+        0x00435, 0x00300, 0x00435, 0x00308, 0x00433, 0x00301, 0x00456, 0x00308,
+        0x0043a, 0x00301, 0x00438, 0x00300, 0x00443, 0x00306, 0x00474, 0x0030f,
+        0x00475, 0x0030f, 0x00416, 0x00306, 0x00436, 0x00306, 0x00410, 0x00306,
+        0x00430, 0x00306, 0x00410, 0x00308, 0x00430, 0x00308, 0x00415, 0x00306,
+        0x00435, 0x00306, 0x004d8, 0x00308, 0x004d9, 0x00308, 0x00416, 0x00308,
+        0x00436, 0x00308, 0x00417, 0x00308, 0x00437, 0x00308, 0x00418, 0x00304,
+        0x00438, 0x00304, 0x00418, 0x00308, 0x00438, 0x00308, 0x0041e, 0x00308,
+        0x0043e, 0x00308, 0x004e8, 0x00308, 0x004e9, 0x00308, 0x0042d, 0x00308,
+        0x0044d, 0x00308, 0x00423, 0x00304, 0x00443, 0x00304, 0x00423, 0x00308,
+        0x00443, 0x00308, 0x00423, 0x0030b, 0x00443, 0x0030b, 0x00427, 0x00308,
+        0x00447, 0x00308, 0x0042b, 0x00308, 0x0044b, 0x00308, 0x00627, 0x00653,
+        0x00627, 0x00654, 0x00648, 0x00654, 0x00627, 0x00655, 0x0064a, 0x00654,
+        0x006d5, 0x00654, 0x006c1, 0x00654, 0x006d2, 0x00654, 0x00928, 0x0093c,
+        0x00930, 0x0093c, 0x00933, 0x0093c, 0x00915, 0x0093c, 0x00916, 0x0093c,
+        0x00917, 0x0093c, 0x0091c, 0x0093c, 0x00921, 0x0093c, 0x00922, 0x0093c,
+        0x0092b, 0x0093c, 0x0092f, 0x0093c, 0x009c7, 0x009be, 0x009c7, 0x009d7,
+        0x009a1, 0x009bc, 0x009a2, 0x009bc, 0x009af, 0x009bc, 0x00a32, 0x00a3c,
+        0x00a38, 0x00a3c, 0x00a16, 0x00a3c, 0x00a17, 0x00a3c, 0x00a1c, 0x00a3c,
+        0x00a2b, 0x00a3c, 0x00b47, 0x00b56, 0x00b47, 0x00b3e, 0x00b47, 0x00b57,
+        0x00b21, 0x00b3c, 0x00b22, 0x00b3c, 0x00b92, 0x00bd7, 0x00bc6, 0x00bbe,
+        0x00bc7, 0x00bbe, 0x00bc6, 0x00bd7, 0x00c46, 0x00c56, 0x00cbf, 0x00cd5,
+        0x00cc6, 0x00cd5, 0x00cc6, 0x00cd6, 0x00cc6, 0x00cc2, 0x00cc6, 0x00cc2,
+        0x00cd5, 0x00d46, 0x00d3e, 0x00d47, 0x00d3e, 0x00d46, 0x00d57, 0x00dd9,
+        0x00dca, 0x00dd9, 0x00dcf, 0x00dd9, 0x00dcf, 0x00dca, 0x00dd9, 0x00ddf,
+        0x00f42, 0x00fb7, 0x00f4c, 0x00fb7, 0x00f51, 0x00fb7, 0x00f56, 0x00fb7,
+        0x00f5b, 0x00fb7, 0x00f40, 0x00fb5, 0x00f71, 0x00f72, 0x00f71, 0x00f74,
+        0x00fb2, 0x00f80, 0x00fb3, 0x00f80, 0x00f71, 0x00f80, 0x00f92, 0x00fb7,
+        0x00f9c, 0x00fb7, 0x00fa1, 0x00fb7, 0x00fa6, 0x00fb7, 0x00fab, 0x00fb7,
+        0x00f90, 0x00fb5, 0x01025, 0x0102e, 0x01b05, 0x01b35, 0x01b07, 0x01b35,
+        0x01b09, 0x01b35, 0x01b0b, 0x01b35, 0x01b0d, 0x01b35, 0x01b11, 0x01b35,
+        0x01b3a, 0x01b35, 0x01b3c, 0x01b35, 0x01b3e, 0x01b35, 0x01b3f, 0x01b35,
+        0x01b42, 0x01b35, 0x00041, 0x00325, 0x00061, 0x00325, 0x00042, 0x00307,
+        0x00062, 0x00307, 0x00042, 0x00323, 0x00062, 0x00323, 0x00042, 0x00331,
+        0x00062, 0x00331, 0x00043, 0x00327, 0x00301, 0x00063, 0x00327, 0x00301,
+        0x00044, 0x00307, 0x00064, 0x00307, 0x00044, 0x00323, 0x00064, 0x00323,
+        0x00044, 0x00331, 0x00064, 0x00331, 0x00044, 0x00327, 0x00064, 0x00327,
+        0x00044, 0x0032d, 0x00064, 0x0032d, 0x00045, 0x00304, 0x00300, 0x00065,
+        0x00304, 0x00300, 0x00045, 0x00304, 0x00301, 0x00065, 0x00304, 0x00301,
+        0x00045, 0x0032d, 0x00065, 0x0032d, 0x00045, 0x00330, 0x00065, 0x00330,
+        0x00045, 0x00327, 0x00306, 0x00065, 0x00327, 0x00306, 0x00046, 0x00307,
+        0x00066, 0x00307, 0x00047, 0x00304, 0x00067, 0x00304, 0x00048, 0x00307,
+        0x00068, 0x00307, 0x00048, 0x00323, 0x00068, 0x00323, 0x00048, 0x00308,
+        0x00068, 0x00308, 0x00048, 0x00327, 0x00068, 0x00327, 0x00048, 0x0032e,
+        0x00068, 0x0032e, 0x00049, 0x00330, 0x00069, 0x00330, 0x00049, 0x00308,
+        0x00301, 0x00069, 0x00308, 0x00301, 0x0004b, 0x00301, 0x0006b, 0x00301,
+        0x0004b, 0x00323, 0x0006b, 0x00323, 0x0004b, 0x00331, 0x0006b, 0x00331,
+        0x0004c, 0x00323, 0x0006c, 0x00323, 0x0004c, 0x00323, 0x00304, 0x0006c,
+        0x00323, 0x00304, 0x0004c, 0x00331, 0x0006c, 0x00331, 0x0004c, 0x0032d,
+        0x0006c, 0x0032d, 0x0004d, 0x00301, 0x0006d, 0x00301, 0x0004d, 0x00307,
+        0x0006d, 0x00307, 0x0004d, 0x00323, 0x0006d, 0x00323, 0x0004e, 0x00307,
+        0x0006e, 0x00307, 0x0004e, 0x00323, 0x0006e, 0x00323, 0x0004e, 0x00331,
+        0x0006e, 0x00331, 0x0004e, 0x0032d, 0x0006e, 0x0032d, 0x0004f, 0x00303,
+        0x00301, 0x0006f, 0x00303, 0x00301, 0x0004f, 0x00303, 0x00308, 0x0006f,
+        0x00303, 0x00308, 0x0004f, 0x00304, 0x00300, 0x0006f, 0x00304, 0x00300,
+        0x0004f, 0x00304, 0x00301, 0x0006f, 0x00304, 0x00301, 0x00050, 0x00301,
+        0x00070, 0x00301, 0x00050, 0x00307, 0x00070, 0x00307, 0x00052, 0x00307,
+        0x00072, 0x00307, 0x00052, 0x00323, 0x00072, 0x00323, 0x00052, 0x00323,
+        0x00304, 0x00072, 0x00323, 0x00304, 0x00052, 0x00331, 0x00072, 0x00331,
+        0x00053, 0x00307, 0x00073, 0x00307, 0x00053, 0x00323, 0x00073, 0x00323,
+        0x00053, 0x00301, 0x00307, 0x00073, 0x00301, 0x00307, 0x00053, 0x0030c,
+        0x00307, 0x00073, 0x0030c, 0x00307, 0x00053, 0x00323, 0x00307, 0x00073,
+        0x00323, 0x00307, 0x00054, 0x00307, 0x00074, 0x00307, 0x00054, 0x00323,
+        0x00074, 0x00323, 0x00054, 0x00331, 0x00074, 0x00331, 0x00054, 0x0032d,
+        0x00074, 0x0032d, 0x00055, 0x00324, 0x00075, 0x00324, 0x00055, 0x00330,
+        0x00075, 0x00330, 0x00055, 0x0032d, 0x00075, 0x0032d, 0x00055, 0x00303,
+        0x00301, 0x00075, 0x00303, 0x00301, 0x00055, 0x00304, 0x00308, 0x00075,
+        0x00304, 0x00308, 0x00056, 0x00303, 0x00076, 0x00303, 0x00056, 0x00323,
+        0x00076, 0x00323, 0x00057, 0x00300, 0x00077, 0x00300, 0x00057, 0x00301,
+        0x00077, 0x00301, 0x00057, 0x00308, 0x00077, 0x00308, 0x00057, 0x00307,
+        0x00077, 0x00307, 0x00057, 0x00323, 0x00077, 0x00323, 0x00058, 0x00307,
+        0x00078, 0x00307, 0x00058, 0x00308, 0x00078, 0x00308, 0x00059, 0x00307,
+        0x00079, 0x00307, 0x0005a, 0x00302, 0x0007a, 0x00302, 0x0005a, 0x00323,
+        0x0007a, 0x00323, 0x0005a, 0x00331, 0x0007a, 0x00331, 0x00068, 0x00331,
+        0x00074, 0x00308, 0x00077, 0x0030a, 0x00079, 0x0030a, 0x0017f, 0x00307,
+        0x00041, 0x00323, 0x00061, 0x00323, 0x00041, 0x00309, 0x00061, 0x00309,
+        0x00041, 0x00302, 0x00301, 0x00061, 0x00302, 0x00301, 0x00041, 0x00302,
+        0x00300, 0x00061, 0x00302, 0x00300, 0x00041, 0x00302, 0x00309, 0x00061,
+        0x00302, 0x00309, 0x00041, 0x00302, 0x00303, 0x00061, 0x00302, 0x00303,
+        0x00041, 0x00323, 0x00302, 0x00061, 0x00323, 0x00302, 0x00041, 0x00306,
+        0x00301, 0x00061, 0x00306, 0x00301, 0x00041, 0x00306, 0x00300, 0x00061,
+        0x00306, 0x00300, 0x00041, 0x00306, 0x00309, 0x00061, 0x00306, 0x00309,
+        0x00041, 0x00306, 0x00303, 0x00061, 0x00306, 0x00303, 0x00041, 0x00323,
+        0x00306, 0x00061, 0x00323, 0x00306, 0x00045, 0x00323, 0x00065, 0x00323,
+        0x00045, 0x00309, 0x00065, 0x00309, 0x00045, 0x00303, 0x00065, 0x00303,
+        0x00045, 0x00302, 0x00301, 0x00065, 0x00302, 0x00301, 0x00045, 0x00302,
+        0x00300, 0x00065, 0x00302, 0x00300, 0x00045, 0x00302, 0x00309, 0x00065,
+        0x00302, 0x00309, 0x00045, 0x00302, 0x00303, 0x00065, 0x00302, 0x00303,
+        0x00045, 0x00323, 0x00302, 0x00065, 0x00323, 0x00302, 0x00049, 0x00309,
+        0x00069, 0x00309, 0x00049, 0x00323, 0x00069, 0x00323, 0x0004f, 0x00323,
+        0x0006f, 0x00323, 0x0004f, 0x00309, 0x0006f, 0x00309, 0x0004f, 0x00302,
+        0x00301, 0x0006f, 0x00302, 0x00301, 0x0004f, 0x00302, 0x00300, 0x0006f,
+        0x00302, 0x00300, 0x0004f, 0x00302, 0x00309, 0x0006f, 0x00302, 0x00309,
+        0x0004f, 0x00302, 0x00303, 0x0006f, 0x00302, 0x00303, 0x0004f, 0x00323,
+        0x00302, 0x0006f, 0x00323, 0x00302, 0x0004f, 0x0031b, 0x00301, 0x0006f,
+        0x0031b, 0x00301, 0x0004f, 0x0031b, 0x00300, 0x0006f, 0x0031b, 0x00300,
+        0x0004f, 0x0031b, 0x00309, 0x0006f, 0x0031b, 0x00309, 0x0004f, 0x0031b,
+        0x00303, 0x0006f, 0x0031b, 0x00303, 0x0004f, 0x0031b, 0x00323, 0x0006f,
+        0x0031b, 0x00323, 0x00055, 0x00323, 0x00075, 0x00323, 0x00055, 0x00309,
+        0x00075, 0x00309, 0x00055, 0x0031b, 0x00301, 0x00075, 0x0031b, 0x00301,
+        0x00055, 0x0031b, 0x00300, 0x00075, 0x0031b, 0x00300, 0x00055, 0x0031b,
+        0x00309, 0x00075, 0x0031b, 0x00309, 0x00055, 0x0031b, 0x00303, 0x00075,
+        0x0031b, 0x00303, 0x00055, 0x0031b, 0x00323, 0x00075, 0x0031b, 0x00323,
+        0x00059, 0x00300, 0x00079, 0x00300, 0x00059, 0x00323, 0x00079, 0x00323,
+        0x00059, 0x00309, 0x00079, 0x00309, 0x00059, 0x00303, 0x00079, 0x00303,
+        0x003b1, 0x00313, 0x003b1, 0x00314, 0x003b1, 0x00313, 0x00300, 0x003b1,
+        0x00314, 0x00300, 0x003b1, 0x00313, 0x00301, 0x003b1, 0x00314, 0x00301,
+        0x003b1, 0x00313, 0x00342, 0x003b1, 0x00314, 0x00342, 0x00391, 0x00313,
+        0x00391, 0x00314, 0x00391, 0x00313, 0x00300, 0x00391, 0x00314, 0x00300,
+        0x00391, 0x00313, 0x00301, 0x00391, 0x00314, 0x00301, 0x00391, 0x00313,
+        0x00342, 0x00391, 0x00314, 0x00342, 0x003b5, 0x00313, 0x003b5, 0x00314,
+        0x003b5, 0x00313, 0x00300, 0x003b5, 0x00314, 0x00300, 0x003b5, 0x00313,
+        0x00301, 0x003b5, 0x00314, 0x00301, 0x00395, 0x00313, 0x00395, 0x00314,
+        0x00395, 0x00313, 0x00300, 0x00395, 0x00314, 0x00300, 0x00395, 0x00313,
+        0x00301, 0x00395, 0x00314, 0x00301, 0x003b7, 0x00313, 0x003b7, 0x00314,
+        0x003b7, 0x00313, 0x00300, 0x003b7, 0x00314, 0x00300, 0x003b7, 0x00313,
+        0x00301, 0x003b7, 0x00314, 0x00301, 0x003b7, 0x00313, 0x00342, 0x003b7,
+        0x00314, 0x00342, 0x00397, 0x00313, 0x00397, 0x00314, 0x00397, 0x00313,
+        0x00300, 0x00397, 0x00314, 0x00300, 0x00397, 0x00313, 0x00301, 0x00397,
+        0x00314, 0x00301, 0x00397, 0x00313, 0x00342, 0x00397, 0x00314, 0x00342,
+        0x003b9, 0x00313, 0x003b9, 0x00314, 0x003b9, 0x00313, 0x00300, 0x003b9,
+        0x00314, 0x00300, 0x003b9, 0x00313, 0x00301, 0x003b9, 0x00314, 0x00301,
+        0x003b9, 0x00313, 0x00342, 0x003b9, 0x00314, 0x00342, 0x00399, 0x00313,
+        0x00399, 0x00314, 0x00399, 0x00313, 0x00300, 0x00399, 0x00314, 0x00300,
+        0x00399, 0x00313, 0x00301, 0x00399, 0x00314, 0x00301, 0x00399, 0x00313,
+        0x00342, 0x00399, 0x00314, 0x00342, 0x003bf, 0x00313, 0x003bf, 0x00314,
+        0x003bf, 0x00313, 0x00300, 0x003bf, 0x00314, 0x00300, 0x003bf, 0x00313,
+        0x00301, 0x003bf, 0x00314, 0x00301, 0x0039f, 0x00313, 0x0039f, 0x00314,
+        0x0039f, 0x00313, 0x00300, 0x0039f, 0x00314, 0x00300, 0x0039f, 0x00313,
+        0x00301, 0x0039f, 0x00314, 0x00301, 0x003c5, 0x00313, 0x003c5, 0x00314,
+        0x003c5, 0x00313, 0x00300, 0x003c5, 0x00314, 0x00300, 0x003c5, 0x00313,
+        0x00301, 0x003c5, 0x00314, 0x00301, 0x003c5, 0x00313, 0x00342, 0x003c5,
+        0x00314, 0x00342, 0x003a5, 0x00314, 0x003a5, 0x00314, 0x00300, 0x003a5,
+        0x00314, 0x00301, 0x003a5, 0x00314, 0x00342, 0x003c9, 0x00313, 0x003c9,
+        0x00314, 0x003c9, 0x00313, 0x00300, 0x003c9, 0x00314, 0x00300, 0x003c9,
+        0x00313, 0x00301, 0x003c9, 0x00314, 0x00301, 0x003c9, 0x00313, 0x00342,
+        0x003c9, 0x00314, 0x00342, 0x003a9, 0x00313, 0x003a9, 0x00314, 0x003a9,
+        0x00313, 0x00300, 0x003a9, 0x00314, 0x00300, 0x003a9, 0x00313, 0x00301,
+        0x003a9, 0x00314, 0x00301, 0x003a9, 0x00313, 0x00342, 0x003a9, 0x00314,
+        0x00342, 0x003b1, 0x00300, 0x003b5, 0x00300, 0x003b7, 0x00300, 0x003b9,
+        0x00300, 0x003bf, 0x00300, 0x003c5, 0x00300, 0x003c9, 0x00300, 0x003b1,
+        0x00313, 0x00345, 0x003b1, 0x00314, 0x00345, 0x003b1, 0x00313, 0x00300,
+        0x00345, 0x003b1, 0x00314, 0x00300, 0x00345, 0x003b1, 0x00313, 0x00301,
+        0x00345, 0x003b1, 0x00314, 0x00301, 0x00345, 0x003b1, 0x00313, 0x00342,
+        0x00345, 0x003b1, 0x00314, 0x00342, 0x00345, 0x00391, 0x00313, 0x00345,
+        0x00391, 0x00314, 0x00345, 0x00391, 0x00313, 0x00300, 0x00345, 0x00391,
+        0x00314, 0x00300, 0x00345, 0x00391, 0x00313, 0x00301, 0x00345, 0x00391,
+        0x00314, 0x00301, 0x00345, 0x00391, 0x00313, 0x00342, 0x00345, 0x00391,
+        0x00314, 0x00342, 0x00345, 0x003b7, 0x00313, 0x00345, 0x003b7, 0x00314,
+        0x00345, 0x003b7, 0x00313, 0x00300, 0x00345, 0x003b7, 0x00314, 0x00300,
+        0x00345, 0x003b7, 0x00313, 0x00301, 0x00345, 0x003b7, 0x00314, 0x00301,
+        0x00345, 0x003b7, 0x00313, 0x00342, 0x00345, 0x003b7, 0x00314, 0x00342,
+        0x00345, 0x00397, 0x00313, 0x00345, 0x00397, 0x00314, 0x00345, 0x00397,
+        0x00313, 0x00300, 0x00345, 0x00397, 0x00314, 0x00300, 0x00345, 0x00397,
+        0x00313, 0x00301, 0x00345, 0x00397, 0x00314, 0x00301, 0x00345, 0x00397,
+        0x00313, 0x00342, 0x00345, 0x00397, 0x00314, 0x00342, 0x00345, 0x003c9,
+        0x00313, 0x00345, 0x003c9, 0x00314, 0x00345, 0x003c9, 0x00313, 0x00300,
+        0x00345, 0x003c9, 0x00314, 0x00300, 0x00345, 0x003c9, 0x00313, 0x00301,
+        0x00345, 0x003c9, 0x00314, 0x00301, 0x00345, 0x003c9, 0x00313, 0x00342,
+        0x00345, 0x003c9, 0x00314, 0x00342, 0x00345, 0x003a9, 0x00313, 0x00345,
+        0x003a9, 0x00314, 0x00345, 0x003a9, 0x00313, 0x00300, 0x00345, 0x003a9,
+        0x00314, 0x00300, 0x00345, 0x003a9, 0x00313, 0x00301, 0x00345, 0x003a9,
+        0x00314, 0x00301, 0x00345, 0x003a9, 0x00313, 0x00342, 0x00345, 0x003a9,
+        0x00314, 0x00342, 0x00345, 0x003b1, 0x00306, 0x003b1, 0x00304, 0x003b1,
+        0x00300, 0x00345, 0x003b1, 0x00345, 0x003b1, 0x00301, 0x00345, 0x003b1,
+        0x00342, 0x003b1, 0x00342, 0x00345, 0x00391, 0x00306, 0x00391, 0x00304,
+        0x00391, 0x00300, 0x00391, 0x00345, 0x003b9, 0x000a8, 0x00342, 0x003b7,
+        0x00300, 0x00345, 0x003b7, 0x00345, 0x003b7, 0x00301, 0x00345, 0x003b7,
+        0x00342, 0x003b7, 0x00342, 0x00345, 0x00395, 0x00300, 0x00397, 0x00300,
+        0x00397, 0x00345, 0x01fbf, 0x00300, 0x01fbf, 0x00301, 0x01fbf, 0x00342,
+        0x003b9, 0x00306, 0x003b9, 0x00304, 0x003b9, 0x00308, 0x00300, 0x003b9,
+        0x00342, 0x003b9, 0x00308, 0x00342, 0x00399, 0x00306, 0x00399, 0x00304,
+        0x00399, 0x00300, 0x01ffe, 0x00300, 0x01ffe, 0x00301, 0x01ffe, 0x00342,
+        0x003c5, 0x00306, 0x003c5, 0x00304, 0x003c5, 0x00308, 0x00300, 0x003c1,
+        0x00313, 0x003c1, 0x00314, 0x003c5, 0x00342, 0x003c5, 0x00308, 0x00342,
+        0x003a5, 0x00306, 0x003a5, 0x00304, 0x003a5, 0x00300, 0x003a1, 0x00314,
+        0x000a8, 0x00300, 0x00060, 0x003c9, 0x00300, 0x00345, 0x003c9, 0x00345,
+        0x003c9, 0x00301, 0x00345, 0x003c9, 0x00342, 0x003c9, 0x00342, 0x00345,
+        0x0039f, 0x00300, 0x003a9, 0x00300, 0x003a9, 0x00345, 0x000b4, 0x02002,
+        0x02003, 0x003a9, 0x0004b, 0x02190, 0x00338, 0x02192, 0x00338, 0x02194,
+        0x00338, 0x021d0, 0x00338, 0x021d4, 0x00338, 0x021d2, 0x00338, 0x02203,
+        0x00338, 0x02208, 0x00338, 0x0220b, 0x00338, 0x02223, 0x00338, 0x02225,
+        0x00338, 0x0223c, 0x00338, 0x02243, 0x00338, 0x02245, 0x00338, 0x02248,
+        0x00338, 0x0003d, 0x00338, 0x02261, 0x00338, 0x0224d, 0x00338, 0x0003c,
+        0x00338, 0x0003e, 0x00338, 0x02264, 0x00338, 0x02265, 0x00338, 0x02272,
+        0x00338, 0x02273, 0x00338, 0x02276, 0x00338, 0x02277, 0x00338, 0x0227a,
+        0x00338, 0x0227b, 0x00338, 0x02282, 0x00338, 0x02283, 0x00338, 0x02286,
+        0x00338, 0x02287, 0x00338, 0x022a2, 0x00338, 0x022a8, 0x00338, 0x022a9,
+        0x00338, 0x022ab, 0x00338, 0x0227c, 0x00338, 0x0227d, 0x00338, 0x02291,
+        0x00338, 0x02292, 0x00338, 0x022b2, 0x00338, 0x022b3, 0x00338, 0x022b4,
+        0x00338, 0x022b5, 0x00338, 0x03008, 0x03009, 0x02add, 0x00338, 0x0304b,
+        0x03099, 0x0304d, 0x03099, 0x0304f, 0x03099, 0x03051, 0x03099, 0x03053,
+        0x03099, 0x03055, 0x03099, 0x03057, 0x03099, 0x03059, 0x03099, 0x0305b,
+        0x03099, 0x0305d, 0x03099, 0x0305f, 0x03099, 0x03061, 0x03099, 0x03064,
+        0x03099, 0x03066, 0x03099, 0x03068, 0x03099, 0x0306f, 0x03099, 0x0306f,
+        0x0309a, 0x03072, 0x03099, 0x03072, 0x0309a, 0x03075, 0x03099, 0x03075,
+        0x0309a, 0x03078, 0x03099, 0x03078, 0x0309a, 0x0307b, 0x03099, 0x0307b,
+        0x0309a, 0x03046, 0x03099, 0x0309d, 0x03099, 0x030ab, 0x03099, 0x030ad,
+        0x03099, 0x030af, 0x03099, 0x030b1, 0x03099, 0x030b3, 0x03099, 0x030b5,
+        0x03099, 0x030b7, 0x03099, 0x030b9, 0x03099, 0x030bb, 0x03099, 0x030bd,
+        0x03099, 0x030bf, 0x03099, 0x030c1, 0x03099, 0x030c4, 0x03099, 0x030c6,
+        0x03099, 0x030c8, 0x03099, 0x030cf, 0x03099, 0x030cf, 0x0309a, 0x030d2,
+        0x03099, 0x030d2, 0x0309a, 0x030d5, 0x03099, 0x030d5, 0x0309a, 0x030d8,
+        0x03099, 0x030d8, 0x0309a, 0x030db, 0x03099, 0x030db, 0x0309a, 0x030a6,
+        0x03099, 0x030ef, 0x03099, 0x030f0, 0x03099, 0x030f1, 0x03099, 0x030f2,
+        0x03099, 0x030fd, 0x03099, 0x08c48, 0x066f4, 0x08eca, 0x08cc8, 0x06ed1,
+        0x04e32, 0x053e5, 0x09f9c, 0x05951, 0x091d1, 0x05587, 0x05948, 0x061f6,
+        0x07669, 0x07f85, 0x0863f, 0x087ba, 0x088f8, 0x0908f, 0x06a02, 0x06d1b,
+        0x070d9, 0x073de, 0x0843d, 0x0916a, 0x099f1, 0x04e82, 0x05375, 0x06b04,
+        0x0721b, 0x0862d, 0x09e1e, 0x05d50, 0x06feb, 0x085cd, 0x08964, 0x062c9,
+        0x081d8, 0x0881f, 0x05eca, 0x06717, 0x06d6a, 0x072fc, 0x090ce, 0x04f86,
+        0x051b7, 0x052de, 0x064c4, 0x06ad3, 0x07210, 0x076e7, 0x08001, 0x08606,
+        0x0865c, 0x08def, 0x09732, 0x09b6f, 0x09dfa, 0x0788c, 0x0797f, 0x07da0,
+        0x083c9, 0x09304, 0x09e7f, 0x08ad6, 0x058df, 0x05f04, 0x07c60, 0x0807e,
+        0x07262, 0x078ca, 0x08cc2, 0x096f7, 0x058d8, 0x05c62, 0x06a13, 0x06dda,
+        0x06f0f, 0x07d2f, 0x07e37, 0x0964b, 0x052d2, 0x0808b, 0x051dc, 0x051cc,
+        0x07a1c, 0x07dbe, 0x083f1, 0x09675, 0x08b80, 0x062cf, 0x08afe, 0x04e39,
+        0x05be7, 0x06012, 0x07387, 0x07570, 0x05317, 0x078fb, 0x04fbf, 0x05fa9,
+        0x04e0d, 0x06ccc, 0x06578, 0x07d22, 0x053c3, 0x0585e, 0x07701, 0x08449,
+        0x08aaa, 0x06bba, 0x08fb0, 0x06c88, 0x062fe, 0x082e5, 0x063a0, 0x07565,
+        0x04eae, 0x05169, 0x051c9, 0x06881, 0x07ce7, 0x0826f, 0x08ad2, 0x091cf,
+        0x052f5, 0x05442, 0x05973, 0x05eec, 0x065c5, 0x06ffe, 0x0792a, 0x095ad,
+        0x09a6a, 0x09e97, 0x09ece, 0x0529b, 0x066c6, 0x06b77, 0x08f62, 0x05e74,
+        0x06190, 0x06200, 0x0649a, 0x06f23, 0x07149, 0x07489, 0x079ca, 0x07df4,
+        0x0806f, 0x08f26, 0x084ee, 0x09023, 0x0934a, 0x05217, 0x052a3, 0x054bd,
+        0x070c8, 0x088c2, 0x05ec9, 0x05ff5, 0x0637b, 0x06bae, 0x07c3e, 0x07375,
+        0x04ee4, 0x056f9, 0x05dba, 0x0601c, 0x073b2, 0x07469, 0x07f9a, 0x08046,
+        0x09234, 0x096f6, 0x09748, 0x09818, 0x04f8b, 0x079ae, 0x091b4, 0x096b8,
+        0x060e1, 0x04e86, 0x050da, 0x05bee, 0x05c3f, 0x06599, 0x071ce, 0x07642,
+        0x084fc, 0x0907c, 0x09f8d, 0x06688, 0x0962e, 0x05289, 0x0677b, 0x067f3,
+        0x06d41, 0x06e9c, 0x07409, 0x07559, 0x0786b, 0x07d10, 0x0985e, 0x0516d,
+        0x0622e, 0x09678, 0x0502b, 0x05d19, 0x06dea, 0x08f2a, 0x05f8b, 0x06144,
+        0x06817, 0x09686, 0x05229, 0x0540f, 0x05c65, 0x06613, 0x0674e, 0x068a8,
+        0x06ce5, 0x07406, 0x075e2, 0x07f79, 0x088cf, 0x088e1, 0x091cc, 0x096e2,
+        0x0533f, 0x06eba, 0x0541d, 0x071d0, 0x07498, 0x085fa, 0x096a3, 0x09c57,
+        0x09e9f, 0x06797, 0x06dcb, 0x081e8, 0x07acb, 0x07b20, 0x07c92, 0x072c0,
+        0x07099, 0x08b58, 0x04ec0, 0x08336, 0x0523a, 0x05207, 0x05ea6, 0x062d3,
+        0x07cd6, 0x05b85, 0x06d1e, 0x066b4, 0x08f3b, 0x0884c, 0x0964d, 0x0898b,
+        0x05ed3, 0x05140, 0x055c0, 0x0585a, 0x06674, 0x051de, 0x0732a, 0x076ca,
+        0x0793c, 0x0795e, 0x07965, 0x0798f, 0x09756, 0x07cbe, 0x07fbd, 0x08612,
+        0x08af8, 0x09038, 0x090fd, 0x098ef, 0x098fc, 0x09928, 0x09db4, 0x090de,
+        0x096b7, 0x04fae, 0x050e7, 0x0514d, 0x052c9, 0x052e4, 0x05351, 0x0559d,
+        0x05606, 0x05668, 0x05840, 0x058a8, 0x05c64, 0x05c6e, 0x06094, 0x06168,
+        0x0618e, 0x061f2, 0x0654f, 0x065e2, 0x06691, 0x06885, 0x06d77, 0x06e1a,
+        0x06f22, 0x0716e, 0x0722b, 0x07422, 0x07891, 0x0793e, 0x07949, 0x07948,
+        0x07950, 0x07956, 0x0795d, 0x0798d, 0x0798e, 0x07a40, 0x07a81, 0x07bc0,
+        0x07e09, 0x07e41, 0x07f72, 0x08005, 0x081ed, 0x08279, 0x08457, 0x08910,
+        0x08996, 0x08b01, 0x08b39, 0x08cd3, 0x08d08, 0x08fb6, 0x096e3, 0x097ff,
+        0x0983b, 0x06075, 0x242ee, 0x08218, 0x04e26, 0x051b5, 0x05168, 0x04f80,
+        0x05145, 0x05180, 0x052c7, 0x052fa, 0x05555, 0x05599, 0x055e2, 0x058b3,
+        0x05944, 0x05954, 0x05a62, 0x05b28, 0x05ed2, 0x05ed9, 0x05f69, 0x05fad,
+        0x060d8, 0x0614e, 0x06108, 0x06160, 0x06234, 0x063c4, 0x0641c, 0x06452,
+        0x06556, 0x0671b, 0x06756, 0x06b79, 0x06edb, 0x06ecb, 0x0701e, 0x077a7,
+        0x07235, 0x072af, 0x07471, 0x07506, 0x0753b, 0x0761d, 0x0761f, 0x076db,
+        0x076f4, 0x0774a, 0x07740, 0x078cc, 0x07ab1, 0x07c7b, 0x07d5b, 0x07f3e,
+        0x08352, 0x083ef, 0x08779, 0x08941, 0x08986, 0x08abf, 0x08acb, 0x08aed,
+        0x08b8a, 0x08f38, 0x09072, 0x09199, 0x09276, 0x0967c, 0x097db, 0x0980b,
+        0x09b12, 0x2284a, 0x22844, 0x233d5, 0x03b9d, 0x04018, 0x04039, 0x25249,
+        0x25cd0, 0x27ed3, 0x09f43, 0x09f8e, 0x005d9, 0x005b4, 0x005f2, 0x005b7,
+        0x005e9, 0x005c1, 0x005e9, 0x005c2, 0x005e9, 0x005bc, 0x005c1, 0x005e9,
+        0x005bc, 0x005c2, 0x005d0, 0x005b7, 0x005d0, 0x005b8, 0x005d0, 0x005bc,
+        0x005d1, 0x005bc, 0x005d2, 0x005bc, 0x005d3, 0x005bc, 0x005d4, 0x005bc,
+        0x005d5, 0x005bc, 0x005d6, 0x005bc, 0x005d8, 0x005bc, 0x005d9, 0x005bc,
+        0x005da, 0x005bc, 0x005db, 0x005bc, 0x005dc, 0x005bc, 0x005de, 0x005bc,
+        0x005e0, 0x005bc, 0x005e1, 0x005bc, 0x005e3, 0x005bc, 0x005e4, 0x005bc,
+        0x005e6, 0x005bc, 0x005e7, 0x005bc, 0x005e8, 0x005bc, 0x005e9, 0x005bc,
+        0x005ea, 0x005bc, 0x005d5, 0x005b9, 0x005d1, 0x005bf, 0x005db, 0x005bf,
+        0x005e4, 0x005bf, 0x11099, 0x110ba, 0x1109b, 0x110ba, 0x110a5, 0x110ba,
+        0x11131, 0x11127, 0x11132, 0x11127, 0x11347, 0x1133e, 0x11347, 0x11357,
+        0x114b9, 0x114ba, 0x114b9, 0x114b0, 0x114b9, 0x114bd, 0x115b8, 0x115af,
+        0x115b9, 0x115af, 0x11935, 0x11930, 0x1d157, 0x1d165, 0x1d158, 0x1d165,
+        0x1d158, 0x1d165, 0x1d16e, 0x1d158, 0x1d165, 0x1d16f, 0x1d158, 0x1d165,
+        0x1d170, 0x1d158, 0x1d165, 0x1d171, 0x1d158, 0x1d165, 0x1d172, 0x1d1b9,
+        0x1d165, 0x1d1ba, 0x1d165, 0x1d1b9, 0x1d165, 0x1d16e, 0x1d1ba, 0x1d165,
+        0x1d16e, 0x1d1b9, 0x1d165, 0x1d16f, 0x1d1ba, 0x1d165, 0x1d16f, 0x04e3d,
+        0x04e38, 0x04e41, 0x20122, 0x04f60, 0x04fbb, 0x05002, 0x0507a, 0x05099,
+        0x050cf, 0x0349e, 0x2063a, 0x05154, 0x05164, 0x05177, 0x2051c, 0x034b9,
+        0x05167, 0x0518d, 0x2054b, 0x05197, 0x051a4, 0x04ecc, 0x051ac, 0x291df,
+        0x051f5, 0x05203, 0x034df, 0x0523b, 0x05246, 0x05272, 0x05277, 0x03515,
+        0x05305, 0x05306, 0x05349, 0x0535a, 0x05373, 0x0537d, 0x0537f, 0x20a2c,
+        0x07070, 0x053ca, 0x053df, 0x20b63, 0x053eb, 0x053f1, 0x05406, 0x0549e,
+        0x05438, 0x05448, 0x05468, 0x054a2, 0x054f6, 0x05510, 0x05553, 0x05563,
+        0x05584, 0x055ab, 0x055b3, 0x055c2, 0x05716, 0x05717, 0x05651, 0x05674,
+        0x058ee, 0x057ce, 0x057f4, 0x0580d, 0x0578b, 0x05832, 0x05831, 0x058ac,
+        0x214e4, 0x058f2, 0x058f7, 0x05906, 0x0591a, 0x05922, 0x05962, 0x216a8,
+        0x216ea, 0x059ec, 0x05a1b, 0x05a27, 0x059d8, 0x05a66, 0x036ee, 0x036fc,
+        0x05b08, 0x05b3e, 0x219c8, 0x05bc3, 0x05bd8, 0x05bf3, 0x21b18, 0x05bff,
+        0x05c06, 0x05f53, 0x05c22, 0x03781, 0x05c60, 0x05cc0, 0x05c8d, 0x21de4,
+        0x05d43, 0x21de6, 0x05d6e, 0x05d6b, 0x05d7c, 0x05de1, 0x05de2, 0x0382f,
+        0x05dfd, 0x05e28, 0x05e3d, 0x05e69, 0x03862, 0x22183, 0x0387c, 0x05eb0,
+        0x05eb3, 0x05eb6, 0x2a392, 0x05efe, 0x22331, 0x08201, 0x05f22, 0x038c7,
+        0x232b8, 0x261da, 0x05f62, 0x05f6b, 0x038e3, 0x05f9a, 0x05fcd, 0x05fd7,
+        0x05ff9, 0x06081, 0x0393a, 0x0391c, 0x226d4, 0x060c7, 0x06148, 0x0614c,
+        0x0617a, 0x061b2, 0x061a4, 0x061af, 0x061de, 0x06210, 0x0621b, 0x0625d,
+        0x062b1, 0x062d4, 0x06350, 0x22b0c, 0x0633d, 0x062fc, 0x06368, 0x06383,
+        0x063e4, 0x22bf1, 0x06422, 0x063c5, 0x063a9, 0x03a2e, 0x06469, 0x0647e,
+        0x0649d, 0x06477, 0x03a6c, 0x0656c, 0x2300a, 0x065e3, 0x066f8, 0x06649,
+        0x03b19, 0x03b08, 0x03ae4, 0x05192, 0x05195, 0x06700, 0x0669c, 0x080ad,
+        0x043d9, 0x06721, 0x0675e, 0x06753, 0x233c3, 0x03b49, 0x067fa, 0x06785,
+        0x06852, 0x2346d, 0x0688e, 0x0681f, 0x06914, 0x06942, 0x069a3, 0x069ea,
+        0x06aa8, 0x236a3, 0x06adb, 0x03c18, 0x06b21, 0x238a7, 0x06b54, 0x03c4e,
+        0x06b72, 0x06b9f, 0x06bbb, 0x23a8d, 0x21d0b, 0x23afa, 0x06c4e, 0x23cbc,
+        0x06cbf, 0x06ccd, 0x06c67, 0x06d16, 0x06d3e, 0x06d69, 0x06d78, 0x06d85,
+        0x23d1e, 0x06d34, 0x06e2f, 0x06e6e, 0x03d33, 0x06ec7, 0x23ed1, 0x06df9,
+        0x06f6e, 0x23f5e, 0x23f8e, 0x06fc6, 0x07039, 0x0701b, 0x03d96, 0x0704a,
+        0x0707d, 0x07077, 0x070ad, 0x20525, 0x07145, 0x24263, 0x0719c, 0x243ab,
+        0x07228, 0x07250, 0x24608, 0x07280, 0x07295, 0x24735, 0x24814, 0x0737a,
+        0x0738b, 0x03eac, 0x073a5, 0x03eb8, 0x07447, 0x0745c, 0x07485, 0x074ca,
+        0x03f1b, 0x07524, 0x24c36, 0x0753e, 0x24c92, 0x2219f, 0x07610, 0x24fa1,
+        0x24fb8, 0x25044, 0x03ffc, 0x04008, 0x250f3, 0x250f2, 0x25119, 0x25133,
+        0x0771e, 0x0771f, 0x0778b, 0x04046, 0x04096, 0x2541d, 0x0784e, 0x040e3,
+        0x25626, 0x2569a, 0x256c5, 0x079eb, 0x0412f, 0x07a4a, 0x07a4f, 0x2597c,
+        0x25aa7, 0x07aee, 0x04202, 0x25bab, 0x07bc6, 0x07bc9, 0x04227, 0x25c80,
+        0x07cd2, 0x042a0, 0x07ce8, 0x07ce3, 0x07d00, 0x25f86, 0x07d63, 0x04301,
+        0x07dc7, 0x07e02, 0x07e45, 0x04334, 0x26228, 0x26247, 0x04359, 0x262d9,
+        0x07f7a, 0x2633e, 0x07f95, 0x07ffa, 0x264da, 0x26523, 0x08060, 0x265a8,
+        0x08070, 0x2335f, 0x043d5, 0x080b2, 0x08103, 0x0440b, 0x0813e, 0x05ab5,
+        0x267a7, 0x267b5, 0x23393, 0x2339c, 0x08204, 0x08f9e, 0x0446b, 0x08291,
+        0x0828b, 0x0829d, 0x052b3, 0x082b1, 0x082b3, 0x082bd, 0x082e6, 0x26b3c,
+        0x0831d, 0x08363, 0x083ad, 0x08323, 0x083bd, 0x083e7, 0x08353, 0x083ca,
+        0x083cc, 0x083dc, 0x26c36, 0x26d6b, 0x26cd5, 0x0452b, 0x084f1, 0x084f3,
+        0x08516, 0x273ca, 0x08564, 0x26f2c, 0x0455d, 0x04561, 0x26fb1, 0x270d2,
+        0x0456b, 0x08650, 0x08667, 0x08669, 0x086a9, 0x08688, 0x0870e, 0x086e2,
+        0x08728, 0x0876b, 0x08786, 0x045d7, 0x087e1, 0x08801, 0x045f9, 0x08860,
+        0x08863, 0x27667, 0x088d7, 0x088de, 0x04635, 0x088fa, 0x034bb, 0x278ae,
+        0x27966, 0x046be, 0x046c7, 0x08aa0, 0x08c55, 0x27ca8, 0x08cab, 0x08cc1,
+        0x08d1b, 0x08d77, 0x27f2f, 0x20804, 0x08dcb, 0x08dbc, 0x08df0, 0x208de,
+        0x08ed4, 0x285d2, 0x285ed, 0x09094, 0x090f1, 0x09111, 0x2872e, 0x0911b,
+        0x09238, 0x092d7, 0x092d8, 0x0927c, 0x093f9, 0x09415, 0x28bfa, 0x0958b,
+        0x04995, 0x095b7, 0x28d77, 0x049e6, 0x096c3, 0x05db2, 0x09723, 0x29145,
+        0x2921a, 0x04a6e, 0x04a76, 0x097e0, 0x2940a, 0x04ab2, 0x29496, 0x09829,
+        0x295b6, 0x098e2, 0x04b33, 0x09929, 0x099a7, 0x099c2, 0x099fe, 0x04bce,
+        0x29b30, 0x09c40, 0x09cfd, 0x04cce, 0x04ced, 0x09d67, 0x2a0ce, 0x04cf8,
+        0x2a105, 0x2a20e, 0x2a291, 0x09ebb, 0x04d56, 0x09ef9, 0x09efe, 0x09f05,
+        0x09f0f, 0x09f16, 0x09f3b, 0x2a600, 0x00020, 0x00020, 0x00308, 0x00061,
+        0x00020, 0x00304, 0x00032, 0x00033, 0x00020, 0x00301, 0x003bc, 0x00020,
+        0x00327, 0x00031, 0x0006f, 0x00031, 0x02044, 0x00034, 0x00031, 0x02044,
+        0x00032, 0x00033, 0x02044, 0x00034, 0x00049, 0x0004a, 0x00069, 0x0006a,
+        0x0004c, 0x000b7, 0x0006c, 0x000b7, 0x002bc, 0x0006e, 0x00073, 0x00044,
+        0x0005a, 0x0030c, 0x00044, 0x0007a, 0x0030c, 0x00064, 0x0007a, 0x0030c,
+        0x0004c, 0x0004a, 0x0004c, 0x0006a, 0x0006c, 0x0006a, 0x0004e, 0x0004a,
+        0x0004e, 0x0006a, 0x0006e, 0x0006a, 0x00044, 0x0005a, 0x00044, 0x0007a,
+        0x00064, 0x0007a, 0x00068, 0x00266, 0x0006a, 0x00072, 0x00279, 0x0027b,
+        0x00281, 0x00077, 0x00079, 0x00020, 0x00306, 0x00020, 0x00307, 0x00020,
+        0x0030a, 0x00020, 0x00328, 0x00020, 0x00303, 0x00020, 0x0030b, 0x00263,
+        0x0006c, 0x00078, 0x00295, 0x00020, 0x00345, 0x00020, 0x00308, 0x00301,
+        0x003b2, 0x003b8, 0x003a5, 0x003c6, 0x003c0, 0x003ba, 0x003c1, 0x003c2,
+        0x00398, 0x003b5, 0x003a3, 0x00565, 0x00582, 0x00627, 0x00674, 0x00648,
+        0x00674, 0x006c7, 0x00674, 0x0064a, 0x00674, 0x00e4d, 0x00e32, 0x00ecd,
+        0x00eb2, 0x00eab, 0x00e99, 0x00eab, 0x00ea1, 0x00f0b, 0x00fb2, 0x00f71,
+        0x00f80, 0x00fb3, 0x00f71, 0x00f80, 0x010dc, 0x00041, 0x000c6, 0x00042,
+        0x00044, 0x00045, 0x0018e, 0x00047, 0x00048, 0x00049, 0x0004a, 0x0004c,
+        0x0004d, 0x0004e, 0x0004f, 0x00222, 0x00050, 0x00052, 0x00054, 0x00055,
+        0x00057, 0x00250, 0x00251, 0x01d02, 0x00062, 0x00064, 0x00065, 0x00259,
+        0x0025b, 0x0025c, 0x00067, 0x0006b, 0x0006d, 0x0014b, 0x00254, 0x01d16,
+        0x01d17, 0x00070, 0x00074, 0x00075, 0x01d1d, 0x0026f, 0x00076, 0x01d25,
+        0x003b3, 0x003b4, 0x003c7, 0x00069, 0x0043d, 0x00252, 0x00063, 0x00255,
+        0x000f0, 0x00066, 0x0025f, 0x00261, 0x00265, 0x00268, 0x00269, 0x0026a,
+        0x01d7b, 0x0029d, 0x0026d, 0x01d85, 0x0029f, 0x00271, 0x00270, 0x00272,
+        0x00273, 0x00274, 0x00275, 0x00278, 0x00282, 0x00283, 0x001ab, 0x00289,
+        0x0028a, 0x01d1c, 0x0028b, 0x0028c, 0x0007a, 0x00290, 0x00291, 0x00292,
+        0x00061, 0x002be, 0x00020, 0x00313, 0x00020, 0x00342, 0x00020, 0x00308,
+        0x00342, 0x00020, 0x00313, 0x00300, 0x00020, 0x00313, 0x00301, 0x00020,
+        0x00313, 0x00342, 0x00020, 0x00314, 0x00300, 0x00020, 0x00314, 0x00301,
+        0x00020, 0x00314, 0x00342, 0x00020, 0x00308, 0x00300, 0x00020, 0x00314,
+        0x02010, 0x00020, 0x00333, 0x0002e, 0x0002e, 0x0002e, 0x0002e, 0x0002e,
+        0x0002e, 0x02032, 0x02032, 0x02032, 0x02032, 0x02032, 0x02035, 0x02035,
+        0x02035, 0x02035, 0x02035, 0x00021, 0x00021, 0x00020, 0x00305, 0x0003f,
+        0x0003f, 0x0003f, 0x00021, 0x00021, 0x0003f, 0x02032, 0x02032, 0x02032,
+        0x02032, 0x00030, 0x00034, 0x00035, 0x00036, 0x00037, 0x00038, 0x00039,
+        0x0002b, 0x02212, 0x0003d, 0x00028, 0x00029, 0x0006e, 0x00052, 0x00073,
+        0x00061, 0x0002f, 0x00063, 0x00061, 0x0002f, 0x00073, 0x00043, 0x000b0,
+        0x00043, 0x00063, 0x0002f, 0x0006f, 0x00063, 0x0002f, 0x00075, 0x00190,
+        0x000b0, 0x00046, 0x00127, 0x0004e, 0x0006f, 0x00051, 0x00053, 0x0004d,
+        0x00054, 0x00045, 0x0004c, 0x00054, 0x0004d, 0x0005a, 0x00046, 0x005d0,
+        0x005d1, 0x005d2, 0x005d3, 0x00046, 0x00041, 0x00058, 0x00393, 0x003a0,
+        0x02211, 0x00031, 0x02044, 0x00037, 0x00031, 0x02044, 0x00039, 0x00031,
+        0x02044, 0x00031, 0x00030, 0x00031, 0x02044, 0x00033, 0x00032, 0x02044,
+        0x00033, 0x00031, 0x02044, 0x00035, 0x00032, 0x02044, 0x00035, 0x00033,
+        0x02044, 0x00035, 0x00034, 0x02044, 0x00035, 0x00031, 0x02044, 0x00036,
+        0x00035, 0x02044, 0x00036, 0x00031, 0x02044, 0x00038, 0x00033, 0x02044,
+        0x00038, 0x00035, 0x02044, 0x00038, 0x00037, 0x02044, 0x00038, 0x00031,
+        0x02044, 0x00049, 0x00049, 0x00049, 0x00049, 0x00049, 0x00049, 0x00056,
+        0x00056, 0x00056, 0x00049, 0x00056, 0x00049, 0x00049, 0x00056, 0x00049,
+        0x00049, 0x00049, 0x00049, 0x00058, 0x00058, 0x00058, 0x00049, 0x00058,
+        0x00049, 0x00049, 0x00069, 0x00069, 0x00069, 0x00069, 0x00069, 0x00069,
+        0x00076, 0x00076, 0x00069, 0x00076, 0x00069, 0x00069, 0x00076, 0x00069,
+        0x00069, 0x00069, 0x00069, 0x00078, 0x00078, 0x00069, 0x00078, 0x00069,
+        0x00069, 0x00030, 0x02044, 0x00033, 0x0222b, 0x0222b, 0x0222b, 0x0222b,
+        0x0222b, 0x0222e, 0x0222e, 0x0222e, 0x0222e, 0x0222e, 0x00031, 0x00030,
+        0x00031, 0x00031, 0x00031, 0x00032, 0x00031, 0x00033, 0x00031, 0x00034,
+        0x00031, 0x00035, 0x00031, 0x00036, 0x00031, 0x00037, 0x00031, 0x00038,
+        0x00031, 0x00039, 0x00032, 0x00030, 0x00028, 0x00031, 0x00029, 0x00028,
+        0x00032, 0x00029, 0x00028, 0x00033, 0x00029, 0x00028, 0x00034, 0x00029,
+        0x00028, 0x00035, 0x00029, 0x00028, 0x00036, 0x00029, 0x00028, 0x00037,
+        0x00029, 0x00028, 0x00038, 0x00029, 0x00028, 0x00039, 0x00029, 0x00028,
+        0x00031, 0x00030, 0x00029, 0x00028, 0x00031, 0x00031, 0x00029, 0x00028,
+        0x00031, 0x00032, 0x00029, 0x00028, 0x00031, 0x00033, 0x00029, 0x00028,
+        0x00031, 0x00034, 0x00029, 0x00028, 0x00031, 0x00035, 0x00029, 0x00028,
+        0x00031, 0x00036, 0x00029, 0x00028, 0x00031, 0x00037, 0x00029, 0x00028,
+        0x00031, 0x00038, 0x00029, 0x00028, 0x00031, 0x00039, 0x00029, 0x00028,
+        0x00032, 0x00030, 0x00029, 0x00031, 0x0002e, 0x00032, 0x0002e, 0x00033,
+        0x0002e, 0x00034, 0x0002e, 0x00035, 0x0002e, 0x00036, 0x0002e, 0x00037,
+        0x0002e, 0x00038, 0x0002e, 0x00039, 0x0002e, 0x00031, 0x00030, 0x0002e,
+        0x00031, 0x00031, 0x0002e, 0x00031, 0x00032, 0x0002e, 0x00031, 0x00033,
+        0x0002e, 0x00031, 0x00034, 0x0002e, 0x00031, 0x00035, 0x0002e, 0x00031,
+        0x00036, 0x0002e, 0x00031, 0x00037, 0x0002e, 0x00031, 0x00038, 0x0002e,
+        0x00031, 0x00039, 0x0002e, 0x00032, 0x00030, 0x0002e, 0x00028, 0x00061,
+        0x00029, 0x00028, 0x00062, 0x00029, 0x00028, 0x00063, 0x00029, 0x00028,
+        0x00064, 0x00029, 0x00028, 0x00065, 0x00029, 0x00028, 0x00066, 0x00029,
+        0x00028, 0x00067, 0x00029, 0x00028, 0x00068, 0x00029, 0x00028, 0x00069,
+        0x00029, 0x00028, 0x0006a, 0x00029, 0x00028, 0x0006b, 0x00029, 0x00028,
+        0x0006c, 0x00029, 0x00028, 0x0006d, 0x00029, 0x00028, 0x0006e, 0x00029,
+        0x00028, 0x0006f, 0x00029, 0x00028, 0x00070, 0x00029, 0x00028, 0x00071,
+        0x00029, 0x00028, 0x00072, 0x00029, 0x00028, 0x00073, 0x00029, 0x00028,
+        0x00074, 0x00029, 0x00028, 0x00075, 0x00029, 0x00028, 0x00076, 0x00029,
+        0x00028, 0x00077, 0x00029, 0x00028, 0x00078, 0x00029, 0x00028, 0x00079,
+        0x00029, 0x00028, 0x0007a, 0x00029, 0x00053, 0x00059, 0x00071, 0x0222b,
+        0x0222b, 0x0222b, 0x0222b, 0x0003a, 0x0003a, 0x0003d, 0x0003d, 0x0003d,
+        0x0003d, 0x0003d, 0x0003d, 0x02d61, 0x06bcd, 0x09f9f, 0x04e00, 0x04e28,
+        0x04e36, 0x04e3f, 0x04e59, 0x04e85, 0x04e8c, 0x04ea0, 0x04eba, 0x0513f,
+        0x05165, 0x0516b, 0x05182, 0x05196, 0x051ab, 0x051e0, 0x05200, 0x052f9,
+        0x05315, 0x0531a, 0x05338, 0x05341, 0x0535c, 0x05369, 0x05382, 0x053b6,
+        0x053c8, 0x053e3, 0x056d7, 0x0571f, 0x058eb, 0x05902, 0x0590a, 0x05915,
+        0x05927, 0x05b50, 0x05b80, 0x05bf8, 0x05c0f, 0x05c38, 0x05c71, 0x05ddb,
+        0x05de5, 0x05df1, 0x05dfe, 0x05e72, 0x05e7a, 0x05e7f, 0x05ef4, 0x05f0b,
+        0x05f13, 0x05f50, 0x05f61, 0x05f73, 0x05fc3, 0x06208, 0x06236, 0x0624b,
+        0x0652f, 0x06534, 0x06587, 0x06597, 0x065a4, 0x065b9, 0x065e0, 0x065e5,
+        0x066f0, 0x06708, 0x06728, 0x06b20, 0x06b62, 0x06bb3, 0x06bcb, 0x06bd4,
+        0x06bdb, 0x06c0f, 0x06c14, 0x06c34, 0x0706b, 0x0722a, 0x07236, 0x0723b,
+        0x0723f, 0x07247, 0x07259, 0x0725b, 0x072ac, 0x07384, 0x07389, 0x074dc,
+        0x074e6, 0x07518, 0x0751f, 0x07528, 0x07530, 0x0758b, 0x07592, 0x07676,
+        0x0767d, 0x076ae, 0x076bf, 0x076ee, 0x077db, 0x077e2, 0x077f3, 0x0793a,
+        0x079b8, 0x079be, 0x07a74, 0x07af9, 0x07c73, 0x07cf8, 0x07f36, 0x07f51,
+        0x07f8a, 0x0800c, 0x08012, 0x08033, 0x0807f, 0x08089, 0x081e3, 0x081ea,
+        0x081f3, 0x081fc, 0x0820c, 0x0821b, 0x0821f, 0x0826e, 0x08272, 0x08278,
+        0x0864d, 0x0866b, 0x08840, 0x0897e, 0x089d2, 0x08a00, 0x08c37, 0x08c46,
+        0x08c78, 0x08c9d, 0x08d64, 0x08d70, 0x08db3, 0x08eab, 0x08f9b, 0x08fb5,
+        0x09091, 0x09149, 0x091c6, 0x09577, 0x09580, 0x0961c, 0x096b6, 0x096b9,
+        0x096e8, 0x09751, 0x0975e, 0x09762, 0x09769, 0x097cb, 0x097ed, 0x097f3,
+        0x09801, 0x098a8, 0x098db, 0x098df, 0x09996, 0x09999, 0x099ac, 0x09aa8,
+        0x09ad8, 0x09adf, 0x09b25, 0x09b2f, 0x09b32, 0x09b3c, 0x09b5a, 0x09ce5,
+        0x09e75, 0x09ea5, 0x09ec3, 0x09ecd, 0x09ed1, 0x09efd, 0x09f0e, 0x09f13,
+        0x09f20, 0x09f4a, 0x09f52, 0x09fa0, 0x03012, 0x05344, 0x05345, 0x00020,
+        0x03099, 0x00020, 0x0309a, 0x03088, 0x0308a, 0x030b3, 0x030c8, 0x01100,
+        0x01101, 0x011aa, 0x01102, 0x011ac, 0x011ad, 0x01103, 0x01104, 0x01105,
+        0x011b0, 0x011b1, 0x011b2, 0x011b3, 0x011b4, 0x011b5, 0x0111a, 0x01106,
+        0x01107, 0x01108, 0x01121, 0x01109, 0x0110a, 0x0110b, 0x0110c, 0x0110d,
+        0x0110e, 0x0110f, 0x01110, 0x01111, 0x01112, 0x01161, 0x01162, 0x01163,
+        0x01164, 0x01165, 0x01166, 0x01167, 0x01168, 0x01169, 0x0116a, 0x0116b,
+        0x0116c, 0x0116d, 0x0116e, 0x0116f, 0x01170, 0x01171, 0x01172, 0x01173,
+        0x01174, 0x01175, 0x01160, 0x01114, 0x01115, 0x011c7, 0x011c8, 0x011cc,
+        0x011ce, 0x011d3, 0x011d7, 0x011d9, 0x0111c, 0x011dd, 0x011df, 0x0111d,
+        0x0111e, 0x01120, 0x01122, 0x01123, 0x01127, 0x01129, 0x0112b, 0x0112c,
+        0x0112d, 0x0112e, 0x0112f, 0x01132, 0x01136, 0x01140, 0x01147, 0x0114c,
+        0x011f1, 0x011f2, 0x01157, 0x01158, 0x01159, 0x01184, 0x01185, 0x01188,
+        0x01191, 0x01192, 0x01194, 0x0119e, 0x011a1, 0x04e09, 0x056db, 0x04e0a,
+        0x04e2d, 0x04e0b, 0x07532, 0x04e19, 0x04e01, 0x05929, 0x05730, 0x00028,
+        0x01100, 0x00029, 0x00028, 0x01102, 0x00029, 0x00028, 0x01103, 0x00029,
+        0x00028, 0x01105, 0x00029, 0x00028, 0x01106, 0x00029, 0x00028, 0x01107,
+        0x00029, 0x00028, 0x01109, 0x00029, 0x00028, 0x0110b, 0x00029, 0x00028,
+        0x0110c, 0x00029, 0x00028, 0x0110e, 0x00029, 0x00028, 0x0110f, 0x00029,
+        0x00028, 0x01110, 0x00029, 0x00028, 0x01111, 0x00029, 0x00028, 0x01112,
+        0x00029, 0x00028, 0x01100, 0x01161, 0x00029, 0x00028, 0x01102, 0x01161,
+        0x00029, 0x00028, 0x01103, 0x01161, 0x00029, 0x00028, 0x01105, 0x01161,
+        0x00029, 0x00028, 0x01106, 0x01161, 0x00029, 0x00028, 0x01107, 0x01161,
+        0x00029, 0x00028, 0x01109, 0x01161, 0x00029, 0x00028, 0x0110b, 0x01161,
+        0x00029, 0x00028, 0x0110c, 0x01161, 0x00029, 0x00028, 0x0110e, 0x01161,
+        0x00029, 0x00028, 0x0110f, 0x01161, 0x00029, 0x00028, 0x01110, 0x01161,
+        0x00029, 0x00028, 0x01111, 0x01161, 0x00029, 0x00028, 0x01112, 0x01161,
+        0x00029, 0x00028, 0x0110c, 0x0116e, 0x00029, 0x00028, 0x0110b, 0x01169,
+        0x0110c, 0x01165, 0x011ab, 0x00029, 0x00028, 0x0110b, 0x01169, 0x01112,
+        0x0116e, 0x00029, 0x00028, 0x04e00, 0x00029, 0x00028, 0x04e8c, 0x00029,
+        0x00028, 0x04e09, 0x00029, 0x00028, 0x056db, 0x00029, 0x00028, 0x04e94,
+        0x00029, 0x00028, 0x0516d, 0x00029, 0x00028, 0x04e03, 0x00029, 0x00028,
+        0x0516b, 0x00029, 0x00028, 0x04e5d, 0x00029, 0x00028, 0x05341, 0x00029,
+        0x00028, 0x06708, 0x00029, 0x00028, 0x0706b, 0x00029, 0x00028, 0x06c34,
+        0x00029, 0x00028, 0x06728, 0x00029, 0x00028, 0x091d1, 0x00029, 0x00028,
+        0x0571f, 0x00029, 0x00028, 0x065e5, 0x00029, 0x00028, 0x0682a, 0x00029,
+        0x00028, 0x06709, 0x00029, 0x00028, 0x0793e, 0x00029, 0x00028, 0x0540d,
+        0x00029, 0x00028, 0x07279, 0x00029, 0x00028, 0x08ca1, 0x00029, 0x00028,
+        0x0795d, 0x00029, 0x00028, 0x052b4, 0x00029, 0x00028, 0x04ee3, 0x00029,
+        0x00028, 0x0547c, 0x00029, 0x00028, 0x05b66, 0x00029, 0x00028, 0x076e3,
+        0x00029, 0x00028, 0x04f01, 0x00029, 0x00028, 0x08cc7, 0x00029, 0x00028,
+        0x05354, 0x00029, 0x00028, 0x0796d, 0x00029, 0x00028, 0x04f11, 0x00029,
+        0x00028, 0x081ea, 0x00029, 0x00028, 0x081f3, 0x00029, 0x0554f, 0x05e7c,
+        0x07b8f, 0x00050, 0x00054, 0x00045, 0x00032, 0x00031, 0x00032, 0x00032,
+        0x00032, 0x00033, 0x00032, 0x00034, 0x00032, 0x00035, 0x00032, 0x00036,
+        0x00032, 0x00037, 0x00032, 0x00038, 0x00032, 0x00039, 0x00033, 0x00030,
+        0x00033, 0x00031, 0x00033, 0x00032, 0x00033, 0x00033, 0x00033, 0x00034,
+        0x00033, 0x00035, 0x01100, 0x01161, 0x01102, 0x01161, 0x01103, 0x01161,
+        0x01105, 0x01161, 0x01106, 0x01161, 0x01107, 0x01161, 0x01109, 0x01161,
+        0x0110b, 0x01161, 0x0110c, 0x01161, 0x0110e, 0x01161, 0x0110f, 0x01161,
+        0x01110, 0x01161, 0x01111, 0x01161, 0x01112, 0x01161, 0x0110e, 0x01161,
+        0x011b7, 0x01100, 0x01169, 0x0110c, 0x0116e, 0x0110b, 0x01174, 0x0110b,
+        0x0116e, 0x04e94, 0x04e03, 0x04e5d, 0x0682a, 0x06709, 0x0540d, 0x07279,
+        0x08ca1, 0x052b4, 0x079d8, 0x07537, 0x09069, 0x0512a, 0x05370, 0x06ce8,
+        0x09805, 0x04f11, 0x05199, 0x06b63, 0x05de6, 0x053f3, 0x0533b, 0x05b97,
+        0x05b66, 0x076e3, 0x04f01, 0x08cc7, 0x05354, 0x0591c, 0x00033, 0x00036,
+        0x00033, 0x00037, 0x00033, 0x00038, 0x00033, 0x00039, 0x00034, 0x00030,
+        0x00034, 0x00031, 0x00034, 0x00032, 0x00034, 0x00033, 0x00034, 0x00034,
+        0x00034, 0x00035, 0x00034, 0x00036, 0x00034, 0x00037, 0x00034, 0x00038,
+        0x00034, 0x00039, 0x00035, 0x00030, 0x00031, 0x06708, 0x00032, 0x06708,
+        0x00033, 0x06708, 0x00034, 0x06708, 0x00035, 0x06708, 0x00036, 0x06708,
+        0x00037, 0x06708, 0x00038, 0x06708, 0x00039, 0x06708, 0x00031, 0x00030,
+        0x06708, 0x00031, 0x00031, 0x06708, 0x00031, 0x00032, 0x06708, 0x00048,
+        0x00067, 0x00065, 0x00072, 0x00067, 0x00065, 0x00056, 0x0004c, 0x00054,
+        0x00044, 0x030a2, 0x030a4, 0x030a6, 0x030a8, 0x030aa, 0x030ab, 0x030ad,
+        0x030af, 0x030b1, 0x030b3, 0x030b5, 0x030b7, 0x030b9, 0x030bb, 0x030bd,
+        0x030bf, 0x030c1, 0x030c4, 0x030c6, 0x030c8, 0x030ca, 0x030cb, 0x030cc,
+        0x030cd, 0x030ce, 0x030cf, 0x030d2, 0x030d5, 0x030d8, 0x030db, 0x030de,
+        0x030df, 0x030e0, 0x030e1, 0x030e2, 0x030e4, 0x030e6, 0x030e8, 0x030e9,
+        0x030ea, 0x030eb, 0x030ec, 0x030ed, 0x030ef, 0x030f0, 0x030f1, 0x030f2,
+        0x04ee4, 0x0548c, 0x030a2, 0x030cf, 0x0309a, 0x030fc, 0x030c8, 0x030a2,
+        0x030eb, 0x030d5, 0x030a1, 0x030a2, 0x030f3, 0x030d8, 0x0309a, 0x030a2,
+        0x030a2, 0x030fc, 0x030eb, 0x030a4, 0x030cb, 0x030f3, 0x030af, 0x03099,
+        0x030a4, 0x030f3, 0x030c1, 0x030a6, 0x030a9, 0x030f3, 0x030a8, 0x030b9,
+        0x030af, 0x030fc, 0x030c8, 0x03099, 0x030a8, 0x030fc, 0x030ab, 0x030fc,
+        0x030aa, 0x030f3, 0x030b9, 0x030aa, 0x030fc, 0x030e0, 0x030ab, 0x030a4,
+        0x030ea, 0x030ab, 0x030e9, 0x030c3, 0x030c8, 0x030ab, 0x030ed, 0x030ea,
+        0x030fc, 0x030ab, 0x03099, 0x030ed, 0x030f3, 0x030ab, 0x03099, 0x030f3,
+        0x030de, 0x030ad, 0x03099, 0x030ab, 0x03099, 0x030ad, 0x03099, 0x030cb,
+        0x030fc, 0x030ad, 0x030e5, 0x030ea, 0x030fc, 0x030ad, 0x03099, 0x030eb,
+        0x030bf, 0x03099, 0x030fc, 0x030ad, 0x030ed, 0x030ad, 0x030ed, 0x030af,
+        0x03099, 0x030e9, 0x030e0, 0x030ad, 0x030ed, 0x030e1, 0x030fc, 0x030c8,
+        0x030eb, 0x030ad, 0x030ed, 0x030ef, 0x030c3, 0x030c8, 0x030af, 0x03099,
+        0x030e9, 0x030e0, 0x030af, 0x03099, 0x030e9, 0x030e0, 0x030c8, 0x030f3,
+        0x030af, 0x030eb, 0x030bb, 0x03099, 0x030a4, 0x030ed, 0x030af, 0x030ed,
+        0x030fc, 0x030cd, 0x030b1, 0x030fc, 0x030b9, 0x030b3, 0x030eb, 0x030ca,
+        0x030b3, 0x030fc, 0x030db, 0x0309a, 0x030b5, 0x030a4, 0x030af, 0x030eb,
+        0x030b5, 0x030f3, 0x030c1, 0x030fc, 0x030e0, 0x030b7, 0x030ea, 0x030f3,
+        0x030af, 0x03099, 0x030bb, 0x030f3, 0x030c1, 0x030bb, 0x030f3, 0x030c8,
+        0x030bf, 0x03099, 0x030fc, 0x030b9, 0x030c6, 0x03099, 0x030b7, 0x030c8,
+        0x03099, 0x030eb, 0x030c8, 0x030f3, 0x030ca, 0x030ce, 0x030ce, 0x030c3,
+        0x030c8, 0x030cf, 0x030a4, 0x030c4, 0x030cf, 0x0309a, 0x030fc, 0x030bb,
+        0x030f3, 0x030c8, 0x030cf, 0x0309a, 0x030fc, 0x030c4, 0x030cf, 0x03099,
+        0x030fc, 0x030ec, 0x030eb, 0x030d2, 0x0309a, 0x030a2, 0x030b9, 0x030c8,
+        0x030eb, 0x030d2, 0x0309a, 0x030af, 0x030eb, 0x030d2, 0x0309a, 0x030b3,
+        0x030d2, 0x03099, 0x030eb, 0x030d5, 0x030a1, 0x030e9, 0x030c3, 0x030c8,
+        0x03099, 0x030d5, 0x030a3, 0x030fc, 0x030c8, 0x030d5, 0x03099, 0x030c3,
+        0x030b7, 0x030a7, 0x030eb, 0x030d5, 0x030e9, 0x030f3, 0x030d8, 0x030af,
+        0x030bf, 0x030fc, 0x030eb, 0x030d8, 0x0309a, 0x030bd, 0x030d8, 0x0309a,
+        0x030cb, 0x030d2, 0x030d8, 0x030eb, 0x030c4, 0x030d8, 0x0309a, 0x030f3,
+        0x030b9, 0x030d8, 0x0309a, 0x030fc, 0x030b7, 0x03099, 0x030d8, 0x03099,
+        0x030fc, 0x030bf, 0x030db, 0x0309a, 0x030a4, 0x030f3, 0x030c8, 0x030db,
+        0x03099, 0x030eb, 0x030c8, 0x030db, 0x030f3, 0x030db, 0x0309a, 0x030f3,
+        0x030c8, 0x03099, 0x030db, 0x030fc, 0x030eb, 0x030db, 0x030fc, 0x030f3,
+        0x030de, 0x030a4, 0x030af, 0x030ed, 0x030de, 0x030a4, 0x030eb, 0x030de,
+        0x030c3, 0x030cf, 0x030de, 0x030eb, 0x030af, 0x030de, 0x030f3, 0x030b7,
+        0x030e7, 0x030f3, 0x030df, 0x030af, 0x030ed, 0x030f3, 0x030df, 0x030ea,
+        0x030df, 0x030ea, 0x030cf, 0x03099, 0x030fc, 0x030eb, 0x030e1, 0x030ab,
+        0x03099, 0x030e1, 0x030ab, 0x03099, 0x030c8, 0x030f3, 0x030e1, 0x030fc,
+        0x030c8, 0x030eb, 0x030e4, 0x030fc, 0x030c8, 0x03099, 0x030e4, 0x030fc,
+        0x030eb, 0x030e6, 0x030a2, 0x030f3, 0x030ea, 0x030c3, 0x030c8, 0x030eb,
+        0x030ea, 0x030e9, 0x030eb, 0x030d2, 0x0309a, 0x030fc, 0x030eb, 0x030fc,
+        0x030d5, 0x03099, 0x030eb, 0x030ec, 0x030e0, 0x030ec, 0x030f3, 0x030c8,
+        0x030b1, 0x03099, 0x030f3, 0x030ef, 0x030c3, 0x030c8, 0x00030, 0x070b9,
+        0x00031, 0x070b9, 0x00032, 0x070b9, 0x00033, 0x070b9, 0x00034, 0x070b9,
+        0x00035, 0x070b9, 0x00036, 0x070b9, 0x00037, 0x070b9, 0x00038, 0x070b9,
+        0x00039, 0x070b9, 0x00031, 0x00030, 0x070b9, 0x00031, 0x00031, 0x070b9,
+        0x00031, 0x00032, 0x070b9, 0x00031, 0x00033, 0x070b9, 0x00031, 0x00034,
+        0x070b9, 0x00031, 0x00035, 0x070b9, 0x00031, 0x00036, 0x070b9, 0x00031,
+        0x00037, 0x070b9, 0x00031, 0x00038, 0x070b9, 0x00031, 0x00039, 0x070b9,
+        0x00032, 0x00030, 0x070b9, 0x00032, 0x00031, 0x070b9, 0x00032, 0x00032,
+        0x070b9, 0x00032, 0x00033, 0x070b9, 0x00032, 0x00034, 0x070b9, 0x00068,
+        0x00050, 0x00061, 0x00064, 0x00061, 0x00041, 0x00055, 0x00062, 0x00061,
+        0x00072, 0x0006f, 0x00056, 0x00070, 0x00063, 0x00064, 0x0006d, 0x00064,
+        0x0006d, 0x00032, 0x00064, 0x0006d, 0x00033, 0x00049, 0x00055, 0x05e73,
+        0x06210, 0x0662d, 0x0548c, 0x05927, 0x06b63, 0x0660e, 0x06cbb, 0x0682a,
+        0x05f0f, 0x04f1a, 0x0793e, 0x00070, 0x00041, 0x0006e, 0x00041, 0x003bc,
+        0x00041, 0x0006d, 0x00041, 0x0006b, 0x00041, 0x0004b, 0x00042, 0x0004d,
+        0x00042, 0x00047, 0x00042, 0x00063, 0x00061, 0x0006c, 0x0006b, 0x00063,
+        0x00061, 0x0006c, 0x00070, 0x00046, 0x0006e, 0x00046, 0x003bc, 0x00046,
+        0x003bc, 0x00067, 0x0006d, 0x00067, 0x0006b, 0x00067, 0x00048, 0x0007a,
+        0x0006b, 0x00048, 0x0007a, 0x0004d, 0x00048, 0x0007a, 0x00047, 0x00048,
+        0x0007a, 0x00054, 0x00048, 0x0007a, 0x003bc, 0x0006c, 0x0006d, 0x0006c,
+        0x00064, 0x0006c, 0x0006b, 0x0006c, 0x00066, 0x0006d, 0x0006e, 0x0006d,
+        0x003bc, 0x0006d, 0x0006d, 0x0006d, 0x00063, 0x0006d, 0x0006b, 0x0006d,
+        0x0006d, 0x0006d, 0x00032, 0x00063, 0x0006d, 0x00032, 0x0006d, 0x00032,
+        0x0006b, 0x0006d, 0x00032, 0x0006d, 0x0006d, 0x00033, 0x00063, 0x0006d,
+        0x00033, 0x0006d, 0x00033, 0x0006b, 0x0006d, 0x00033, 0x0006d, 0x02215,
+        0x00073, 0x0006d, 0x02215, 0x00073, 0x00032, 0x00050, 0x00061, 0x0006b,
+        0x00050, 0x00061, 0x0004d, 0x00050, 0x00061, 0x00047, 0x00050, 0x00061,
+        0x00072, 0x00061, 0x00064, 0x00072, 0x00061, 0x00064, 0x02215, 0x00073,
+        0x00072, 0x00061, 0x00064, 0x02215, 0x00073, 0x00032, 0x00070, 0x00073,
+        0x0006e, 0x00073, 0x003bc, 0x00073, 0x0006d, 0x00073, 0x00070, 0x00056,
+        0x0006e, 0x00056, 0x003bc, 0x00056, 0x0006d, 0x00056, 0x0006b, 0x00056,
+        0x0004d, 0x00056, 0x00070, 0x00057, 0x0006e, 0x00057, 0x003bc, 0x00057,
+        0x0006d, 0x00057, 0x0006b, 0x00057, 0x0004d, 0x00057, 0x0006b, 0x003a9,
+        0x0004d, 0x003a9, 0x00061, 0x0002e, 0x0006d, 0x0002e, 0x00042, 0x00071,
+        0x00063, 0x00063, 0x00063, 0x00064, 0x00043, 0x02215, 0x0006b, 0x00067,
+        0x00043, 0x0006f, 0x0002e, 0x00064, 0x00042, 0x00047, 0x00079, 0x00068,
+        0x00061, 0x00048, 0x00050, 0x00069, 0x0006e, 0x0004b, 0x0004b, 0x0004b,
+        0x0004d, 0x0006b, 0x00074, 0x0006c, 0x0006d, 0x0006c, 0x0006e, 0x0006c,
+        0x0006f, 0x00067, 0x0006c, 0x00078, 0x0006d, 0x00062, 0x0006d, 0x00069,
+        0x0006c, 0x0006d, 0x0006f, 0x0006c, 0x00050, 0x00048, 0x00070, 0x0002e,
+        0x0006d, 0x0002e, 0x00050, 0x00050, 0x0004d, 0x00050, 0x00052, 0x00073,
+        0x00072, 0x00053, 0x00076, 0x00057, 0x00062, 0x00056, 0x02215, 0x0006d,
+        0x00041, 0x02215, 0x0006d, 0x00031, 0x065e5, 0x00032, 0x065e5, 0x00033,
+        0x065e5, 0x00034, 0x065e5, 0x00035, 0x065e5, 0x00036, 0x065e5, 0x00037,
+        0x065e5, 0x00038, 0x065e5, 0x00039, 0x065e5, 0x00031, 0x00030, 0x065e5,
+        0x00031, 0x00031, 0x065e5, 0x00031, 0x00032, 0x065e5, 0x00031, 0x00033,
+        0x065e5, 0x00031, 0x00034, 0x065e5, 0x00031, 0x00035, 0x065e5, 0x00031,
+        0x00036, 0x065e5, 0x00031, 0x00037, 0x065e5, 0x00031, 0x00038, 0x065e5,
+        0x00031, 0x00039, 0x065e5, 0x00032, 0x00030, 0x065e5, 0x00032, 0x00031,
+        0x065e5, 0x00032, 0x00032, 0x065e5, 0x00032, 0x00033, 0x065e5, 0x00032,
+        0x00034, 0x065e5, 0x00032, 0x00035, 0x065e5, 0x00032, 0x00036, 0x065e5,
+        0x00032, 0x00037, 0x065e5, 0x00032, 0x00038, 0x065e5, 0x00032, 0x00039,
+        0x065e5, 0x00033, 0x00030, 0x065e5, 0x00033, 0x00031, 0x065e5, 0x00067,
+        0x00061, 0x0006c, 0x0044a, 0x0044c, 0x0a76f, 0x00126, 0x00153, 0x0a727,
+        0x0ab37, 0x0026b, 0x0ab52, 0x0028d, 0x00066, 0x00066, 0x00066, 0x00069,
+        0x00066, 0x0006c, 0x00066, 0x00066, 0x00069, 0x00066, 0x00066, 0x0006c,
+        0x00073, 0x00074, 0x00574, 0x00576, 0x00574, 0x00565, 0x00574, 0x0056b,
+        0x0057e, 0x00576, 0x00574, 0x0056d, 0x005e2, 0x005d4, 0x005db, 0x005dc,
+        0x005dd, 0x005e8, 0x005ea, 0x005d0, 0x005dc, 0x00671, 0x0067b, 0x0067e,
+        0x00680, 0x0067a, 0x0067f, 0x00679, 0x006a4, 0x006a6, 0x00684, 0x00683,
+        0x00686, 0x00687, 0x0068d, 0x0068c, 0x0068e, 0x00688, 0x00698, 0x00691,
+        0x006a9, 0x006af, 0x006b3, 0x006b1, 0x006ba, 0x006bb, 0x006c1, 0x006be,
+        0x006d2, 0x006ad, 0x006c7, 0x006c6, 0x006c8, 0x006cb, 0x006c5, 0x006c9,
+        0x006d0, 0x00649, 0x0064a, 0x00654, 0x00627, 0x0064a, 0x00654, 0x006d5,
+        0x0064a, 0x00654, 0x00648, 0x0064a, 0x00654, 0x006c7, 0x0064a, 0x00654,
+        0x006c6, 0x0064a, 0x00654, 0x006c8, 0x0064a, 0x00654, 0x006d0, 0x0064a,
+        0x00654, 0x00649, 0x006cc, 0x0064a, 0x00654, 0x0062c, 0x0064a, 0x00654,
+        0x0062d, 0x0064a, 0x00654, 0x00645, 0x0064a, 0x00654, 0x0064a, 0x00628,
+        0x0062c, 0x00628, 0x0062d, 0x00628, 0x0062e, 0x00628, 0x00645, 0x00628,
+        0x00649, 0x00628, 0x0064a, 0x0062a, 0x0062c, 0x0062a, 0x0062d, 0x0062a,
+        0x0062e, 0x0062a, 0x00645, 0x0062a, 0x00649, 0x0062a, 0x0064a, 0x0062b,
+        0x0062c, 0x0062b, 0x00645, 0x0062b, 0x00649, 0x0062b, 0x0064a, 0x0062c,
+        0x0062d, 0x0062c, 0x00645, 0x0062d, 0x0062c, 0x0062d, 0x00645, 0x0062e,
+        0x0062c, 0x0062e, 0x0062d, 0x0062e, 0x00645, 0x00633, 0x0062c, 0x00633,
+        0x0062d, 0x00633, 0x0062e, 0x00633, 0x00645, 0x00635, 0x0062d, 0x00635,
+        0x00645, 0x00636, 0x0062c, 0x00636, 0x0062d, 0x00636, 0x0062e, 0x00636,
+        0x00645, 0x00637, 0x0062d, 0x00637, 0x00645, 0x00638, 0x00645, 0x00639,
+        0x0062c, 0x00639, 0x00645, 0x0063a, 0x0062c, 0x0063a, 0x00645, 0x00641,
+        0x0062c, 0x00641, 0x0062d, 0x00641, 0x0062e, 0x00641, 0x00645, 0x00641,
+        0x00649, 0x00641, 0x0064a, 0x00642, 0x0062d, 0x00642, 0x00645, 0x00642,
+        0x00649, 0x00642, 0x0064a, 0x00643, 0x00627, 0x00643, 0x0062c, 0x00643,
+        0x0062d, 0x00643, 0x0062e, 0x00643, 0x00644, 0x00643, 0x00645, 0x00643,
+        0x00649, 0x00643, 0x0064a, 0x00644, 0x0062c, 0x00644, 0x0062d, 0x00644,
+        0x0062e, 0x00644, 0x00645, 0x00644, 0x00649, 0x00644, 0x0064a, 0x00645,
+        0x0062c, 0x00645, 0x0062d, 0x00645, 0x0062e, 0x00645, 0x00645, 0x00645,
+        0x00649, 0x00645, 0x0064a, 0x00646, 0x0062c, 0x00646, 0x0062d, 0x00646,
+        0x0062e, 0x00646, 0x00645, 0x00646, 0x00649, 0x00646, 0x0064a, 0x00647,
+        0x0062c, 0x00647, 0x00645, 0x00647, 0x00649, 0x00647, 0x0064a, 0x0064a,
+        0x0062c, 0x0064a, 0x0062d, 0x0064a, 0x0062e, 0x0064a, 0x00645, 0x0064a,
+        0x00649, 0x0064a, 0x0064a, 0x00630, 0x00670, 0x00631, 0x00670, 0x00649,
+        0x00670, 0x00020, 0x0064c, 0x00651, 0x00020, 0x0064d, 0x00651, 0x00020,
+        0x0064e, 0x00651, 0x00020, 0x0064f, 0x00651, 0x00020, 0x00650, 0x00651,
+        0x00020, 0x00651, 0x00670, 0x0064a, 0x00654, 0x00631, 0x0064a, 0x00654,
+        0x00632, 0x0064a, 0x00654, 0x00646, 0x00628, 0x00631, 0x00628, 0x00632,
+        0x00628, 0x00646, 0x0062a, 0x00631, 0x0062a, 0x00632, 0x0062a, 0x00646,
+        0x0062b, 0x00631, 0x0062b, 0x00632, 0x0062b, 0x00646, 0x00645, 0x00627,
+        0x00646, 0x00631, 0x00646, 0x00632, 0x00646, 0x00646, 0x0064a, 0x00631,
+        0x0064a, 0x00632, 0x0064a, 0x00646, 0x0064a, 0x00654, 0x0062e, 0x0064a,
+        0x00654, 0x00647, 0x00628, 0x00647, 0x0062a, 0x00647, 0x00635, 0x0062e,
+        0x00644, 0x00647, 0x00646, 0x00647, 0x00647, 0x00670, 0x0064a, 0x00647,
+        0x0062b, 0x00647, 0x00633, 0x00647, 0x00634, 0x00645, 0x00634, 0x00647,
+        0x00640, 0x0064e, 0x00651, 0x00640, 0x0064f, 0x00651, 0x00640, 0x00650,
+        0x00651, 0x00637, 0x00649, 0x00637, 0x0064a, 0x00639, 0x00649, 0x00639,
+        0x0064a, 0x0063a, 0x00649, 0x0063a, 0x0064a, 0x00633, 0x00649, 0x00633,
+        0x0064a, 0x00634, 0x00649, 0x00634, 0x0064a, 0x0062d, 0x00649, 0x0062d,
+        0x0064a, 0x0062c, 0x00649, 0x0062c, 0x0064a, 0x0062e, 0x00649, 0x0062e,
+        0x0064a, 0x00635, 0x00649, 0x00635, 0x0064a, 0x00636, 0x00649, 0x00636,
+        0x0064a, 0x00634, 0x0062c, 0x00634, 0x0062d, 0x00634, 0x0062e, 0x00634,
+        0x00631, 0x00633, 0x00631, 0x00635, 0x00631, 0x00636, 0x00631, 0x00627,
+        0x0064b, 0x0062a, 0x0062c, 0x00645, 0x0062a, 0x0062d, 0x0062c, 0x0062a,
+        0x0062d, 0x00645, 0x0062a, 0x0062e, 0x00645, 0x0062a, 0x00645, 0x0062c,
+        0x0062a, 0x00645, 0x0062d, 0x0062a, 0x00645, 0x0062e, 0x0062c, 0x00645,
+        0x0062d, 0x0062d, 0x00645, 0x0064a, 0x0062d, 0x00645, 0x00649, 0x00633,
+        0x0062d, 0x0062c, 0x00633, 0x0062c, 0x0062d, 0x00633, 0x0062c, 0x00649,
+        0x00633, 0x00645, 0x0062d, 0x00633, 0x00645, 0x0062c, 0x00633, 0x00645,
+        0x00645, 0x00635, 0x0062d, 0x0062d, 0x00635, 0x00645, 0x00645, 0x00634,
+        0x0062d, 0x00645, 0x00634, 0x0062c, 0x0064a, 0x00634, 0x00645, 0x0062e,
+        0x00634, 0x00645, 0x00645, 0x00636, 0x0062d, 0x00649, 0x00636, 0x0062e,
+        0x00645, 0x00637, 0x00645, 0x0062d, 0x00637, 0x00645, 0x00645, 0x00637,
+        0x00645, 0x0064a, 0x00639, 0x0062c, 0x00645, 0x00639, 0x00645, 0x00645,
+        0x00639, 0x00645, 0x00649, 0x0063a, 0x00645, 0x00645, 0x0063a, 0x00645,
+        0x0064a, 0x0063a, 0x00645, 0x00649, 0x00641, 0x0062e, 0x00645, 0x00642,
+        0x00645, 0x0062d, 0x00642, 0x00645, 0x00645, 0x00644, 0x0062d, 0x00645,
+        0x00644, 0x0062d, 0x0064a, 0x00644, 0x0062d, 0x00649, 0x00644, 0x0062c,
+        0x0062c, 0x00644, 0x0062e, 0x00645, 0x00644, 0x00645, 0x0062d, 0x00645,
+        0x0062d, 0x0062c, 0x00645, 0x0062d, 0x00645, 0x00645, 0x0062d, 0x0064a,
+        0x00645, 0x0062c, 0x0062d, 0x00645, 0x0062c, 0x00645, 0x00645, 0x0062e,
+        0x0062c, 0x00645, 0x0062e, 0x00645, 0x00645, 0x0062c, 0x0062e, 0x00647,
+        0x00645, 0x0062c, 0x00647, 0x00645, 0x00645, 0x00646, 0x0062d, 0x00645,
+        0x00646, 0x0062d, 0x00649, 0x00646, 0x0062c, 0x00645, 0x00646, 0x0062c,
+        0x00649, 0x00646, 0x00645, 0x0064a, 0x00646, 0x00645, 0x00649, 0x0064a,
+        0x00645, 0x00645, 0x00628, 0x0062e, 0x0064a, 0x0062a, 0x0062c, 0x0064a,
+        0x0062a, 0x0062c, 0x00649, 0x0062a, 0x0062e, 0x0064a, 0x0062a, 0x0062e,
+        0x00649, 0x0062a, 0x00645, 0x0064a, 0x0062a, 0x00645, 0x00649, 0x0062c,
+        0x00645, 0x0064a, 0x0062c, 0x0062d, 0x00649, 0x0062c, 0x00645, 0x00649,
+        0x00633, 0x0062e, 0x00649, 0x00635, 0x0062d, 0x0064a, 0x00634, 0x0062d,
+        0x0064a, 0x00636, 0x0062d, 0x0064a, 0x00644, 0x0062c, 0x0064a, 0x00644,
+        0x00645, 0x0064a, 0x0064a, 0x0062d, 0x0064a, 0x0064a, 0x0062c, 0x0064a,
+        0x0064a, 0x00645, 0x0064a, 0x00645, 0x00645, 0x0064a, 0x00642, 0x00645,
+        0x0064a, 0x00646, 0x0062d, 0x0064a, 0x00639, 0x00645, 0x0064a, 0x00643,
+        0x00645, 0x0064a, 0x00646, 0x0062c, 0x0062d, 0x00645, 0x0062e, 0x0064a,
+        0x00644, 0x0062c, 0x00645, 0x00643, 0x00645, 0x00645, 0x0062c, 0x0062d,
+        0x0064a, 0x0062d, 0x0062c, 0x0064a, 0x00645, 0x0062c, 0x0064a, 0x00641,
+        0x00645, 0x0064a, 0x00628, 0x0062d, 0x0064a, 0x00633, 0x0062e, 0x0064a,
+        0x00646, 0x0062c, 0x0064a, 0x00635, 0x00644, 0x006d2, 0x00642, 0x00644,
+        0x006d2, 0x00627, 0x00644, 0x00644, 0x00647, 0x00627, 0x00643, 0x00628,
+        0x00631, 0x00645, 0x0062d, 0x00645, 0x0062f, 0x00635, 0x00644, 0x00639,
+        0x00645, 0x00631, 0x00633, 0x00648, 0x00644, 0x00639, 0x00644, 0x0064a,
+        0x00647, 0x00648, 0x00633, 0x00644, 0x00645, 0x00635, 0x00644, 0x00649,
+        0x00635, 0x00644, 0x00649, 0x00020, 0x00627, 0x00644, 0x00644, 0x00647,
+        0x00020, 0x00639, 0x00644, 0x0064a, 0x00647, 0x00020, 0x00648, 0x00633,
+        0x00644, 0x00645, 0x0062c, 0x00644, 0x00020, 0x0062c, 0x00644, 0x00627,
+        0x00644, 0x00647, 0x00631, 0x006cc, 0x00627, 0x00644, 0x0002c, 0x03001,
+        0x03002, 0x0003a, 0x00021, 0x0003f, 0x03016, 0x03017, 0x02014, 0x02013,
+        0x0005f, 0x0007b, 0x0007d, 0x03014, 0x03015, 0x03010, 0x03011, 0x0300a,
+        0x0300b, 0x0300c, 0x0300d, 0x0300e, 0x0300f, 0x0005b, 0x0005d, 0x00023,
+        0x00026, 0x0002a, 0x0002d, 0x0003c, 0x0003e, 0x0005c, 0x00024, 0x00025,
+        0x00040, 0x00020, 0x0064b, 0x00640, 0x0064b, 0x00020, 0x0064c, 0x00020,
+        0x0064d, 0x00020, 0x0064e, 0x00640, 0x0064e, 0x00020, 0x0064f, 0x00640,
+        0x0064f, 0x00020, 0x00650, 0x00640, 0x00650, 0x00020, 0x00651, 0x00640,
+        0x00651, 0x00020, 0x00652, 0x00640, 0x00652, 0x00621, 0x00627, 0x00628,
+        0x00629, 0x0062a, 0x0062b, 0x0062c, 0x0062d, 0x0062e, 0x0062f, 0x00630,
+        0x00631, 0x00632, 0x00633, 0x00634, 0x00635, 0x00636, 0x00637, 0x00638,
+        0x00639, 0x0063a, 0x00641, 0x00642, 0x00643, 0x00644, 0x00645, 0x00646,
+        0x00647, 0x00648, 0x0064a, 0x00644, 0x00627, 0x00653, 0x00644, 0x00627,
+        0x00654, 0x00644, 0x00627, 0x00655, 0x00644, 0x00627, 0x00022, 0x00027,
+        0x0002f, 0x0005e, 0x0007c, 0x0007e, 0x02985, 0x02986, 0x030fb, 0x030a1,
+        0x030a3, 0x030a5, 0x030a7, 0x030a9, 0x030e3, 0x030e5, 0x030e7, 0x030c3,
+        0x030fc, 0x030f3, 0x03099, 0x0309a, 0x000a2, 0x000a3, 0x000ac, 0x000a6,
+        0x000a5, 0x020a9, 0x02502, 0x02190, 0x02191, 0x02192, 0x02193, 0x025a0,
+        0x025cb, 0x002d0, 0x002d1, 0x000e6, 0x00299, 0x00253, 0x002a3, 0x0ab66,
+        0x002a5, 0x002a4, 0x00256, 0x00257, 0x01d91, 0x00258, 0x0025e, 0x002a9,
+        0x00264, 0x00262, 0x00260, 0x0029b, 0x0029c, 0x00267, 0x00284, 0x002aa,
+        0x002ab, 0x0026c, 0x1df04, 0x0a78e, 0x0026e, 0x1df05, 0x0028e, 0x1df06,
+        0x000f8, 0x00276, 0x00277, 0x0027a, 0x1df08, 0x0027d, 0x0027e, 0x00280,
+        0x002a8, 0x002a6, 0x0ab67, 0x002a7, 0x00288, 0x02c71, 0x0028f, 0x002a1,
+        0x002a2, 0x00298, 0x001c0, 0x001c1, 0x001c2, 0x1df0a, 0x1df1e, 0x00131,
+        0x00237, 0x00391, 0x00392, 0x00394, 0x00395, 0x00396, 0x00397, 0x00399,
+        0x0039a, 0x0039b, 0x0039c, 0x0039d, 0x0039e, 0x0039f, 0x003a1, 0x003a4,
+        0x003a6, 0x003a7, 0x003a8, 0x02207, 0x003b1, 0x003b6, 0x003b7, 0x003bb,
+        0x003bd, 0x003be, 0x003bf, 0x003c3, 0x003c4, 0x003c5, 0x003c8, 0x003c9,
+        0x02202, 0x003dc, 0x003dd, 0x00430, 0x00431, 0x00432, 0x00433, 0x00434,
+        0x00435, 0x00436, 0x00437, 0x00438, 0x0043a, 0x0043b, 0x0043c, 0x0043e,
+        0x0043f, 0x00440, 0x00441, 0x00442, 0x00443, 0x00444, 0x00445, 0x00446,
+        0x00447, 0x00448, 0x0044b, 0x0044d, 0x0044e, 0x0a689, 0x004d9, 0x00456,
+        0x00458, 0x004e9, 0x004af, 0x004cf, 0x00491, 0x00455, 0x0045f, 0x004ab,
+        0x0a651, 0x004b1, 0x0066e, 0x006a1, 0x0066f, 0x00030, 0x0002e, 0x00030,
+        0x0002c, 0x00031, 0x0002c, 0x00032, 0x0002c, 0x00033, 0x0002c, 0x00034,
+        0x0002c, 0x00035, 0x0002c, 0x00036, 0x0002c, 0x00037, 0x0002c, 0x00038,
+        0x0002c, 0x00039, 0x0002c, 0x00028, 0x00041, 0x00029, 0x00028, 0x00042,
+        0x00029, 0x00028, 0x00043, 0x00029, 0x00028, 0x00044, 0x00029, 0x00028,
+        0x00045, 0x00029, 0x00028, 0x00046, 0x00029, 0x00028, 0x00047, 0x00029,
+        0x00028, 0x00048, 0x00029, 0x00028, 0x00049, 0x00029, 0x00028, 0x0004a,
+        0x00029, 0x00028, 0x0004b, 0x00029, 0x00028, 0x0004c, 0x00029, 0x00028,
+        0x0004d, 0x00029, 0x00028, 0x0004e, 0x00029, 0x00028, 0x0004f, 0x00029,
+        0x00028, 0x00050, 0x00029, 0x00028, 0x00051, 0x00029, 0x00028, 0x00052,
+        0x00029, 0x00028, 0x00053, 0x00029, 0x00028, 0x00054, 0x00029, 0x00028,
+        0x00055, 0x00029, 0x00028, 0x00056, 0x00029, 0x00028, 0x00057, 0x00029,
+        0x00028, 0x00058, 0x00029, 0x00028, 0x00059, 0x00029, 0x00028, 0x0005a,
+        0x00029, 0x03014, 0x00053, 0x03015, 0x00043, 0x00044, 0x00057, 0x0005a,
+        0x00048, 0x00056, 0x00053, 0x00044, 0x00053, 0x00053, 0x00050, 0x00050,
+        0x00056, 0x00057, 0x00043, 0x0004d, 0x00043, 0x0004d, 0x00044, 0x0004d,
+        0x00052, 0x00044, 0x0004a, 0x0307b, 0x0304b, 0x030b3, 0x030b3, 0x05b57,
+        0x053cc, 0x089e3, 0x04ea4, 0x06620, 0x07121, 0x0524d, 0x05f8c, 0x065b0,
+        0x0521d, 0x07d42, 0x08ca9, 0x058f0, 0x05439, 0x06f14, 0x06295, 0x06355,
+        0x0904a, 0x06307, 0x06253, 0x07981, 0x07a7a, 0x05408, 0x06e80, 0x07533,
+        0x055b6, 0x0914d, 0x03014, 0x0672c, 0x03015, 0x03014, 0x04e09, 0x03015,
+        0x03014, 0x04e8c, 0x03015, 0x03014, 0x05b89, 0x03015, 0x03014, 0x070b9,
+        0x03015, 0x03014, 0x06253, 0x03015, 0x03014, 0x076d7, 0x03015, 0x03014,
+        0x052dd, 0x03015, 0x03014, 0x06557, 0x03015, 0x05f97, 0x053ef,
+    };
+
+    struct CompositionEntry {
+        uint32_t first;
+        uint32_t second;
+        uint32_t composite;
+    };
+
+    // Primary composites, sorted by (first, second).
+    inline constexpr CompositionEntry COMPOSITIONS[941] = {
+        {0x0003c, 0x00338, 0x0226e}, {0x0003d, 0x00338, 0x02260}, {0x0003e, 0x00338, 0x0226f},
+        {0x00041, 0x00300, 0x000c0}, {0x00041, 0x00301, 0x000c1}, {0x00041, 0x00302, 0x000c2},
+        {0x00041, 0x00303, 0x000c3}, {0x00041, 0x00304, 0x00100}, {0x00041, 0x00306, 0x00102},
+        {0x00041, 0x00307, 0x00226}, {0x00041, 0x00308, 0x000c4}, {0x00041, 0x00309, 0x01ea2},
+        {0x00041, 0x0030a, 0x000c5}, {0x00041, 0x0030c, 0x001cd}, {0x00041, 0x0030f, 0x00200},
+        {0x00041, 0x00311, 0x00202}, {0x00041, 0x00323, 0x01ea0}, {0x00041, 0x00325, 0x01e00},
+        {0x00041, 0x00328, 0x00104}, {0x00042, 0x00307, 0x01e02}, {0x00042, 0x00323, 0x01e04},
+        {0x00042, 0x00331, 0x01e06}, {0x00043, 0x00301, 0x00106}, {0x00043, 0x00302, 0x00108},
+        {0x00043, 0x00307, 0x0010a}, {0x00043, 0x0030c, 0x0010c}, {0x00043, 0x00327, 0x000c7},
+        {0x00044, 0x00307, 0x01e0a}, {0x00044, 0x0030c, 0x0010e}, {0x00044, 0x00323, 0x01e0c},
+        {0x00044, 0x00327, 0x01e10}, {0x00044, 0x0032d, 0x01e12}, {0x00044, 0x00331, 0x01e0e},
+        {0x00045, 0x00300, 0x000c8}, {0x00045, 0x00301, 0x000c9}, {0x00045, 0x00302, 0x000ca},
+        {0x00045, 0x00303, 0x01ebc}, {0x00045, 0x00304, 0x00112}, {0x00045, 0x00306, 0x00114},
+        {0x00045, 0x00307, 0x00116}, {0x00045, 0x00308, 0x000cb}, {0x00045, 0x00309, 0x01eba},
+        {0x00045, 0x0030c, 0x0011a}, {0x00045, 0x0030f, 0x00204}, {0x00045, 0x00311, 0x00206},
+        {0x00045, 0x00323, 0x01eb8}, {0x00045, 0x00327, 0x00228}, {0x00045, 0x00328, 0x00118},
+        {0x00045, 0x0032d, 0x01e18}, {0x00045, 0x00330, 0x01e1a}, {0x00046, 0x00307, 0x01e1e},
+        {0x00047, 0x00301, 0x001f4}, {0x00047, 0x00302, 0x0011c}, {0x00047, 0x00304, 0x01e20},
+        {0x00047, 0x00306, 0x0011e}, {0x00047, 0x00307, 0x00120}, {0x00047, 0x0030c, 0x001e6},
+        {0x00047, 0x00327, 0x00122}, {0x00048, 0x00302, 0x00124}, {0x00048, 0x00307, 0x01e22},
+        {0x00048, 0x00308, 0x01e26}, {0x00048, 0x0030c, 0x0021e}, {0x00048, 0x00323, 0x01e24},
+        {0x00048, 0x00327, 0x01e28}, {0x00048, 0x0032e, 0x01e2a}, {0x00049, 0x00300, 0x000cc},
+        {0x00049, 0x00301, 0x000cd}, {0x00049, 0x00302, 0x000ce}, {0x00049, 0x00303, 0x00128},
+        {0x00049, 0x00304, 0x0012a}, {0x00049, 0x00306, 0x0012c}, {0x00049, 0x00307, 0x00130},
+        {0x00049, 0x00308, 0x000cf}, {0x00049, 0x00309, 0x01ec8}, {0x00049, 0x0030c, 0x001cf},
+        {0x00049, 0x0030f, 0x00208}, {0x00049, 0x00311, 0x0020a}, {0x00049, 0x00323, 0x01eca},
+        {0x00049, 0x00328, 0x0012e}, {0x00049, 0x00330, 0x01e2c}, {0x0004a, 0x00302, 0x00134},
+        {0x0004b, 0x00301, 0x01e30}, {0x0004b, 0x0030c, 0x001e8}, {0x0004b, 0x00323, 0x01e32},
+        {0x0004b, 0x00327, 0x00136}, {0x0004b, 0x00331, 0x01e34}, {0x0004c, 0x00301, 0x00139},
+        {0x0004c, 0x0030c, 0x0013d}, {0x0004c, 0x00323, 0x01e36}, {0x0004c, 0x00327, 0x0013b},
+        {0x0004c, 0x0032d, 0x01e3c}, {0x0004c, 0x00331, 0x01e3a}, {0x0004d, 0x00301, 0x01e3e},
+        {0x0004d, 0x00307, 0x01e40}, {0x0004d, 0x00323, 0x01e42}, {0x0004e, 0x00300, 0x001f8},
+        {0x0004e, 0x00301, 0x00143}, {0x0004e, 0x00303, 0x000d1}, {0x0004e, 0x00307, 0x01e44},
+        {0x0004e, 0x0030c, 0x00147}, {0x0004e, 0x00323, 0x01e46}, {0x0004e, 0x00327, 0x00145},
+        {0x0004e, 0x0032d, 0x01e4a}, {0x0004e, 0x00331, 0x01e48}, {0x0004f, 0x00300, 0x000d2},
+        {0x0004f, 0x00301, 0x000d3}, {0x0004f, 0x00302, 0x000d4}, {0x0004f, 0x00303, 0x000d5},
+        {0x0004f, 0x00304, 0x0014c}, {0x0004f, 0x00306, 0x0014e}, {0x0004f, 0x00307, 0x0022e},
+        {0x0004f, 0x00308, 0x000d6}, {0x0004f, 0x00309, 0x01ece}, {0x0004f, 0x0030b, 0x00150},
+        {0x0004f, 0x0030c, 0x001d1}, {0x0004f, 0x0030f, 0x0020c}, {0x0004f, 0x00311, 0x0020e},
+        {0x0004f, 0x0031b, 0x001a0}, {0x0004f, 0x00323, 0x01ecc}, {0x0004f, 0x00328, 0x001ea},
+        {0x00050, 0x00301, 0x01e54}, {0x00050, 0x00307, 0x01e56}, {0x00052, 0x00301, 0x00154},
+        {0x00052, 0x00307, 0x01e58}, {0x00052, 0x0030c, 0x00158}, {0x00052, 0x0030f, 0x00210},
+        {0x00052, 0x00311, 0x00212}, {0x00052, 0x00323, 0x01e5a}, {0x00052, 0x00327, 0x00156},
+        {0x00052, 0x00331, 0x01e5e}, {0x00053, 0x00301, 0x0015a}, {0x00053, 0x00302, 0x0015c},
+        {0x00053, 0x00307, 0x01e60}, {0x00053, 0x0030c, 0x00160}, {0x00053, 0x00323, 0x01e62},
+        {0x00053, 0x00326, 0x00218}, {0x00053, 0x00327, 0x0015e}, {0x00054, 0x00307, 0x01e6a},
+        {0x00054, 0x0030c, 0x00164}, {0x00054, 0x00323, 0x01e6c}, {0x00054, 0x00326, 0x0021a},
+        {0x00054, 0x00327, 0x00162}, {0x00054, 0x0032d, 0x01e70}, {0x00054, 0x00331, 0x01e6e},
+        {0x00055, 0x00300, 0x000d9}, {0x00055, 0x00301, 0x000da}, {0x00055, 0x00302, 0x000db},
+        {0x00055, 0x00303, 0x00168}, {0x00055, 0x00304, 0x0016a}, {0x00055, 0x00306, 0x0016c},
+        {0x00055, 0x00308, 0x000dc}, {0x00055, 0x00309, 0x01ee6}, {0x00055, 0x0030a, 0x0016e},
+        {0x00055, 0x0030b, 0x00170}, {0x00055, 0x0030c, 0x001d3}, {0x00055, 0x0030f, 0x00214},
+        {0x00055, 0x00311, 0x00216}, {0x00055, 0x0031b, 0x001af}, {0x00055, 0x00323, 0x01ee4},
+        {0x00055, 0x00324, 0x01e72}, {0x00055, 0x00328, 0x00172}, {0x00055, 0x0032d, 0x01e76},
+        {0x00055, 0x00330, 0x01e74}, {0x00056, 0x00303, 0x01e7c}, {0x00056, 0x00323, 0x01e7e},
+        {0x00057, 0x00300, 0x01e80}, {0x00057, 0x00301, 0x01e82}, {0x00057, 0x00302, 0x00174},
+        {0x00057, 0x00307, 0x01e86}, {0x00057, 0x00308, 0x01e84}, {0x00057, 0x00323, 0x01e88},
+        {0x00058, 0x00307, 0x01e8a}, {0x00058, 0x00308, 0x01e8c}, {0x00059, 0x00300, 0x01ef2},
+        {0x00059, 0x00301, 0x000dd}, {0x00059, 0x00302, 0x00176}, {0x00059, 0x00303, 0x01ef8},
+        {0x00059, 0x00304, 0x00232}, {0x00059, 0x00307, 0x01e8e}, {0x00059, 0x00308, 0x00178},
+        {0x00059, 0x00309, 0x01ef6}, {0x00059, 0x00323, 0x01ef4}, {0x0005a, 0x00301, 0x00179},
+        {0x0005a, 0x00302, 0x01e90}, {0x0005a, 0x00307, 0x0017b}, {0x0005a, 0x0030c, 0x0017d},
+        {0x0005a, 0x00323, 0x01e92}, {0x0005a, 0x00331, 0x01e94}, {0x00061, 0x00300, 0x000e0},
+        {0x00061, 0x00301, 0x000e1}, {0x00061, 0x00302, 0x000e2}, {0x00061, 0x00303, 0x000e3},
+        {0x00061, 0x00304, 0x00101}, {0x00061, 0x00306, 0x00103}, {0x00061, 0x00307, 0x00227},
+        {0x00061, 0x00308, 0x000e4}, {0x00061, 0x00309, 0x01ea3}, {0x00061, 0x0030a, 0x000e5},
+        {0x00061, 0x0030c, 0x001ce}, {0x00061, 0x0030f, 0x00201}, {0x00061, 0x00311, 0x00203},
+        {0x00061, 0x00323, 0x01ea1}, {0x00061, 0x00325, 0x01e01}, {0x00061, 0x00328, 0x00105},
+        {0x00062, 0x00307, 0x01e03}, {0x00062, 0x00323, 0x01e05}, {0x00062, 0x00331, 0x01e07},
+        {0x00063, 0x00301, 0x00107}, {0x00063, 0x00302, 0x00109}, {0x00063, 0x00307, 0x0010b},
+        {0x00063, 0x0030c, 0x0010d}, {0x00063, 0x00327, 0x000e7}, {0x00064, 0x00307, 0x01e0b},
+        {0x00064, 0x0030c, 0x0010f}, {0x00064, 0x00323, 0x01e0d}, {0x00064, 0x00327, 0x01e11},
+        {0x00064, 0x0032d, 0x01e13}, {0x00064, 0x00331, 0x01e0f}, {0x00065, 0x00300, 0x000e8},
+        {0x00065, 0x00301, 0x000e9}, {0x00065, 0x00302, 0x000ea}, {0x00065, 0x00303, 0x01ebd},
+        {0x00065, 0x00304, 0x00113}, {0x00065, 0x00306, 0x00115}, {0x00065, 0x00307, 0x00117},
+        {0x00065, 0x00308, 0x000eb}, {0x00065, 0x00309, 0x01ebb}, {0x00065, 0x0030c, 0x0011b},
+        {0x00065, 0x0030f, 0x00205}, {0x00065, 0x00311, 0x00207}, {0x00065, 0x00323, 0x01eb9},
+        {0x00065, 0x00327, 0x00229}, {0x00065, 0x00328, 0x00119}, {0x00065, 0x0032d, 0x01e19},
+        {0x00065, 0x00330, 0x01e1b}, {0x00066, 0x00307, 0x01e1f}, {0x00067, 0x00301, 0x001f5},
+        {0x00067, 0x00302, 0x0011d}, {0x00067, 0x00304, 0x01e21}, {0x00067, 0x00306, 0x0011f},
+        {0x00067, 0x00307, 0x00121}, {0x00067, 0x0030c, 0x001e7}, {0x00067, 0x00327, 0x00123},
+        {0x00068, 0x00302, 0x00125}, {0x00068, 0x00307, 0x01e23}, {0x00068, 0x00308, 0x01e27},
+        {0x00068, 0x0030c, 0x0021f}, {0x00068, 0x00323, 0x01e25}, {0x00068, 0x00327, 0x01e29},
+        {0x00068, 0x0032e, 0x01e2b}, {0x00068, 0x00331, 0x01e96}, {0x00069, 0x00300, 0x000ec},
+        {0x00069, 0x00301, 0x000ed}, {0x00069, 0x00302, 0x000ee}, {0x00069, 0x00303, 0x00129},
+        {0x00069, 0x00304, 0x0012b}, {0x00069, 0x00306, 0x0012d}, {0x00069, 0x00308, 0x000ef},
+        {0x00069, 0x00309, 0x01ec9}, {0x00069, 0x0030c, 0x001d0}, {0x00069, 0x0030f, 0x00209},
+        {0x00069, 0x00311, 0x0020b}, {0x00069, 0x00323, 0x01ecb}, {0x00069, 0x00328, 0x0012f},
+        {0x00069, 0x00330, 0x01e2d}, {0x0006a, 0x00302, 0x00135}, {0x0006a, 0x0030c, 0x001f0},
+        {0x0006b, 0x00301, 0x01e31}, {0x0006b, 0x0030c, 0x001e9}, {0x0006b, 0x00323, 0x01e33},
+        {0x0006b, 0x00327, 0x00137}, {0x0006b, 0x00331, 0x01e35}, {0x0006c, 0x00301, 0x0013a},
+        {0x0006c, 0x0030c, 0x0013e}, {0x0006c, 0x00323, 0x01e37}, {0x0006c, 0x00327, 0x0013c},
+        {0x0006c, 0x0032d, 0x01e3d}, {0x0006c, 0x00331, 0x01e3b}, {0x0006d, 0x00301, 0x01e3f},
+        {0x0006d, 0x00307, 0x01e41}, {0x0006d, 0x00323, 0x01e43}, {0x0006e, 0x00300, 0x001f9},
+        {0x0006e, 0x00301, 0x00144}, {0x0006e, 0x00303, 0x000f1}, {0x0006e, 0x00307, 0x01e45},
+        {0x0006e, 0x0030c, 0x00148}, {0x0006e, 0x00323, 0x01e47}, {0x0006e, 0x00327, 0x00146},
+        {0x0006e, 0x0032d, 0x01e4b}, {0x0006e, 0x00331, 0x01e49}, {0x0006f, 0x00300, 0x000f2},
+        {0x0006f, 0x00301, 0x000f3}, {0x0006f, 0x00302, 0x000f4}, {0x0006f, 0x00303, 0x000f5},
+        {0x0006f, 0x00304, 0x0014d}, {0x0006f, 0x00306, 0x0014f}, {0x0006f, 0x00307, 0x0022f},
+        {0x0006f, 0x00308, 0x000f6}, {0x0006f, 0x00309, 0x01ecf}, {0x0006f, 0x0030b, 0x00151},
+        {0x0006f, 0x0030c, 0x001d2}, {0x0006f, 0x0030f, 0x0020d}, {0x0006f, 0x00311, 0x0020f},
+        {0x0006f, 0x0031b, 0x001a1}, {0x0006f, 0x00323, 0x01ecd}, {0x0006f, 0x00328, 0x001eb},
+        {0x00070, 0x00301, 0x01e55}, {0x00070, 0x00307, 0x01e57}, {0x00072, 0x00301, 0x00155},
+        {0x00072, 0x00307, 0x01e59}, {0x00072, 0x0030c, 0x00159}, {0x00072, 0x0030f, 0x00211},
+        {0x00072, 0x00311, 0x00213}, {0x00072, 0x00323, 0x01e5b}, {0x00072, 0x00327, 0x00157},
+        {0x00072, 0x00331, 0x01e5f}, {0x00073, 0x00301, 0x0015b}, {0x00073, 0x00302, 0x0015d},
+        {0x00073, 0x00307, 0x01e61}, {0x00073, 0x0030c, 0x00161}, {0x00073, 0x00323, 0x01e63},
+        {0x00073, 0x00326, 0x00219}, {0x00073, 0x00327, 0x0015f}, {0x00074, 0x00307, 0x01e6b},
+        {0x00074, 0x00308, 0x01e97}, {0x00074, 0x0030c, 0x00165}, {0x00074, 0x00323, 0x01e6d},
+        {0x00074, 0x00326, 0x0021b}, {0x00074, 0x00327, 0x00163}, {0x00074, 0x0032d, 0x01e71},
+        {0x00074, 0x00331, 0x01e6f}, {0x00075, 0x00300, 0x000f9}, {0x00075, 0x00301, 0x000fa},
+        {0x00075, 0x00302, 0x000fb}, {0x00075, 0x00303, 0x00169}, {0x00075, 0x00304, 0x0016b},
+        {0x00075, 0x00306, 0x0016d}, {0x00075, 0x00308, 0x000fc}, {0x00075, 0x00309, 0x01ee7},
+        {0x00075, 0x0030a, 0x0016f}, {0x00075, 0x0030b, 0x00171}, {0x00075, 0x0030c, 0x001d4},
+        {0x00075, 0x0030f, 0x00215}, {0x00075, 0x00311, 0x00217}, {0x00075, 0x0031b, 0x001b0},
+        {0x00075, 0x00323, 0x01ee5}, {0x00075, 0x00324, 0x01e73}, {0x00075, 0x00328, 0x00173},
+        {0x00075, 0x0032d, 0x01e77}, {0x00075, 0x00330, 0x01e75}, {0x00076, 0x00303, 0x01e7d},
+        {0x00076, 0x00323, 0x01e7f}, {0x00077, 0x00300, 0x01e81}, {0x00077, 0x00301, 0x01e83},
+        {0x00077, 0x00302, 0x00175}, {0x00077, 0x00307, 0x01e87}, {0x00077, 0x00308, 0x01e85},
+        {0x00077, 0x0030a, 0x01e98}, {0x00077, 0x00323, 0x01e89}, {0x00078, 0x00307, 0x01e8b},
+        {0x00078, 0x00308, 0x01e8d}, {0x00079, 0x00300, 0x01ef3}, {0x00079, 0x00301, 0x000fd},
+        {0x00079, 0x00302, 0x00177}, {0x00079, 0x00303, 0x01ef9}, {0x00079, 0x00304, 0x00233},
+        {0x00079, 0x00307, 0x01e8f}, {0x00079, 0x00308, 0x000ff}, {0x00079, 0x00309, 0x01ef7},
+        {0x00079, 0x0030a, 0x01e99}, {0x00079, 0x00323, 0x01ef5}, {0x0007a, 0x00301, 0x0017a},
+        {0x0007a, 0x00302, 0x01e91}, {0x0007a, 0x00307, 0x0017c}, {0x0007a, 0x0030c, 0x0017e},
+        {0x0007a, 0x00323, 0x01e93}, {0x0007a, 0x00331, 0x01e95}, {0x000a8, 0x00300, 0x01fed},
+        {0x000a8, 0x00301, 0x00385}, {0x000a8, 0x00342, 0x01fc1}, {0x000c2, 0x00300, 0x01ea6},
+        {0x000c2, 0x00301, 0x01ea4}, {0x000c2, 0x00303, 0x01eaa}, {0x000c2, 0x00309, 0x01ea8},
+        {0x000c4, 0x00304, 0x001de}, {0x000c5, 0x00301, 0x001fa}, {0x000c6, 0x00301, 0x001fc},
+        {0x000c6, 0x00304, 0x001e2}, {0x000c7, 0x00301, 0x01e08}, {0x000ca, 0x00300, 0x01ec0},
+        {0x000ca, 0x00301, 0x01ebe}, {0x000ca, 0x00303, 0x01ec4}, {0x000ca, 0x00309, 0x01ec2},
+        {0x000cf, 0x00301, 0x01e2e}, {0x000d4, 0x00300, 0x01ed2}, {0x000d4, 0x00301, 0x01ed0},
+        {0x000d4, 0x00303, 0x01ed6}, {0x000d4, 0x00309, 0x01ed4}, {0x000d5, 0x00301, 0x01e4c},
+        {0x000d5, 0x00304, 0x0022c}, {0x000d5, 0x00308, 0x01e4e}, {0x000d6, 0x00304, 0x0022a},
+        {0x000d8, 0x00301, 0x001fe}, {0x000dc, 0x00300, 0x001db}, {0x000dc, 0x00301, 0x001d7},
+        {0x000dc, 0x00304, 0x001d5}, {0x000dc, 0x0030c, 0x001d9}, {0x000e2, 0x00300, 0x01ea7},
+        {0x000e2, 0x00301, 0x01ea5}, {0x000e2, 0x00303, 0x01eab}, {0x000e2, 0x00309, 0x01ea9},
+        {0x000e4, 0x00304, 0x001df}, {0x000e5, 0x00301, 0x001fb}, {0x000e6, 0x00301, 0x001fd},
+        {0x000e6, 0x00304, 0x001e3}, {0x000e7, 0x00301, 0x01e09}, {0x000ea, 0x00300, 0x01ec1},
+        {0x000ea, 0x00301, 0x01ebf}, {0x000ea, 0x00303, 0x01ec5}, {0x000ea, 0x00309, 0x01ec3},
+        {0x000ef, 0x00301, 0x01e2f}, {0x000f4, 0x00300, 0x01ed3}, {0x000f4, 0x00301, 0x01ed1},
+        {0x000f4, 0x00303, 0x01ed7}, {0x000f4, 0x00309, 0x01ed5}, {0x000f5, 0x00301, 0x01e4d},
+        {0x000f5, 0x00304, 0x0022d}, {0x000f5, 0x00308, 0x01e4f}, {0x000f6, 0x00304, 0x0022b},
+        {0x000f8, 0x00301, 0x001ff}, {0x000fc, 0x00300, 0x001dc}, {0x000fc, 0x00301, 0x001d8},
+        {0x000fc, 0x00304, 0x001d6}, {0x000fc, 0x0030c, 0x001da}, {0x00102, 0x00300, 0x01eb0},
+        {0x00102, 0x00301, 0x01eae}, {0x00102, 0x00303, 0x01eb4}, {0x00102, 0x00309, 0x01eb2},
+        {0x00103, 0x00300, 0x01eb1}, {0x00103, 0x00301, 0x01eaf}, {0x00103, 0x00303, 0x01eb5},
+        {0x00103, 0x00309, 0x01eb3}, {0x00112, 0x00300, 0x01e14}, {0x00112, 0x00301, 0x01e16},
+        {0x00113, 0x00300, 0x01e15}, {0x00113, 0x00301, 0x01e17}, {0x0014c, 0x00300, 0x01e50},
+        {0x0014c, 0x00301, 0x01e52}, {0x0014d, 0x00300, 0x01e51}, {0x0014d, 0x00301, 0x01e53},
+        {0x0015a, 0x00307, 0x01e64}, {0x0015b, 0x00307, 0x01e65}, {0x00160, 0x00307, 0x01e66},
+        {0x00161, 0x00307, 0x01e67}, {0x00168, 0x00301, 0x01e78}, {0x00169, 0x00301, 0x01e79},
+        {0x0016a, 0x00308, 0x01e7a}, {0x0016b, 0x00308, 0x01e7b}, {0x0017f, 0x00307, 0x01e9b},
+        {0x001a0, 0x00300, 0x01edc}, {0x001a0, 0x00301, 0x01eda}, {0x001a0, 0x00303, 0x01ee0},
+        {0x001a0, 0x00309, 0x01ede}, {0x001a0, 0x00323, 0x01ee2}, {0x001a1, 0x00300, 0x01edd},
+        {0x001a1, 0x00301, 0x01edb}, {0x001a1, 0x00303, 0x01ee1}, {0x001a1, 0x00309, 0x01edf},
+        {0x001a1, 0x00323, 0x01ee3}, {0x001af, 0x00300, 0x01eea}, {0x001af, 0x00301, 0x01ee8},
+        {0x001af, 0x00303, 0x01eee}, {0x001af, 0x00309, 0x01eec}, {0x001af, 0x00323, 0x01ef0},
+        {0x001b0, 0x00300, 0x01eeb}, {0x001b0, 0x00301, 0x01ee9}, {0x001b0, 0x00303, 0x01eef},
+        {0x001b0, 0x00309, 0x01eed}, {0x001b0, 0x00323, 0x01ef1}, {0x001b7, 0x0030c, 0x001ee},
+        {0x001ea, 0x00304, 0x001ec}, {0x001eb, 0x00304, 0x001ed}, {0x00226, 0x00304, 0x001e0},
+        {0x00227, 0x00304, 0x001e1}, {0x00228, 0x00306, 0x01e1c}, {0x00229, 0x00306, 0x01e1d},
+        {0x0022e, 0x00304, 0x00230}, {0x0022f, 0x00304, 0x00231}, {0x00292, 0x0030c, 0x001ef},
+        {0x00391, 0x00300, 0x01fba}, {0x00391, 0x00301, 0x00386}, {0x00391, 0x00304, 0x01fb9},
+        {0x00391, 0x00306, 0x01fb8}, {0x00391, 0x00313, 0x01f08}, {0x00391, 0x00314, 0x01f09},
+        {0x00391, 0x00345, 0x01fbc}, {0x00395, 0x00300, 0x01fc8}, {0x00395, 0x00301, 0x00388},
+        {0x00395, 0x00313, 0x01f18}, {0x00395, 0x00314, 0x01f19}, {0x00397, 0x00300, 0x01fca},
+        {0x00397, 0x00301, 0x00389}, {0x00397, 0x00313, 0x01f28}, {0x00397, 0x00314, 0x01f29},
+        {0x00397, 0x00345, 0x01fcc}, {0x00399, 0x00300, 0x01fda}, {0x00399, 0x00301, 0x0038a},
+        {0x00399, 0x00304, 0x01fd9}, {0x00399, 0x00306, 0x01fd8}, {0x00399, 0x00308, 0x003aa},
+        {0x00399, 0x00313, 0x01f38}, {0x00399, 0x00314, 0x01f39}, {0x0039f, 0x00300, 0x01ff8},
+        {0x0039f, 0x00301, 0x0038c}, {0x0039f, 0x00313, 0x01f48}, {0x0039f, 0x00314, 0x01f49},
+        {0x003a1, 0x00314, 0x01fec}, {0x003a5, 0x00300, 0x01fea}, {0x003a5, 0x00301, 0x0038e},
+        {0x003a5, 0x00304, 0x01fe9}, {0x003a5, 0x00306, 0x01fe8}, {0x003a5, 0x00308, 0x003ab},
+        {0x003a5, 0x00314, 0x01f59}, {0x003a9, 0x00300, 0x01ffa}, {0x003a9, 0x00301, 0x0038f},
+        {0x003a9, 0x00313, 0x01f68}, {0x003a9, 0x00314, 0x01f69}, {0x003a9, 0x00345, 0x01ffc},
+        {0x003ac, 0x00345, 0x01fb4}, {0x003ae, 0x00345, 0x01fc4}, {0x003b1, 0x00300, 0x01f70},
+        {0x003b1, 0x00301, 0x003ac}, {0x003b1, 0x00304, 0x01fb1}, {0x003b1, 0x00306, 0x01fb0},
+        {0x003b1, 0x00313, 0x01f00}, {0x003b1, 0x00314, 0x01f01}, {0x003b1, 0x00342, 0x01fb6},
+        {0x003b1, 0x00345, 0x01fb3}, {0x003b5, 0x00300, 0x01f72}, {0x003b5, 0x00301, 0x003ad},
+        {0x003b5, 0x00313, 0x01f10}, {0x003b5, 0x00314, 0x01f11}, {0x003b7, 0x00300, 0x01f74},
+        {0x003b7, 0x00301, 0x003ae}, {0x003b7, 0x00313, 0x01f20}, {0x003b7, 0x00314, 0x01f21},
+        {0x003b7, 0x00342, 0x01fc6}, {0x003b7, 0x00345, 0x01fc3}, {0x003b9, 0x00300, 0x01f76},
+        {0x003b9, 0x00301, 0x003af}, {0x003b9, 0x00304, 0x01fd1}, {0x003b9, 0x00306, 0x01fd0},
+        {0x003b9, 0x00308, 0x003ca}, {0x003b9, 0x00313, 0x01f30}, {0x003b9, 0x00314, 0x01f31},
+        {0x003b9, 0x00342, 0x01fd6}, {0x003bf, 0x00300, 0x01f78}, {0x003bf, 0x00301, 0x003cc},
+        {0x003bf, 0x00313, 0x01f40}, {0x003bf, 0x00314, 0x01f41}, {0x003c1, 0x00313, 0x01fe4},
+        {0x003c1, 0x00314, 0x01fe5}, {0x003c5, 0x00300, 0x01f7a}, {0x003c5, 0x00301, 0x003cd},
+        {0x003c5, 0x00304, 0x01fe1}, {0x003c5, 0x00306, 0x01fe0}, {0x003c5, 0x00308, 0x003cb},
+        {0x003c5, 0x00313, 0x01f50}, {0x003c5, 0x00314, 0x01f51}, {0x003c5, 0x00342, 0x01fe6},
+        {0x003c9, 0x00300, 0x01f7c}, {0x003c9, 0x00301, 0x003ce}, {0x003c9, 0x00313, 0x01f60},
+        {0x003c9, 0x00314, 0x01f61}, {0x003c9, 0x00342, 0x01ff6}, {0x003c9, 0x00345, 0x01ff3},
+        {0x003ca, 0x00300, 0x01fd2}, {0x003ca, 0x00301, 0x00390}, {0x003ca, 0x00342, 0x01fd7},
+        {0x003cb, 0x00300, 0x01fe2}, {0x003cb, 0x00301, 0x003b0}, {0x003cb, 0x00342, 0x01fe7},
+        {0x003ce, 0x00345, 0x01ff4}, {0x003d2, 0x00301, 0x003d3}, {0x003d2, 0x00308, 0x003d4},
+        {0x00406, 0x00308, 0x00407}, {0x00410, 0x00306, 0x004d0}, {0x00410, 0x00308, 0x004d2},
+        {0x00413, 0x00301, 0x00403}, {0x00415, 0x00300, 0x00400}, {0x00415, 0x00306, 0x004d6},
+        {0x00415, 0x00308, 0x00401}, {0x00416, 0x00306, 0x004c1}, {0x00416, 0x00308, 0x004dc},
+        {0x00417, 0x00308, 0x004de}, {0x00418, 0x00300, 0x0040d}, {0x00418, 0x00304, 0x004e2},
+        {0x00418, 0x00306, 0x00419}, {0x00418, 0x00308, 0x004e4}, {0x0041a, 0x00301, 0x0040c},
+        {0x0041e, 0x00308, 0x004e6}, {0x00423, 0x00304, 0x004ee}, {0x00423, 0x00306, 0x0040e},
+        {0x00423, 0x00308, 0x004f0}, {0x00423, 0x0030b, 0x004f2}, {0x00427, 0x00308, 0x004f4},
+        {0x0042b, 0x00308, 0x004f8}, {0x0042d, 0x00308, 0x004ec}, {0x00430, 0x00306, 0x004d1},
+        {0x00430, 0x00308, 0x004d3}, {0x00433, 0x00301, 0x00453}, {0x00435, 0x00300, 0x00450},
+        {0x00435, 0x00306, 0x004d7}, {0x00435, 0x00308, 0x00451}, {0x00436, 0x00306, 0x004c2},
+        {0x00436, 0x00308, 0x004dd}, {0x00437, 0x00308, 0x004df}, {0x00438, 0x00300, 0x0045d},
+        {0x00438, 0x00304, 0x004e3}, {0x00438, 0x00306, 0x00439}, {0x00438, 0x00308, 0x004e5},
+        {0x0043a, 0x00301, 0x0045c}, {0x0043e, 0x00308, 0x004e7}, {0x00443, 0x00304, 0x004ef},
+        {0x00443, 0x00306, 0x0045e}, {0x00443, 0x00308, 0x004f1}, {0x00443, 0x0030b, 0x004f3},
+        {0x00447, 0x00308, 0x004f5}, {0x0044b, 0x00308, 0x004f9}, {0x0044d, 0x00308, 0x004ed},
+        {0x00456, 0x00308, 0x00457}, {0x00474, 0x0030f, 0x00476}, {0x00475, 0x0030f, 0x00477},
+        {0x004d8, 0x00308, 0x004da}, {0x004d9, 0x00308, 0x004db}, {0x004e8, 0x00308, 0x004ea},
+        {0x004e9, 0x00308, 0x004eb}, {0x00627, 0x00653, 0x00622}, {0x00627, 0x00654, 0x00623},
+        {0x00627, 0x00655, 0x00625}, {0x00648, 0x00654, 0x00624}, {0x0064a, 0x00654, 0x00626},
+        {0x006c1, 0x00654, 0x006c2}, {0x006d2, 0x00654, 0x006d3}, {0x006d5, 0x00654, 0x006c0},
+        {0x00928, 0x0093c, 0x00929}, {0x00930, 0x0093c, 0x00931}, {0x00933, 0x0093c, 0x00934},
+        {0x009c7, 0x009be, 0x009cb}, {0x009c7, 0x009d7, 0x009cc}, {0x00b47, 0x00b3e, 0x00b4b},
+        {0x00b47, 0x00b56, 0x00b48}, {0x00b47, 0x00b57, 0x00b4c}, {0x00b92, 0x00bd7, 0x00b94},
+        {0x00bc6, 0x00bbe, 0x00bca}, {0x00bc6, 0x00bd7, 0x00bcc}, {0x00bc7, 0x00bbe, 0x00bcb},
+        {0x00c46, 0x00c56, 0x00c48}, {0x00cbf, 0x00cd5, 0x00cc0}, {0x00cc6, 0x00cc2, 0x00cca},
+        {0x00cc6, 0x00cd5, 0x00cc7}, {0x00cc6, 0x00cd6, 0x00cc8}, {0x00cca, 0x00cd5, 0x00ccb},
+        {0x00d46, 0x00d3e, 0x00d4a}, {0x00d46, 0x00d57, 0x00d4c}, {0x00d47, 0x00d3e, 0x00d4b},
+        {0x00dd9, 0x00dca, 0x00dda}, {0x00dd9, 0x00dcf, 0x00ddc}, {0x00dd9, 0x00ddf, 0x00dde},
+        {0x00ddc, 0x00dca, 0x00ddd}, {0x01025, 0x0102e, 0x01026}, {0x01b05, 0x01b35, 0x01b06},
+        {0x01b07, 0x01b35, 0x01b08}, {0x01b09, 0x01b35, 0x01b0a}, {0x01b0b, 0x01b35, 0x01b0c},
+        {0x01b0d, 0x01b35, 0x01b0e}, {0x01b11, 0x01b35, 0x01b12}, {0x01b3a, 0x01b35, 0x01b3b},
+        {0x01b3c, 0x01b35, 0x01b3d}, {0x01b3e, 0x01b35, 0x01b40}, {0x01b3f, 0x01b35, 0x01b41},
+        {0x01b42, 0x01b35, 0x01b43}, {0x01e36, 0x00304, 0x01e38}, {0x01e37, 0x00304, 0x01e39},
+        {0x01e5a, 0x00304, 0x01e5c}, {0x01e5b, 0x00304, 0x01e5d}, {0x01e62, 0x00307, 0x01e68},
+        {0x01e63, 0x00307, 0x01e69}, {0x01ea0, 0x00302, 0x01eac}, {0x01ea0, 0x00306, 0x01eb6},
+        {0x01ea1, 0x00302, 0x01ead}, {0x01ea1, 0x00306, 0x01eb7}, {0x01eb8, 0x00302, 0x01ec6},
+        {0x01eb9, 0x00302, 0x01ec7}, {0x01ecc, 0x00302, 0x01ed8}, {0x01ecd, 0x00302, 0x01ed9},
+        {0x01f00, 0x00300, 0x01f02}, {0x01f00, 0x00301, 0x01f04}, {0x01f00, 0x00342, 0x01f06},
+        {0x01f00, 0x00345, 0x01f80}, {0x01f01, 0x00300, 0x01f03}, {0x01f01, 0x00301, 0x01f05},
+        {0x01f01, 0x00342, 0x01f07}, {0x01f01, 0x00345, 0x01f81}, {0x01f02, 0x00345, 0x01f82},
+        {0x01f03, 0x00345, 0x01f83}, {0x01f04, 0x00345, 0x01f84}, {0x01f05, 0x00345, 0x01f85},
+        {0x01f06, 0x00345, 0x01f86}, {0x01f07, 0x00345, 0x01f87}, {0x01f08, 0x00300, 0x01f0a},
+        {0x01f08, 0x00301, 0x01f0c}, {0x01f08, 0x00342, 0x01f0e}, {0x01f08, 0x00345, 0x01f88},
+        {0x01f09, 0x00300, 0x01f0b}, {0x01f09, 0x00301, 0x01f0d}, {0x01f09, 0x00342, 0x01f0f},
+        {0x01f09, 0x00345, 0x01f89}, {0x01f0a, 0x00345, 0x01f8a}, {0x01f0b, 0x00345, 0x01f8b},
+        {0x01f0c, 0x00345, 0x01f8c}, {0x01f0d, 0x00345, 0x01f8d}, {0x01f0e, 0x00345, 0x01f8e},
+        {0x01f0f, 0x00345, 0x01f8f}, {0x01f10, 0x00300, 0x01f12}, {0x01f10, 0x00301, 0x01f14},
+        {0x01f11, 0x00300, 0x01f13}, {0x01f11, 0x00301, 0x01f15}, {0x01f18, 0x00300, 0x01f1a},
+        {0x01f18, 0x00301, 0x01f1c}, {0x01f19, 0x00300, 0x01f1b}, {0x01f19, 0x00301, 0x01f1d},
+        {0x01f20, 0x00300, 0x01f22}, {0x01f20, 0x00301, 0x01f24}, {0x01f20, 0x00342, 0x01f26},
+        {0x01f20, 0x00345, 0x01f90}, {0x01f21, 0x00300, 0x01f23}, {0x01f21, 0x00301, 0x01f25},
+        {0x01f21, 0x00342, 0x01f27}, {0x01f21, 0x00345, 0x01f91}, {0x01f22, 0x00345, 0x01f92},
+        {0x01f23, 0x00345, 0x01f93}, {0x01f24, 0x00345, 0x01f94}, {0x01f25, 0x00345, 0x01f95},
+        {0x01f26, 0x00345, 0x01f96}, {0x01f27, 0x00345, 0x01f97}, {0x01f28, 0x00300, 0x01f2a},
+        {0x01f28, 0x00301, 0x01f2c}, {0x01f28, 0x00342, 0x01f2e}, {0x01f28, 0x00345, 0x01f98},
+        {0x01f29, 0x00300, 0x01f2b}, {0x01f29, 0x00301, 0x01f2d}, {0x01f29, 0x00342, 0x01f2f},
+        {0x01f29, 0x00345, 0x01f99}, {0x01f2a, 0x00345, 0x01f9a}, {0x01f2b, 0x00345, 0x01f9b},
+        {0x01f2c, 0x00345, 0x01f9c}, {0x01f2d, 0x00345, 0x01f9d}, {0x01f2e, 0x00345, 0x01f9e},
+        {0x01f2f, 0x00345, 0x01f9f}, {0x01f30, 0x00300, 0x01f32}, {0x01f30, 0x00301, 0x01f34},
+        {0x01f30, 0x00342, 0x01f36}, {0x01f31, 0x00300, 0x01f33}, {0x01f31, 0x00301, 0x01f35},
+        {0x01f31, 0x00342, 0x01f37}, {0x01f38, 0x00300, 0x01f3a}, {0x01f38, 0x00301, 0x01f3c},
+        {0x01f38, 0x00342, 0x01f3e}, {0x01f39, 0x00300, 0x01f3b}, {0x01f39, 0x00301, 0x01f3d},
+        {0x01f39, 0x00342, 0x01f3f}, {0x01f40, 0x00300, 0x01f42}, {0x01f40, 0x00301, 0x01f44},
+        {0x01f41, 0x00300, 0x01f43}, {0x01f41, 0x00301, 0x01f45}, {0x01f48, 0x00300, 0x01f4a},
+        {0x01f48, 0x00301, 0x01f4c}, {0x01f49, 0x00300, 0x01f4b}, {0x01f49, 0x00301, 0x01f4d},
+        {0x01f50, 0x00300, 0x01f52}, {0x01f50, 0x00301, 0x01f54}, {0x01f50, 0x00342, 0x01f56},
+        {0x01f51, 0x00300, 0x01f53}, {0x01f51, 0x00301, 0x01f55}, {0x01f51, 0x00342, 0x01f57},
+        {0x01f59, 0x00300, 0x01f5b}, {0x01f59, 0x00301, 0x01f5d}, {0x01f59, 0x00342, 0x01f5f},
+        {0x01f60, 0x00300, 0x01f62}, {0x01f60, 0x00301, 0x01f64}, {0x01f60, 0x00342, 0x01f66},
+        {0x01f60, 0x00345, 0x01fa0}, {0x01f61, 0x00300, 0x01f63}, {0x01f61, 0x00301, 0x01f65},
+        {0x01f61, 0x00342, 0x01f67}, {0x01f61, 0x00345, 0x01fa1}, {0x01f62, 0x00345, 0x01fa2},
+        {0x01f63, 0x00345, 0x01fa3}, {0x01f64, 0x00345, 0x01fa4}, {0x01f65, 0x00345, 0x01fa5},
+        {0x01f66, 0x00345, 0x01fa6}, {0x01f67, 0x00345, 0x01fa7}, {0x01f68, 0x00300, 0x01f6a},
+        {0x01f68, 0x00301, 0x01f6c}, {0x01f68, 0x00342, 0x01f6e}, {0x01f68, 0x00345, 0x01fa8},
+        {0x01f69, 0x00300, 0x01f6b}, {0x01f69, 0x00301, 0x01f6d}, {0x01f69, 0x00342, 0x01f6f},
+        {0x01f69, 0x00345, 0x01fa9}, {0x01f6a, 0x00345, 0x01faa}, {0x01f6b, 0x00345, 0x01fab},
+        {0x01f6c, 0x00345, 0x01fac}, {0x01f6d, 0x00345, 0x01fad}, {0x01f6e, 0x00345, 0x01fae},
+        {0x01f6f, 0x00345, 0x01faf}, {0x01f70, 0x00345, 0x01fb2}, {0x01f74, 0x00345, 0x01fc2},
+        {0x01f7c, 0x00345, 0x01ff2}, {0x01fb6, 0x00345, 0x01fb7}, {0x01fbf, 0x00300, 0x01fcd},
+        {0x01fbf, 0x00301, 0x01fce}, {0x01fbf, 0x00342, 0x01fcf}, {0x01fc6, 0x00345, 0x01fc7},
+        {0x01ff6, 0x00345, 0x01ff7}, {0x01ffe, 0x00300, 0x01fdd}, {0x01ffe, 0x00301, 0x01fde},
+        {0x01ffe, 0x00342, 0x01fdf}, {0x02190, 0x00338, 0x0219a}, {0x02192, 0x00338, 0x0219b},
+        {0x02194, 0x00338, 0x021ae}, {0x021d0, 0x00338, 0x021cd}, {0x021d2, 0x00338, 0x021cf},
+        {0x021d4, 0x00338, 0x021ce}, {0x02203, 0x00338, 0x02204}, {0x02208, 0x00338, 0x02209},
+        {0x0220b, 0x00338, 0x0220c}, {0x02223, 0x00338, 0x02224}, {0x02225, 0x00338, 0x02226},
+        {0x0223c, 0x00338, 0x02241}, {0x02243, 0x00338, 0x02244}, {0x02245, 0x00338, 0x02247},
+        {0x02248, 0x00338, 0x02249}, {0x0224d, 0x00338, 0x0226d}, {0x02261, 0x00338, 0x02262},
+        {0x02264, 0x00338, 0x02270}, {0x02265, 0x00338, 0x02271}, {0x02272, 0x00338, 0x02274},
+        {0x02273, 0x00338, 0x02275}, {0x02276, 0x00338, 0x02278}, {0x02277, 0x00338, 0x02279},
+        {0x0227a, 0x00338, 0x02280}, {0x0227b, 0x00338, 0x02281}, {0x0227c, 0x00338, 0x022e0},
+        {0x0227d, 0x00338, 0x022e1}, {0x02282, 0x00338, 0x02284}, {0x02283, 0x00338, 0x02285},
+        {0x02286, 0x00338, 0x02288}, {0x02287, 0x00338, 0x02289}, {0x02291, 0x00338, 0x022e2},
+        {0x02292, 0x00338, 0x022e3}, {0x022a2, 0x00338, 0x022ac}, {0x022a8, 0x00338, 0x022ad},
+        {0x022a9, 0x00338, 0x022ae}, {0x022ab, 0x00338, 0x022af}, {0x022b2, 0x00338, 0x022ea},
+        {0x022b3, 0x00338, 0x022eb}, {0x022b4, 0x00338, 0x022ec}, {0x022b5, 0x00338, 0x022ed},
+        {0x03046, 0x03099, 0x03094}, {0x0304b, 0x03099, 0x0304c}, {0x0304d, 0x03099, 0x0304e},
+        {0x0304f, 0x03099, 0x03050}, {0x03051, 0x03099, 0x03052}, {0x03053, 0x03099, 0x03054},
+        {0x03055, 0x03099, 0x03056}, {0x03057, 0x03099, 0x03058}, {0x03059, 0x03099, 0x0305a},
+        {0x0305b, 0x03099, 0x0305c}, {0x0305d, 0x03099, 0x0305e}, {0x0305f, 0x03099, 0x03060},
+        {0x03061, 0x03099, 0x03062}, {0x03064, 0x03099, 0x03065}, {0x03066, 0x03099, 0x03067},
+        {0x03068, 0x03099, 0x03069}, {0x0306f, 0x03099, 0x03070}, {0x0306f, 0x0309a, 0x03071},
+        {0x03072, 0x03099, 0x03073}, {0x03072, 0x0309a, 0x03074}, {0x03075, 0x03099, 0x03076},
+        {0x03075, 0x0309a, 0x03077}, {0x03078, 0x03099, 0x03079}, {0x03078, 0x0309a, 0x0307a},
+        {0x0307b, 0x03099, 0x0307c}, {0x0307b, 0x0309a, 0x0307d}, {0x0309d, 0x03099, 0x0309e},
+        {0x030a6, 0x03099, 0x030f4}, {0x030ab, 0x03099, 0x030ac}, {0x030ad, 0x03099, 0x030ae},
+        {0x030af, 0x03099, 0x030b0}, {0x030b1, 0x03099, 0x030b2}, {0x030b3, 0x03099, 0x030b4},
+        {0x030b5, 0x03099, 0x030b6}, {0x030b7, 0x03099, 0x030b8}, {0x030b9, 0x03099, 0x030ba},
+        {0x030bb, 0x03099, 0x030bc}, {0x030bd, 0x03099, 0x030be}, {0x030bf, 0x03099, 0x030c0},
+        {0x030c1, 0x03099, 0x030c2}, {0x030c4, 0x03099, 0x030c5}, {0x030c6, 0x03099, 0x030c7},
+        {0x030c8, 0x03099, 0x030c9}, {0x030cf, 0x03099, 0x030d0}, {0x030cf, 0x0309a, 0x030d1},
+        {0x030d2, 0x03099, 0x030d3}, {0x030d2, 0x0309a, 0x030d4}, {0x030d5, 0x03099, 0x030d6},
+        {0x030d5, 0x0309a, 0x030d7}, {0x030d8, 0x03099, 0x030d9}, {0x030d8, 0x0309a, 0x030da},
+        {0x030db, 0x03099, 0x030dc}, {0x030db, 0x0309a, 0x030dd}, {0x030ef, 0x03099, 0x030f7},
+        {0x030f0, 0x03099, 0x030f8}, {0x030f1, 0x03099, 0x030f9}, {0x030f2, 0x03099, 0x030fa},
+        {0x030fd, 0x03099, 0x030fe}, {0x11099, 0x110ba, 0x1109a}, {0x1109b, 0x110ba, 0x1109c},
+        {0x110a5, 0x110ba, 0x110ab}, {0x11131, 0x11127, 0x1112e}, {0x11132, 0x11127, 0x1112f},
+        {0x11347, 0x1133e, 0x1134b}, {0x11347, 0x11357, 0x1134c}, {0x114b9, 0x114b0, 0x114bc},
+        {0x114b9, 0x114ba, 0x114bb}, {0x114b9, 0x114bd, 0x114be}, {0x115b8, 0x115af, 0x115ba},
+        {0x115b9, 0x115af, 0x115bb}, {0x11935, 0x11930, 0x11938},
+    };
+} // namespace detail
+} // namespace gc
+
+#endif // __GENIUS_C_UTF8_NORMALIZATION_TABLES__
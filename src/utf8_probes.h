@@ -0,0 +1,88 @@
+#ifndef __GENIUS_C_UTF8_PROBES__
+#define __GENIUS_C_UTF8_PROBES__
+
+#include <cstddef>
+
+/*
+** Optional USDT (user-level statically defined tracing) probes at the entry
+** and exit of the bulk APIs, for perf, bpftrace and SystemTap. They are off
+** unless GC_UTF8_USDT is defined. Building them in needs <sys/sdt.h> (eg.
+** from systemtap-sdt-dev) at compile time only: a probe is a nop and an ELF
+** note, so nothing is linked or loaded at run time, and a probe that no
+** tracer is attached to costs about as much as the nop. When off, the probe
+** scope is empty and compiles away.
+**
+** Provider 'gc_utf8':
+**     entry(const char* api, size_t inputLength)
+**     exit(const char* api, size_t inputLength, size_t outputLength, int status)
+**
+** Lengths count code units of the input and the output. For the validators,
+** 'outputLength' is the length of the valid prefix. 'status' is one of the
+** PROBE_* values below. Since the probes stay in the inlined copies, the
+** caller's stack tells call sites apart, eg.
+**
+**     bpftrace -e 'usdt:./app:gc_utf8:exit { @[str(arg0), ustack(1)] = hist(arg2); }'
+*/
+#if defined(GC_UTF8_USDT)
+#   if defined(__has_include)
+#       if !__has_include(<sys/sdt.h>)
+#           error "GC_UTF8_USDT needs <sys/sdt.h> (eg. systemtap-sdt-dev)"
+#       endif
+#   endif
+#   include <sys/sdt.h>
+#endif
+
+namespace gc {
+namespace detail {
+    // The call returned normally.
+    constexpr int PROBE_OK = 0;
+    // The input was rejected without throwing (eg. 'isValidUtf8' said no).
+    constexpr int PROBE_REJECTED = 1;
+    // The call left by an exception.
+    constexpr int PROBE_THREW = -1;
+
+    /*
+    ** @brief: Fires the 'entry' probe when made and the 'exit' probe when
+    **    destroyed, so that calls that throw are traced too.
+    ** @note: 'api' has to be a string literal.
+    */
+    class ProbeScope {
+        public:
+#if defined(GC_UTF8_USDT)
+            ProbeScope(const char* api, std::size_t inputLength)
+                : api(api), inputLength(inputLength) {
+                DTRACE_PROBE2(gc_utf8, entry, api, inputLength);
+            }
+
+            ~ProbeScope() {
+                DTRACE_PROBE4(gc_utf8, exit, api, inputLength, outputLength, status);
+            }
+
+            /*
+            ** @brief: Records how the call ended, for the 'exit' probe.
+            */
+            void finish(std::size_t length, int result = PROBE_OK) {
+                outputLength = length;
+                status = result;
+            }
+#else
+            ProbeScope(const char*, std::size_t) {}
+
+            void finish(std::size_t, int = PROBE_OK) {}
+#endif
+
+            ProbeScope(const ProbeScope&) = delete;
+            ProbeScope& operator=(const ProbeScope&) = delete;
+
+#if defined(GC_UTF8_USDT)
+        private:
+            const char* api;
+            std::size_t inputLength;
+            std::size_t outputLength = 0;
+            int status = PROBE_THREW;
+#endif
+    };
+} // namespace detail
+} // namespace gc
+
+#endif // __GENIUS_C_UTF8_PROBES__
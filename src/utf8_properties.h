@@ -0,0 +1,167 @@
+#ifndef __GENIUS_C_UTF8_PROPERTIES__
+#define __GENIUS_C_UTF8_PROPERTIES__
+
+#include <cstdint>
+
+#include "utf8_property_tables.h"
+
+namespace gc {
+namespace detail {
+    /*
+    ** @brief: Looks a code point up in a three-stage table, as laid out by
+    **    'tools/unicode_tables.py'.
+    ** @note: Each stage is indexed by a slice of the code point, and
+    **    identical slices of the next stage are stored once. For text in
+    **    one script, lookups keep hitting the same few cache lines.
+    */
+    template <int Shift1, int Shift2, typename IndexT, typename MiddleT, typename BlockT>
+    constexpr BlockT lookupThreeStage(
+        const IndexT* index,
+        const MiddleT* middle,
+        const BlockT* blocks,
+        uint32_t codePoint
+    ) {
+        const uint32_t slice = index[codePoint >> (Shift1 + Shift2)];
+        const uint32_t block = middle[
+            (slice << Shift1) + ((codePoint >> Shift2) & ((1u << Shift1) - 1))
+        ];
+        return blocks[(block << Shift2) + (codePoint & ((1u << Shift2) - 1))];
+    }
+
+    constexpr uint8_t getPropertyFlags(uint32_t codePoint) {
+        if (codePoint > 0x10ffff) {
+            return 0;
+        }
+        return lookupThreeStage<PROPERTY_FLAGS_SHIFT1, PROPERTY_FLAGS_SHIFT2>(
+            PROPERTY_FLAGS_INDEX, PROPERTY_FLAGS_MIDDLE, PROPERTY_FLAGS_BLOCKS, codePoint
+        );
+    }
+} // namespace detail
+
+    /*
+    ** @brief: The General_Category of the given code point. Values above
+    **    U+10FFFF are 'Unassigned'.
+    ** @note: The tables are generated by 'tools/gen_properties.py' from the
+    **    files in 'data/ucd'.
+    */
+    constexpr GeneralCategory generalCategory(uint32_t codePoint) {
+        if (codePoint > 0x10ffff) {
+            return GeneralCategory::Unassigned;
+        }
+        return static_cast<GeneralCategory>(
+            detail::lookupThreeStage<detail::CATEGORY_SHIFT1, detail::CATEGORY_SHIFT2>(
+                detail::CATEGORY_INDEX, detail::CATEGORY_MIDDLE, detail::CATEGORY_BLOCKS,
+                codePoint
+            )
+        );
+    }
+
+    /*
+    ** @brief: The Script of the given code point. Values above U+10FFFF are
+    **    'Unknown'.
+    */
+    constexpr Script script(uint32_t codePoint) {
+        if (codePoint > 0x10ffff) {
+            return Script::Unknown;
+        }
+        return static_cast<Script>(
+            detail::lookupThreeStage<detail::SCRIPT_SHIFT1, detail::SCRIPT_SHIFT2>(
+                detail::SCRIPT_INDEX, detail::SCRIPT_MIDDLE, detail::SCRIPT_BLOCKS,
+                codePoint
+            )
+        );
+    }
+
+    /*
+    ** @brief: The Unicode name of the given script (eg. "Old_Italic").
+    */
+    constexpr const char* getScriptName(Script value) {
+        return detail::SCRIPT_NAMES[static_cast<int>(value)];
+    }
+
+    constexpr bool isLetter(uint32_t codePoint) {
+        return generalCategory(codePoint) <= GeneralCategory::OtherLetter;
+    }
+
+    constexpr bool isMark(uint32_t codePoint) {
+        const auto category = generalCategory(codePoint);
+        return category >= GeneralCategory::NonspacingMark &&
+            category <= GeneralCategory::EnclosingMark;
+    }
+
+    constexpr bool isNumber(uint32_t codePoint) {
+        const auto category = generalCategory(codePoint);
+        return category >= GeneralCategory::DecimalNumber &&
+            category <= GeneralCategory::OtherNumber;
+    }
+
+    constexpr bool isPunctuation(uint32_t codePoint) {
+        const auto category = generalCategory(codePoint);
+        return category >= GeneralCategory::ConnectorPunctuation &&
+            category <= GeneralCategory::OtherPunctuation;
+    }
+
+    constexpr bool isSymbol(uint32_t codePoint) {
+        const auto category = generalCategory(codePoint);
+        return category >= GeneralCategory::MathSymbol &&
+            category <= GeneralCategory::OtherSymbol;
+    }
+
+    /*
+    ** @brief: Whether the code point is a decimal digit of any script
+    **    (General_Category Nd).
+    */
+    constexpr bool isDigit(uint32_t codePoint) {
+        return generalCategory(codePoint) == GeneralCategory::DecimalNumber;
+    }
+
+    /*
+    ** @brief: The White_Space property: spaces, tabs, line and paragraph
+    **    separators and the like.
+    */
+    constexpr bool isWhiteSpace(uint32_t codePoint) {
+        return (detail::getPropertyFlags(codePoint) & detail::PROPERTY_WHITE_SPACE) != 0;
+    }
+
+    /*
+    ** @brief: The Alphabetic property: letters, plus letter numbers and
+    **    the marks that are part of words in their scripts.
+    */
+    constexpr bool isAlphabetic(uint32_t codePoint) {
+        return (detail::getPropertyFlags(codePoint) & detail::PROPERTY_ALPHABETIC) != 0;
+    }
+
+    /*
+    ** @brief: Alphabetic or a decimal digit, the Unicode counterpart of
+    **    'iswalnum'.
+    */
+    constexpr bool isAlphanumeric(uint32_t codePoint) {
+        return isAlphabetic(codePoint) || isDigit(codePoint);
+    }
+
+    constexpr bool isLowercase(uint32_t codePoint) {
+        return (detail::getPropertyFlags(codePoint) & detail::PROPERTY_LOWERCASE) != 0;
+    }
+
+    constexpr bool isUppercase(uint32_t codePoint) {
+        return (detail::getPropertyFlags(codePoint) & detail::PROPERTY_UPPERCASE) != 0;
+    }
+
+    /*
+    ** @brief: The ID_Start property of UAX #31: code points that can start
+    **    an identifier.
+    */
+    constexpr bool isIdentifierStart(uint32_t codePoint) {
+        return (detail::getPropertyFlags(codePoint) & detail::PROPERTY_ID_START) != 0;
+    }
+
+    /*
+    ** @brief: The ID_Continue property of UAX #31: code points that can
+    **    follow the first one of an identifier.
+    */
+    constexpr bool isIdentifierContinue(uint32_t codePoint) {
+        return (detail::getPropertyFlags(codePoint) & detail::PROPERTY_ID_CONTINUE) != 0;
+    }
+} // namespace gc
+
+#endif // __GENIUS_C_UTF8_PROPERTIES__
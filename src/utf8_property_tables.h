@@ -0,0 +1,4185 @@
+// Generated by tools/gen_properties.py from Unicode 15.0.0. Do not edit.
+#ifndef __GENIUS_C_UTF8_PROPERTY_TABLES__
+#define __GENIUS_C_UTF8_PROPERTY_TABLES__
+
+#include <cstdint>
+
+namespace gc {
+    /*
+    ** @brief: The General_Category values, with the two-letter aliases
+    **    in comments.
+    */
+    enum class GeneralCategory : uint8_t {
+        UppercaseLetter, // Lu
+        LowercaseLetter, // Ll
+        TitlecaseLetter, // Lt
+        ModifierLetter, // Lm
+        OtherLetter, // Lo
+        NonspacingMark, // Mn
+        SpacingMark, // Mc
+        EnclosingMark, // Me
+        DecimalNumber, // Nd
+        LetterNumber, // Nl
+        OtherNumber, // No
+        ConnectorPunctuation, // Pc
+        DashPunctuation, // Pd
+        OpenPunctuation, // Ps
+        ClosePunctuation, // Pe
+        InitialPunctuation, // Pi
+        FinalPunctuation, // Pf
+        OtherPunctuation, // Po
+        MathSymbol, // Sm
+        CurrencySymbol, // Sc
+        ModifierSymbol, // Sk
+        OtherSymbol, // So
+        SpaceSeparator, // Zs
+        LineSeparator, // Zl
+        ParagraphSeparator, // Zp
+        Control, // Cc
+        Format, // Cf
+        Surrogate, // Cs
+        PrivateUse, // Co
+        Unassigned, // Cn
+    };
+
+    /*
+    ** @brief: The Script values. 'Unknown' is the default for unassigned
+    **    code points.
+    */
+    enum class Script : uint8_t {
+        Unknown,
+        Adlam,
+        Ahom,
+        AnatolianHieroglyphs,
+        Arabic,
+        Armenian,
+        Avestan,
+        Balinese,
+        Bamum,
+        BassaVah,
+        Batak,
+        Bengali,
+        Bhaiksuki,
+        Bopomofo,
+        Brahmi,
+        Braille,
+        Buginese,
+        Buhid,
+        CanadianAboriginal,
+        Carian,
+        CaucasianAlbanian,
+        Chakma,
+        Cham,
+        Cherokee,
+        Chorasmian,
+        Common,
+        Coptic,
+        Cuneiform,
+        Cypriot,
+        CyproMinoan,
+        Cyrillic,
+        Deseret,
+        Devanagari,
+        DivesAkuru,
+        Dogra,
+        Duployan,
+        EgyptianHieroglyphs,
+        Elbasan,
+        Elymaic,
+        Ethiopic,
+        Georgian,
+        Glagolitic,
+        Gothic,
+        Grantha,
+        Greek,
+        Gujarati,
+        GunjalaGondi,
+        Gurmukhi,
+        Han,
+        Hangul,
+        HanifiRohingya,
+        Hanunoo,
+        Hatran,
+        Hebrew,
+        Hiragana,
+        ImperialAramaic,
+        Inherited,
+        InscriptionalPahlavi,
+        InscriptionalParthian,
+        Javanese,
+        Kaithi,
+        Kannada,
+        Katakana,
+        Kawi,
+        KayahLi,
+        Kharoshthi,
+        KhitanSmallScript,
+        Khmer,
+        Khojki,
+        Khudawadi,
+        Lao,
+        Latin,
+        Lepcha,
+        Limbu,
+        LinearA,
+        LinearB,
+        Lisu,
+        Lycian,
+        Lydian,
+        Mahajani,
+        Makasar,
+        Malayalam,
+        Mandaic,
+        Manichaean,
+        Marchen,
+        MasaramGondi,
+        Medefaidrin,
+        MeeteiMayek,
+        MendeKikakui,
+        MeroiticCursive,
+        MeroiticHieroglyphs,
+        Miao,
+        Modi,
+        Mongolian,
+        Mro,
+        Multani,
+        Myanmar,
+        Nabataean,
+        NagMundari,
+        Nandinagari,
+        NewTaiLue,
+        Newa,
+        Nko,
+        Nushu,
+        NyiakengPuachueHmong,
+        Ogham,
+        OlChiki,
+        OldHungarian,
+        OldItalic,
+        OldNorthArabian,
+        OldPermic,
+        OldPersian,
+        OldSogdian,
+        OldSouthArabian,
+        OldTurkic,
+        OldUyghur,
+        Oriya,
+        Osage,
+        Osmanya,
+        PahawhHmong,
+        Palmyrene,
+        PauCinHau,
+        PhagsPa,
+        Phoenician,
+        PsalterPahlavi,
+        Rejang,
+        Runic,
+        Samaritan,
+        Saurashtra,
+        Sharada,
+        Shavian,
+        Siddham,
+        SignWriting,
+        Sinhala,
+        Sogdian,
+        SoraSompeng,
+        Soyombo,
+        Sundanese,
+        SylotiNagri,
+        Syriac,
+        Tagalog,
+        Tagbanwa,
+        TaiLe,
+        TaiTham,
+        TaiViet,
+        Takri,
+        Tamil,
+        Tangsa,
+        Tangut,
+        Telugu,
+        Thaana,
+        Thai,
+        Tibetan,
+        Tifinagh,
+        Tirhuta,
+        Toto,
+        Ugaritic,
+        Vai,
+        Vithkuqi,
+        Wancho,
+        WarangCiti,
+        Yezidi,
+        Yi,
+        ZanabazarSquare,
+    };
+
+namespace detail {
+    inline constexpr uint8_t PROPERTY_WHITE_SPACE = 0x01;
+    inline constexpr uint8_t PROPERTY_ALPHABETIC = 0x02;
+    inline constexpr uint8_t PROPERTY_LOWERCASE = 0x04;
+    inline constexpr uint8_t PROPERTY_UPPERCASE = 0x08;
+    inline constexpr uint8_t PROPERTY_ID_START = 0x10;
+    inline constexpr uint8_t PROPERTY_ID_CONTINUE = 0x20;
+
+    // The Unicode names of the scripts, indexed by 'Script'.
+    inline constexpr const char* SCRIPT_NAMES[164] = {
+        "Unknown",
+        "Adlam",
+        "Ahom",
+        "Anatolian_Hieroglyphs",
+        "Arabic",
+        "Armenian",
+        "Avestan",
+        "Balinese",
+        "Bamum",
+        "Bassa_Vah",
+        "Batak",
+        "Bengali",
+        "Bhaiksuki",
+        "Bopomofo",
+        "Brahmi",
+        "Braille",
+        "Buginese",
+        "Buhid",
+        "Canadian_Aboriginal",
+        "Carian",
+        "Caucasian_Albanian",
+        "Chakma",
+        "Cham",
+        "Cherokee",
+        "Chorasmian",
+        "Common",
+        "Coptic",
+        "Cuneiform",
+        "Cypriot",
+        "Cypro_Minoan",
+        "Cyrillic",
+        "Deseret",
+        "Devanagari",
+        "Dives_Akuru",
+        "Dogra",
+        "Duployan",
+        "Egyptian_Hieroglyphs",
+        "Elbasan",
+        "Elymaic",
+        "Ethiopic",
+        "Georgian",
+        "Glagolitic",
+        "Gothic",
+        "Grantha",
+        "Greek",
+        "Gujarati",
+        "Gunjala_Gondi",
+        "Gurmukhi",
+        "Han",
+        "Hangul",
+        "Hanifi_Rohingya",
+        "Hanunoo",
+        "Hatran",
+        "Hebrew",
+        "Hiragana",
+        "Imperial_Aramaic",
+        "Inherited",
+        "Inscriptional_Pahlavi",
+        "Inscriptional_Parthian",
+        "Javanese",
+        "Kaithi",
+        "Kannada",
+        "Katakana",
+        "Kawi",
+        "Kayah_Li",
+        "Kharoshthi",
+        "Khitan_Small_Script",
+        "Khmer",
+        "Khojki",
+        "Khudawadi",
+        "Lao",
+        "Latin",
+        "Lepcha",
+        "Limbu",
+        "Linear_A",
+        "Linear_B",
+        "Lisu",
+        "Lycian",
+        "Lydian",
+        "Mahajani",
+        "Makasar",
+        "Malayalam",
+        "Mandaic",
+        "Manichaean",
+        "Marchen",
+        "Masaram_Gondi",
+        "Medefaidrin",
+        "Meetei_Mayek",
+        "Mende_Kikakui",
+        "Meroitic_Cursive",
+        "Meroitic_Hieroglyphs",
+        "Miao",
+        "Modi",
+        "Mongolian",
+        "Mro",
+        "Multani",
+        "Myanmar",
+        "Nabataean",
+        "Nag_Mundari",
+        "Nandinagari",
+        "New_Tai_Lue",
+        "Newa",
+        "Nko",
+        "Nushu",
+        "Nyiakeng_Puachue_Hmong",
+        "Ogham",
+        "Ol_Chiki",
+        "Old_Hungarian",
+        "Old_Italic",
+        "Old_North_Arabian",
+        "Old_Permic",
+        "Old_Persian",
+        "Old_Sogdian",
+        "Old_South_Arabian",
+        "Old_Turkic",
+        "Old_Uyghur",
+        "Oriya",
+        "Osage",
+        "Osmanya",
+        "Pahawh_Hmong",
+        "Palmyrene",
+        "Pau_Cin_Hau",
+        "Phags_Pa",
+        "Phoenician",
+        "Psalter_Pahlavi",
+        "Rejang",
+        "Runic",
+        "Samaritan",
+        "Saurashtra",
+        "Sharada",
+        "Shavian",
+        "Siddham",
+        "SignWriting",
+        "Sinhala",
+        "Sogdian",
+        "Sora_Sompeng",
+        "Soyombo",
+        "Sundanese",
+        "Syloti_Nagri",
+        "Syriac",
+        "Tagalog",
+        "Tagbanwa",
+        "Tai_Le",
+        "Tai_Tham",
+        "Tai_Viet",
+        "Takri",
+        "Tamil",
+        "Tangsa",
+        "Tangut",
+        "Telugu",
+        "Thaana",
+        "Thai",
+        "Tibetan",
+        "Tifinagh",
+        "Tirhuta",
+        "Toto",
+        "Ugaritic",
+        "Vai",
+        "Vithkuqi",
+        "Wancho",
+        "Warang_Citi",
+        "Yezidi",
+        "Yi",
+        "Zanabazar_Square",
+    };
+
+    inline constexpr int CATEGORY_SHIFT1 = 5;
+    inline constexpr int CATEGORY_SHIFT2 = 4;
+    inline constexpr uint8_t CATEGORY_INDEX[2176] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+        12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+        24, 25, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 27, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 28, 26, 29, 30,
+        31, 32, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 33,
+        34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 36, 37, 38, 39, 40, 41, 42, 43,
+        44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+        26, 56, 57, 58, 58, 58, 58, 59, 26, 26, 60, 58,
+        58, 58, 58, 58, 58, 58, 26, 61, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        26, 62, 58, 63, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 64, 26, 26, 65, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 66,
+        67, 68, 58, 58, 58, 58, 69, 58, 58, 58, 58, 58,
+        58, 58, 58, 70, 71, 72, 73, 74, 75, 76, 58, 77,
+        78, 79, 80, 81, 82, 58, 83, 84, 85, 86, 75, 87,
+        88, 89, 58, 58, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 90, 26, 26, 26, 26, 26, 26, 26, 91,
+        92, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 93,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 94, 58, 58, 58, 58, 58, 58, 26, 95, 58, 58,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 96, 26, 26,
+        26, 26, 26, 26, 26, 97, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 98, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 99, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 99,
+    };
+    inline constexpr uint16_t CATEGORY_MIDDLE[3200] = {
+        0, 0, 1, 2, 3, 4, 5, 6, 0, 0, 7, 8,
+        9, 10, 11, 12, 13, 13, 13, 14, 15, 13, 13, 16,
+        17, 18, 19, 20, 21, 22, 13, 23, 13, 13, 13, 24,
+        25, 11, 11, 11, 11, 26, 11, 27, 28, 29, 30, 31,
+        32, 32, 32, 32, 32, 32, 32, 33, 34, 35, 36, 11,
+        37, 38, 13, 39, 9, 9, 9, 11, 11, 11, 13, 13,
+        40, 13, 13, 13, 41, 13, 13, 13, 13, 13, 13, 42,
+        9, 43, 11, 11, 44, 45, 32, 46, 47, 48, 49, 50,
+        51, 52, 48, 48, 53, 32, 54, 55, 48, 48, 48, 48,
+        48, 56, 57, 58, 59, 60, 48, 32, 61, 48, 48, 48,
+        48, 48, 62, 63, 64, 48, 65, 66, 48, 67, 68, 69,
+        48, 70, 71, 48, 72, 73, 48, 48, 74, 32, 75, 32,
+        76, 48, 48, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+        86, 87, 88, 89, 90, 83, 84, 91, 92, 93, 94, 95,
+        96, 97, 84, 98, 99, 100, 88, 101, 102, 83, 84, 103,
+        104, 105, 88, 106, 107, 108, 109, 110, 111, 112, 94, 113,
+        114, 115, 84, 116, 117, 118, 88, 119, 120, 115, 84, 121,
+        122, 123, 88, 124, 125, 115, 48, 126, 127, 128, 88, 129,
+        130, 131, 48, 132, 133, 134, 94, 135, 136, 48, 48, 137,
+        138, 139, 140, 140, 141, 48, 142, 143, 144, 145, 140, 140,
+        146, 147, 148, 149, 150, 48, 151, 152, 153, 154, 32, 155,
+        156, 157, 140, 140, 48, 48, 158, 159, 160, 161, 162, 163,
+        164, 165, 9, 9, 166, 11, 11, 167, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 168, 169, 48, 48, 168, 48, 48, 170,
+        171, 172, 48, 48, 48, 171, 48, 48, 48, 173, 174, 175,
+        48, 176, 9, 9, 9, 9, 9, 177, 178, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 179, 48,
+        180, 181, 48, 48, 48, 48, 182, 183, 48, 184, 48, 185,
+        48, 186, 187, 188, 48, 48, 48, 189, 190, 191, 192, 193,
+        194, 192, 48, 48, 195, 48, 48, 196, 197, 48, 198, 48,
+        48, 48, 48, 199, 48, 200, 201, 202, 203, 48, 204, 205,
+        48, 48, 206, 48, 207, 208, 209, 209, 48, 210, 48, 48,
+        48, 211, 212, 213, 192, 192, 214, 215, 216, 140, 140, 140,
+        217, 48, 48, 218, 219, 160, 220, 221, 222, 48, 223, 64,
+        48, 48, 224, 225, 48, 48, 226, 227, 228, 64, 48, 229,
+        230, 9, 9, 231, 232, 233, 234, 235, 11, 11, 236, 27,
+        27, 27, 237, 238, 11, 239, 27, 27, 32, 32, 32, 32,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 240, 13, 13,
+        13, 13, 13, 13, 241, 242, 241, 241, 242, 243, 241, 244,
+        245, 245, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254,
+        255, 256, 257, 258, 259, 260, 261, 261, 262, 263, 264, 265,
+        266, 267, 268, 269, 270, 271, 272, 272, 273, 274, 275, 209,
+        276, 277, 209, 278, 279, 279, 279, 279, 279, 279, 279, 279,
+        279, 279, 279, 279, 279, 279, 279, 279, 280, 209, 281, 209,
+        209, 209, 209, 282, 209, 283, 279, 284, 209, 285, 286, 209,
+        209, 209, 287, 140, 288, 140, 271, 271, 271, 289, 209, 209,
+        209, 209, 290, 271, 209, 209, 209, 209, 209, 209, 209, 209,
+        209, 209, 209, 291, 292, 209, 209, 293, 209, 209, 209, 209,
+        209, 209, 294, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+        209, 209, 209, 209, 209, 209, 295, 296, 271, 297, 209, 209,
+        298, 279, 299, 279, 209, 209, 209, 209, 209, 209, 209, 209,
+        209, 209, 209, 209, 209, 209, 209, 209, 279, 279, 279, 279,
+        279, 279, 279, 279, 300, 301, 279, 279, 279, 302, 279, 303,
+        279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279,
+        279, 279, 279, 279, 209, 209, 209, 279, 304, 209, 209, 305,
+        209, 306, 209, 209, 209, 209, 209, 209, 9, 9, 9, 11,
+        11, 11, 307, 308, 13, 13, 13, 13, 13, 13, 309, 310,
+        11, 11, 311, 48, 48, 48, 312, 313, 48, 314, 315, 315,
+        315, 315, 32, 32, 316, 317, 318, 319, 320, 321, 140, 140,
+        209, 322, 209, 209, 209, 209, 209, 323, 209, 209, 209, 209,
+        209, 209, 209, 209, 209, 209, 209, 209, 209, 324, 140, 325,
+        326, 327, 328, 329, 136, 48, 48, 48, 48, 330, 178, 48,
+        48, 48, 48, 331, 332, 48, 48, 136, 48, 48, 48, 48,
+        200, 333, 48, 48, 209, 209, 323, 48, 209, 334, 335, 209,
+        336, 337, 209, 209, 335, 209, 209, 337, 209, 209, 209, 209,
+        209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+        209, 209, 209, 209, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 209, 209, 209, 209, 48, 338, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        151, 209, 209, 209, 287, 48, 48, 229, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        339, 48, 340, 140, 13, 13, 341, 342, 13, 343, 48, 48,
+        48, 48, 344, 345, 31, 346, 347, 348, 13, 13, 13, 349,
+        350, 351, 352, 353, 354, 355, 140, 356, 357, 48, 358, 359,
+        48, 48, 48, 360, 361, 48, 48, 362, 363, 192, 32, 364,
+        64, 48, 365, 48, 366, 367, 48, 151, 76, 48, 48, 368,
+        369, 370, 371, 372, 48, 48, 373, 374, 375, 376, 48, 377,
+        48, 48, 48, 378, 379, 380, 381, 382, 383, 384, 315, 11,
+        11, 385, 386, 11, 11, 11, 11, 11, 48, 48, 387, 192,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 388, 48, 389, 48, 48, 206, 390, 390, 390, 390,
+        390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390,
+        390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390,
+        390, 390, 390, 390, 391, 391, 391, 391, 391, 391, 391, 391,
+        391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+        391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+        391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+        391, 391, 391, 391, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 204, 48, 48, 48, 48, 48, 48, 207, 140, 140,
+        392, 393, 394, 395, 396, 48, 48, 48, 48, 48, 48, 397,
+        398, 399, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 400,
+        209, 48, 48, 48, 48, 401, 48, 48, 402, 140, 140, 403,
+        32, 404, 32, 405, 406, 407, 408, 409, 48, 48, 48, 48,
+        48, 48, 48, 410, 411, 2, 3, 4, 5, 412, 413, 414,
+        48, 415, 48, 200, 416, 417, 418, 419, 420, 48, 172, 421,
+        204, 204, 140, 140, 48, 48, 48, 48, 48, 48, 48, 71,
+        422, 271, 271, 423, 272, 272, 272, 424, 425, 426, 427, 140,
+        140, 209, 209, 428, 140, 140, 140, 140, 140, 140, 140, 140,
+        48, 151, 48, 48, 48, 100, 429, 430, 48, 48, 431, 48,
+        432, 48, 48, 433, 48, 434, 48, 48, 435, 436, 140, 140,
+        9, 9, 437, 11, 11, 48, 48, 48, 48, 204, 192, 9,
+        9, 438, 11, 439, 48, 48, 440, 48, 48, 48, 441, 442,
+        442, 443, 444, 445, 140, 140, 140, 140, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 314, 48, 199, 440, 140, 446, 27, 27, 447,
+        140, 140, 140, 140, 448, 48, 48, 449, 48, 450, 48, 451,
+        48, 200, 452, 140, 140, 140, 48, 453, 48, 454, 48, 455,
+        140, 140, 140, 140, 48, 48, 48, 456, 271, 457, 271, 271,
+        458, 459, 48, 460, 461, 462, 48, 463, 48, 464, 140, 140,
+        465, 48, 466, 467, 48, 48, 48, 468, 48, 469, 48, 470,
+        48, 471, 472, 140, 140, 140, 140, 140, 48, 48, 48, 48,
+        196, 140, 140, 140, 9, 9, 9, 473, 11, 11, 11, 474,
+        48, 48, 475, 192, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 271, 476,
+        48, 48, 477, 478, 140, 140, 140, 479, 48, 464, 480, 48,
+        62, 481, 140, 48, 482, 140, 140, 48, 483, 140, 48, 314,
+        484, 48, 48, 485, 486, 457, 487, 488, 222, 48, 48, 489,
+        490, 48, 196, 192, 491, 48, 492, 493, 494, 48, 48, 495,
+        222, 48, 48, 496, 497, 498, 499, 500, 48, 97, 501, 502,
+        503, 140, 140, 140, 504, 505, 506, 48, 48, 507, 508, 192,
+        509, 83, 84, 510, 511, 512, 513, 514, 140, 140, 140, 140,
+        140, 140, 140, 140, 48, 48, 48, 515, 516, 517, 478, 140,
+        48, 48, 48, 518, 519, 192, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 48, 48, 520, 521, 522, 523, 140, 140,
+        48, 48, 48, 524, 525, 192, 526, 140, 48, 48, 527, 528,
+        192, 140, 140, 140, 48, 173, 529, 530, 314, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 48, 48, 501, 531,
+        140, 140, 140, 140, 140, 140, 9, 9, 11, 11, 148, 532,
+        533, 534, 48, 535, 536, 192, 140, 140, 140, 140, 537, 48,
+        48, 538, 539, 140, 540, 48, 48, 541, 542, 543, 48, 48,
+        544, 545, 546, 48, 48, 48, 48, 196, 547, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        84, 48, 520, 548, 549, 148, 175, 550, 48, 551, 552, 553,
+        140, 140, 140, 140, 554, 48, 48, 555, 556, 192, 557, 48,
+        558, 559, 192, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 48, 560,
+        561, 115, 48, 562, 563, 192, 140, 140, 140, 140, 140, 100,
+        271, 564, 565, 566, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 207, 140, 140, 140, 140, 140, 140,
+        272, 272, 272, 272, 272, 272, 567, 568, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 388, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 48, 48, 48, 48, 48, 48, 569,
+        48, 48, 48, 570, 571, 572, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 48, 48, 48, 48,
+        314, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 48, 48, 48, 196, 48, 200, 370, 48,
+        48, 48, 48, 200, 192, 48, 204, 573, 48, 48, 48, 574,
+        575, 576, 577, 578, 48, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 9, 9, 11, 11, 271, 579, 140, 140,
+        140, 140, 140, 140, 48, 48, 48, 48, 580, 581, 582, 582,
+        583, 584, 140, 140, 140, 140, 585, 586, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 440, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 199, 140, 140, 196, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 587, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 588, 589, 140, 590, 591, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 206, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        48, 48, 48, 48, 48, 48, 71, 151, 196, 592, 593, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        32, 32, 594, 32, 595, 209, 209, 209, 209, 209, 209, 209,
+        323, 140, 140, 140, 209, 209, 209, 209, 209, 209, 209, 209,
+        209, 209, 209, 209, 209, 209, 209, 324, 209, 209, 596, 209,
+        209, 209, 597, 598, 599, 209, 600, 209, 209, 209, 288, 140,
+        209, 209, 209, 209, 601, 140, 140, 140, 140, 140, 140, 140,
+        271, 602, 271, 602, 209, 209, 209, 209, 209, 287, 271, 461,
+        140, 140, 140, 140, 140, 140, 140, 140, 9, 603, 11, 604,
+        605, 606, 241, 9, 607, 608, 609, 610, 611, 9, 603, 11,
+        612, 613, 11, 614, 615, 616, 617, 9, 618, 11, 9, 603,
+        11, 604, 605, 11, 241, 9, 607, 617, 9, 618, 11, 9,
+        603, 11, 619, 9, 620, 621, 622, 623, 11, 624, 9, 625,
+        626, 627, 628, 11, 629, 9, 630, 11, 631, 632, 632, 632,
+        209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+        209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+        209, 209, 209, 209, 209, 209, 209, 209, 32, 32, 32, 633,
+        32, 32, 634, 635, 636, 637, 45, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 638, 639, 640, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        641, 642, 643, 27, 27, 27, 644, 140, 645, 140, 140, 140,
+        140, 140, 140, 140, 48, 48, 151, 646, 647, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 48, 648, 140, 48, 48, 649, 650,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 48, 651, 192, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 652, 200, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 653, 595, 140, 140,
+        9, 9, 607, 11, 654, 370, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 499,
+        271, 271, 655, 656, 140, 140, 140, 140, 499, 271, 657, 658,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        659, 48, 660, 661, 662, 663, 664, 665, 666, 206, 667, 206,
+        140, 140, 140, 668, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 209, 209, 325, 209,
+        209, 209, 209, 209, 209, 323, 334, 669, 669, 669, 209, 324,
+        670, 209, 209, 209, 209, 209, 209, 209, 209, 209, 671, 140,
+        140, 140, 672, 209, 673, 209, 209, 325, 674, 675, 324, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 209, 209, 209, 209,
+        209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 676,
+        209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+        209, 677, 426, 426, 209, 209, 209, 209, 209, 209, 209, 678,
+        209, 209, 209, 209, 209, 176, 325, 427, 325, 209, 209, 209,
+        679, 176, 209, 209, 679, 209, 671, 675, 140, 140, 140, 140,
+        209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+        209, 209, 209, 209, 209, 209, 209, 209, 209, 323, 671, 426,
+        674, 209, 209, 680, 681, 325, 674, 674, 209, 209, 209, 209,
+        209, 209, 209, 209, 209, 682, 209, 209, 288, 140, 140, 192,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 140, 140, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 207, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 204, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 478, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 100, 140, 48, 204, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 71, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 140,
+        140, 140, 140, 140, 683, 140, 570, 570, 570, 570, 570, 570,
+        140, 140, 140, 140, 140, 140, 140, 140, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 140,
+        391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+        391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+        391, 391, 391, 391, 391, 391, 391, 684,
+    };
+    inline constexpr uint8_t CATEGORY_BLOCKS[10960] = {
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 22, 17, 17, 17, 19, 17, 17, 17,
+        13, 14, 17, 18, 17, 12, 17, 17, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 17, 17, 18, 18, 18, 17,
+        17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 13, 17, 14, 20, 11, 20, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 13,
+        18, 14, 18, 25, 22, 17, 19, 19, 19, 19, 21, 17,
+        20, 21, 4, 15, 18, 26, 21, 20, 21, 18, 10, 10,
+        20, 1, 17, 17, 20, 10, 4, 16, 10, 10, 10, 17,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18,
+        0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 18, 1, 1, 1, 1,
+        1, 1, 1, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+        0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+        0, 1, 0, 1, 1, 0, 1, 0, 1, 0, 1, 0,
+        1, 0, 1, 0, 1, 0, 1, 0, 1, 1, 0, 1,
+        0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+        0, 0, 1, 0, 1, 0, 1, 1, 1, 0, 0, 1,
+        0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0,
+        0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 1,
+        0, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0, 0,
+        1, 0, 1, 1, 0, 1, 0, 0, 1, 0, 0, 0,
+        1, 0, 1, 0, 0, 1, 1, 4, 0, 1, 1, 1,
+        4, 4, 4, 4, 0, 2, 1, 0, 2, 1, 0, 2,
+        1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+        1, 0, 1, 0, 1, 1, 0, 1, 1, 0, 2, 1,
+        0, 1, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1,
+        0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+        1, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 1,
+        0, 1, 0, 1, 0, 1, 0, 1, 1, 1, 1, 1,
+        4, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 20, 20, 20, 20, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        3, 3, 3, 3, 3, 20, 20, 20, 20, 20, 20, 20,
+        3, 20, 3, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        0, 1, 0, 1, 3, 20, 0, 1, 29, 29, 3, 1,
+        1, 1, 17, 0, 29, 29, 29, 29, 20, 20, 0, 17,
+        0, 0, 0, 29, 0, 29, 0, 0, 1, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0,
+        0, 1, 1, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+        1, 1, 1, 1, 0, 1, 18, 0, 1, 0, 0, 1,
+        1, 0, 0, 0, 0, 1, 21, 5, 5, 5, 5, 5,
+        7, 7, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0,
+        1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 1,
+        29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29,
+        29, 3, 17, 17, 17, 17, 17, 17, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 17, 12, 29, 29, 21, 21, 19,
+        29, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 12, 5, 17, 5, 5, 17,
+        5, 5, 17, 5, 29, 29, 29, 29, 29, 29, 29, 29,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 29, 29, 29, 29, 4, 4, 4, 4, 17,
+        17, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        26, 26, 26, 26, 26, 26, 18, 18, 18, 17, 17, 19,
+        17, 17, 21, 21, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 17, 26, 17, 17, 17, 3, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 17, 17,
+        17, 17, 4, 4, 5, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        17, 4, 5, 5, 5, 5, 5, 5, 5, 26, 21, 5,
+        5, 5, 5, 5, 5, 3, 3, 5, 5, 21, 5, 5,
+        5, 5, 4, 4, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 4, 4, 4, 21, 21, 4, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 29, 26,
+        4, 5, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 29, 29, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 4, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 3, 3, 21, 17, 17, 17, 3, 29,
+        29, 5, 19, 19, 4, 4, 4, 4, 4, 4, 5, 5,
+        5, 5, 3, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        3, 5, 5, 5, 3, 5, 5, 5, 5, 5, 29, 29,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 29, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 5, 5, 5, 29, 29, 17, 29, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 29,
+        4, 4, 4, 4, 4, 4, 4, 4, 20, 4, 4, 4,
+        4, 4, 4, 29, 26, 26, 29, 29, 29, 29, 29, 29,
+        5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 3, 5, 5, 5, 5, 5, 5,
+        5, 5, 26, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 6, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 5, 6, 5, 4, 6, 6,
+        6, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6,
+        6, 5, 6, 6, 4, 5, 5, 5, 5, 5, 5, 5,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5,
+        17, 17, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        17, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 5, 6, 6, 29, 4, 4, 4,
+        4, 4, 4, 4, 4, 29, 29, 4, 4, 29, 29, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 4, 4,
+        4, 4, 4, 4, 4, 29, 4, 29, 29, 29, 4, 4,
+        4, 4, 29, 29, 5, 4, 6, 6, 6, 5, 5, 5,
+        5, 29, 29, 6, 6, 29, 29, 6, 6, 5, 4, 29,
+        29, 29, 29, 29, 29, 29, 29, 6, 29, 29, 29, 29,
+        4, 4, 29, 4, 4, 4, 5, 5, 29, 29, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 4, 4, 19, 19,
+        10, 10, 10, 10, 10, 10, 21, 19, 4, 17, 5, 29,
+        29, 5, 5, 6, 29, 4, 4, 4, 4, 4, 4, 29,
+        29, 29, 29, 4, 4, 29, 4, 4, 29, 4, 4, 29,
+        4, 4, 29, 29, 5, 29, 6, 6, 6, 5, 5, 29,
+        29, 29, 29, 5, 5, 29, 29, 5, 5, 5, 29, 29,
+        29, 5, 29, 29, 29, 29, 29, 29, 29, 4, 4, 4,
+        4, 29, 4, 29, 29, 29, 29, 29, 29, 29, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 5, 5, 4, 4,
+        4, 5, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 5, 5, 6, 29, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 29, 4, 4, 4, 29, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 4, 4,
+        29, 4, 4, 4, 4, 4, 29, 29, 5, 4, 6, 6,
+        6, 5, 5, 5, 5, 5, 29, 5, 5, 6, 29, 6,
+        6, 5, 29, 29, 4, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 17, 19, 29, 29,
+        29, 29, 29, 29, 29, 4, 5, 5, 5, 5, 5, 5,
+        29, 5, 6, 6, 29, 4, 4, 4, 4, 4, 4, 4,
+        4, 29, 29, 4, 4, 29, 4, 4, 29, 4, 4, 4,
+        4, 4, 29, 29, 5, 4, 6, 5, 6, 5, 5, 5,
+        5, 29, 29, 6, 6, 29, 29, 6, 6, 5, 29, 29,
+        29, 29, 29, 29, 29, 5, 5, 6, 29, 29, 29, 29,
+        4, 4, 29, 4, 21, 4, 10, 10, 10, 10, 10, 10,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 5, 4,
+        29, 4, 4, 4, 4, 4, 4, 29, 29, 29, 4, 4,
+        4, 29, 4, 4, 4, 4, 29, 29, 29, 4, 4, 29,
+        4, 29, 4, 4, 29, 29, 29, 4, 4, 29, 29, 29,
+        4, 4, 4, 29, 29, 29, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 6, 6,
+        5, 6, 6, 29, 29, 29, 6, 6, 6, 29, 6, 6,
+        6, 5, 29, 29, 4, 29, 29, 29, 29, 29, 29, 6,
+        29, 29, 29, 29, 29, 29, 29, 29, 10, 10, 10, 21,
+        21, 21, 21, 21, 21, 19, 21, 29, 29, 29, 29, 29,
+        5, 6, 6, 6, 5, 4, 4, 4, 4, 4, 4, 4,
+        4, 29, 4, 4, 4, 29, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 29, 29, 5, 4, 5, 5,
+        5, 6, 6, 6, 6, 29, 5, 5, 5, 29, 5, 5,
+        5, 5, 29, 29, 29, 29, 29, 29, 29, 5, 5, 29,
+        4, 4, 4, 29, 29, 4, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 17, 10, 10, 10, 10, 10, 10, 10, 21,
+        4, 5, 6, 6, 17, 4, 4, 4, 4, 4, 4, 4,
+        4, 29, 4, 4, 4, 4, 4, 4, 29, 4, 4, 4,
+        4, 4, 29, 29, 5, 4, 6, 5, 6, 6, 6, 6,
+        6, 29, 5, 6, 6, 29, 6, 6, 5, 5, 29, 29,
+        29, 29, 29, 29, 29, 6, 6, 29, 29, 29, 29, 29,
+        29, 4, 4, 29, 29, 4, 4, 6, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 5, 5, 6, 6,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5,
+        5, 4, 6, 6, 6, 5, 5, 5, 5, 29, 6, 6,
+        6, 29, 6, 6, 6, 5, 4, 21, 29, 29, 29, 29,
+        4, 4, 4, 6, 10, 10, 10, 10, 10, 10, 10, 4,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 21, 4, 4,
+        4, 4, 4, 4, 29, 5, 6, 6, 29, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 29, 29, 29, 4, 4, 4, 4, 4, 4,
+        4, 4, 29, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        29, 4, 29, 29, 4, 4, 4, 4, 4, 4, 4, 29,
+        29, 29, 5, 29, 29, 29, 29, 6, 6, 6, 5, 5,
+        5, 29, 5, 29, 6, 6, 6, 6, 6, 6, 6, 6,
+        29, 29, 6, 6, 17, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 4, 4,
+        5, 5, 5, 5, 5, 5, 5, 29, 29, 29, 29, 19,
+        4, 4, 4, 4, 4, 4, 3, 5, 5, 5, 5, 5,
+        5, 5, 5, 17, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 4, 4, 29, 4, 29, 4, 4, 4, 4, 4, 29,
+        4, 4, 4, 4, 4, 4, 4, 4, 29, 4, 29, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 4, 4,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 29, 29,
+        4, 4, 4, 4, 4, 29, 3, 29, 5, 5, 5, 5,
+        5, 5, 5, 29, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 29, 29, 4, 4, 4, 4, 4, 21, 21, 21,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 21, 17, 21, 21, 21, 5, 5, 21, 21,
+        21, 21, 21, 21, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        21, 5, 21, 5, 21, 5, 13, 14, 13, 14, 6, 6,
+        4, 4, 4, 4, 4, 4, 4, 4, 29, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 29, 29, 29, 29, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6,
+        5, 5, 5, 5, 5, 17, 5, 5, 4, 4, 4, 4,
+        4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        29, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 29, 21, 21,
+        21, 21, 21, 21, 21, 21, 5, 21, 21, 21, 21, 21,
+        21, 29, 21, 21, 17, 17, 17, 17, 17, 21, 21, 21,
+        21, 17, 17, 29, 29, 29, 29, 29, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 6, 6, 5, 5, 5,
+        5, 6, 5, 5, 5, 5, 5, 5, 6, 5, 5, 6,
+        6, 5, 5, 4, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 17, 17, 17, 17, 17, 17, 4, 4, 4, 4,
+        4, 4, 6, 6, 5, 5, 4, 4, 4, 4, 5, 5,
+        5, 4, 6, 6, 6, 4, 4, 6, 6, 6, 6, 6,
+        6, 6, 4, 4, 4, 5, 5, 5, 5, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 6,
+        6, 5, 5, 6, 6, 6, 6, 6, 6, 5, 4, 6,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 6, 6,
+        6, 5, 21, 21, 0, 0, 0, 0, 0, 0, 29, 0,
+        29, 29, 29, 29, 29, 0, 29, 29, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 17, 3, 1, 1, 1,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 4, 4,
+        4, 4, 29, 29, 4, 4, 4, 4, 4, 4, 4, 29,
+        4, 29, 4, 4, 4, 4, 29, 29, 4, 29, 4, 4,
+        4, 4, 29, 29, 4, 4, 4, 4, 4, 4, 4, 29,
+        4, 29, 4, 4, 4, 4, 29, 29, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 29, 29, 5, 5, 5,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 29, 29, 29, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 29, 29, 29, 29, 29, 29,
+        0, 0, 0, 0, 0, 0, 29, 29, 1, 1, 1, 1,
+        1, 1, 29, 29, 12, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 21, 17, 4,
+        22, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 13, 14, 29, 29, 29, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 17, 17, 17, 9, 9,
+        9, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29,
+        29, 29, 29, 29, 4, 4, 5, 5, 5, 6, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 4, 4, 4, 5, 5,
+        6, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        4, 4, 5, 5, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 29, 4, 4, 4, 29, 5, 5,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        4, 4, 4, 4, 5, 5, 6, 5, 5, 5, 5, 5,
+        5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 5, 6,
+        6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        17, 17, 17, 3, 17, 17, 17, 19, 4, 5, 29, 29,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 29, 29,
+        29, 29, 29, 29, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 29, 29, 29, 29, 29, 29, 17, 17, 17, 17,
+        17, 17, 12, 17, 17, 17, 17, 5, 5, 5, 26, 5,
+        4, 4, 4, 3, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 29, 29, 29, 29, 29, 29, 29, 4, 4, 4, 4,
+        4, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 4, 29,
+        29, 29, 29, 29, 4, 4, 4, 4, 4, 4, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29,
+        5, 5, 5, 6, 6, 6, 6, 5, 5, 6, 6, 6,
+        29, 29, 29, 29, 6, 6, 5, 6, 6, 6, 6, 6,
+        6, 5, 5, 5, 29, 29, 29, 29, 21, 29, 29, 29,
+        17, 17, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 29, 29, 4, 4, 4, 4, 4, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29,
+        29, 29, 29, 29, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 10, 29, 29, 29, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        4, 4, 4, 4, 4, 4, 4, 5, 5, 6, 6, 5,
+        29, 29, 17, 17, 4, 4, 4, 4, 4, 6, 5, 6,
+        5, 5, 5, 5, 5, 5, 5, 29, 5, 6, 5, 6,
+        6, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6,
+        6, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 29, 29, 5, 17, 17, 17, 17, 17, 17, 17, 3,
+        17, 17, 17, 17, 17, 17, 29, 29, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 29, 5, 5, 5, 5, 6, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        5, 6, 5, 5, 5, 5, 5, 6, 5, 6, 6, 6,
+        6, 6, 5, 6, 6, 4, 4, 4, 4, 4, 4, 4,
+        4, 29, 29, 29, 17, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 17, 17, 29,
+        5, 5, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 6, 5, 5, 5, 5, 6, 6,
+        5, 5, 6, 5, 5, 5, 4, 4, 4, 4, 4, 4,
+        4, 4, 5, 6, 5, 5, 6, 6, 6, 5, 6, 5,
+        5, 5, 6, 6, 29, 29, 29, 29, 29, 29, 29, 29,
+        17, 17, 17, 17, 4, 4, 4, 4, 6, 6, 6, 6,
+        6, 6, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5,
+        6, 6, 5, 5, 29, 29, 29, 17, 17, 17, 17, 17,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 29, 29,
+        29, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        3, 3, 3, 3, 3, 3, 17, 17, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 29, 29, 29, 29, 29, 29, 29,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29,
+        29, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17,
+        29, 29, 29, 29, 29, 29, 29, 29, 5, 5, 5, 17,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 6, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4,
+        4, 5, 4, 4, 4, 4, 4, 4, 5, 4, 4, 6,
+        5, 5, 4, 29, 29, 29, 29, 29, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 3, 3, 3, 3, 3,
+        0, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+        1, 1, 29, 29, 0, 0, 0, 0, 0, 0, 29, 29,
+        1, 1, 1, 1, 1, 1, 1, 1, 29, 0, 29, 0,
+        29, 0, 29, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 29, 29, 1, 1, 1, 1,
+        1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2,
+        1, 1, 1, 1, 1, 29, 1, 1, 0, 0, 0, 0,
+        2, 20, 1, 20, 20, 20, 1, 1, 1, 29, 1, 1,
+        0, 0, 0, 0, 2, 20, 20, 20, 1, 1, 1, 1,
+        29, 29, 1, 1, 0, 0, 0, 0, 29, 20, 20, 20,
+        1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+        0, 20, 20, 20, 29, 29, 1, 1, 1, 29, 1, 1,
+        0, 0, 0, 0, 2, 20, 20, 29, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 26, 26, 26, 26, 26,
+        12, 12, 12, 12, 12, 12, 17, 17, 15, 16, 13, 15,
+        15, 16, 13, 15, 17, 17, 17, 17, 17, 17, 17, 17,
+        23, 24, 26, 26, 26, 26, 26, 22, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 15, 16, 17, 17, 17, 17, 11,
+        11, 17, 17, 17, 18, 13, 14, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 18, 17, 11, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 22, 26, 26, 26, 26,
+        26, 29, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        10, 3, 29, 29, 10, 10, 10, 10, 10, 10, 18, 18,
+        18, 13, 14, 3, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 18, 18, 18, 13, 14, 29, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 29, 29, 29,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 7, 7,
+        7, 5, 7, 7, 7, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 21, 21, 0, 21,
+        21, 21, 21, 0, 21, 21, 1, 0, 0, 0, 1, 1,
+        0, 0, 0, 1, 21, 0, 21, 21, 18, 0, 0, 0,
+        0, 0, 21, 21, 21, 21, 21, 21, 0, 21, 0, 21,
+        0, 21, 0, 0, 0, 0, 21, 1, 0, 0, 0, 0,
+        1, 4, 4, 4, 4, 1, 21, 21, 1, 1, 0, 0,
+        18, 18, 18, 18, 18, 0, 1, 1, 1, 1, 21, 18,
+        21, 21, 1, 21, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 0, 1, 9, 9, 9, 9, 10, 21, 21,
+        29, 29, 29, 29, 18, 18, 18, 18, 18, 21, 21, 21,
+        21, 21, 18, 18, 21, 21, 21, 21, 18, 21, 21, 18,
+        21, 21, 18, 21, 21, 21, 21, 21, 21, 21, 18, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 18, 18, 21, 21, 18, 21, 18, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 21, 21, 21, 21, 21, 21, 21, 21,
+        13, 14, 13, 14, 21, 21, 21, 21, 18, 18, 21, 21,
+        21, 21, 21, 21, 21, 13, 14, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        18, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        18, 18, 18, 18, 18, 18, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 29,
+        29, 29, 29, 29, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 10, 10, 10, 10, 10, 10,
+        21, 21, 21, 21, 21, 21, 21, 18, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 18, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 18, 18, 18, 18, 18, 18, 18, 18,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 18, 21, 21, 21, 21, 21, 21, 21, 21,
+        13, 14, 13, 14, 13, 14, 13, 14, 13, 14, 13, 14,
+        13, 14, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 18, 18, 18, 18, 18, 13, 14, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 13, 14, 13, 14, 13, 14, 13, 14, 13, 14,
+        18, 18, 18, 13, 14, 13, 14, 13, 14, 13, 14, 13,
+        14, 13, 14, 13, 14, 13, 14, 13, 14, 13, 14, 13,
+        14, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 13, 14, 13, 14, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        13, 14, 18, 18, 18, 18, 18, 18, 18, 21, 21, 18,
+        18, 18, 18, 18, 18, 21, 21, 21, 21, 21, 21, 21,
+        29, 29, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 29, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 0, 1, 0, 0, 0, 1, 1, 0,
+        1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1,
+        1, 0, 1, 1, 1, 1, 1, 1, 3, 3, 0, 0,
+        0, 1, 0, 1, 1, 21, 21, 21, 21, 21, 21, 0,
+        1, 0, 1, 5, 5, 5, 0, 1, 29, 29, 29, 29,
+        29, 17, 17, 17, 17, 10, 17, 17, 1, 1, 1, 1,
+        1, 1, 29, 1, 29, 29, 29, 29, 29, 1, 29, 29,
+        4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29,
+        29, 29, 29, 3, 17, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 5, 4, 4, 4, 4,
+        4, 4, 4, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        4, 4, 4, 4, 4, 4, 4, 29, 4, 4, 4, 4,
+        4, 4, 4, 29, 17, 17, 15, 16, 15, 16, 17, 17,
+        17, 15, 16, 17, 15, 16, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 12, 17, 17, 12, 17, 15, 16, 17, 17,
+        15, 16, 13, 14, 13, 14, 13, 14, 13, 14, 17, 17,
+        17, 17, 17, 3, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 12, 12, 17, 17, 17, 17, 12, 17, 13, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        21, 21, 17, 17, 17, 13, 14, 13, 14, 13, 14, 13,
+        14, 12, 29, 29, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 29, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        21, 21, 21, 21, 21, 21, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 29, 29, 29, 29, 22, 17, 17, 17,
+        21, 3, 4, 9, 13, 14, 13, 14, 13, 14, 13, 14,
+        13, 14, 21, 21, 13, 14, 13, 14, 13, 14, 13, 14,
+        12, 13, 14, 14, 21, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 5, 5, 5, 5, 6, 6, 12, 3, 3, 3,
+        3, 3, 21, 21, 9, 9, 9, 3, 4, 17, 21, 21,
+        4, 4, 4, 4, 4, 4, 4, 29, 29, 5, 5, 20,
+        20, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 17, 3, 3, 3, 4, 29, 29, 29, 29,
+        29, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        21, 21, 10, 10, 10, 10, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 29, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 10, 10, 10, 10,
+        10, 10, 10, 10, 21, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4,
+        4, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        3, 17, 17, 17, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 4, 4, 29, 29, 29, 29, 0, 1, 0, 1,
+        0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 4, 5,
+        7, 7, 7, 17, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 17, 3, 0, 1, 0, 1, 0, 1, 0, 1,
+        0, 1, 0, 1, 3, 3, 5, 5, 4, 4, 4, 4,
+        4, 4, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        5, 5, 17, 17, 17, 17, 17, 17, 29, 29, 29, 29,
+        29, 29, 29, 29, 20, 20, 20, 20, 20, 20, 20, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 20, 20, 0, 1,
+        0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+        1, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+        0, 1, 0, 1, 3, 1, 1, 1, 1, 1, 1, 1,
+        1, 0, 1, 0, 1, 0, 0, 1, 0, 1, 0, 1,
+        0, 1, 0, 1, 3, 20, 20, 0, 1, 0, 1, 4,
+        0, 1, 0, 1, 1, 1, 0, 1, 0, 1, 0, 1,
+        0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+        0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+        0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+        0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 29,
+        29, 29, 29, 29, 0, 1, 29, 1, 29, 1, 0, 1,
+        0, 1, 29, 29, 29, 29, 29, 29, 29, 29, 3, 3,
+        3, 0, 1, 4, 3, 3, 1, 4, 4, 4, 4, 4,
+        4, 4, 5, 4, 4, 4, 5, 4, 4, 4, 4, 5,
+        4, 4, 4, 4, 4, 4, 4, 6, 6, 5, 5, 6,
+        21, 21, 21, 21, 5, 29, 29, 29, 10, 10, 10, 10,
+        10, 10, 21, 21, 19, 21, 29, 29, 29, 29, 29, 29,
+        4, 4, 4, 4, 17, 17, 17, 17, 29, 29, 29, 29,
+        29, 29, 29, 29, 6, 6, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 5, 5, 29, 29, 29, 29, 29, 29,
+        29, 29, 17, 17, 5, 5, 4, 4, 4, 4, 4, 4,
+        17, 17, 17, 4, 17, 4, 4, 5, 4, 4, 4, 4,
+        4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 17, 17,
+        4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 6, 6, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 17, 4, 4, 4, 5,
+        6, 6, 5, 5, 5, 5, 6, 6, 5, 5, 6, 6,
+        6, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 29, 3, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 29, 29, 29, 29, 17, 17, 4, 4, 4, 4,
+        4, 5, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4,
+        4, 4, 4, 29, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 5, 5, 5, 5, 5, 5, 6, 6, 5, 5, 6,
+        6, 5, 5, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        4, 4, 4, 5, 4, 4, 4, 4, 4, 4, 4, 4,
+        5, 6, 29, 29, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 29, 29, 17, 17, 17, 17, 3, 4, 4, 4,
+        4, 4, 4, 21, 21, 21, 4, 6, 5, 6, 4, 4,
+        5, 4, 5, 5, 5, 4, 4, 5, 5, 4, 4, 4,
+        4, 4, 5, 5, 4, 5, 4, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 4, 4, 3, 17, 17,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 6,
+        5, 5, 6, 6, 17, 17, 4, 3, 3, 6, 5, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 4, 4, 4,
+        4, 4, 4, 29, 29, 4, 4, 4, 4, 4, 4, 29,
+        29, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 20, 3, 3, 3, 3, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 3, 20, 20, 29, 29, 29, 29,
+        4, 4, 4, 6, 6, 5, 6, 6, 5, 6, 6, 17,
+        6, 5, 29, 29, 4, 4, 4, 4, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 4, 4, 4, 4,
+        4, 4, 4, 29, 29, 29, 29, 4, 4, 4, 4, 4,
+        27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+        27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 28,
+        28, 28, 28, 28, 28, 28, 28, 28, 1, 1, 1, 1,
+        1, 1, 1, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 1, 1, 1, 1, 1, 29, 29, 29, 29,
+        29, 4, 5, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 18, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 29, 4, 4, 4, 4, 4, 29, 4, 29,
+        4, 4, 29, 4, 4, 29, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 14, 13, 29, 29, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29,
+        29, 29, 29, 21, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 19, 21, 21, 21, 17, 17, 17, 17,
+        17, 17, 17, 13, 14, 17, 29, 29, 29, 29, 29, 29,
+        17, 12, 12, 11, 11, 13, 14, 13, 14, 13, 14, 13,
+        14, 13, 14, 13, 14, 13, 14, 13, 14, 17, 17, 13,
+        14, 17, 17, 17, 17, 11, 11, 11, 17, 17, 17, 29,
+        17, 17, 17, 17, 12, 13, 14, 13, 14, 13, 14, 17,
+        17, 17, 18, 12, 18, 18, 18, 29, 17, 19, 17, 17,
+        29, 29, 29, 29, 4, 4, 4, 4, 4, 29, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 26,
+        29, 17, 17, 17, 19, 17, 17, 17, 13, 14, 17, 18,
+        17, 12, 17, 17, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 13, 18, 14, 18, 13, 14, 17, 13, 14,
+        17, 17, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 3, 3, 29, 29, 4, 4,
+        4, 4, 4, 4, 29, 29, 4, 4, 4, 4, 4, 4,
+        29, 29, 4, 4, 4, 4, 4, 4, 29, 29, 4, 4,
+        4, 29, 29, 29, 19, 19, 18, 20, 21, 19, 19, 29,
+        21, 18, 18, 18, 18, 21, 21, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 26, 26, 26, 21, 21, 29, 29,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        29, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 29, 4, 4, 29, 4, 17, 17, 17, 29,
+        29, 29, 29, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 29, 29, 29, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 9, 9, 9, 9, 9, 10, 10, 10,
+        10, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 10, 10, 21, 21, 21, 29,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 29, 29, 29, 21, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 5, 29, 29,
+        5, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 29, 29, 29, 29, 10, 10, 10, 10,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 4, 4, 4,
+        4, 9, 4, 4, 4, 4, 4, 4, 4, 4, 9, 29,
+        29, 29, 29, 29, 4, 4, 4, 4, 4, 4, 5, 5,
+        5, 5, 5, 29, 29, 29, 29, 29, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 17,
+        4, 4, 4, 4, 29, 29, 29, 29, 4, 4, 4, 4,
+        4, 4, 4, 4, 17, 9, 9, 9, 9, 9, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 29, 29, 29, 29, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 29, 29, 29, 29, 4, 4, 4, 4,
+        4, 4, 4, 4, 29, 29, 29, 29, 29, 29, 29, 29,
+        4, 4, 4, 4, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 17, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 29,
+        0, 0, 29, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 29, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 29, 1, 1, 1, 1, 1,
+        1, 1, 29, 1, 1, 29, 29, 29, 3, 3, 3, 3,
+        3, 3, 29, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 29, 3, 3, 3, 3, 3, 3, 3, 3, 3, 29,
+        29, 29, 29, 29, 4, 4, 4, 4, 4, 4, 29, 29,
+        4, 29, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 29, 4, 4, 29, 29, 29, 4, 29, 29, 4,
+        4, 4, 4, 4, 4, 4, 29, 17, 10, 10, 10, 10,
+        10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 21,
+        21, 10, 10, 10, 10, 10, 10, 10, 29, 29, 29, 29,
+        29, 29, 29, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        4, 4, 4, 29, 4, 4, 29, 29, 29, 29, 29, 10,
+        10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 10, 10,
+        10, 10, 10, 10, 29, 29, 29, 17, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 29, 29, 29, 29, 29, 17,
+        4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 29, 29,
+        10, 10, 4, 4, 29, 29, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 4, 5, 5, 5,
+        29, 5, 5, 29, 29, 29, 29, 29, 5, 5, 5, 5,
+        4, 4, 4, 4, 29, 4, 4, 4, 29, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29,
+        5, 5, 5, 29, 29, 29, 29, 5, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 29, 29, 29, 29, 29, 29, 29,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 29, 29, 29,
+        29, 29, 29, 29, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 10, 10, 17, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 10, 10, 10,
+        4, 4, 4, 4, 4, 4, 4, 4, 21, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 29,
+        29, 29, 29, 10, 10, 10, 10, 10, 17, 17, 17, 17,
+        17, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        4, 4, 4, 4, 4, 4, 29, 29, 29, 17, 17, 17,
+        17, 17, 17, 17, 4, 4, 4, 4, 4, 4, 29, 29,
+        10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 29,
+        29, 29, 29, 29, 10, 10, 10, 10, 10, 10, 10, 10,
+        4, 4, 29, 29, 29, 29, 29, 29, 29, 17, 17, 17,
+        17, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        1, 1, 1, 29, 29, 29, 29, 29, 29, 29, 10, 10,
+        10, 10, 10, 10, 4, 4, 4, 4, 5, 5, 5, 5,
+        29, 29, 29, 29, 29, 29, 29, 29, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 29,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 5,
+        5, 12, 29, 29, 4, 4, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 5, 5, 5,
+        10, 10, 10, 10, 10, 10, 10, 4, 29, 29, 29, 29,
+        29, 29, 29, 29, 5, 10, 10, 10, 10, 17, 17, 17,
+        17, 17, 29, 29, 29, 29, 29, 29, 4, 4, 5, 5,
+        5, 5, 17, 17, 17, 17, 29, 29, 29, 29, 29, 29,
+        4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10,
+        29, 29, 29, 29, 6, 5, 6, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 17, 17, 17, 17, 17,
+        17, 17, 29, 29, 10, 10, 10, 10, 10, 10, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 5, 4, 4, 5,
+        5, 4, 29, 29, 29, 29, 29, 29, 29, 29, 29, 5,
+        6, 6, 6, 5, 5, 5, 5, 6, 6, 5, 5, 17,
+        17, 26, 17, 17, 17, 17, 5, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 26, 29, 29, 5, 5, 5, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5,
+        6, 5, 5, 5, 5, 5, 5, 5, 5, 29, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 17, 17, 17, 17,
+        4, 6, 6, 4, 29, 29, 29, 29, 29, 29, 29, 29,
+        4, 4, 4, 5, 17, 17, 4, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 4, 4, 4, 6, 6, 6, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 6, 6, 4, 4, 4,
+        4, 17, 17, 17, 17, 5, 5, 5, 5, 17, 6, 5,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4, 17,
+        4, 17, 17, 17, 29, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        6, 6, 6, 5, 5, 5, 6, 6, 5, 6, 5, 5,
+        17, 17, 17, 17, 17, 17, 5, 4, 4, 5, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        4, 4, 4, 4, 4, 4, 4, 29, 4, 29, 4, 4,
+        4, 4, 29, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 29, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 17, 29, 29, 29, 29, 29, 29,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 5, 6, 6, 6, 5, 5, 5, 5, 5,
+        5, 5, 5, 29, 29, 29, 29, 29, 5, 5, 6, 6,
+        29, 4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 4,
+        4, 29, 4, 4, 29, 4, 4, 4, 4, 4, 29, 5,
+        5, 4, 6, 6, 5, 6, 6, 6, 6, 29, 29, 6,
+        6, 29, 29, 6, 6, 6, 29, 29, 4, 29, 29, 29,
+        29, 29, 29, 6, 29, 29, 29, 29, 29, 4, 4, 4,
+        4, 4, 6, 6, 29, 29, 5, 5, 5, 5, 5, 5,
+        5, 29, 29, 29, 5, 5, 5, 5, 5, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 4, 4, 4, 4,
+        4, 6, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5,
+        6, 6, 5, 5, 5, 6, 5, 4, 4, 4, 4, 17,
+        17, 17, 17, 17, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 17, 17, 29, 17, 5, 4, 6, 6, 6, 5,
+        5, 5, 5, 5, 5, 6, 5, 6, 6, 6, 6, 5,
+        5, 6, 5, 5, 4, 4, 17, 4, 29, 29, 29, 29,
+        29, 29, 29, 29, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 6, 6, 6, 5, 5,
+        5, 5, 29, 29, 6, 6, 6, 6, 5, 5, 6, 5,
+        5, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        4, 4, 4, 4, 5, 5, 29, 29, 6, 6, 6, 5,
+        5, 5, 5, 5, 5, 5, 5, 6, 6, 5, 6, 5,
+        5, 17, 17, 17, 4, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 29, 29, 29, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 5, 6, 5, 6, 6,
+        5, 5, 5, 5, 5, 5, 6, 5, 4, 17, 29, 29,
+        29, 29, 29, 29, 6, 6, 5, 5, 5, 5, 6, 5,
+        5, 5, 5, 5, 29, 29, 29, 29, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 10, 10, 17, 17, 17, 21,
+        5, 5, 5, 5, 5, 5, 5, 5, 6, 5, 5, 17,
+        29, 29, 29, 29, 10, 10, 10, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 4, 4, 4, 4, 4,
+        4, 4, 4, 29, 29, 4, 29, 29, 4, 4, 4, 4,
+        4, 4, 4, 4, 29, 4, 4, 29, 4, 4, 4, 4,
+        4, 4, 4, 4, 6, 6, 6, 6, 6, 6, 29, 6,
+        6, 29, 29, 5, 5, 6, 5, 4, 6, 4, 6, 5,
+        17, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 4, 4,
+        4, 4, 4, 4, 4, 6, 6, 6, 5, 5, 5, 5,
+        29, 29, 5, 5, 6, 6, 6, 6, 5, 4, 17, 4,
+        6, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4,
+        4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5,
+        5, 6, 4, 5, 5, 5, 5, 17, 17, 17, 17, 17,
+        17, 17, 17, 5, 29, 29, 29, 29, 29, 29, 29, 29,
+        4, 5, 5, 5, 5, 5, 5, 6, 6, 5, 5, 5,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 6, 5, 5, 17, 17, 17, 4, 17, 17,
+        17, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 29, 29, 29, 29, 29, 29, 5, 5, 5, 5,
+        5, 5, 5, 29, 5, 5, 5, 5, 5, 5, 6, 5,
+        4, 17, 17, 17, 17, 17, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 17, 17, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 29, 29, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 29, 6, 5, 5,
+        5, 5, 5, 5, 5, 6, 5, 5, 6, 5, 5, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 4, 4, 4, 4,
+        4, 4, 4, 29, 4, 4, 29, 4, 4, 4, 4, 4,
+        4, 5, 5, 5, 5, 5, 5, 29, 29, 29, 5, 29,
+        5, 5, 29, 5, 5, 5, 5, 5, 5, 5, 4, 5,
+        29, 29, 29, 29, 29, 29, 29, 29, 4, 4, 4, 4,
+        4, 4, 29, 4, 4, 29, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 6, 6,
+        6, 6, 6, 29, 5, 5, 29, 6, 6, 5, 6, 5,
+        4, 29, 29, 29, 29, 29, 29, 29, 4, 4, 4, 5,
+        5, 6, 6, 17, 17, 29, 29, 29, 29, 29, 29, 29,
+        5, 5, 4, 6, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 6, 6, 5, 5,
+        5, 5, 5, 29, 29, 29, 6, 6, 5, 6, 5, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        10, 10, 10, 10, 10, 21, 21, 21, 21, 21, 21, 21,
+        21, 19, 19, 19, 19, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 17,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 29, 17, 17, 17, 17, 17, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 4, 17, 17, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 5, 4, 4, 4, 4, 4, 4, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        5, 5, 5, 5, 5, 17, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 5, 5, 5, 5, 5, 5, 5, 17,
+        17, 17, 17, 17, 21, 21, 21, 21, 3, 3, 3, 3,
+        17, 21, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 29, 10,
+        10, 10, 10, 10, 10, 10, 29, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 29, 29, 29, 29, 29, 4, 4, 4,
+        10, 10, 10, 10, 10, 10, 10, 17, 17, 17, 17, 29,
+        29, 29, 29, 29, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 29, 29, 29, 29, 5, 4, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        29, 29, 29, 29, 29, 29, 29, 5, 5, 5, 5, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 17, 3, 5, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 6, 6, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 3, 3, 3, 3,
+        29, 3, 3, 3, 3, 3, 3, 3, 29, 3, 3, 29,
+        4, 4, 4, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 4, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 4, 4, 4, 29,
+        29, 4, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 4, 4, 4, 4, 29, 29, 29, 29,
+        29, 29, 29, 29, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 29, 29, 21, 5, 5, 17, 26, 26, 26, 26,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 29, 29, 5, 5, 5, 5, 5, 5, 5, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 21, 21, 21, 21,
+        21, 21, 21, 29, 29, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 6, 6, 5, 5, 5, 21, 21,
+        21, 6, 6, 6, 6, 6, 6, 26, 26, 26, 26, 26,
+        26, 26, 26, 5, 5, 5, 5, 5, 5, 5, 5, 21,
+        21, 5, 5, 5, 5, 5, 5, 5, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 5, 5,
+        5, 5, 21, 21, 21, 21, 5, 5, 5, 21, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 10, 10, 10, 10,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+        1, 1, 1, 1, 1, 29, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 0, 29, 0, 0,
+        29, 29, 0, 29, 29, 0, 0, 29, 29, 0, 0, 0,
+        0, 29, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+        1, 1, 29, 1, 29, 1, 1, 1, 1, 1, 1, 1,
+        29, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 0, 0, 29, 0, 0, 0, 0, 29,
+        29, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0,
+        0, 0, 0, 0, 0, 29, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 0, 0, 29, 0, 0, 0, 0, 29,
+        0, 0, 0, 0, 0, 29, 0, 29, 29, 29, 0, 0,
+        0, 0, 0, 0, 0, 29, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 29, 29,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18,
+        1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 18, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 18, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18,
+        1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 18, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 18, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 18, 1, 1, 1, 1,
+        1, 1, 0, 1, 29, 29, 8, 8, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        5, 5, 5, 5, 5, 5, 5, 21, 21, 21, 21, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 21, 21, 21, 21, 21, 21, 21,
+        21, 5, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 5, 21, 21, 17, 17, 17, 17, 17,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 5, 5, 5, 5, 5, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 4, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 29, 29, 29, 29, 29, 29, 1, 1, 1,
+        1, 1, 1, 29, 29, 29, 29, 29, 5, 5, 5, 5,
+        5, 5, 5, 29, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 29, 29, 5,
+        5, 5, 5, 5, 5, 5, 29, 5, 5, 29, 5, 5,
+        5, 5, 5, 29, 29, 29, 29, 29, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 5, 5, 5, 5, 5, 5, 5, 5, 3,
+        3, 3, 3, 3, 3, 3, 29, 29, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 29, 29, 29, 29, 4, 21,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 5, 29, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 5, 5, 5, 5, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 29, 29, 29, 29, 29, 19,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3,
+        5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 29,
+        4, 4, 4, 4, 29, 4, 4, 29, 4, 4, 4, 4,
+        4, 29, 29, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        1, 1, 1, 1, 5, 5, 5, 5, 5, 5, 5, 3,
+        29, 29, 29, 29, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 21, 10, 10, 10, 19, 10, 10, 10,
+        10, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 21, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 29, 29, 4, 4, 4, 4,
+        29, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        29, 4, 4, 29, 4, 29, 29, 4, 29, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 29, 4, 4, 4, 4,
+        29, 4, 29, 4, 29, 29, 29, 29, 29, 29, 4, 29,
+        29, 29, 29, 4, 29, 4, 29, 4, 29, 4, 4, 4,
+        29, 4, 4, 29, 4, 29, 29, 4, 29, 4, 29, 4,
+        29, 4, 29, 4, 29, 4, 4, 29, 4, 29, 29, 4,
+        4, 4, 4, 29, 4, 4, 4, 4, 4, 4, 4, 29,
+        4, 4, 4, 4, 29, 4, 4, 4, 4, 29, 4, 29,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 29, 4,
+        4, 4, 4, 4, 29, 4, 4, 4, 29, 4, 4, 4,
+        4, 4, 29, 4, 4, 4, 4, 4, 18, 18, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 29, 29,
+        29, 29, 29, 29, 29, 29, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 29, 29, 29, 29, 29, 29, 29,
+        21, 21, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 20, 20, 20, 20, 20, 21, 21, 21, 21,
+        21, 21, 21, 21, 29, 29, 29, 29, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 29, 29, 29, 29, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        29, 29, 29, 29, 29, 29, 29, 29, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 29, 21,
+        21, 21, 21, 21, 21, 21, 29, 29, 29, 29, 29, 29,
+        29, 29, 21, 21, 21, 21, 21, 29, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 29, 26, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+        28, 28, 29, 29,
+    };
+
+    inline constexpr int SCRIPT_SHIFT1 = 5;
+    inline constexpr int SCRIPT_SHIFT2 = 4;
+    inline constexpr uint8_t SCRIPT_INDEX[2176] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+        12, 13, 14, 15, 16, 17, 18, 17, 19, 20, 21, 22,
+        23, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 26, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 27, 27, 28, 29,
+        30, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 35, 36, 37, 38, 39, 40, 41, 42,
+        43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54,
+        55, 56, 57, 34, 34, 34, 34, 58, 59, 59, 60, 34,
+        34, 34, 34, 34, 34, 34, 61, 62, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        63, 64, 34, 65, 66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 67, 66, 68, 69, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 70,
+        71, 72, 34, 34, 34, 34, 73, 34, 34, 34, 34, 34,
+        34, 34, 34, 74, 75, 76, 77, 78, 79, 80, 34, 81,
+        82, 83, 84, 85, 86, 34, 87, 88, 89, 90, 17, 91,
+        92, 93, 34, 34, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 94, 25, 25, 25, 25, 25, 25, 25, 95,
+        96, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 97,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 98, 34, 34, 34, 34, 34, 34, 25, 99, 34, 34,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 100, 25, 25,
+        25, 25, 25, 25, 25, 101, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 102, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34,
+    };
+    inline constexpr uint16_t SCRIPT_MIDDLE[3296] = {
+        0, 0, 0, 0, 1, 2, 1, 2, 0, 0, 3, 3,
+        4, 5, 4, 5, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 6, 0, 0, 7, 0,
+        8, 8, 8, 8, 8, 8, 8, 9, 10, 11, 12, 11,
+        11, 11, 13, 11, 14, 14, 14, 14, 14, 14, 14, 14,
+        15, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 16,
+        17, 18, 17, 17, 19, 20, 21, 21, 22, 21, 23, 24,
+        25, 26, 27, 27, 28, 29, 27, 30, 27, 27, 27, 27,
+        27, 31, 27, 27, 32, 33, 33, 33, 34, 27, 27, 27,
+        35, 35, 35, 36, 37, 37, 37, 38, 39, 39, 40, 41,
+        42, 43, 44, 27, 45, 46, 27, 27, 27, 27, 47, 27,
+        48, 48, 48, 48, 48, 49, 50, 48, 51, 52, 53, 54,
+        55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+        67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78,
+        79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+        91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102,
+        103, 104, 105, 106, 107, 108, 109, 109, 110, 111, 112, 109,
+        113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 122, 123,
+        122, 124, 125, 125, 126, 127, 128, 129, 130, 131, 125, 125,
+        132, 132, 132, 132, 133, 132, 134, 135, 132, 133, 132, 136,
+        136, 137, 125, 125, 138, 138, 138, 138, 138, 138, 138, 138,
+        138, 138, 139, 139, 140, 139, 139, 141, 142, 142, 142, 142,
+        142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+        143, 143, 143, 143, 144, 145, 143, 143, 144, 143, 143, 146,
+        147, 148, 143, 143, 143, 147, 143, 143, 143, 149, 143, 150,
+        143, 151, 152, 152, 152, 152, 152, 153, 154, 154, 154, 154,
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+        155, 156, 157, 157, 157, 157, 158, 159, 160, 161, 162, 163,
+        164, 165, 166, 167, 168, 168, 168, 168, 168, 169, 170, 170,
+        171, 172, 173, 173, 173, 173, 173, 174, 173, 173, 175, 154,
+        154, 154, 154, 176, 177, 178, 179, 179, 180, 181, 182, 183,
+        184, 184, 185, 184, 186, 187, 168, 168, 188, 189, 190, 190,
+        190, 191, 190, 192, 193, 193, 194, 8, 195, 125, 125, 125,
+        196, 196, 196, 196, 197, 196, 196, 198, 199, 199, 199, 199,
+        200, 200, 200, 201, 202, 202, 202, 203, 204, 205, 205, 205,
+        206, 139, 139, 207, 208, 209, 210, 211, 4, 4, 212, 4,
+        4, 213, 214, 215, 4, 4, 4, 216, 8, 8, 8, 8,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 11, 217, 11, 11, 217, 218, 11, 219,
+        11, 11, 11, 220, 220, 221, 11, 222, 223, 0, 0, 0,
+        0, 0, 224, 225, 226, 227, 0, 0, 228, 8, 8, 229,
+        0, 0, 230, 231, 232, 0, 4, 4, 233, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 234, 125, 235, 125, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 236, 236, 236, 236,
+        236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 237, 0, 238, 0, 0, 0, 0, 0, 0,
+        239, 239, 239, 239, 239, 239, 4, 4, 240, 240, 240, 240,
+        240, 240, 240, 241, 139, 139, 140, 242, 242, 242, 243, 244,
+        143, 245, 246, 246, 246, 246, 14, 14, 0, 0, 0, 0,
+        0, 247, 125, 125, 248, 249, 248, 248, 248, 248, 248, 250,
+        248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+        248, 251, 125, 252, 253, 0, 254, 255, 256, 257, 257, 257,
+        257, 258, 259, 260, 260, 260, 260, 261, 262, 263, 263, 264,
+        142, 142, 142, 142, 265, 0, 263, 263, 0, 0, 266, 260,
+        142, 265, 0, 0, 0, 0, 142, 267, 0, 0, 0, 0,
+        0, 260, 260, 268, 260, 260, 260, 260, 260, 269, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 248, 248, 248, 248,
+        248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+        248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+        248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+        248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+        248, 248, 248, 248, 248, 248, 248, 248, 0, 0, 0, 0,
+        270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270,
+        270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270,
+        270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270,
+        270, 270, 270, 270, 271, 270, 270, 270, 272, 273, 273, 273,
+        274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+        274, 274, 274, 274, 274, 274, 275, 125, 14, 14, 14, 14,
+        14, 14, 276, 276, 276, 276, 276, 277, 0, 0, 278, 4,
+        4, 4, 4, 4, 279, 4, 4, 4, 280, 281, 125, 282,
+        283, 283, 284, 285, 286, 286, 286, 287, 288, 288, 288, 288,
+        289, 290, 48, 48, 291, 291, 292, 293, 293, 294, 142, 295,
+        296, 296, 296, 296, 297, 298, 138, 299, 300, 300, 300, 301,
+        302, 303, 138, 138, 304, 304, 304, 304, 305, 306, 307, 308,
+        309, 310, 246, 4, 4, 311, 312, 152, 152, 152, 152, 152,
+        307, 307, 313, 314, 142, 142, 142, 142, 142, 142, 142, 142,
+        142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+        142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+        142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+        142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+        142, 142, 315, 142, 316, 142, 142, 317, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 248, 248, 248, 248,
+        248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+        248, 248, 248, 248, 248, 248, 318, 248, 248, 248, 248, 248,
+        248, 319, 125, 125, 320, 321, 21, 322, 323, 27, 27, 27,
+        27, 27, 27, 27, 324, 325, 27, 27, 27, 27, 27, 27,
+        27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+        27, 27, 27, 326, 27, 27, 27, 27, 27, 327, 27, 27,
+        328, 125, 125, 27, 8, 285, 329, 0, 0, 330, 331, 332,
+        27, 27, 27, 27, 27, 27, 27, 333, 334, 0, 1, 2,
+        1, 2, 335, 259, 260, 336, 142, 265, 337, 338, 339, 340,
+        341, 342, 343, 344, 345, 345, 125, 125, 342, 342, 342, 342,
+        342, 342, 342, 346, 347, 0, 0, 348, 11, 11, 11, 11,
+        349, 350, 351, 125, 125, 0, 0, 352, 125, 125, 125, 125,
+        125, 125, 125, 125, 353, 354, 355, 355, 355, 356, 357, 252,
+        358, 358, 359, 360, 361, 362, 362, 363, 364, 365, 366, 366,
+        367, 368, 125, 125, 369, 369, 369, 369, 369, 370, 370, 370,
+        371, 372, 373, 374, 374, 375, 374, 376, 377, 377, 378, 379,
+        379, 379, 380, 381, 381, 382, 383, 384, 125, 125, 125, 125,
+        385, 385, 385, 385, 385, 385, 385, 385, 385, 385, 385, 385,
+        385, 385, 385, 385, 385, 385, 385, 386, 385, 387, 388, 125,
+        389, 4, 4, 390, 125, 125, 125, 125, 391, 392, 392, 393,
+        394, 395, 396, 396, 397, 398, 399, 125, 125, 125, 400, 401,
+        402, 403, 404, 405, 125, 125, 125, 125, 406, 406, 407, 408,
+        407, 409, 407, 407, 410, 411, 412, 413, 414, 414, 415, 415,
+        416, 416, 125, 125, 417, 417, 418, 419, 420, 420, 420, 421,
+        422, 423, 424, 425, 426, 427, 428, 125, 125, 125, 125, 125,
+        429, 429, 429, 429, 430, 125, 125, 125, 431, 431, 431, 432,
+        431, 431, 431, 433, 434, 434, 435, 436, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 27, 45, 437, 437, 438, 439, 125, 125, 125, 440,
+        441, 441, 442, 443, 443, 444, 125, 445, 446, 125, 125, 447,
+        448, 125, 449, 450, 451, 451, 451, 451, 452, 453, 451, 454,
+        455, 455, 455, 455, 456, 457, 458, 459, 460, 460, 460, 461,
+        462, 463, 463, 464, 465, 465, 465, 465, 465, 465, 466, 467,
+        468, 469, 468, 468, 470, 125, 125, 125, 471, 472, 473, 474,
+        474, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484,
+        125, 125, 125, 125, 125, 125, 125, 125, 485, 485, 485, 485,
+        485, 486, 487, 125, 488, 488, 488, 488, 489, 490, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 491, 491, 491, 492,
+        491, 493, 125, 125, 494, 494, 494, 494, 495, 496, 497, 125,
+        498, 498, 498, 499, 499, 125, 125, 125, 500, 501, 502, 500,
+        503, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        504, 504, 504, 505, 125, 125, 125, 125, 125, 125, 506, 506,
+        506, 506, 506, 507, 508, 509, 510, 511, 512, 513, 125, 125,
+        125, 125, 514, 515, 515, 514, 516, 125, 517, 517, 517, 517,
+        518, 519, 519, 519, 519, 519, 520, 154, 521, 521, 521, 522,
+        523, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 524, 525, 525, 526, 527, 525, 528, 529,
+        529, 530, 531, 532, 125, 125, 125, 125, 533, 534, 534, 535,
+        536, 537, 538, 539, 540, 541, 542, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 543, 544, 545, 546, 545, 547, 545, 548, 125, 125,
+        125, 125, 125, 549, 550, 550, 550, 551, 552, 552, 552, 552,
+        552, 552, 552, 552, 552, 552, 552, 552, 552, 552, 552, 552,
+        552, 552, 552, 552, 552, 552, 552, 552, 552, 552, 552, 552,
+        552, 552, 552, 552, 552, 552, 552, 552, 552, 552, 552, 552,
+        552, 552, 552, 552, 552, 552, 552, 552, 552, 552, 552, 552,
+        552, 552, 552, 552, 552, 553, 125, 125, 125, 125, 125, 125,
+        552, 552, 552, 552, 552, 552, 554, 555, 552, 552, 552, 552,
+        552, 552, 552, 552, 552, 552, 552, 552, 556, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 557, 557, 557,
+        557, 557, 557, 558, 559, 559, 559, 559, 559, 559, 559, 559,
+        559, 559, 559, 559, 559, 559, 559, 559, 559, 559, 559, 559,
+        559, 559, 559, 559, 559, 559, 559, 559, 559, 559, 559, 559,
+        559, 559, 559, 559, 559, 560, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 561, 561, 561, 561,
+        561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+        561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+        561, 561, 561, 561, 561, 561, 561, 561, 562, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276,
+        276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276,
+        276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 563,
+        564, 565, 566, 567, 567, 567, 567, 568, 569, 570, 571, 572,
+        573, 573, 573, 573, 574, 575, 576, 577, 573, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 578, 578, 578, 578,
+        578, 579, 125, 125, 125, 125, 125, 125, 580, 580, 580, 580,
+        581, 580, 580, 580, 582, 580, 125, 125, 125, 125, 583, 584,
+        585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585,
+        585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585,
+        585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585,
+        585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585,
+        585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585,
+        585, 585, 585, 586, 585, 585, 585, 585, 585, 585, 585, 585,
+        585, 585, 585, 585, 585, 585, 585, 585, 587, 587, 587, 587,
+        587, 587, 587, 587, 587, 587, 587, 587, 587, 587, 587, 587,
+        587, 587, 587, 587, 587, 587, 587, 587, 587, 587, 587, 587,
+        587, 588, 125, 125, 589, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 590, 591, 257, 257, 257, 257, 257, 257, 257,
+        257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 592, 593,
+        125, 594, 595, 596, 596, 596, 596, 596, 596, 596, 596, 596,
+        596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596,
+        596, 596, 596, 597, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 598, 598, 598, 598,
+        598, 598, 599, 600, 601, 602, 266, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 8, 8, 603, 8,
+        604, 0, 0, 0, 0, 0, 0, 0, 266, 125, 125, 125,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 605, 0, 0, 606, 0, 0, 0, 607, 608,
+        609, 0, 610, 0, 0, 0, 235, 125, 11, 11, 11, 11,
+        611, 125, 125, 125, 125, 125, 125, 125, 0, 266, 0, 266,
+        0, 0, 0, 0, 0, 234, 0, 612, 125, 125, 125, 125,
+        125, 125, 125, 125, 0, 0, 0, 0, 0, 224, 0, 0,
+        0, 613, 614, 615, 616, 0, 0, 0, 617, 618, 0, 619,
+        620, 621, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 622, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 623, 0, 0, 0, 624, 624, 624, 624,
+        624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 624,
+        624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 624,
+        624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 624,
+        625, 626, 627, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 4, 628, 629, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 630, 631, 632, 14,
+        14, 14, 633, 125, 634, 125, 125, 125, 125, 125, 125, 125,
+        635, 635, 636, 637, 638, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 639, 640, 125, 641, 641, 641, 642, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 643, 643, 644, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 645, 646, 647, 647, 647, 647, 647, 647, 647, 647,
+        647, 647, 647, 647, 648, 649, 125, 125, 650, 650, 650, 650,
+        651, 652, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 334, 0, 0, 0, 653,
+        125, 125, 125, 125, 334, 0, 0, 247, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 654, 27, 655, 656,
+        657, 658, 659, 660, 661, 662, 663, 662, 125, 125, 125, 664,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 0, 0, 252, 0, 0, 0, 0, 0,
+        0, 266, 226, 334, 334, 334, 0, 605, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 247, 125, 125, 125, 665, 0,
+        666, 0, 0, 252, 612, 667, 605, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 668, 350, 350,
+        0, 0, 0, 0, 0, 0, 0, 669, 0, 0, 0, 0,
+        0, 285, 252, 228, 252, 0, 0, 0, 670, 285, 0, 0,
+        670, 0, 247, 667, 125, 125, 125, 125, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 266, 247, 350, 612, 0, 0, 671,
+        672, 252, 612, 612, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 330, 0, 0, 235, 125, 125, 285, 248, 248, 248, 248,
+        248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 125, 125,
+        248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+        248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+        248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 319,
+        248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+        248, 318, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+        248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+        248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+        248, 248, 248, 248, 248, 248, 584, 248, 248, 248, 248, 248,
+        248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+        248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+        248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+        248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 673, 125,
+        248, 318, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 248, 248, 248, 248,
+        248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+        248, 248, 248, 248, 674, 248, 248, 248, 248, 248, 248, 248,
+        248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+        248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+        248, 248, 248, 248, 248, 248, 248, 125, 125, 125, 125, 125,
+        675, 125, 0, 0, 0, 0, 0, 0, 125, 125, 125, 125,
+        125, 125, 125, 125, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 125,
+    };
+    inline constexpr uint8_t SCRIPT_BLOCKS[10816] = {
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 71, 71, 71, 71, 71, 71, 71,
+        71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+        71, 71, 71, 71, 71, 71, 71, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 71, 25,
+        25, 25, 25, 25, 71, 71, 71, 71, 71, 71, 71, 71,
+        71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+        71, 71, 71, 25, 71, 71, 71, 71, 71, 71, 71, 71,
+        71, 71, 71, 71, 71, 71, 71, 71, 71, 25, 25, 25,
+        25, 25, 25, 25, 71, 71, 71, 71, 71, 25, 25, 25,
+        25, 25, 13, 13, 25, 25, 25, 25, 56, 56, 56, 56,
+        56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+        44, 44, 44, 44, 25, 44, 44, 44, 0, 0, 44, 44,
+        44, 44, 25, 44, 0, 0, 0, 0, 44, 25, 44, 25,
+        44, 44, 44, 0, 44, 0, 44, 44, 44, 44, 44, 44,
+        44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+        44, 44, 0, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+        44, 44, 44, 44, 44, 44, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 30, 30, 30, 30,
+        30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        30, 30, 30, 30, 30, 56, 56, 30, 30, 30, 30, 30,
+        30, 30, 30, 30, 0, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 0, 0, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 0, 0, 5, 5, 5, 0, 53, 53, 53,
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+        0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53, 53,
+        53, 53, 53, 53, 53, 53, 53, 0, 0, 0, 0, 53,
+        53, 53, 53, 53, 53, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4, 4, 4, 4, 4, 25, 4, 4,
+        4, 4, 4, 4, 25, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 25, 4, 4, 4, 25,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 25, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+        56, 56, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        56, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 25, 4, 4, 139, 139, 139, 139,
+        139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 0, 139,
+        139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+        139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+        139, 139, 139, 0, 0, 139, 139, 139, 150, 150, 150, 150,
+        150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+        150, 150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 0, 0, 102, 102, 102,
+        127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+        127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+        127, 127, 127, 127, 127, 127, 0, 0, 127, 127, 127, 127,
+        127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 0,
+        82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+        82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+        82, 82, 82, 82, 0, 0, 82, 0, 139, 139, 139, 139,
+        139, 139, 139, 139, 139, 139, 139, 0, 0, 0, 0, 0,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 0, 4, 4, 0, 0, 0, 0, 0, 0,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 25, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 56, 56, 56, 56, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        25, 25, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        11, 11, 11, 11, 0, 11, 11, 11, 11, 11, 11, 11,
+        11, 0, 0, 11, 11, 0, 0, 11, 11, 11, 11, 11,
+        11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+        11, 11, 11, 11, 11, 0, 11, 11, 11, 11, 11, 11,
+        11, 0, 11, 0, 0, 0, 11, 11, 11, 11, 0, 0,
+        11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 11,
+        11, 0, 0, 11, 11, 11, 11, 0, 0, 0, 0, 0,
+        0, 0, 0, 11, 0, 0, 0, 0, 11, 11, 0, 11,
+        11, 11, 11, 11, 0, 0, 11, 11, 11, 11, 11, 11,
+        11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+        11, 11, 11, 11, 11, 11, 11, 0, 0, 47, 47, 47,
+        0, 47, 47, 47, 47, 47, 47, 0, 0, 0, 0, 47,
+        47, 0, 0, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+        47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+        47, 0, 47, 47, 47, 47, 47, 47, 47, 0, 47, 47,
+        0, 47, 47, 0, 47, 47, 0, 0, 47, 0, 47, 47,
+        47, 47, 47, 0, 0, 0, 0, 47, 47, 0, 0, 47,
+        47, 47, 0, 0, 0, 47, 0, 0, 0, 0, 0, 0,
+        0, 47, 47, 47, 47, 0, 47, 0, 0, 0, 0, 0,
+        0, 0, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+        47, 47, 47, 47, 47, 47, 47, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 45, 45, 45, 0, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 0, 45, 45, 45, 0, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 0, 45, 45,
+        45, 45, 45, 45, 45, 0, 45, 45, 0, 45, 45, 45,
+        45, 45, 0, 0, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 0, 45, 45, 45, 0, 45, 45, 45, 0, 0,
+        45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 45, 45, 45, 45, 0, 0, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 0, 0,
+        0, 0, 0, 0, 0, 45, 45, 45, 45, 45, 45, 45,
+        0, 116, 116, 116, 0, 116, 116, 116, 116, 116, 116, 116,
+        116, 0, 0, 116, 116, 0, 0, 116, 116, 116, 116, 116,
+        116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+        116, 116, 116, 116, 116, 0, 116, 116, 116, 116, 116, 116,
+        116, 0, 116, 116, 0, 116, 116, 116, 116, 116, 0, 0,
+        116, 116, 116, 116, 116, 116, 116, 116, 116, 0, 0, 116,
+        116, 0, 0, 116, 116, 116, 0, 0, 0, 0, 0, 0,
+        0, 116, 116, 116, 0, 0, 0, 0, 116, 116, 0, 116,
+        116, 116, 116, 116, 0, 0, 116, 116, 116, 116, 116, 116,
+        116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 146, 146,
+        0, 146, 146, 146, 146, 146, 146, 0, 0, 0, 146, 146,
+        146, 0, 146, 146, 146, 146, 0, 0, 0, 146, 146, 0,
+        146, 0, 146, 146, 0, 0, 0, 146, 146, 0, 0, 0,
+        146, 146, 146, 0, 0, 0, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 146, 146, 0, 0, 0, 0, 146, 146,
+        146, 146, 146, 0, 0, 0, 146, 146, 146, 0, 146, 146,
+        146, 146, 0, 0, 146, 0, 0, 0, 0, 0, 0, 146,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 0,
+        0, 0, 0, 0, 149, 149, 149, 149, 149, 149, 149, 149,
+        149, 149, 149, 149, 149, 0, 149, 149, 149, 0, 149, 149,
+        149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149,
+        149, 149, 149, 149, 149, 149, 149, 149, 149, 0, 149, 149,
+        149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149,
+        149, 149, 0, 0, 149, 149, 149, 149, 149, 149, 149, 149,
+        149, 0, 149, 149, 149, 0, 149, 149, 149, 149, 0, 0,
+        0, 0, 0, 0, 0, 149, 149, 0, 149, 149, 149, 0,
+        0, 149, 0, 0, 149, 149, 149, 149, 0, 0, 149, 149,
+        149, 149, 149, 149, 149, 149, 149, 149, 0, 0, 0, 0,
+        0, 0, 0, 149, 149, 149, 149, 149, 149, 149, 149, 149,
+        61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+        61, 0, 61, 61, 61, 0, 61, 61, 61, 61, 61, 61,
+        61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+        61, 61, 61, 61, 61, 0, 61, 61, 61, 61, 61, 61,
+        61, 61, 61, 61, 0, 61, 61, 61, 61, 61, 0, 0,
+        61, 61, 61, 61, 61, 61, 61, 61, 61, 0, 61, 61,
+        61, 0, 61, 61, 61, 61, 0, 0, 0, 0, 0, 0,
+        0, 61, 61, 0, 0, 0, 0, 0, 0, 61, 61, 0,
+        61, 61, 61, 61, 0, 0, 61, 61, 61, 61, 61, 61,
+        61, 61, 61, 61, 0, 61, 61, 61, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 81, 81, 81, 81,
+        81, 81, 81, 81, 81, 81, 81, 81, 81, 0, 81, 81,
+        81, 0, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+        81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+        81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+        81, 0, 81, 81, 81, 0, 81, 81, 81, 81, 81, 81,
+        0, 0, 0, 0, 81, 81, 81, 81, 81, 81, 81, 81,
+        81, 81, 81, 81, 81, 81, 81, 81, 0, 0, 81, 81,
+        81, 81, 81, 81, 81, 81, 81, 81, 0, 133, 133, 133,
+        0, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 0, 0, 0, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 0, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 0, 133, 0, 0,
+        133, 133, 133, 133, 133, 133, 133, 0, 0, 0, 133, 0,
+        0, 0, 0, 133, 133, 133, 133, 133, 133, 0, 133, 0,
+        133, 133, 133, 133, 133, 133, 133, 133, 0, 0, 0, 0,
+        0, 0, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        0, 0, 133, 133, 133, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 151, 151, 151, 151, 151, 151, 151,
+        151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+        151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+        151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 0,
+        0, 0, 0, 25, 151, 151, 151, 151, 151, 151, 151, 151,
+        151, 151, 151, 151, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 70, 70, 0, 70, 0, 70, 70, 70, 70, 70, 0,
+        70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+        70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+        0, 70, 0, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+        70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+        70, 70, 0, 0, 70, 70, 70, 70, 70, 0, 70, 0,
+        70, 70, 70, 70, 70, 70, 70, 0, 70, 70, 70, 70,
+        70, 70, 70, 70, 70, 70, 0, 0, 70, 70, 70, 70,
+        152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152,
+        152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152,
+        0, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152,
+        152, 152, 152, 152, 152, 152, 152, 152, 152, 0, 0, 0,
+        0, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152,
+        152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152,
+        152, 152, 152, 152, 152, 0, 152, 152, 152, 152, 152, 152,
+        152, 25, 25, 25, 25, 152, 152, 0, 0, 0, 0, 0,
+        96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+        96, 96, 96, 96, 40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 0, 40, 0, 0, 0, 0, 0, 40, 0, 0,
+        40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 25,
+        40, 40, 40, 40, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 39, 39, 39, 39,
+        39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+        39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 39, 39,
+        39, 39, 0, 0, 39, 39, 39, 39, 39, 39, 39, 0,
+        39, 0, 39, 39, 39, 39, 0, 0, 39, 0, 39, 39,
+        39, 39, 0, 0, 39, 39, 39, 39, 39, 39, 39, 0,
+        39, 0, 39, 39, 39, 39, 0, 0, 39, 39, 39, 39,
+        39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0,
+        39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+        39, 39, 39, 39, 39, 39, 39, 0, 0, 39, 39, 39,
+        39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+        39, 0, 0, 0, 39, 39, 39, 39, 39, 39, 39, 39,
+        39, 39, 0, 0, 0, 0, 0, 0, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 0, 0, 23, 23, 23, 23,
+        23, 23, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 105, 105, 105, 105,
+        105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+        105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+        105, 0, 0, 0, 126, 126, 126, 126, 126, 126, 126, 126,
+        126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+        126, 126, 126, 126, 126, 126, 126, 25, 25, 25, 126, 126,
+        126, 126, 126, 126, 126, 126, 126, 126, 126, 0, 0, 0,
+        0, 0, 0, 0, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+        140, 140, 0, 0, 0, 0, 0, 0, 0, 0, 0, 140,
+        51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+        51, 51, 51, 51, 51, 51, 51, 51, 51, 25, 25, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 141, 141, 141, 141, 141, 141, 141, 141,
+        141, 141, 141, 141, 141, 0, 141, 141, 141, 0, 141, 141,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 0, 0, 67, 67, 67, 67,
+        67, 67, 67, 67, 67, 67, 0, 0, 0, 0, 0, 0,
+        93, 93, 25, 25, 93, 25, 93, 93, 93, 93, 93, 93,
+        93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+        93, 93, 0, 0, 0, 0, 0, 0, 93, 93, 93, 93,
+        93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+        93, 93, 93, 93, 93, 93, 93, 93, 93, 0, 0, 0,
+        0, 0, 0, 0, 93, 93, 93, 93, 93, 93, 93, 93,
+        93, 93, 93, 0, 0, 0, 0, 0, 18, 18, 18, 18,
+        18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+        73, 73, 73, 73, 73, 73, 73, 0, 73, 73, 73, 73,
+        73, 73, 73, 73, 73, 73, 73, 73, 0, 0, 0, 0,
+        73, 0, 0, 0, 73, 73, 73, 73, 73, 73, 73, 73,
+        73, 73, 73, 73, 142, 142, 142, 142, 142, 142, 142, 142,
+        142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+        142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 0, 0,
+        142, 142, 142, 142, 142, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 0, 0, 0, 0,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 0, 0,
+        0, 0, 0, 0, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 0, 0, 0, 100, 100, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        0, 0, 16, 16, 143, 143, 143, 143, 143, 143, 143, 143,
+        143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+        143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 0,
+        143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+        143, 0, 0, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+        143, 143, 0, 0, 0, 0, 0, 0, 143, 143, 143, 143,
+        143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 0, 0,
+        56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+        56, 56, 56, 0, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 0, 137, 137, 137, 137, 137, 137, 137, 137,
+        137, 137, 137, 137, 137, 137, 137, 137, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+        10, 10, 10, 10, 72, 72, 72, 72, 72, 72, 72, 72,
+        72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+        72, 72, 72, 72, 0, 0, 0, 72, 72, 72, 72, 72,
+        72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0, 0,
+        0, 72, 72, 72, 106, 106, 106, 106, 106, 106, 106, 106,
+        106, 106, 106, 106, 106, 106, 106, 106, 30, 30, 30, 30,
+        30, 30, 30, 30, 30, 0, 0, 0, 0, 0, 0, 0,
+        40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0,
+        0, 40, 40, 40, 137, 137, 137, 137, 137, 137, 137, 137,
+        0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 25,
+        56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+        56, 25, 56, 56, 56, 56, 56, 56, 56, 25, 25, 25,
+        25, 56, 25, 25, 25, 25, 25, 25, 56, 25, 25, 25,
+        56, 56, 25, 0, 0, 0, 0, 0, 71, 71, 71, 71,
+        71, 71, 44, 44, 44, 44, 44, 30, 71, 71, 71, 71,
+        71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+        71, 44, 44, 44, 44, 44, 71, 71, 71, 71, 44, 44,
+        44, 44, 44, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+        71, 71, 71, 71, 30, 71, 71, 71, 71, 71, 71, 71,
+        71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+        71, 71, 71, 44, 44, 44, 44, 44, 44, 44, 0, 0,
+        44, 44, 44, 44, 44, 44, 0, 0, 44, 44, 44, 44,
+        44, 44, 44, 44, 0, 44, 0, 44, 0, 44, 0, 44,
+        44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+        44, 44, 0, 0, 44, 44, 44, 44, 44, 0, 44, 44,
+        44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+        0, 0, 44, 44, 44, 44, 44, 44, 0, 44, 44, 44,
+        0, 0, 44, 44, 44, 0, 44, 44, 44, 44, 44, 44,
+        44, 44, 44, 0, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 56, 56, 25, 25, 25, 25, 25, 25,
+        25, 0, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 71, 0, 0, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 71, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 0, 71, 71, 71, 71,
+        71, 71, 71, 71, 71, 71, 71, 71, 71, 0, 0, 0,
+        25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 25, 25, 25, 25,
+        25, 25, 44, 25, 25, 25, 71, 71, 25, 25, 25, 25,
+        25, 25, 71, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 71, 25, 71, 71, 71, 71,
+        71, 71, 71, 71, 71, 25, 25, 25, 0, 0, 0, 0,
+        25, 25, 25, 25, 25, 25, 25, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 0, 0, 0, 0, 0, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        25, 25, 25, 25, 0, 0, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 0, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 41, 41, 41, 41,
+        41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 0, 0, 0, 0,
+        0, 26, 26, 26, 26, 26, 26, 26, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153, 0, 0, 0, 0,
+        0, 0, 0, 153, 153, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 153, 39, 39, 39, 39,
+        39, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        39, 39, 39, 39, 39, 39, 39, 0, 39, 39, 39, 39,
+        39, 39, 39, 0, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 0, 0, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 0, 48,
+        48, 48, 48, 48, 48, 48, 48, 48, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 48, 48, 48, 48,
+        48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        0, 0, 0, 0, 25, 25, 25, 25, 25, 48, 25, 48,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 56, 56, 56, 56, 49, 49,
+        25, 25, 25, 25, 25, 25, 25, 25, 48, 48, 48, 48,
+        25, 25, 25, 25, 0, 54, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 54, 54, 54, 54, 0, 0, 56, 56, 25,
+        25, 54, 54, 54, 25, 62, 62, 62, 62, 62, 62, 62,
+        62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+        62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+        62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 25,
+        25, 62, 62, 62, 0, 0, 0, 0, 0, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 0, 25, 25, 25, 25,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 25, 62, 62, 62, 62, 62, 62, 62, 62,
+        62, 62, 62, 62, 62, 62, 62, 25, 62, 62, 62, 62,
+        62, 62, 62, 62, 25, 25, 25, 25, 25, 25, 25, 25,
+        162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+        162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+        162, 162, 162, 162, 162, 0, 0, 0, 162, 162, 162, 162,
+        162, 162, 162, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+        76, 76, 76, 76, 157, 157, 157, 157, 157, 157, 157, 157,
+        157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+        157, 157, 157, 157, 157, 157, 157, 157, 0, 0, 0, 0,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        0, 0, 0, 0, 0, 0, 0, 0, 25, 25, 71, 71,
+        71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+        71, 71, 71, 71, 71, 71, 71, 71, 25, 25, 25, 71,
+        71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+        71, 71, 71, 0, 0, 0, 0, 0, 71, 71, 0, 71,
+        0, 71, 71, 71, 71, 71, 0, 0, 0, 0, 0, 0,
+        0, 0, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+        71, 71, 71, 71, 138, 138, 138, 138, 138, 138, 138, 138,
+        138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138,
+        138, 138, 138, 138, 138, 138, 138, 138, 138, 0, 0, 0,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 0, 0,
+        0, 0, 0, 0, 122, 122, 122, 122, 122, 122, 122, 122,
+        122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+        122, 122, 122, 122, 0, 0, 0, 0, 0, 0, 0, 0,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 0,
+        0, 0, 0, 0, 0, 0, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 0, 0, 0, 0, 0, 0,
+        64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 25, 64, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 125, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 0, 0, 0, 59, 59, 59, 59,
+        59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+        59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+        59, 59, 0, 25, 59, 59, 59, 59, 59, 59, 59, 59,
+        59, 59, 0, 0, 0, 0, 59, 59, 96, 96, 96, 96,
+        96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0,
+        22, 22, 22, 22, 144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144,
+        144, 144, 144, 144, 87, 87, 87, 87, 87, 87, 87, 87,
+        87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+        87, 87, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 39, 39, 39, 39, 39, 39, 0, 0, 39, 39, 39,
+        39, 39, 39, 0, 0, 39, 39, 39, 39, 39, 39, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 71, 71, 71, 71,
+        71, 71, 71, 71, 71, 71, 71, 25, 71, 71, 71, 71,
+        71, 71, 71, 71, 71, 44, 71, 71, 71, 71, 25, 25,
+        0, 0, 0, 0, 87, 87, 87, 87, 87, 87, 87, 87,
+        87, 87, 87, 87, 87, 87, 0, 0, 87, 87, 87, 87,
+        87, 87, 87, 87, 87, 87, 0, 0, 0, 0, 0, 0,
+        49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 0,
+        0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0,
+        48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 0, 0, 48, 48, 48, 48, 48, 48, 48, 48,
+        48, 48, 0, 0, 0, 0, 0, 0, 71, 71, 71, 71,
+        71, 71, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 5, 5, 5, 5, 5, 0, 0, 0, 0,
+        0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0,
+        53, 53, 53, 53, 53, 0, 53, 0, 53, 53, 0, 53,
+        53, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+        4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 25, 25,
+        0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        0, 0, 0, 0, 0, 0, 0, 4, 56, 56, 56, 56,
+        56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 30, 30,
+        25, 25, 25, 0, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 0,
+        25, 25, 25, 25, 0, 0, 0, 0, 4, 4, 4, 4,
+        4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 0, 0, 25, 0, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+        62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+        62, 62, 25, 25, 0, 0, 49, 49, 49, 49, 49, 49,
+        0, 0, 49, 49, 49, 49, 49, 49, 0, 0, 49, 49,
+        49, 49, 49, 49, 0, 0, 49, 49, 49, 0, 0, 0,
+        25, 25, 25, 25, 25, 25, 25, 0, 25, 25, 25, 25,
+        25, 25, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 25, 25, 25, 25, 25, 0, 0, 75, 75, 75, 75,
+        75, 75, 75, 75, 75, 75, 75, 75, 0, 75, 75, 75,
+        75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+        75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 0,
+        75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+        75, 75, 75, 75, 75, 75, 75, 0, 75, 75, 0, 75,
+        75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+        75, 75, 0, 0, 75, 75, 75, 75, 75, 75, 75, 75,
+        75, 75, 75, 0, 0, 0, 0, 0, 25, 25, 25, 0,
+        0, 0, 0, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 0, 0, 0, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 44, 44, 44, 44, 44, 44, 44, 44,
+        44, 44, 44, 44, 44, 44, 44, 0, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 0, 0, 0,
+        44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 56, 0, 0, 77, 77, 77, 77,
+        77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+        77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+        77, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        56, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 108, 108, 108, 108, 108, 108, 108, 108,
+        108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 108, 108, 108,
+        42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+        42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+        42, 42, 42, 0, 0, 0, 0, 0, 110, 110, 110, 110,
+        110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+        110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 0,
+        0, 0, 0, 0, 156, 156, 156, 156, 156, 156, 156, 156,
+        156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+        156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 0, 156,
+        111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+        111, 111, 111, 111, 111, 111, 111, 111, 0, 0, 0, 0,
+        111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+        111, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+        31, 31, 31, 31, 130, 130, 130, 130, 130, 130, 130, 130,
+        130, 130, 130, 130, 130, 130, 130, 130, 118, 118, 118, 118,
+        118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+        118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+        118, 118, 0, 0, 118, 118, 118, 118, 118, 118, 118, 118,
+        118, 118, 0, 0, 0, 0, 0, 0, 117, 117, 117, 117,
+        117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+        117, 117, 117, 117, 0, 0, 0, 0, 117, 117, 117, 117,
+        117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+        117, 117, 117, 117, 0, 0, 0, 0, 37, 37, 37, 37,
+        37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+        37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0,
+        0, 0, 0, 0, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20,
+        158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 0,
+        158, 158, 158, 158, 158, 158, 158, 0, 158, 158, 0, 158,
+        158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 0, 158,
+        158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+        158, 158, 0, 158, 158, 158, 158, 158, 158, 158, 0, 158,
+        158, 0, 0, 0, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        74, 74, 74, 74, 74, 74, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 74, 74, 74, 74, 74, 74, 74, 74,
+        0, 0, 0, 0, 0, 0, 0, 0, 71, 71, 71, 71,
+        71, 71, 0, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+        71, 0, 71, 71, 71, 71, 71, 71, 71, 71, 71, 0,
+        0, 0, 0, 0, 28, 28, 28, 28, 28, 28, 0, 0,
+        28, 0, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+        28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+        28, 28, 28, 28, 28, 28, 0, 28, 28, 0, 0, 0,
+        28, 0, 0, 28, 55, 55, 55, 55, 55, 55, 55, 55,
+        55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+        55, 55, 0, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+        120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+        120, 120, 120, 120, 97, 97, 97, 97, 97, 97, 97, 97,
+        97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+        97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 0,
+        0, 0, 0, 0, 0, 0, 0, 97, 97, 97, 97, 97,
+        97, 97, 97, 97, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 0,
+        52, 52, 0, 0, 0, 0, 0, 52, 52, 52, 52, 52,
+        123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123,
+        123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123,
+        123, 123, 123, 123, 0, 0, 0, 123, 78, 78, 78, 78,
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 0, 0,
+        0, 0, 0, 78, 90, 90, 90, 90, 90, 90, 90, 90,
+        90, 90, 90, 90, 90, 90, 90, 90, 89, 89, 89, 89,
+        89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+        89, 89, 89, 89, 89, 89, 89, 89, 0, 0, 0, 0,
+        89, 89, 89, 89, 0, 0, 89, 89, 89, 89, 89, 89,
+        89, 89, 89, 89, 89, 89, 89, 89, 65, 65, 65, 65,
+        0, 65, 65, 0, 0, 0, 0, 0, 65, 65, 65, 65,
+        65, 65, 65, 65, 0, 65, 65, 65, 0, 65, 65, 65,
+        65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+        65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+        65, 65, 0, 0, 65, 65, 65, 0, 0, 0, 0, 65,
+        65, 65, 65, 65, 65, 65, 65, 65, 65, 0, 0, 0,
+        0, 0, 0, 0, 113, 113, 113, 113, 113, 113, 113, 113,
+        113, 113, 113, 113, 113, 113, 113, 113, 109, 109, 109, 109,
+        109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 0,
+        0, 0, 0, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0,
+        0, 6, 6, 6, 6, 6, 6, 6, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 0, 0, 58, 58, 58, 58,
+        58, 58, 58, 58, 57, 57, 57, 57, 57, 57, 57, 57,
+        57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 0,
+        0, 0, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57,
+        124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124,
+        124, 124, 124, 124, 124, 124, 0, 0, 0, 0, 0, 0,
+        0, 124, 124, 124, 124, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 124, 124, 124, 124, 124, 124, 124,
+        114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+        114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+        114, 0, 0, 0, 0, 0, 0, 0, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 107, 107, 107, 0, 0, 0, 0, 0,
+        0, 0, 107, 107, 107, 107, 107, 107, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0,
+        0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 0, 0, 0, 0, 0, 0, 161, 161, 161, 161,
+        161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,
+        161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 0, 161,
+        161, 161, 0, 0, 161, 161, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4,
+        112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+        112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+        0, 0, 0, 0, 0, 0, 0, 0, 134, 134, 134, 134,
+        134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+        134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 0, 0,
+        0, 0, 0, 0, 115, 115, 115, 115, 115, 115, 115, 115,
+        115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+        115, 115, 115, 115, 115, 115, 0, 0, 0, 0, 0, 0,
+        24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 0, 0, 0, 0, 38, 38, 38, 38,
+        38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+        38, 38, 38, 38, 38, 38, 38, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0,
+        0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 14, 60, 60, 60, 60,
+        60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+        60, 60, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 60, 0, 0, 135, 135, 135, 135, 135, 135, 135, 135,
+        135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
+        135, 135, 135, 135, 135, 0, 0, 0, 0, 0, 0, 0,
+        135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 0, 0,
+        0, 0, 0, 0, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 0, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 0, 0, 0, 0,
+        0, 0, 0, 0, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+        129, 129, 129, 129, 0, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+        68, 68, 68, 68, 68, 68, 0, 68, 68, 68, 68, 68,
+        68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        95, 95, 95, 95, 95, 95, 95, 0, 95, 0, 95, 95,
+        95, 95, 0, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+        95, 95, 95, 95, 95, 95, 0, 95, 95, 95, 95, 95,
+        95, 95, 95, 95, 95, 95, 0, 0, 0, 0, 0, 0,
+        69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
+        69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
+        69, 69, 69, 0, 0, 0, 0, 0, 69, 69, 69, 69,
+        69, 69, 69, 69, 69, 69, 0, 0, 0, 0, 0, 0,
+        43, 43, 43, 43, 0, 43, 43, 43, 43, 43, 43, 43,
+        43, 0, 0, 43, 43, 0, 0, 43, 43, 43, 43, 43,
+        43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+        43, 43, 43, 43, 43, 0, 43, 43, 43, 43, 43, 43,
+        43, 0, 43, 43, 0, 43, 43, 43, 43, 43, 0, 56,
+        43, 43, 43, 43, 43, 43, 43, 43, 43, 0, 0, 43,
+        43, 0, 0, 43, 43, 43, 0, 0, 43, 0, 0, 0,
+        0, 0, 0, 43, 0, 0, 0, 0, 0, 43, 43, 43,
+        43, 43, 43, 43, 0, 0, 43, 43, 43, 43, 43, 43,
+        43, 0, 0, 0, 43, 43, 43, 43, 43, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+        0, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 154, 154, 154, 154,
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+        154, 154, 154, 154, 154, 154, 154, 154, 0, 0, 0, 0,
+        0, 0, 0, 0, 154, 154, 154, 154, 154, 154, 154, 154,
+        154, 154, 0, 0, 0, 0, 0, 0, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 0, 0, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 0, 0, 92, 92, 92, 92,
+        92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+        92, 92, 92, 92, 92, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 92, 92, 92, 92, 92, 92, 92, 92,
+        92, 92, 0, 0, 0, 0, 0, 0, 93, 93, 93, 93,
+        93, 93, 93, 93, 93, 93, 93, 93, 93, 0, 0, 0,
+        145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+        145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+        145, 145, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+        0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2,
+        2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 0, 0, 0, 0, 160, 160, 160, 160,
+        160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+        160, 160, 160, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 160, 33, 33, 33, 33, 33, 33, 33, 0,
+        0, 33, 0, 0, 33, 33, 33, 33, 33, 33, 33, 33,
+        0, 33, 33, 0, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 0, 33,
+        33, 0, 0, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 0, 0,
+        0, 0, 0, 0, 99, 99, 99, 99, 99, 99, 99, 99,
+        0, 0, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 163, 163, 163, 163, 163, 163, 163, 163,
+        163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+        163, 163, 163, 163, 0, 0, 0, 0, 0, 0, 0, 0,
+        136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+        136, 136, 136, 136, 136, 136, 136, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 121, 121, 121, 121,
+        121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+        121, 121, 121, 121, 121, 121, 121, 121, 121, 0, 0, 0,
+        0, 0, 0, 0, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 0, 0, 0, 0, 0, 0, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 0, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 0, 0, 0, 84, 84, 84, 84, 84, 84, 84, 84,
+        84, 84, 84, 84, 84, 84, 84, 84, 0, 0, 84, 84,
+        84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+        84, 84, 84, 84, 84, 84, 84, 84, 0, 84, 84, 84,
+        84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 85, 85, 85, 85,
+        85, 85, 85, 0, 85, 85, 0, 85, 85, 85, 85, 85,
+        85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+        85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0,
+        0, 0, 85, 0, 85, 85, 0, 85, 85, 85, 85, 85,
+        85, 85, 85, 85, 0, 0, 0, 0, 0, 0, 0, 0,
+        85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 0,
+        0, 0, 0, 0, 46, 46, 46, 46, 46, 46, 0, 46,
+        46, 0, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+        46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+        46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+        46, 46, 46, 0, 46, 46, 0, 46, 46, 46, 46, 46,
+        46, 0, 0, 0, 0, 0, 0, 0, 46, 46, 46, 46,
+        46, 46, 46, 46, 46, 46, 0, 0, 0, 0, 0, 0,
+        80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+        80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+        80, 0, 0, 0, 0, 0, 0, 0, 63, 63, 63, 63,
+        63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+        63, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+        63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+        63, 63, 63, 0, 0, 0, 63, 63, 63, 63, 63, 63,
+        63, 63, 63, 63, 63, 63, 0, 0, 0, 0, 0, 0,
+        76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 146,
+        27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+        27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+        27, 27, 0, 0, 0, 0, 0, 0, 27, 27, 27, 27,
+        27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 0,
+        27, 27, 27, 27, 27, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 27, 27, 27, 27, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 36, 36, 36, 36, 36, 36, 36, 36,
+        36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+        36, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0,
+        94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
+        94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
+        94, 94, 94, 94, 94, 94, 94, 0, 94, 94, 94, 94,
+        94, 94, 94, 94, 94, 94, 0, 0, 0, 0, 94, 94,
+        147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147,
+        147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147,
+        147, 147, 147, 147, 147, 147, 147, 0, 147, 147, 147, 147,
+        147, 147, 147, 147, 147, 147, 0, 0, 0, 0, 0, 0,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 0, 0, 9, 9, 9, 9,
+        9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+        119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 119, 119, 119, 119,
+        119, 119, 119, 119, 119, 119, 0, 119, 119, 119, 119, 119,
+        119, 119, 0, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+        119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+        0, 0, 0, 0, 0, 119, 119, 119, 86, 86, 86, 86,
+        86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+        86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 0,
+        0, 0, 0, 0, 91, 91, 91, 91, 91, 91, 91, 91,
+        91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+        91, 91, 91, 91, 91, 91, 91, 0, 0, 0, 0, 91,
+        91, 91, 91, 91, 91, 91, 91, 91, 0, 0, 0, 0,
+        0, 0, 0, 91, 148, 103, 48, 48, 66, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 48, 48, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+        148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+        0, 0, 0, 0, 0, 0, 0, 0, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+        66, 66, 66, 66, 66, 66, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 148, 148, 148, 148, 148, 148, 148, 148,
+        148, 0, 0, 0, 0, 0, 0, 0, 62, 62, 62, 62,
+        0, 62, 62, 62, 62, 62, 62, 62, 0, 62, 62, 0,
+        62, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 54, 62, 62, 62, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        54, 54, 54, 0, 0, 62, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 62, 62,
+        0, 0, 0, 0, 0, 0, 0, 0, 103, 103, 103, 103,
+        103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+        103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+        0, 0, 0, 0, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 0, 0, 0, 0, 0,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 0, 0, 0, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 0, 0, 0, 0, 0, 0, 0, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 0, 0, 35, 35, 35, 35,
+        56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+        56, 56, 0, 0, 56, 56, 56, 56, 56, 56, 56, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 25, 25, 25, 25,
+        25, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        25, 25, 25, 25, 25, 25, 25, 0, 0, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 56,
+        56, 56, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 56, 56, 56, 56, 56,
+        56, 56, 56, 25, 25, 56, 56, 56, 56, 56, 56, 56,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 56, 56, 56, 56, 25, 25, 44, 44, 44, 44,
+        44, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 0, 0, 0,
+        0, 0, 0, 0, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 0, 25, 25, 0, 0, 25, 0,
+        0, 25, 25, 0, 0, 25, 25, 25, 25, 0, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 0, 25,
+        0, 25, 25, 25, 25, 25, 25, 25, 0, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 0, 25, 25, 25, 25, 0, 0, 25, 25, 25,
+        25, 25, 25, 25, 25, 0, 25, 25, 25, 25, 25, 25,
+        25, 0, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 0, 25, 25, 25, 25, 0, 25, 25, 25, 25,
+        25, 0, 25, 0, 0, 0, 25, 25, 25, 25, 25, 25,
+        25, 0, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 0, 0,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 0, 0, 25, 25,
+        132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+        132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+        132, 132, 132, 132, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 132, 132, 132, 132, 132,
+        0, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+        132, 132, 132, 132, 71, 71, 71, 71, 71, 71, 71, 71,
+        71, 71, 71, 71, 71, 71, 71, 0, 0, 0, 0, 0,
+        0, 71, 71, 71, 71, 71, 71, 0, 0, 0, 0, 0,
+        41, 41, 41, 41, 41, 41, 41, 0, 41, 41, 41, 41,
+        41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+        41, 0, 0, 41, 41, 41, 41, 41, 41, 41, 0, 41,
+        41, 0, 41, 41, 41, 41, 41, 0, 0, 0, 0, 0,
+        30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        30, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 30, 104, 104, 104, 104,
+        104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+        104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+        104, 0, 0, 0, 104, 104, 104, 104, 104, 104, 104, 104,
+        104, 104, 104, 104, 104, 104, 0, 0, 104, 104, 104, 104,
+        104, 104, 104, 104, 104, 104, 0, 0, 0, 0, 104, 104,
+        155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+        155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+        155, 155, 155, 155, 155, 155, 155, 0, 159, 159, 159, 159,
+        159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+        159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 0, 0,
+        0, 0, 0, 159, 98, 98, 98, 98, 98, 98, 98, 98,
+        98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+        98, 98, 98, 98, 98, 98, 0, 0, 0, 0, 0, 0,
+        39, 39, 39, 39, 39, 39, 39, 0, 39, 39, 39, 39,
+        0, 39, 39, 0, 39, 39, 39, 39, 39, 39, 39, 39,
+        39, 39, 39, 39, 39, 39, 39, 0, 88, 88, 88, 88,
+        88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+        88, 88, 88, 88, 88, 0, 0, 88, 88, 88, 88, 88,
+        88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 0, 0, 0, 0, 1, 1, 25, 25, 25, 25,
+        25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 0, 4, 4, 0, 4, 0, 0, 4,
+        0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+        4, 4, 4, 4, 0, 4, 0, 4, 0, 0, 0, 0,
+        0, 0, 4, 0, 0, 0, 0, 4, 0, 4, 0, 4,
+        0, 4, 4, 4, 0, 4, 4, 0, 4, 0, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 4, 0,
+        4, 0, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4,
+        4, 4, 4, 0, 4, 4, 4, 4, 0, 4, 4, 4,
+        4, 0, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+        0, 4, 4, 4, 0, 4, 4, 4, 4, 4, 0, 4,
+        4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        54, 25, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 25, 25, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 25, 25, 25, 25,
+        25, 25, 25, 25, 0, 0, 0, 0, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 0, 0, 0, 0, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        0, 0, 0, 0, 0, 0, 0, 0, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 0, 25,
+        25, 25, 25, 25, 25, 25, 0, 0, 0, 0, 0, 0,
+        0, 0, 25, 25, 48, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 48, 48, 48, 48,
+        48, 48, 48, 48, 48, 48, 48, 0, 0, 0, 0, 0,
+        0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+    };
+
+    inline constexpr int PROPERTY_FLAGS_SHIFT1 = 5;
+    inline constexpr int PROPERTY_FLAGS_SHIFT2 = 4;
+    inline constexpr uint8_t PROPERTY_FLAGS_INDEX[2176] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+        12, 13, 14, 15, 16, 17, 18, 17, 17, 17, 19, 20,
+        21, 17, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 23, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 24, 25,
+        26, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 28,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 29, 30, 31, 32, 33, 34, 35, 36,
+        37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+        22, 49, 50, 17, 17, 17, 17, 51, 22, 22, 52, 17,
+        17, 17, 17, 17, 17, 17, 22, 53, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        22, 54, 17, 55, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 56, 22, 22, 57, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 58,
+        59, 60, 17, 17, 17, 17, 61, 17, 17, 17, 17, 17,
+        17, 17, 17, 62, 63, 64, 65, 66, 17, 67, 17, 68,
+        69, 70, 71, 72, 73, 17, 17, 74, 75, 17, 17, 17,
+        17, 76, 17, 17, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 77, 22, 22, 22, 22, 22, 22, 22, 78,
+        79, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 80,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 81, 17, 17, 17, 17, 17, 17, 22, 82, 17, 17,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 83, 22, 22,
+        22, 22, 22, 22, 22, 84, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 85, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17,
+    };
+    inline constexpr uint16_t PROPERTY_FLAGS_MIDDLE[2752] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 1, 9, 10,
+        11, 12, 13, 14, 15, 15, 15, 16, 17, 15, 15, 18,
+        19, 20, 21, 22, 23, 24, 15, 25, 15, 15, 15, 26,
+        27, 13, 13, 13, 13, 28, 13, 29, 30, 31, 32, 1,
+        33, 33, 33, 33, 34, 33, 33, 35, 36, 37, 38, 13,
+        39, 40, 15, 41, 11, 11, 11, 13, 13, 13, 15, 15,
+        42, 15, 15, 15, 43, 15, 15, 15, 15, 15, 15, 4,
+        11, 44, 13, 13, 45, 46, 33, 47, 48, 49, 50, 51,
+        1, 52, 49, 49, 53, 54, 55, 56, 49, 49, 49, 49,
+        49, 57, 58, 59, 1, 60, 49, 61, 62, 49, 49, 49,
+        49, 49, 63, 64, 65, 49, 66, 67, 49, 68, 69, 1,
+        49, 70, 71, 49, 72, 73, 49, 49, 74, 75, 76, 61,
+        77, 49, 49, 78, 79, 80, 81, 82, 83, 84, 85, 86,
+        87, 88, 81, 89, 90, 84, 85, 91, 92, 93, 94, 95,
+        96, 97, 85, 98, 99, 100, 81, 101, 102, 84, 85, 98,
+        103, 104, 81, 105, 106, 107, 108, 109, 110, 111, 94, 1,
+        112, 113, 85, 114, 115, 116, 81, 1, 117, 113, 85, 118,
+        115, 119, 81, 120, 121, 113, 49, 122, 123, 124, 81, 125,
+        126, 127, 49, 128, 129, 130, 94, 131, 82, 49, 49, 132,
+        133, 3, 1, 1, 134, 49, 135, 136, 137, 138, 1, 1,
+        100, 139, 3, 140, 141, 49, 142, 143, 144, 145, 61, 146,
+        147, 1, 1, 1, 49, 49, 53, 148, 3, 149, 150, 151,
+        152, 153, 11, 11, 154, 13, 13, 155, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 156, 157, 49, 49, 156, 49, 49, 158,
+        159, 160, 49, 49, 49, 159, 49, 49, 49, 161, 162, 163,
+        49, 1, 11, 11, 11, 11, 11, 164, 82, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 165, 49,
+        166, 71, 49, 49, 49, 49, 167, 168, 49, 169, 49, 170,
+        49, 171, 172, 173, 49, 49, 49, 174, 175, 176, 3, 1,
+        177, 3, 49, 49, 49, 49, 49, 168, 49, 49, 178, 49,
+        49, 49, 49, 179, 49, 180, 181, 182, 94, 49, 183, 184,
+        49, 49, 185, 49, 186, 187, 1, 1, 49, 188, 49, 49,
+        49, 189, 190, 191, 3, 3, 192, 193, 194, 1, 1, 1,
+        195, 49, 49, 196, 197, 3, 198, 199, 200, 49, 201, 65,
+        49, 49, 202, 203, 49, 49, 204, 205, 206, 65, 49, 183,
+        45, 11, 11, 207, 1, 208, 209, 210, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 33, 33, 211, 212,
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 213, 15, 15,
+        15, 15, 15, 15, 214, 215, 214, 214, 215, 216, 214, 217,
+        218, 218, 218, 219, 220, 221, 222, 220, 223, 1, 224, 225,
+        226, 227, 1, 228, 1, 229, 1, 1, 1, 230, 231, 226,
+        232, 233, 234, 235, 236, 1, 11, 13, 237, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 238,
+        239, 240, 241, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 11, 11, 11, 13,
+        13, 13, 242, 243, 15, 15, 15, 15, 15, 15, 244, 245,
+        13, 13, 246, 49, 49, 49, 247, 225, 49, 248, 249, 249,
+        249, 249, 61, 61, 1, 1, 250, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        251, 1, 252, 253, 82, 49, 49, 49, 49, 254, 82, 49,
+        49, 49, 49, 255, 256, 49, 49, 82, 49, 49, 49, 49,
+        180, 1, 49, 49, 1, 1, 1, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 1, 1, 1, 1,
+        49, 49, 49, 49, 49, 49, 49, 49, 142, 1, 1, 1,
+        1, 49, 49, 183, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 142, 49, 257, 1,
+        15, 15, 258, 259, 15, 260, 49, 49, 49, 49, 49, 163,
+        1, 261, 262, 263, 15, 15, 15, 264, 265, 266, 267, 268,
+        269, 270, 1, 271, 272, 49, 273, 1, 49, 49, 49, 274,
+        275, 49, 49, 204, 276, 3, 33, 277, 65, 49, 278, 49,
+        279, 280, 49, 142, 77, 49, 49, 281, 282, 3, 283, 284,
+        49, 49, 285, 286, 287, 3, 49, 288, 49, 49, 49, 289,
+        290, 291, 53, 292, 293, 294, 249, 13, 13, 155, 295, 13,
+        13, 13, 13, 13, 49, 49, 296, 3, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 274, 49,
+        297, 49, 49, 185, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 183, 49, 49, 49, 49, 49,
+        49, 186, 1, 1, 298, 299, 85, 300, 301, 49, 49, 49,
+        49, 49, 49, 31, 1, 302, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 183, 1, 49, 49, 49, 49, 303, 49, 49,
+        304, 1, 1, 185, 33, 1, 33, 305, 306, 1, 1, 307,
+        49, 49, 49, 49, 49, 49, 49, 142, 1, 3, 4, 5,
+        6, 7, 308, 49, 49, 49, 49, 180, 309, 310, 1, 1,
+        311, 49, 160, 312, 183, 183, 1, 1, 49, 49, 49, 49,
+        49, 49, 49, 71, 1, 1, 1, 1, 49, 49, 49, 184,
+        1, 1, 1, 1, 1, 1, 1, 313, 1, 1, 1, 1,
+        1, 1, 1, 1, 49, 142, 49, 49, 49, 100, 226, 1,
+        49, 49, 314, 49, 71, 49, 49, 315, 49, 183, 49, 49,
+        316, 317, 1, 1, 11, 11, 318, 13, 13, 49, 49, 49,
+        49, 183, 3, 11, 11, 319, 13, 320, 49, 49, 304, 49,
+        49, 49, 274, 321, 321, 322, 323, 324, 1, 1, 1, 1,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 248, 49, 179, 304, 1,
+        325, 13, 13, 326, 1, 1, 1, 1, 327, 49, 49, 328,
+        49, 179, 49, 248, 49, 180, 1, 1, 1, 1, 49, 329,
+        49, 179, 49, 186, 1, 1, 1, 1, 49, 49, 49, 330,
+        1, 1, 1, 1, 331, 332, 49, 333, 1, 1, 49, 142,
+        49, 142, 1, 1, 141, 49, 334, 1, 49, 49, 49, 179,
+        49, 179, 49, 51, 49, 31, 1, 1, 1, 1, 1, 1,
+        49, 49, 49, 49, 168, 1, 1, 1, 11, 11, 11, 335,
+        13, 13, 13, 336, 49, 49, 337, 3, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 49, 49, 338, 31, 1, 1, 1, 306,
+        49, 142, 192, 49, 339, 226, 1, 49, 340, 1, 1, 49,
+        184, 1, 49, 248, 200, 49, 49, 341, 342, 1, 94, 343,
+        200, 49, 49, 344, 345, 49, 168, 3, 200, 49, 279, 346,
+        347, 49, 49, 348, 200, 49, 49, 349, 350, 351, 1, 1,
+        49, 97, 352, 353, 354, 1, 1, 1, 355, 356, 168, 49,
+        49, 357, 344, 3, 358, 84, 85, 359, 103, 360, 361, 362,
+        1, 1, 1, 1, 1, 1, 1, 1, 49, 49, 49, 363,
+        364, 365, 31, 1, 49, 49, 49, 61, 366, 3, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 49, 49, 357, 367,
+        226, 368, 1, 1, 49, 49, 49, 369, 370, 3, 1, 1,
+        49, 49, 53, 371, 3, 1, 1, 1, 49, 372, 373, 3,
+        248, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        49, 49, 352, 344, 1, 1, 1, 1, 1, 1, 11, 11,
+        13, 13, 3, 374, 375, 376, 49, 377, 378, 3, 1, 1,
+        1, 1, 379, 49, 49, 380, 381, 1, 382, 49, 49, 383,
+        384, 385, 49, 49, 386, 387, 1, 49, 49, 49, 49, 168,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 85, 49, 357, 388, 100, 3, 1, 303,
+        49, 389, 145, 286, 1, 1, 1, 1, 390, 49, 49, 391,
+        392, 3, 393, 49, 394, 395, 3, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 49, 396, 397, 113, 49, 398, 399, 3, 1, 1,
+        1, 1, 1, 100, 1, 1, 1, 1, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 186, 1, 1,
+        1, 1, 1, 1, 49, 49, 49, 49, 49, 49, 180, 1,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        274, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 49, 49, 49, 49, 49, 49, 100, 49, 49, 49, 1,
+        400, 401, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 49, 49, 49, 49, 248, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        49, 49, 49, 168, 49, 180, 3, 49, 49, 49, 49, 180,
+        3, 49, 183, 362, 49, 49, 49, 402, 274, 3, 302, 403,
+        49, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        11, 11, 13, 13, 1, 1, 1, 1, 1, 1, 1, 1,
+        49, 49, 49, 49, 404, 405, 61, 61, 406, 200, 1, 1,
+        1, 1, 407, 408, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 304,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 179, 1, 1, 168, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 409, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 51, 410,
+        1, 411, 412, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 185, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 49, 49, 49, 49,
+        49, 49, 71, 142, 168, 413, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 33, 33, 414, 33,
+        402, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 415, 416,
+        417, 1, 418, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        419, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 11, 420, 13, 421, 422, 423, 214, 11,
+        424, 425, 426, 427, 428, 11, 420, 13, 429, 430, 13, 431,
+        432, 433, 434, 11, 435, 13, 11, 420, 13, 421, 422, 13,
+        214, 11, 424, 434, 11, 435, 13, 11, 420, 13, 436, 11,
+        433, 155, 437, 438, 13, 439, 11, 440, 441, 442, 443, 13,
+        444, 11, 445, 13, 446, 33, 33, 33, 33, 33, 33, 447,
+        33, 33, 230, 448, 449, 198, 46, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 450, 441, 451, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        452, 453, 454, 13, 13, 13, 217, 1, 455, 1, 1, 1,
+        1, 1, 1, 1, 49, 49, 142, 456, 457, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 49, 458, 1, 49, 49, 459, 3,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 49, 459, 3, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 460, 180, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 184, 402, 1, 1,
+        11, 11, 424, 13, 461, 3, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 462, 49, 463, 464, 465, 466, 467, 468,
+        469, 185, 470, 185, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 239, 471, 239, 471, 239,
+        471, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 3, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 1, 1, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 186, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 183, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 31, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 100, 1, 49, 183, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        71, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 1,
+    };
+    inline constexpr uint8_t PROPERTY_FLAGS_BLOCKS[7552] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+        1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 0, 0,
+        0, 0, 0, 0, 0, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 0, 0, 0, 0, 32,
+        0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 32,
+        0, 0, 54, 0, 0, 0, 0, 0, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 0, 58, 58, 58, 58,
+        58, 58, 58, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+        58, 54, 58, 54, 58, 54, 58, 54, 58, 54, 58, 54,
+        58, 54, 58, 54, 58, 54, 58, 54, 58, 54, 58, 54,
+        54, 58, 54, 58, 54, 58, 54, 58, 54, 58, 54, 58,
+        54, 58, 54, 58, 54, 54, 58, 54, 58, 54, 58, 54,
+        58, 54, 58, 54, 58, 54, 58, 54, 58, 58, 54, 58,
+        54, 58, 54, 54, 54, 58, 58, 54, 58, 54, 58, 58,
+        54, 58, 58, 58, 54, 54, 58, 58, 58, 58, 54, 58,
+        58, 54, 58, 58, 58, 54, 54, 54, 58, 58, 54, 58,
+        58, 54, 58, 54, 58, 54, 58, 58, 54, 58, 54, 54,
+        58, 54, 58, 58, 54, 58, 58, 58, 54, 58, 54, 58,
+        58, 54, 54, 50, 58, 54, 54, 54, 50, 50, 50, 50,
+        58, 50, 54, 58, 50, 54, 58, 50, 54, 58, 54, 58,
+        54, 58, 54, 58, 54, 58, 54, 58, 54, 58, 54, 58,
+        54, 54, 58, 54, 54, 58, 50, 54, 58, 54, 58, 58,
+        58, 54, 58, 54, 58, 54, 58, 54, 58, 54, 58, 54,
+        54, 54, 54, 54, 54, 54, 58, 58, 54, 58, 58, 54,
+        54, 58, 54, 58, 58, 58, 58, 54, 58, 54, 58, 54,
+        58, 54, 58, 54, 54, 54, 54, 54, 50, 54, 54, 54,
+        54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 54, 54, 50, 50, 50, 50, 50, 50, 50,
+        54, 54, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+        54, 0, 0, 0, 0, 0, 0, 0, 50, 0, 50, 0,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 38, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 58, 54, 58, 54,
+        50, 0, 58, 54, 0, 0, 54, 54, 54, 54, 0, 58,
+        0, 0, 0, 0, 0, 0, 58, 32, 58, 58, 58, 0,
+        58, 0, 58, 58, 54, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 0, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 54, 54, 54, 54,
+        54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 58, 54, 54, 58, 58, 58, 54, 54, 54,
+        58, 54, 58, 54, 58, 54, 58, 54, 54, 54, 54, 54,
+        58, 54, 0, 58, 54, 58, 58, 54, 54, 58, 58, 58,
+        58, 54, 0, 32, 32, 32, 32, 32, 0, 0, 58, 54,
+        58, 54, 58, 54, 58, 58, 54, 58, 54, 58, 54, 58,
+        54, 58, 54, 58, 54, 58, 54, 54, 58, 58, 58, 58,
+        58, 58, 58, 0, 0, 50, 0, 0, 0, 0, 0, 0,
+        54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0,
+        0, 0, 0, 0, 0, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 34,
+        0, 34, 34, 0, 34, 34, 0, 34, 0, 0, 0, 0,
+        0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 50,
+        50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 0, 0, 0, 0, 0, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 32, 34, 34, 34,
+        34, 34, 34, 34, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 0, 0, 0, 0, 50, 50, 34, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 0, 50, 34, 34, 34, 34, 34, 34,
+        34, 0, 0, 32, 32, 34, 34, 34, 34, 50, 50, 34,
+        34, 0, 32, 32, 32, 34, 50, 50, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 50, 50, 50, 0, 0, 50,
+        50, 34, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 0, 0, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 50, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 50, 50, 0, 0,
+        0, 0, 50, 0, 0, 32, 0, 0, 50, 50, 50, 50,
+        50, 50, 34, 34, 32, 32, 50, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 50, 34, 34, 34, 50, 34, 34, 34,
+        34, 32, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 32, 32, 32, 0, 0, 0, 0, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0,
+        50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50,
+        50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        32, 32, 32, 32, 32, 32, 32, 32, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 32, 32, 0, 34, 34, 34, 34, 34,
+        34, 34, 32, 32, 32, 32, 32, 32, 34, 34, 34, 34,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 34, 34,
+        32, 50, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 32, 34, 34, 50, 32, 32, 32,
+        32, 34, 34, 34, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 34, 34, 0, 0, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 0, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 34, 34, 34,
+        0, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 50,
+        50, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 0, 50, 50, 50, 50, 50, 50, 50, 0, 50, 0,
+        0, 0, 50, 50, 50, 50, 0, 0, 32, 50, 34, 34,
+        34, 34, 34, 34, 34, 0, 0, 34, 34, 0, 0, 34,
+        34, 32, 50, 0, 0, 0, 0, 0, 0, 0, 0, 34,
+        0, 0, 0, 0, 50, 50, 0, 50, 50, 50, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 32, 0,
+        0, 34, 34, 34, 0, 50, 50, 50, 50, 50, 50, 0,
+        0, 0, 0, 50, 50, 0, 50, 50, 0, 50, 50, 0,
+        50, 50, 0, 0, 32, 0, 34, 34, 34, 34, 34, 0,
+        0, 0, 0, 34, 34, 0, 0, 34, 34, 32, 0, 0,
+        0, 34, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50,
+        50, 0, 50, 0, 0, 0, 0, 0, 0, 0, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 34, 34, 50, 50,
+        50, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 34, 34, 34, 0, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 0, 50, 50, 50, 0, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50,
+        0, 50, 50, 50, 50, 50, 0, 0, 32, 50, 34, 34,
+        34, 34, 34, 34, 34, 34, 0, 34, 34, 34, 0, 34,
+        34, 32, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 50, 34, 34, 34, 32, 32, 32,
+        0, 34, 34, 34, 0, 50, 50, 50, 50, 50, 50, 50,
+        50, 0, 0, 50, 34, 34, 34, 34, 34, 0, 0, 34,
+        34, 0, 0, 34, 34, 32, 0, 0, 0, 0, 0, 0,
+        0, 32, 34, 34, 0, 0, 0, 0, 50, 50, 0, 50,
+        0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 34, 50, 0, 50, 50, 50,
+        50, 50, 50, 0, 0, 0, 50, 50, 50, 0, 50, 50,
+        50, 50, 0, 0, 0, 50, 50, 0, 50, 0, 50, 50,
+        0, 0, 0, 50, 50, 0, 0, 0, 50, 50, 50, 0,
+        0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 0, 0, 0, 0, 34, 34, 34, 34, 34, 0,
+        0, 0, 34, 34, 34, 0, 34, 34, 34, 32, 0, 0,
+        50, 0, 0, 0, 0, 0, 0, 34, 0, 0, 0, 0,
+        0, 0, 0, 0, 34, 34, 34, 34, 34, 50, 50, 50,
+        50, 50, 50, 50, 50, 0, 50, 50, 50, 0, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0,
+        32, 50, 34, 34, 34, 34, 34, 34, 34, 0, 34, 34,
+        34, 0, 34, 34, 34, 32, 0, 0, 0, 0, 0, 0,
+        0, 34, 34, 0, 50, 50, 50, 0, 0, 50, 0, 0,
+        50, 34, 34, 34, 0, 50, 50, 50, 50, 50, 50, 50,
+        50, 0, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50,
+        50, 50, 0, 0, 32, 50, 34, 34, 0, 0, 0, 0,
+        0, 34, 34, 0, 0, 0, 0, 0, 0, 50, 50, 0,
+        0, 50, 50, 34, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 34, 34, 34, 34, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 32, 32, 50, 34, 34,
+        34, 34, 34, 34, 34, 0, 34, 34, 34, 0, 34, 34,
+        34, 32, 50, 0, 0, 0, 0, 0, 50, 50, 50, 34,
+        0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50,
+        0, 34, 34, 34, 0, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0,
+        0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 0, 0,
+        50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 32, 0,
+        0, 0, 0, 34, 34, 34, 34, 34, 34, 0, 34, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 34, 34,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        50, 34, 50, 50, 34, 34, 34, 34, 34, 34, 34, 0,
+        0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 32,
+        32, 32, 32, 32, 32, 34, 32, 0, 0, 50, 50, 0,
+        50, 0, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50,
+        50, 50, 50, 50, 0, 50, 0, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 34, 50, 50, 34, 34, 34, 34,
+        34, 34, 32, 34, 34, 50, 0, 0, 50, 50, 50, 50,
+        50, 0, 50, 0, 32, 32, 32, 32, 32, 34, 32, 0,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 0, 0,
+        50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0,
+        32, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 32, 0, 32, 0, 32, 0, 0, 0, 0, 32, 32,
+        50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 0, 0, 0, 0, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 32, 0, 32, 32, 50, 50, 50, 50,
+        50, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 34, 34, 34, 34, 34, 34, 34, 32,
+        34, 32, 32, 34, 34, 34, 34, 50, 50, 50, 50, 50,
+        50, 50, 34, 34, 34, 34, 50, 50, 50, 50, 34, 34,
+        34, 50, 34, 34, 34, 50, 50, 34, 34, 34, 34, 34,
+        34, 34, 50, 50, 50, 34, 34, 34, 34, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 50, 34,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 34,
+        34, 34, 0, 0, 58, 58, 58, 58, 58, 58, 0, 58,
+        0, 0, 0, 0, 0, 58, 0, 0, 54, 54, 54, 54,
+        54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50,
+        50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 50, 0,
+        50, 0, 50, 50, 50, 50, 0, 0, 50, 0, 50, 50,
+        50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 50, 0,
+        50, 0, 50, 50, 50, 50, 0, 0, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 0, 0, 32, 32, 32,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 58, 58, 58, 58,
+        58, 58, 0, 0, 54, 54, 54, 54, 54, 54, 0, 0,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 0, 0, 50, 1, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0,
+        0, 0, 0, 0, 50, 50, 34, 34, 32, 32, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 34, 34,
+        32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        50, 50, 34, 34, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 0, 50, 50, 50, 0, 34, 34,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        50, 50, 50, 50, 32, 32, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        0, 0, 0, 50, 0, 0, 0, 0, 50, 32, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32,
+        32, 32, 0, 32, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 34, 50, 0, 0, 0, 0, 0, 50, 50, 50, 50,
+        50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 0, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 0, 0, 0, 0, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 32, 32, 32, 0, 0, 0, 0,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 0, 0, 50, 50, 50, 50, 50, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0,
+        0, 0, 0, 0, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 0, 0, 0, 0, 0, 50, 50, 50, 50,
+        50, 50, 50, 34, 34, 34, 34, 34, 0, 0, 0, 0,
+        50, 50, 50, 50, 50, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 0, 32, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 32, 32, 32, 32, 32, 32, 32, 32, 0, 0, 32,
+        0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0,
+        0, 0, 0, 0, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 0, 34, 34, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 34, 34, 34, 0,
+        34, 34, 34, 34, 34, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 32, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        32, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 34, 34, 34, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 34, 34, 34, 34, 34, 34, 34, 34, 34, 32, 32,
+        34, 34, 50, 50, 50, 50, 50, 50, 50, 50, 32, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 32, 32,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        50, 50, 50, 50, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 32,
+        0, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 0, 0, 0, 50, 50, 50,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 0,
+        0, 58, 58, 58, 32, 32, 32, 0, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 50, 50, 50, 50, 32, 50, 50,
+        50, 50, 50, 50, 32, 50, 50, 32, 32, 32, 50, 0,
+        0, 0, 0, 0, 32, 32, 32, 32, 32, 32, 32, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        58, 54, 58, 54, 58, 54, 54, 54, 54, 54, 54, 54,
+        54, 54, 58, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+        58, 58, 58, 58, 58, 58, 58, 58, 54, 54, 54, 54,
+        54, 54, 0, 0, 58, 58, 58, 58, 58, 58, 0, 0,
+        54, 54, 54, 54, 54, 54, 54, 54, 0, 58, 0, 58,
+        0, 58, 0, 58, 54, 54, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 54, 54, 54, 0, 0, 54, 54, 54, 54,
+        54, 54, 54, 54, 50, 50, 50, 50, 50, 50, 50, 50,
+        54, 54, 54, 54, 54, 0, 54, 54, 58, 58, 58, 58,
+        50, 0, 54, 0, 0, 0, 54, 54, 54, 0, 54, 54,
+        58, 58, 58, 58, 50, 0, 0, 0, 54, 54, 54, 54,
+        0, 0, 54, 54, 58, 58, 58, 58, 0, 0, 0, 0,
+        54, 54, 54, 54, 54, 54, 54, 54, 58, 58, 58, 58,
+        58, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 32, 32, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+        0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 54, 54, 0, 0, 0, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 0, 0, 0,
+        0, 32, 0, 0, 0, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 0, 0, 58, 0, 0, 0, 0, 58,
+        0, 0, 54, 58, 58, 58, 54, 54, 58, 58, 58, 54,
+        0, 58, 0, 0, 48, 58, 58, 58, 58, 58, 0, 0,
+        0, 0, 0, 0, 58, 0, 58, 0, 58, 0, 58, 58,
+        58, 58, 48, 54, 58, 58, 58, 58, 54, 50, 50, 50,
+        50, 54, 0, 0, 54, 54, 58, 58, 0, 0, 0, 0,
+        0, 58, 54, 54, 54, 54, 0, 0, 0, 0, 54, 0,
+        50, 50, 50, 58, 54, 50, 50, 50, 50, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 0, 0, 0, 0, 0, 0, 58, 54, 58, 58,
+        58, 54, 54, 58, 54, 58, 54, 58, 54, 58, 58, 58,
+        58, 54, 58, 54, 54, 58, 54, 54, 54, 54, 54, 54,
+        54, 54, 58, 58, 58, 54, 58, 54, 54, 0, 0, 0,
+        0, 0, 0, 58, 54, 58, 54, 32, 32, 32, 58, 54,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        54, 54, 54, 54, 54, 54, 0, 54, 0, 0, 0, 0,
+        0, 54, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50,
+        0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50,
+        50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50,
+        50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0,
+        0, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 32, 32,
+        32, 32, 32, 32, 0, 50, 50, 50, 50, 50, 0, 0,
+        50, 50, 50, 50, 50, 0, 0, 0, 50, 50, 50, 50,
+        50, 50, 50, 0, 0, 32, 32, 48, 48, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0,
+        50, 50, 50, 50, 0, 0, 0, 0, 0, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 50, 50, 0, 0, 0, 0,
+        58, 54, 58, 54, 58, 54, 58, 54, 58, 54, 58, 54,
+        58, 54, 50, 32, 0, 0, 0, 0, 34, 34, 34, 34,
+        34, 34, 34, 34, 32, 32, 0, 50, 58, 54, 58, 54,
+        58, 54, 58, 54, 58, 54, 58, 54, 54, 54, 34, 34,
+        0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 0, 0, 58, 54, 58, 54, 58, 54,
+        58, 54, 58, 54, 58, 54, 58, 54, 54, 54, 58, 54,
+        58, 54, 58, 54, 58, 54, 58, 54, 58, 54, 58, 54,
+        54, 54, 54, 54, 54, 54, 54, 54, 54, 58, 54, 58,
+        54, 58, 58, 54, 58, 54, 58, 54, 58, 54, 58, 54,
+        50, 0, 0, 58, 54, 58, 54, 50, 58, 54, 58, 54,
+        54, 54, 58, 54, 58, 54, 58, 54, 58, 54, 58, 54,
+        58, 54, 58, 54, 58, 54, 58, 54, 58, 54, 58, 58,
+        58, 58, 58, 54, 58, 58, 58, 58, 58, 54, 58, 54,
+        58, 54, 58, 54, 58, 54, 58, 54, 58, 54, 58, 54,
+        58, 58, 58, 58, 54, 58, 54, 0, 0, 0, 0, 0,
+        58, 54, 0, 54, 0, 54, 58, 54, 58, 54, 0, 0,
+        0, 0, 0, 0, 0, 0, 54, 54, 54, 58, 54, 50,
+        54, 54, 54, 50, 50, 50, 50, 50, 50, 50, 34, 50,
+        50, 50, 32, 50, 50, 50, 50, 34, 50, 50, 50, 50,
+        50, 50, 50, 34, 34, 34, 34, 34, 0, 0, 0, 0,
+        32, 0, 0, 0, 50, 50, 50, 50, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 34, 34, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        34, 34, 34, 34, 32, 34, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 32, 32, 50, 50, 50, 50, 50, 50,
+        0, 0, 0, 50, 0, 50, 50, 34, 50, 50, 50, 50,
+        50, 50, 34, 34, 34, 34, 34, 32, 32, 32, 0, 0,
+        50, 50, 50, 50, 50, 50, 50, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 32, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 32,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 50, 50, 50, 50, 50, 50, 34, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 50, 50, 50, 50, 50, 0,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 34,
+        50, 50, 50, 50, 50, 50, 50, 50, 34, 34, 0, 0,
+        50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 50, 34,
+        34, 34, 50, 50, 34, 50, 34, 34, 34, 50, 50, 34,
+        34, 50, 50, 50, 50, 50, 34, 32, 50, 32, 50, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50,
+        50, 50, 0, 0, 0, 0, 50, 50, 50, 34, 32, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50,
+        50, 50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 0,
+        0, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+        54, 54, 0, 0, 0, 0, 0, 0, 50, 50, 50, 34,
+        34, 34, 34, 34, 34, 34, 34, 0, 32, 32, 0, 0,
+        50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 50,
+        50, 50, 50, 50, 54, 54, 54, 54, 54, 54, 54, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54,
+        54, 54, 54, 54, 0, 0, 0, 0, 0, 50, 34, 50,
+        50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50,
+        50, 0, 50, 0, 50, 50, 0, 50, 50, 0, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32,
+        32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 32, 32, 32, 50, 50, 50, 50, 50, 0, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0,
+        0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        0, 0, 50, 50, 50, 50, 50, 50, 0, 0, 50, 50,
+        50, 50, 50, 50, 0, 0, 50, 50, 50, 50, 50, 50,
+        0, 0, 50, 50, 50, 0, 0, 0, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0,
+        50, 50, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 34, 34, 34, 34, 34, 0,
+        0, 0, 0, 0, 50, 50, 50, 50, 0, 0, 0, 0,
+        50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50,
+        50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        58, 58, 58, 58, 58, 58, 58, 58, 54, 54, 54, 54,
+        54, 54, 54, 54, 58, 58, 58, 58, 0, 0, 0, 0,
+        54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 0,
+        58, 58, 58, 58, 58, 58, 58, 0, 58, 58, 0, 54,
+        54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54,
+        54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+        54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 0, 54,
+        54, 0, 0, 0, 54, 50, 50, 54, 54, 54, 0, 54,
+        54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54,
+        54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0,
+        50, 50, 50, 50, 50, 50, 0, 0, 50, 0, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50,
+        50, 0, 0, 0, 50, 0, 0, 50, 50, 50, 50, 0,
+        50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0,
+        0, 0, 50, 50, 50, 34, 34, 34, 0, 34, 34, 0,
+        0, 0, 0, 0, 34, 34, 34, 34, 50, 50, 50, 50,
+        0, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 0, 0, 32, 32, 32, 0,
+        0, 0, 0, 32, 50, 50, 50, 50, 50, 32, 32, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 58, 58, 58, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 50, 50, 50, 50, 34, 34, 34, 34,
+        0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 0, 34, 34, 0, 0, 0,
+        50, 50, 50, 50, 50, 50, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 50, 50, 32, 32, 32, 32, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50,
+        50, 50, 50, 50, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 32, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 32, 50, 50, 34, 34, 50, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 32, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 32, 32, 0, 0, 0, 0, 0,
+        0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 34, 34, 34, 32, 32, 0, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 0, 0, 0, 0,
+        50, 34, 34, 50, 0, 0, 0, 0, 0, 0, 0, 0,
+        50, 50, 50, 32, 0, 0, 50, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 50, 50, 50, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 32, 50, 50, 50,
+        50, 0, 0, 0, 0, 32, 32, 32, 32, 0, 34, 34,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 50, 0,
+        50, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 32, 32, 34, 0, 0, 0, 0, 0, 0, 34, 50,
+        50, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 0,
+        50, 0, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 34, 34, 34, 34, 34, 0, 50, 50, 50,
+        50, 50, 50, 50, 50, 0, 0, 50, 50, 0, 50, 50,
+        0, 50, 50, 50, 50, 50, 0, 32, 32, 50, 34, 34,
+        50, 0, 0, 0, 0, 0, 0, 34, 0, 0, 0, 0,
+        0, 50, 50, 50, 50, 50, 34, 34, 0, 0, 32, 32,
+        32, 32, 32, 32, 32, 0, 0, 0, 32, 32, 32, 32,
+        32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        50, 50, 50, 50, 50, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 32, 34, 34, 34, 32, 50,
+        50, 50, 50, 0, 0, 0, 0, 0, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 0, 0, 0, 0, 32, 50,
+        34, 34, 32, 32, 50, 50, 0, 50, 0, 0, 0, 0,
+        0, 0, 0, 0, 34, 34, 34, 34, 34, 34, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 32, 0, 0, 0, 0,
+        0, 0, 0, 0, 50, 50, 50, 50, 34, 34, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 32, 34, 0, 0, 0, 50, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 34, 34, 34, 34,
+        34, 34, 32, 32, 50, 0, 0, 0, 0, 0, 0, 0,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0,
+        0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 32, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50,
+        50, 50, 50, 50, 50, 50, 50, 0, 0, 50, 0, 0,
+        50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 0,
+        50, 50, 50, 50, 50, 50, 50, 50, 34, 34, 34, 34,
+        34, 34, 0, 34, 34, 0, 0, 34, 34, 32, 32, 50,
+        34, 50, 34, 32, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50,
+        0, 0, 50, 50, 50, 50, 50, 50, 50, 34, 34, 34,
+        34, 34, 34, 34, 0, 0, 34, 34, 34, 34, 34, 34,
+        32, 50, 0, 50, 34, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 50, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 50, 50, 50, 50, 50, 50, 50, 50, 32,
+        32, 34, 34, 34, 34, 34, 50, 34, 34, 34, 34, 0,
+        0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0,
+        0, 0, 0, 0, 50, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 32, 32, 0, 0,
+        0, 50, 0, 0, 34, 34, 34, 34, 34, 34, 34, 0,
+        34, 34, 34, 34, 34, 34, 34, 32, 0, 0, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 0, 50,
+        50, 50, 50, 50, 50, 34, 34, 34, 34, 34, 34, 0,
+        0, 0, 34, 0, 34, 34, 0, 34, 34, 34, 32, 34,
+        32, 32, 50, 34, 0, 0, 0, 0, 0, 0, 0, 0,
+        50, 50, 50, 50, 50, 50, 0, 50, 50, 0, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 34, 34, 34, 34, 34, 0, 34, 34, 0, 34,
+        34, 34, 34, 32, 50, 0, 0, 0, 0, 0, 0, 0,
+        50, 50, 50, 34, 34, 34, 34, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 34, 34, 50, 34, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 34, 34,
+        34, 32, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 32, 50, 50, 50, 50, 50, 50, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        32, 32, 32, 32, 32, 32, 32, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50,
+        0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 34,
+        50, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        0, 0, 0, 0, 0, 0, 0, 34, 50, 50, 0, 50,
+        32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        34, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 50, 50, 50, 50, 0, 50, 50, 50,
+        50, 50, 50, 50, 0, 50, 50, 0, 0, 0, 50, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        50, 50, 50, 0, 0, 50, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50,
+        0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 0, 0, 0, 32, 34, 0,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32,
+        32, 32, 0, 0, 0, 32, 32, 32, 32, 32, 32, 0,
+        0, 0, 0, 0, 0, 0, 0, 32, 32, 32, 32, 32,
+        32, 32, 32, 0, 0, 32, 32, 32, 32, 32, 32, 32,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 32, 32, 32, 32, 0, 0, 0, 0, 32, 32,
+        32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 54, 54,
+        54, 54, 54, 54, 54, 54, 54, 54, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 54, 54,
+        54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 54, 58, 58, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 54, 54, 54, 54, 54, 58, 0, 58, 58,
+        0, 0, 58, 0, 0, 58, 58, 0, 0, 58, 58, 58,
+        58, 0, 58, 58, 58, 58, 58, 58, 58, 58, 54, 54,
+        54, 54, 0, 54, 0, 54, 54, 54, 54, 54, 54, 54,
+        0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 54, 58, 58, 0, 58, 58, 58, 58, 0,
+        0, 58, 58, 58, 58, 58, 58, 58, 58, 0, 58, 58,
+        58, 58, 58, 58, 58, 0, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 54, 58, 58, 0, 58, 58, 58, 58, 0,
+        58, 58, 58, 58, 58, 0, 58, 0, 0, 0, 58, 58,
+        58, 58, 58, 58, 58, 0, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 54, 54, 54, 54, 54, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0,
+        58, 58, 58, 58, 58, 58, 58, 58, 54, 54, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 0,
+        54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54,
+        54, 54, 54, 54, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+        54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 0,
+        54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54,
+        54, 54, 54, 54, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0,
+        54, 54, 54, 54, 54, 54, 58, 54, 0, 0, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 0, 0, 0, 0, 32,
+        32, 32, 32, 32, 0, 0, 0, 0, 0, 32, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 50, 54,
+        54, 54, 54, 54, 0, 0, 0, 0, 0, 54, 54, 54,
+        54, 54, 54, 0, 0, 0, 0, 0, 34, 34, 34, 34,
+        34, 34, 34, 0, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 34,
+        34, 34, 34, 34, 34, 34, 0, 34, 34, 0, 34, 34,
+        34, 34, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34,
+        32, 32, 32, 32, 32, 32, 32, 50, 50, 50, 50, 50,
+        50, 50, 0, 0, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 0, 0, 0, 0, 50, 0, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 32, 0,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        32, 32, 32, 32, 50, 50, 50, 50, 50, 50, 50, 0,
+        50, 50, 50, 50, 0, 50, 50, 0, 54, 54, 54, 54,
+        32, 32, 32, 34, 32, 32, 32, 50, 0, 0, 0, 0,
+        50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 0, 50, 50, 0, 50, 0, 0, 50,
+        0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0,
+        50, 50, 50, 50, 0, 50, 0, 50, 0, 0, 0, 0,
+        0, 0, 50, 0, 0, 0, 0, 50, 0, 50, 0, 50,
+        0, 50, 50, 50, 0, 50, 50, 0, 50, 0, 0, 50,
+        0, 50, 0, 50, 0, 50, 0, 50, 0, 50, 50, 0,
+        50, 0, 0, 50, 50, 50, 50, 0, 50, 50, 50, 50,
+        50, 50, 50, 0, 50, 50, 50, 50, 0, 50, 50, 50,
+        50, 0, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 0, 50, 50, 50, 50, 50, 0, 50, 50, 50,
+        0, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0,
+        0, 0, 0, 0,
+    };
+} // namespace detail
+} // namespace gc
+
+#endif // __GENIUS_C_UTF8_PROPERTY_TABLES__
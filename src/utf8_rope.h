@@ -0,0 +1,577 @@
+#ifndef __GENIUS_C_UTF8_ROPE__
+#define __GENIUS_C_UTF8_ROPE__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "utf8.h"
+
+namespace gc {
+    /*
+    ** @brief: Utf8 text held as a B-tree of chunks, for documents that are
+    **    edited in many small places. Positions are code point indices, and
+    **    lines can be turned into positions and back.
+    ** @note: Every node keeps the number of bytes, code points and newlines
+    **    below it, so finding a position or a line, inserting, erasing and
+    **    slicing only walk one path from the root (plus the slice itself):
+    **    O(log n) for a text of n bytes. Chunks hold 256 to 1024 bytes and
+    **    are only ever cut between sequences.
+    ** @note: All text that goes in is validated, so the rope always holds
+    **    strictly valid utf8.
+    */
+    class Utf8Rope {
+        public:
+            Utf8Rope()
+                : root(new Node) {}
+
+            /*
+            ** @throws InvalidUtf8: If the text is not strictly valid utf8.
+            */
+            explicit Utf8Rope(std::string_view text)
+                : root(new Node) {
+                validate(text);
+                if (not text.empty()) {
+                    auto leaves = makeLeaves(std::string(text));
+                    root = buildLevels(std::move(leaves));
+                }
+            }
+
+            Utf8Rope(const Utf8Rope& other)
+                : root(copyNode(*other.root)) {}
+
+            Utf8Rope& operator=(const Utf8Rope& other) {
+                if (this != &other) {
+                    root = copyNode(*other.root);
+                }
+                return *this;
+            }
+
+            /*
+            ** @note: The rope moved from is left empty, with a fresh leaf of
+            **    its own, so that it stays usable. Making that leaf is an
+            **    allocation, so a move may throw std::bad_alloc.
+            */
+            Utf8Rope(Utf8Rope&& other)
+                : root(new Node) {
+                root.swap(other.root);
+            }
+
+            Utf8Rope& operator=(Utf8Rope&& other) {
+                if (this != &other) {
+                    std::unique_ptr<Node> empty(new Node);
+                    root = std::move(other.root);
+                    other.root = std::move(empty);
+                }
+                return *this;
+            }
+
+            /*
+            ** @brief: The length of the text in bytes.
+            */
+            std::size_t size() const {
+                return root->summary.bytes;
+            }
+
+            std::size_t codePointCount() const {
+                return root->summary.codePoints;
+            }
+
+            /*
+            ** @brief: The number of lines, ie. one more than the number of
+            **    '\n' characters.
+            */
+            std::size_t lineCount() const {
+                return root->summary.newlines + 1;
+            }
+
+            /*
+            ** @brief: Inserts utf8 text before the code point at 'position'.
+            ** @throws InvalidUtf8: If the text is not strictly valid utf8.
+            ** @throws std::out_of_range: If 'position' is past the end.
+            */
+            void insert(std::size_t position, std::string_view text) {
+                checkPosition(position);
+                validate(text);
+                if (text.empty()) {
+                    return;
+                }
+
+                auto siblings = insertInto(*root, position, text);
+                if (not siblings.empty()) {
+                    siblings.insert(siblings.begin(), std::move(root));
+                    root = buildLevels(std::move(siblings));
+                }
+            }
+
+            /*
+            ** @brief: Appends utf8 text.
+            ** @throws InvalidUtf8: If the text is not strictly valid utf8.
+            */
+            void append(std::string_view text) {
+                insert(codePointCount(), text);
+            }
+
+            /*
+            ** @brief: Erases up to 'count' code points, starting with the
+            **    one at 'position'.
+            ** @throws std::out_of_range: If 'position' is past the end.
+            */
+            void erase(std::size_t position, std::size_t count) {
+                checkPosition(position);
+                count = std::min(count, codePointCount() - position);
+                if (count == 0) {
+                    return;
+                }
+
+                eraseFrom(*root, position, position + count);
+                while (not root->leaf && root->children.size() == 1) {
+                    root = std::move(root->children[0]);
+                }
+                if (not root->leaf && root->children.empty()) {
+                    root.reset(new Node);
+                }
+            }
+
+            /*
+            ** @brief: Copies out up to 'count' code points, starting with the
+            **    one at 'position'.
+            ** @throws std::out_of_range: If 'position' is past the end.
+            */
+            std::string substr(std::size_t position, std::size_t count) const {
+                checkPosition(position);
+                count = std::min(count, codePointCount() - position);
+
+                std::string output;
+                if (count != 0) {
+                    collect(*root, position, position + count, output);
+                }
+                return output;
+            }
+
+            /*
+            ** @brief: The whole text.
+            */
+            std::string toString() const {
+                std::string output;
+                output.reserve(size());
+                collect(*root, 0, codePointCount(), output);
+                return output;
+            }
+
+            /*
+            ** @brief: The position of the first code point of the given
+            **    zero-based line.
+            ** @throws std::out_of_range: If there is no such line.
+            */
+            std::size_t lineStart(std::size_t line) const {
+                if (line >= lineCount()) {
+                    throw std::out_of_range("utf8 rope line out of range");
+                }
+                if (line == 0) {
+                    return 0;
+                }
+
+                // Find the node that holds the newline ending the line
+                // before, then count the code points up to and including it.
+                const Node* node = root.get();
+                std::size_t newlines = line;
+                std::size_t position = 0;
+
+                while (not node->leaf) {
+                    for (const auto& child : node->children) {
+                        if (child->summary.newlines >= newlines) {
+                            node = child.get();
+                            break;
+                        }
+                        newlines -= child->summary.newlines;
+                        position += child->summary.codePoints;
+                    }
+                }
+
+                const char* text = node->text.data();
+                const char* found = text - 1;
+                for (; newlines > 0; --newlines) {
+                    found = static_cast<const char*>(std::memchr(
+                        found + 1, '\n', node->text.size() - (found + 1 - text)
+                    ));
+                }
+                return position + detail::countCodePoints(
+                    reinterpret_cast<const unsigned char*>(text), found + 1 - text
+                );
+            }
+
+            /*
+            ** @brief: The zero-based line that the code point at 'position'
+            **    is on. The end of the text is on the last line.
+            ** @throws std::out_of_range: If 'position' is past the end.
+            */
+            std::size_t lineOf(std::size_t position) const {
+                checkPosition(position);
+
+                const Node* node = root.get();
+                std::size_t line = 0;
+
+                while (not node->leaf) {
+                    std::size_t index = 0;
+                    for (; index + 1 < node->children.size(); ++index) {
+                        const Summary& summary = node->children[index]->summary;
+                        if (position < summary.codePoints) {
+                            break;
+                        }
+                        position -= summary.codePoints;
+                        line += summary.newlines;
+                    }
+                    node = node->children[index].get();
+                }
+
+                const std::size_t offset = byteOffset(node->text, position);
+                return line + static_cast<std::size_t>(
+                    std::count(node->text.begin(), node->text.begin() + offset, '\n')
+                );
+            }
+
+            /*
+            ** @brief: The text of the given zero-based line, without the '\n'
+            **    that ends it.
+            ** @throws std::out_of_range: If there is no such line.
+            */
+            std::string line(std::size_t line) const {
+                const std::size_t start = lineStart(line);
+                const std::size_t end = line + 1 < lineCount()
+                    ? lineStart(line + 1) - 1
+                    : codePointCount();
+                return substr(start, end - start);
+            }
+
+        private:
+            struct Summary {
+                std::size_t bytes = 0;
+                std::size_t codePoints = 0;
+                std::size_t newlines = 0;
+            };
+
+            struct Node {
+                Summary summary;
+                bool leaf = true;
+                std::string text;
+                std::vector<std::unique_ptr<Node>> children;
+            };
+
+            using NodeList = std::vector<std::unique_ptr<Node>>;
+
+            static constexpr std::size_t LEAF_MIN = 256;
+            static constexpr std::size_t LEAF_MAX = 1024;
+            static constexpr std::size_t CHILDREN_MIN = 4;
+            static constexpr std::size_t CHILDREN_MAX = 16;
+
+            static void validate(std::string_view text) {
+                const auto bytes = reinterpret_cast<const unsigned char*>(text.data());
+                const std::size_t invalid = detail::validateUtf8(bytes, text.size());
+                if (invalid != text.size()) {
+                    detail::throwUtf8Error(bytes, text.size(), invalid);
+                }
+            }
+
+            void checkPosition(std::size_t position) const {
+                if (position > codePointCount()) {
+                    throw std::out_of_range("utf8 rope position out of range");
+                }
+            }
+
+            static std::size_t byteOffset(const std::string& text, std::size_t position) {
+                return detail::skipCodePoints(
+                    reinterpret_cast<const unsigned char*>(text.data()), text.size(), position
+                );
+            }
+
+            static void summarize(Node& node) {
+                Summary summary;
+                if (node.leaf) {
+                    summary.bytes = node.text.size();
+                    summary.codePoints = detail::countCodePoints(
+                        reinterpret_cast<const unsigned char*>(node.text.data()),
+                        node.text.size()
+                    );
+                    summary.newlines = static_cast<std::size_t>(
+                        std::count(node.text.begin(), node.text.end(), '\n')
+                    );
+                } else {
+                    for (const auto& child : node.children) {
+                        summary.bytes += child->summary.bytes;
+                        summary.codePoints += child->summary.codePoints;
+                        summary.newlines += child->summary.newlines;
+                    }
+                }
+                node.summary = summary;
+            }
+
+            static bool isUnderfull(const Node& node) {
+                return node.leaf
+                    ? node.text.size() < LEAF_MIN
+                    : node.children.size() < CHILDREN_MIN;
+            }
+
+            static std::unique_ptr<Node> copyNode(const Node& node) {
+                std::unique_ptr<Node> copy(new Node);
+                copy->summary = node.summary;
+                copy->leaf = node.leaf;
+                copy->text = node.text;
+                for (const auto& child : node.children) {
+                    copy->children.push_back(copyNode(*child));
+                }
+                return copy;
+            }
+
+            /*
+            ** @brief: Cuts text into leaves of at most LEAF_MAX bytes and of
+            **    about the same size, backing each cut off to the start of a
+            **    sequence.
+            */
+            static NodeList makeLeaves(std::string text) {
+                NodeList leaves;
+                const std::size_t pieces = (text.size() + LEAF_MAX - 1) / LEAF_MAX;
+                std::size_t start = 0;
+
+                for (std::size_t piece = 1; piece <= pieces; ++piece) {
+                    std::size_t end = text.size() * piece / pieces;
+                    while (end < text.size() && isValidUtf8TrailByte(text[end])) {
+                        --end;
+                    }
+
+                    std::unique_ptr<Node> leaf(new Node);
+                    if (piece == pieces && start == 0) {
+                        leaf->text = std::move(text);
+                    } else {
+                        leaf->text.assign(text, start, end - start);
+                    }
+                    summarize(*leaf);
+                    leaves.push_back(std::move(leaf));
+                    start = end;
+                }
+                return leaves;
+            }
+
+            /*
+            ** @brief: Groups nodes under parents of at most CHILDREN_MAX
+            **    children each, all about the same size.
+            */
+            static NodeList groupNodes(NodeList nodes) {
+                NodeList parents;
+                const std::size_t groups = (nodes.size() + CHILDREN_MAX - 1) / CHILDREN_MAX;
+                std::size_t start = 0;
+
+                for (std::size_t group = 1; group <= groups; ++group) {
+                    const std::size_t end = nodes.size() * group / groups;
+                    std::unique_ptr<Node> parent(new Node);
+                    parent->leaf = false;
+                    for (std::size_t index = start; index < end; ++index) {
+                        parent->children.push_back(std::move(nodes[index]));
+                    }
+                    summarize(*parent);
+                    parents.push_back(std::move(parent));
+                    start = end;
+                }
+                return parents;
+            }
+
+            /*
+            ** @brief: Builds parents over the given nodes, level by level,
+            **    until one node is left.
+            */
+            static std::unique_ptr<Node> buildLevels(NodeList nodes) {
+                while (nodes.size() > 1) {
+                    nodes = groupNodes(std::move(nodes));
+                }
+                return std::move(nodes[0]);
+            }
+
+            /*
+            ** @brief: Inserts text at a code point position within 'node'.
+            ** @returns: The nodes that 'node' had to be split into, apart
+            **    from itself, which go right after it in its parent.
+            */
+            static NodeList insertInto(Node& node, std::size_t position, std::string_view text) {
+                if (node.leaf) {
+                    node.text.insert(byteOffset(node.text, position), text.data(), text.size());
+                    if (node.text.size() <= LEAF_MAX) {
+                        summarize(node);
+                        return {};
+                    }
+
+                    NodeList leaves = makeLeaves(std::move(node.text));
+                    node.text = std::move(leaves[0]->text);
+                    summarize(node);
+                    leaves.erase(leaves.begin());
+                    return leaves;
+                }
+
+                std::size_t index = 0;
+                for (; index + 1 < node.children.size(); ++index) {
+                    const std::size_t codePoints = node.children[index]->summary.codePoints;
+                    if (position <= codePoints) {
+                        break;
+                    }
+                    position -= codePoints;
+                }
+
+                NodeList siblings = insertInto(*node.children[index], position, text);
+                node.children.insert(
+                    node.children.begin() + index + 1,
+                    std::make_move_iterator(siblings.begin()),
+                    std::make_move_iterator(siblings.end())
+                );
+
+                if (node.children.size() <= CHILDREN_MAX) {
+                    summarize(node);
+                    return {};
+                }
+
+                NodeList parents = groupNodes(std::move(node.children));
+                node.children = std::move(parents[0]->children);
+                summarize(node);
+                parents.erase(parents.begin());
+                return parents;
+            }
+
+            /*
+            ** @brief: Erases the code points in '[from, to)' of 'node', then
+            **    merges any child left too small with a neighbour.
+            */
+            static void eraseFrom(Node& node, std::size_t from, std::size_t to) {
+                if (node.leaf) {
+                    const std::size_t begin = byteOffset(node.text, from);
+                    const std::size_t end = begin + detail::skipCodePoints(
+                        reinterpret_cast<const unsigned char*>(node.text.data()) + begin,
+                        node.text.size() - begin,
+                        to - from
+                    );
+                    node.text.erase(begin, end - begin);
+                    summarize(node);
+                    return;
+                }
+
+                std::size_t childStart = 0;
+                for (std::size_t index = 0; index < node.children.size() && childStart < to;) {
+                    Node& child = *node.children[index];
+                    const std::size_t childEnd = childStart + child.summary.codePoints;
+
+                    if (childEnd <= from) {
+                        childStart = childEnd;
+                        ++index;
+                    } else if (from <= childStart && childEnd <= to) {
+                        node.children.erase(node.children.begin() + index);
+                        childStart = childEnd;
+                    } else {
+                        eraseFrom(
+                            child,
+                            std::max(from, childStart) - childStart,
+                            std::min(to, childEnd) - childStart
+                        );
+                        childStart = childEnd;
+                        ++index;
+                    }
+                }
+
+                for (std::size_t index = 0; index < node.children.size() && node.children.size() > 1;) {
+                    if (isUnderfull(*node.children[index])) {
+                        index = mergeWithNeighbour(node, index);
+                    } else {
+                        ++index;
+                    }
+                }
+                summarize(node);
+            }
+
+            /*
+            ** @brief: Merges the child at 'index' with the one next to it,
+            **    splitting the result in two again if it got too large.
+            ** @returns: The index to carry on checking from.
+            */
+            static std::size_t mergeWithNeighbour(Node& parent, std::size_t index) {
+                const std::size_t left = index > 0 ? index - 1 : index;
+                Node& first = *parent.children[left];
+                Node& second = *parent.children[left + 1];
+
+                if (first.leaf) {
+                    first.text += second.text;
+                } else {
+                    std::move(
+                        second.children.begin(), second.children.end(),
+                        std::back_inserter(first.children)
+                    );
+                }
+                parent.children.erase(parent.children.begin() + left + 1);
+
+                const bool overfull = first.leaf
+                    ? first.text.size() > LEAF_MAX
+                    : first.children.size() > CHILDREN_MAX;
+                if (not overfull) {
+                    summarize(first);
+                    return left;
+                }
+
+                NodeList halves;
+                if (first.leaf) {
+                    halves = makeLeaves(std::move(first.text));
+                    first.text = std::move(halves[0]->text);
+                } else {
+                    halves = groupNodes(std::move(first.children));
+                    first.children = std::move(halves[0]->children);
+                }
+                summarize(first);
+                parent.children.insert(
+                    parent.children.begin() + left + 1, std::move(halves[1])
+                );
+                return left + 2;
+            }
+
+            /*
+            ** @brief: Appends the code points in '[from, to)' of 'node'.
+            */
+            static void collect(
+                const Node& node,
+                std::size_t from,
+                std::size_t to,
+                std::string& output
+            ) {
+                if (node.leaf) {
+                    const std::size_t begin = byteOffset(node.text, from);
+                    const std::size_t end = begin + detail::skipCodePoints(
+                        reinterpret_cast<const unsigned char*>(node.text.data()) + begin,
+                        node.text.size() - begin,
+                        to - from
+                    );
+                    output.append(node.text, begin, end - begin);
+                    return;
+                }
+
+                std::size_t childStart = 0;
+                for (const auto& child : node.children) {
+                    const std::size_t childEnd = childStart + child->summary.codePoints;
+                    if (childStart >= to) {
+                        break;
+                    }
+                    if (childEnd > from) {
+                        collect(
+                            *child,
+                            std::max(from, childStart) - childStart,
+                            std::min(to, childEnd) - childStart,
+                            output
+                        );
+                    }
+                    childStart = childEnd;
+                }
+            }
+
+            std::unique_ptr<Node> root;
+    };
+} // namespace gc
+
+#endif // __GENIUS_C_UTF8_ROPE__
@@ -0,0 +1,93 @@
+#ifndef __GENIUS_C_UTF8_SEARCH__
+#define __GENIUS_C_UTF8_SEARCH__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include "utf8.h"
+
+namespace gc {
+    /*
+    ** @brief: Finds the first occurrence of a code point in utf8 text,
+    **    without decoding the text.
+    ** @param pos: The offset at which to start searching.
+    ** @returns: The byte offset of the occurrence, or 'std::string_view::npos'
+    **    if there is none or 'codePoint' is a surrogate or above U+10FFFF.
+    ** @note: The code point is encoded once and its bytes are searched for,
+    **    filtering on the first and last byte with SIMD. An encoded code
+    **    point starts with a lead byte and never with a trail byte, so a
+    **    match always falls on a code point boundary, even when 'pos' does
+    **    not.
+    */
+    inline std::size_t findCodePoint(
+        std::string_view str,
+        uint32_t codePoint,
+        std::size_t pos = 0
+    ) noexcept {
+        if (pos >= str.size() || not detail::scalar::isScalarValue(codePoint)) {
+            return std::string_view::npos;
+        }
+
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data()) + pos;
+        const std::size_t length = str.size() - pos;
+
+        if (codePoint < 0x80) {
+            const void* found = std::memchr(bytes, static_cast<int>(codePoint), length);
+            return found == nullptr
+                ? std::string_view::npos
+                : pos + (static_cast<const unsigned char*>(found) - bytes);
+        }
+
+        unsigned char needle[4];
+        unsigned char* out = needle;
+        put_utf8_char(out, codePoint);
+
+        const std::size_t offset = detail::findByteSequence(
+            bytes, length, needle, static_cast<std::size_t>(out - needle)
+        );
+        return offset == length ? std::string_view::npos : pos + offset;
+    }
+
+    /*
+    ** @brief: Finds the first occurrence of 'needle' in utf8 text.
+    ** @param pos: The offset at which to start searching.
+    ** @returns: The byte offset of the occurrence, or 'std::string_view::npos'
+    **    if there is none. An empty needle is found at 'pos' when 'pos' is
+    **    within the text, as with 'std::string_view::find'.
+    ** @throws InvalidUtf8: If the needle is not strictly valid utf8. The
+    **    text itself is not validated.
+    ** @note: A valid needle starts with a lead byte and ends with a whole
+    **    sequence, so a match starts and ends on code point boundaries of
+    **    the text.
+    */
+    inline std::size_t findSubstring(
+        std::string_view str,
+        std::string_view needle,
+        std::size_t pos = 0
+    ) {
+        const auto needleBytes = reinterpret_cast<const unsigned char*>(needle.data());
+        const std::size_t invalid = detail::validateUtf8(needleBytes, needle.size());
+        if (invalid != needle.size()) {
+            detail::throwUtf8Error(needleBytes, needle.size(), invalid);
+        }
+
+        if (pos > str.size()) {
+            return std::string_view::npos;
+        }
+        if (needle.empty()) {
+            return pos;
+        }
+
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data()) + pos;
+        const std::size_t length = str.size() - pos;
+
+        const std::size_t offset = detail::findByteSequence(
+            bytes, length, needleBytes, needle.size()
+        );
+        return offset == length ? std::string_view::npos : pos + offset;
+    }
+} // namespace gc
+
+#endif // __GENIUS_C_UTF8_SEARCH__
@@ -0,0 +1,228 @@
+#ifndef __GENIUS_C_UTF8_STATS__
+#define __GENIUS_C_UTF8_STATS__
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+** Optional counters that show how much text goes down each path. They are
+** off unless GC_UTF8_STATS is defined, in which case every translation unit
+** has to define it alike. When off, the recording hooks are empty and
+** compile away, and 'getUtf8Stats' returns zeros.
+**
+** Each thread counts into a block of its own, so recording never contends:
+** only the owner writes a block, with a plain load and store. Reading takes
+** a lock and adds up the blocks of the live threads and the totals left by
+** the ones that have exited.
+**
+** Nothing is allocated: the blocks are thread_local and linked into a list,
+** and the registry lives in static storage. Recording only takes the lock
+** on a thread's first count and when the thread exits.
+*/
+#if defined(GC_UTF8_STATS)
+#   include <atomic>
+#   include <mutex>
+#   include <new>
+#endif
+
+namespace gc {
+    /*
+    ** @brief: A snapshot of the counters, totalled over all threads.
+    */
+    struct Utf8Stats {
+        // Bytes given to the validators (on their own, or with hashing or
+        // classification).
+        uint64_t bytesValidated = 0;
+        // Bytes that an all-ascii shortcut accepted without decoding.
+        uint64_t asciiFastPathBytes = 0;
+        // Sequences that the scalar decoder took one at a time.
+        uint64_t slowPathDecodes = 0;
+        // Errors indexed by Utf8ErrorKind, each counted once where it is
+        // thrown, returned (eg. by 'isValidUtf8' or the C functions) or
+        // repaired by 'sanitizeUtf8'. What lossy conversions replace is
+        // not counted.
+        uint64_t errors[8] = {};
+        // Results of 'getUtf8SequenceLength', indexed by the length (0 for
+        // a byte that starts no sequence).
+        uint64_t sequenceLengths[7] = {};
+    };
+
+namespace detail {
+    enum StatsCounter {
+        STAT_BYTES_VALIDATED,
+        STAT_ASCII_FAST_PATH,
+        STAT_SLOW_DECODES,
+        STAT_ERRORS,
+        STAT_SEQUENCE_LENGTHS = STAT_ERRORS + 8,
+        STAT_COUNT = STAT_SEQUENCE_LENGTHS + 7
+    };
+
+#if defined(GC_UTF8_STATS)
+    struct StatsBlock {
+        std::atomic<uint64_t> counters[STAT_COUNT];
+        // The neighbours in the registry's list of live threads.
+        StatsBlock* previous;
+        StatsBlock* next;
+    };
+
+    struct StatsRegistry {
+        std::mutex mutex;
+        StatsBlock* blocks = nullptr;
+        // What exited threads counted.
+        uint64_t retired[STAT_COUNT] = {};
+        // The totals at the last reset.
+        uint64_t baseline[STAT_COUNT] = {};
+    };
+
+    /*
+    ** @note: Never destroyed, so that threads that outlive static
+    **    destruction can still retire their counts.
+    */
+    inline StatsRegistry& getStatsRegistry() {
+        alignas(StatsRegistry) static unsigned char storage[sizeof(StatsRegistry)];
+        static StatsRegistry* registry = new (storage) StatsRegistry();
+        return *registry;
+    }
+
+    /*
+    ** @brief: Registers a thread's block on first use and retires it when
+    **    the thread exits.
+    */
+    class ThreadStats {
+        public:
+            ThreadStats() {
+                for (auto& counter : block.counters) {
+                    counter.store(0, std::memory_order_relaxed);
+                }
+                StatsRegistry& registry = getStatsRegistry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                block.previous = nullptr;
+                block.next = registry.blocks;
+                if (registry.blocks != nullptr) {
+                    registry.blocks->previous = &block;
+                }
+                registry.blocks = &block;
+            }
+
+            ~ThreadStats() {
+                StatsRegistry& registry = getStatsRegistry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                for (int counter = 0; counter < STAT_COUNT; ++counter) {
+                    registry.retired[counter] += block.counters[counter].load(std::memory_order_relaxed);
+                }
+                if (block.previous != nullptr) {
+                    block.previous->next = block.next;
+                } else {
+                    registry.blocks = block.next;
+                }
+                if (block.next != nullptr) {
+                    block.next->previous = block.previous;
+                }
+            }
+
+            ThreadStats(const ThreadStats&) = delete;
+            ThreadStats& operator=(const ThreadStats&) = delete;
+
+            void add(int counter, uint64_t amount) {
+                std::atomic<uint64_t>& value = block.counters[counter];
+                value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+            }
+
+        private:
+            StatsBlock block;
+    };
+
+    inline void addStat(int counter, uint64_t amount) {
+        thread_local ThreadStats stats;
+        stats.add(counter, amount);
+    }
+
+    /*
+    ** @brief: Adds up every thread's counters. The registry has to be
+    **    locked.
+    */
+    inline void sumStats(const StatsRegistry& registry, uint64_t* totals) {
+        for (int counter = 0; counter < STAT_COUNT; ++counter) {
+            totals[counter] = registry.retired[counter];
+        }
+        for (const StatsBlock* block = registry.blocks; block != nullptr; block = block->next) {
+            for (int counter = 0; counter < STAT_COUNT; ++counter) {
+                totals[counter] += block->counters[counter].load(std::memory_order_relaxed);
+            }
+        }
+    }
+#else
+    inline void addStat(int, uint64_t) {}
+#endif
+
+    inline void recordBytesValidated(std::size_t count) {
+        addStat(STAT_BYTES_VALIDATED, count);
+    }
+
+    inline void recordAsciiFastPath(std::size_t count) {
+        addStat(STAT_ASCII_FAST_PATH, count);
+    }
+
+    inline void recordSlowDecode() {
+        addStat(STAT_SLOW_DECODES, 1);
+    }
+
+    /*
+    ** @param kind: A Utf8ErrorKind.
+    */
+    inline void recordUtf8Error(int kind) {
+        addStat(STAT_ERRORS + kind, 1);
+    }
+
+    inline void recordSequenceLength(int length) {
+        addStat(STAT_SEQUENCE_LENGTHS + length, 1);
+    }
+} // namespace detail
+
+    /*
+    ** @brief: The counters since the start, or since the last reset, over
+    **    all threads. All zero unless GC_UTF8_STATS is defined.
+    ** @note: Counts that other threads are making at the time may or may
+    **    not be included, but each counter is read whole.
+    */
+    inline Utf8Stats getUtf8Stats() {
+        Utf8Stats stats;
+#if defined(GC_UTF8_STATS)
+        uint64_t totals[detail::STAT_COUNT];
+        {
+            detail::StatsRegistry& registry = detail::getStatsRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            detail::sumStats(registry, totals);
+            for (int counter = 0; counter < detail::STAT_COUNT; ++counter) {
+                totals[counter] -= registry.baseline[counter];
+            }
+        }
+
+        stats.bytesValidated = totals[detail::STAT_BYTES_VALIDATED];
+        stats.asciiFastPathBytes = totals[detail::STAT_ASCII_FAST_PATH];
+        stats.slowPathDecodes = totals[detail::STAT_SLOW_DECODES];
+        for (int kind = 0; kind < 8; ++kind) {
+            stats.errors[kind] = totals[detail::STAT_ERRORS + kind];
+        }
+        for (int length = 0; length < 7; ++length) {
+            stats.sequenceLengths[length] = totals[detail::STAT_SEQUENCE_LENGTHS + length];
+        }
+#endif
+        return stats;
+    }
+
+    /*
+    ** @brief: Starts the counters again from zero.
+    ** @note: The threads' blocks are left alone; the current totals become
+    **    a baseline that later snapshots subtract.
+    */
+    inline void resetUtf8Stats() {
+#if defined(GC_UTF8_STATS)
+        detail::StatsRegistry& registry = detail::getStatsRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        detail::sumStats(registry, registry.baseline);
+#endif
+    }
+} // namespace gc
+
+#endif // __GENIUS_C_UTF8_STATS__
@@ -0,0 +1,95 @@
+#ifndef __GENIUS_C_UTF8_TRUNCATE__
+#define __GENIUS_C_UTF8_TRUNCATE__
+
+#include <cstddef>
+#include <string_view>
+
+#include "utf8.h"
+#include "utf8_graphemes.h"
+
+namespace gc {
+    /*
+    ** @brief: Where a truncation is allowed to cut the text.
+    */
+    enum class TruncationBoundary {
+        // Between any two code points.
+        CodePoint,
+        // Between grapheme clusters only, so that a letter never loses its
+        // accents and an emoji sequence is never split.
+        Grapheme
+    };
+
+namespace detail {
+    /*
+    ** @returns: 'pos' if it is a grapheme cluster boundary, otherwise the
+    **    start of the cluster that holds it.
+    ** @throws InvalidUtf8: If the text around 'pos' is invalid utf8.
+    */
+    inline std::size_t graphemeBoundaryAtOrBefore(std::string_view str, std::size_t pos) {
+        if (pos == 0 || pos >= str.size()) {
+            return pos;
+        }
+        const std::size_t start = previousGraphemeBreak(str, pos);
+        return nextGraphemeBreak(str, start) == pos ? pos : start;
+    }
+} // namespace detail
+
+    /*
+    ** @brief: Returns the longest prefix of the given utf8 text that is at
+    **    most 'maxBytes' long and does not end inside a sequence.
+    ** @param boundary: With 'TruncationBoundary::Grapheme', the prefix also
+    **    ends on a grapheme cluster boundary.
+    ** @throws InvalidUtf8: With 'TruncationBoundary::Grapheme', if the text
+    **    around the cut is invalid utf8. Otherwise the text is not
+    **    validated and this never throws.
+    ** @note: At most three trail bytes are backed off over, so the cut is
+    **    found in constant time.
+    */
+    inline std::string_view truncateToBytes(
+        std::string_view str,
+        std::size_t maxBytes,
+        TruncationBoundary boundary = TruncationBoundary::CodePoint
+    ) {
+        if (str.size() <= maxBytes) {
+            return str;
+        }
+
+        std::size_t cut = maxBytes;
+        while (cut > 0 && maxBytes - cut < 3 && isValidUtf8TrailByte(str[cut])) {
+            --cut;
+        }
+
+        if (boundary == TruncationBoundary::Grapheme) {
+            cut = detail::graphemeBoundaryAtOrBefore(str, cut);
+        }
+        return str.substr(0, cut);
+    }
+
+    /*
+    ** @brief: Returns the longest prefix of the given utf8 text that holds
+    **    at most 'maxCodePoints' code points.
+    ** @param boundary: With 'TruncationBoundary::Grapheme', the prefix also
+    **    ends on a grapheme cluster boundary.
+    ** @throws InvalidUtf8: With 'TruncationBoundary::Grapheme', if the text
+    **    around the cut is invalid utf8. Otherwise the text is not
+    **    validated and this never throws.
+    ** @note: Code points are counted as the bytes that are not trail bytes,
+    **    a whole block at a time, without decoding.
+    */
+    inline std::string_view truncateToCodePoints(
+        std::string_view str,
+        std::size_t maxCodePoints,
+        TruncationBoundary boundary = TruncationBoundary::CodePoint
+    ) {
+        std::size_t cut = detail::skipCodePoints(
+            reinterpret_cast<const unsigned char*>(str.data()), str.size(), maxCodePoints
+        );
+
+        if (boundary == TruncationBoundary::Grapheme) {
+            cut = detail::graphemeBoundaryAtOrBefore(str, cut);
+        }
+        return str.substr(0, cut);
+    }
+} // namespace gc
+
+#endif // __GENIUS_C_UTF8_TRUNCATE__
@@ -0,0 +1,216 @@
+#ifndef __GENIUS_C_UTF8_URL__
+#define __GENIUS_C_UTF8_URL__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include "utf8.h"
+
+namespace gc {
+    /*
+    ** @brief: Which flavour of percent-encoding to read or write.
+    */
+    enum class PercentEncoding {
+        // RFC 3986: '+' is an ordinary character.
+        Uri,
+        // application/x-www-form-urlencoded, as in query strings: a space
+        // is written as '+', and '+' reads as a space.
+        Form
+    };
+
+namespace detail {
+    /*
+    ** @returns: The value of a hex digit, or -1 if the byte is not one.
+    */
+    inline int getHexDigitValue(unsigned char byte) {
+        if (static_cast<unsigned char>(byte - '0') < 10) {
+            return byte - '0';
+        }
+        if (static_cast<unsigned char>((byte | 0x20) - 'a') < 6) {
+            return (byte | 0x20) - 'a' + 10;
+        }
+        return -1;
+    }
+} // namespace detail
+
+    /*
+    ** @brief: Decodes percent-encoded text (eg. a URL path or query string)
+    **    into 'output', replacing its contents but reusing its storage, and
+    **    checks that the result is strictly valid utf8. 'str' may view
+    **    'output'.
+    ** @param encoding: Whether '+' stands for a space.
+    ** @throws InvalidUtf8: If the decoded text is not strictly valid utf8.
+    **    The offset in the error is an offset into the decoded text.
+    ** @note: As in the WHATWG URL standard, a '%' that is not followed by
+    **    two hex digits is kept as it is.
+    ** @note: The runs between escapes are found with SIMD and copied in
+    **    bulk. Each stretch of output is validated as soon as it is
+    **    written, while it is still in cache; a sequence that an escape
+    **    may leave unfinished is checked again once more bytes arrive.
+    **    Decoding never makes text longer, so 'output' is sized once.
+    */
+    inline void percentDecodeUtf8(
+        std::string_view str,
+        std::string& output,
+        PercentEncoding encoding = PercentEncoding::Uri
+    ) {
+        if (detail::isViewInto(str, output)) {
+            std::string decoded;
+            percentDecodeUtf8(str, decoded, encoding);
+            output.swap(decoded);
+            return;
+        }
+
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data());
+        const std::size_t length = str.size();
+        const bool form = encoding == PercentEncoding::Form;
+
+        output.resize(length);
+        auto out = reinterpret_cast<unsigned char*>(&output[0]);
+        std::size_t pos = 0;
+        std::size_t written = 0;
+        std::size_t checked = 0;
+
+        while (pos < length) {
+            const std::size_t run = detail::percentPlainPrefixLength(
+                bytes + pos, length - pos, form
+            );
+            std::memcpy(out + written, bytes + pos, run);
+            pos += run;
+            written += run;
+
+            while (pos < length && (bytes[pos] == '%' || (form && bytes[pos] == '+'))) {
+                if (bytes[pos] == '+') {
+                    out[written++] = ' ';
+                    ++pos;
+                    continue;
+                }
+
+                const int high = pos + 2 < length ? detail::getHexDigitValue(bytes[pos + 1]) : -1;
+                const int low = high >= 0 ? detail::getHexDigitValue(bytes[pos + 2]) : -1;
+                if (low < 0) {
+                    out[written++] = '%';
+                    ++pos;
+                    continue;
+                }
+                out[written++] = static_cast<unsigned char>((high << 4) | low);
+                pos += 3;
+            }
+
+            // Fewer than four bytes left over may be a sequence that the next
+            // escapes finish. If not, the same error is found again then.
+            checked += detail::validateUtf8(out + checked, written - checked);
+            if (checked != written && (pos == length || written - checked >= 4)) {
+                detail::throwUtf8Error(out, written, checked);
+            }
+        }
+
+        output.resize(written);
+    }
+
+    /*
+    ** @brief: Returns the percent-decoded form of the given text.
+    ** @throws InvalidUtf8: If the decoded text is not strictly valid utf8.
+    */
+    inline std::string percentDecodeUtf8(
+        std::string_view str,
+        PercentEncoding encoding = PercentEncoding::Uri
+    ) {
+        std::string output;
+        percentDecodeUtf8(str, output, encoding);
+        return output;
+    }
+
+    /*
+    ** @brief: Percent-encodes utf8 text into 'output', replacing its
+    **    contents but reusing its storage. Every byte but the unreserved
+    **    ones (letters, digits, '-', '.', '_' and '~') becomes '%XX'.
+    **    'str' may view 'output'.
+    ** @param encoding: Whether a space is written as '+'.
+    ** @throws InvalidUtf8: If the text is not strictly valid utf8.
+    ** @note: Runs of unreserved bytes are found with SIMD and copied in
+    **    bulk. Those are ascii, so only the sequences that get escaped
+    **    need validating, which happens as they are escaped.
+    */
+    inline void percentEncode(
+        std::string_view str,
+        std::string& output,
+        PercentEncoding encoding = PercentEncoding::Uri
+    ) {
+        static const char digits[] = "0123456789ABCDEF";
+
+        if (detail::isViewInto(str, output)) {
+            std::string encoded;
+            percentEncode(str, encoded, encoding);
+            output.swap(encoded);
+            return;
+        }
+
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data());
+        const std::size_t length = str.size();
+        const bool form = encoding == PercentEncoding::Form;
+
+        // The most that one code point turns into: four escaped bytes.
+        constexpr std::size_t maxEscape = 12;
+        output.resize(length + maxEscape);
+        std::size_t pos = 0;
+        std::size_t written = 0;
+
+        while (pos < length) {
+            const std::size_t run = detail::unreservedPrefixLength(bytes + pos, length - pos);
+
+            const std::size_t needed = written + run + maxEscape;
+            if (output.size() < needed) {
+                output.resize(std::max(needed, 2 * output.size()));
+            }
+            char* out = &output[0];
+
+            std::memcpy(out + written, bytes + pos, run);
+            pos += run;
+            written += run;
+            if (pos == length) {
+                break;
+            }
+
+            int size = 1;
+            if (bytes[pos] >= 0x80) {
+                uint32_t codePoint;
+                size = detail::scalar::decodeUtf8Sequence(bytes + pos, length - pos, codePoint);
+                if (size == 0) {
+                    detail::throwUtf8Error(bytes, length, pos);
+                }
+            } else if (form && bytes[pos] == ' ') {
+                out[written++] = '+';
+                ++pos;
+                continue;
+            }
+
+            for (int index = 0; index < size; ++index, ++pos) {
+                out[written++] = '%';
+                out[written++] = digits[bytes[pos] >> 4];
+                out[written++] = digits[bytes[pos] & 0xf];
+            }
+        }
+
+        output.resize(written);
+    }
+
+    /*
+    ** @brief: Returns the percent-encoded form of the given utf8 text.
+    ** @throws InvalidUtf8: If the text is not strictly valid utf8.
+    */
+    inline std::string percentEncode(
+        std::string_view str,
+        PercentEncoding encoding = PercentEncoding::Uri
+    ) {
+        std::string output;
+        percentEncode(str, output, encoding);
+        return output;
+    }
+} // namespace gc
+
+#endif // __GENIUS_C_UTF8_URL__
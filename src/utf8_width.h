@@ -0,0 +1,160 @@
+#ifndef __GENIUS_C_UTF8_WIDTH__
+#define __GENIUS_C_UTF8_WIDTH__
+
+#include <cstddef>
+#include <string_view>
+
+#include "utf8.h"
+#include "utf8_graphemes.h"
+#include "utf8_width_tables.h"
+
+namespace gc {
+namespace detail {
+    inline uint8_t getWidthProperty(uint32_t codePoint) {
+        const uint32_t middle = WIDTH_INDEX[codePoint >> (WIDTH_SHIFT1 + WIDTH_SHIFT2)];
+        const uint32_t block = WIDTH_MIDDLE[
+            (middle << WIDTH_SHIFT1) +
+            ((codePoint >> WIDTH_SHIFT2) & ((1u << WIDTH_SHIFT1) - 1))
+        ];
+        return WIDTH_BLOCKS[(block << WIDTH_SHIFT2) + (codePoint & ((1u << WIDTH_SHIFT2) - 1))];
+    }
+
+    inline bool isRegionalIndicator(uint32_t codePoint) {
+        return codePoint - 0x1f1e6 < 26;
+    }
+
+    /*
+    ** @brief: The number of columns that a grapheme cluster takes up.
+    ** @note: A cluster is as wide as its code points put together, except
+    **    that a variation selector switches an emoji between text (1) and
+    **    emoji (2) presentation, a pair of regional indicators is one flag,
+    **    and skin tone modifiers and whatever follows a ZWJ are drawn into
+    **    the first glyph.
+    */
+    inline std::size_t getClusterWidth(const unsigned char* bytes, std::size_t length) {
+        uint32_t codePoint = 0;
+        std::size_t pos = scalar::decodeUtf8Sequence(bytes, length, codePoint);
+
+        const uint8_t first = getWidthProperty(codePoint);
+        const bool regional = isRegionalIndicator(codePoint);
+        std::size_t width = first & 3;
+        bool joined = false;
+
+        while (pos < length) {
+            pos += scalar::decodeUtf8Sequence(bytes + pos, length - pos, codePoint);
+
+            if (joined) {
+                joined = codePoint == 0x200d;
+            } else if (codePoint == 0x200d) {
+                joined = true;
+            } else if (codePoint == 0xfe0f && (first & WIDTH_EMOJI)) {
+                width = 2;
+            } else if (codePoint == 0xfe0e && (first & WIDTH_EMOJI)) {
+                width = 1;
+            } else if (regional && isRegionalIndicator(codePoint)) {
+                width = 2;
+            } else if (codePoint - 0x1f3fb >= 5) {
+                width += getWidthProperty(codePoint) & 3;
+            }
+        }
+
+        return width;
+    }
+
+    /*
+    ** @brief: Measures the text up to the last grapheme boundary that keeps
+    **    it within 'limit' columns.
+    ** @param width: Receives the width of the measured part.
+    ** @returns: The length of the measured part.
+    ** @throws InvalidUtf8: If the measured part is not strictly valid utf8.
+    */
+    inline std::size_t measureWidth(
+        std::string_view str,
+        std::size_t limit,
+        std::size_t& width
+    ) {
+        const auto bytes = reinterpret_cast<const unsigned char*>(str.data());
+        const std::size_t length = str.size();
+        std::size_t pos = 0;
+        width = 0;
+
+        while (pos < length) {
+            if (bytes[pos] < 0x80) {
+                std::size_t printable = 0;
+                std::size_t run = countAsciiPrintable(bytes + pos, length - pos, printable);
+
+                // The last ascii byte may start a cluster that goes on with
+                // combining marks or a variation selector.
+                if (pos + run < length) {
+                    --run;
+                    printable -= static_cast<unsigned char>(bytes[pos + run] - 0x20) < 0x5f;
+                }
+
+                if (width + printable > limit) {
+                    for (;; ++pos) {
+                        const std::size_t columns =
+                            static_cast<unsigned char>(bytes[pos] - 0x20) < 0x5f;
+                        if (width + columns > limit) {
+                            return pos;
+                        }
+                        width += columns;
+                    }
+                }
+
+                width += printable;
+                pos += run;
+                if (pos == length) {
+                    break;
+                }
+            }
+
+            const std::size_t end = nextGraphemeBreak(str, pos);
+            const std::size_t columns = getClusterWidth(bytes + pos, end - pos);
+            if (width + columns > limit) {
+                return pos;
+            }
+            width += columns;
+            pos = end;
+        }
+
+        return length;
+    }
+} // namespace detail
+
+    /*
+    ** @brief: The number of terminal columns that the given utf8 text takes
+    **    up, in the manner of 'wcswidth' but one grapheme cluster at a time,
+    **    so emoji sequences and flags count as a single wide character.
+    ** @note: East Asian wide and fullwidth characters take two columns;
+    **    ambiguous ones take one. Control characters, combining marks and
+    **    format characters take none.
+    ** @throws InvalidUtf8: If the text is not strictly valid utf8.
+    */
+    inline std::size_t displayWidth(std::string_view str) {
+        std::size_t width;
+        detail::measureWidth(str, static_cast<std::size_t>(-1), width);
+        return width;
+    }
+
+    /*
+    ** @brief: Returns the longest prefix of the given utf8 text that fits in
+    **    'maxWidth' terminal columns, cut at a grapheme cluster boundary.
+    ** @param width: Receives the width of the prefix.
+    ** @throws InvalidUtf8: If the prefix or the cluster after it is not
+    **    strictly valid utf8.
+    */
+    inline std::string_view truncateToWidth(
+        std::string_view str,
+        std::size_t maxWidth,
+        std::size_t& width
+    ) {
+        return str.substr(0, detail::measureWidth(str, maxWidth, width));
+    }
+
+    inline std::string_view truncateToWidth(std::string_view str, std::size_t maxWidth) {
+        std::size_t width;
+        return truncateToWidth(str, maxWidth, width);
+    }
+} // namespace gc
+
+#endif // __GENIUS_C_UTF8_WIDTH__
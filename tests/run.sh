@@ -0,0 +1,74 @@
+#!/bin/sh
+#
+# Builds the tests once per kernel set and runs them:
+#    avx512-vbmi2   AVX-512 F/BW/VL/VBMI/VBMI2 (the compressing encoders)
+#    avx512         the same without VBMI2
+#    sse2           the baseline x86-64 kernels
+#    scalar         GC_UTF8_NO_SIMD
+#
+# Usage (from anywhere):
+#    tests/run.sh [FUZZ_ITERATIONS]
+#
+# The smoke tests are also built with GC_UTF8_STATS, to check the counters.
+# CXX picks the compiler (default g++). SANITIZE=1 builds with ASan and
+# UBSan. The AVX-512 builds run when the host has the instructions, or
+# under Intel SDE when SDE is set to its command prefix, eg.
+#    SDE="sde64 -icx --" tests/run.sh
+# Otherwise they are only built, and reported as skipped.
+
+set -eu
+
+root=$(cd "$(dirname "$0")/.." && pwd)
+iterations=${1:-20000}
+cxx=${CXX:-g++}
+build=$(mktemp -d)
+trap 'rm -rf "$build"' EXIT
+
+flags="-std=c++17 -O2 -Wall -Wextra -Werror -I$root/src"
+if [ "${SANITIZE:-0}" = 1 ]; then
+    flags="$flags -g -fsanitize=address,undefined -fno-sanitize-recover=all"
+fi
+
+has_cpu_flag() {
+    grep -qw "$1" /proc/cpuinfo 2>/dev/null
+}
+
+failed=0
+for config in avx512-vbmi2 avx512 sse2 scalar; do
+    runner=""
+    case $config in
+        avx512-vbmi2)
+            target="-march=icelake-server"
+            needed="avx512_vbmi2" ;;
+        avx512)
+            target="-march=icelake-server -mno-avx512vbmi2"
+            needed="avx512vbmi" ;;
+        sse2)
+            target=""
+            needed="" ;;
+        scalar)
+            target="-DGC_UTF8_NO_SIMD"
+            needed="" ;;
+    esac
+
+    "$cxx" $flags $target "$root/tests/utf8_fuzz.cpp" -o "$build/fuzz-$config"
+    "$cxx" $flags $target "$root/tests/utf8_smoke.cpp" "$root/src/utf8_c.cpp" \
+        -o "$build/smoke-$config"
+    "$cxx" $flags $target -DGC_UTF8_STATS "$root/tests/utf8_smoke.cpp" "$root/src/utf8_c.cpp" \
+        -o "$build/smoke-stats-$config"
+
+    if [ -n "$needed" ] && ! has_cpu_flag "$needed"; then
+        if [ -z "${SDE:-}" ]; then
+            echo "$config: built; skipped running (no $needed here, and SDE is not set)"
+            continue
+        fi
+        runner=$SDE
+    fi
+
+    echo "== $config"
+    $runner "$build/smoke-$config" || failed=1
+    $runner "$build/smoke-stats-$config" || failed=1
+    $runner "$build/fuzz-$config" "$iterations" || failed=1
+done
+
+exit $failed
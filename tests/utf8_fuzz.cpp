@@ -0,0 +1,397 @@
+/*
+** Differential fuzzer: runs random (mostly valid, sometimes corrupted) text
+** through the kernels that 'utf8_kernels.h' picks for the target and checks
+** them against the scalar kernels, and the ascii scans against plain loops.
+** Every output buffer is exactly as large as the API promises, so building
+** with '-fsanitize=address' also catches overruns.
+**
+** Build once per kernel set (see tests/run.sh), eg.
+**    g++ -std=c++17 -O2 -march=native -Isrc tests/utf8_fuzz.cpp -o utf8_fuzz
+**
+** Usage:
+**    utf8_fuzz [ITERATIONS] [SEED]
+*/
+#include "utf8.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    namespace detail = gc::detail;
+
+    std::mt19937_64 generator;
+    std::string current;
+
+    std::size_t pick(std::size_t bound) {
+        return bound == 0 ? 0 : generator() % bound;
+    }
+
+    /*
+    ** @brief: Stops with the failing input, in hex, on a mismatch.
+    */
+    void check(bool condition, const char* what) {
+        if (condition) {
+            return;
+        }
+        std::fprintf(stderr, "mismatch: %s\ninput (%zu bytes):", what, current.size());
+        for (unsigned char byte : current) {
+            std::fprintf(stderr, " %02x", byte);
+        }
+        std::fprintf(stderr, "\n");
+        std::exit(1);
+    }
+
+    template <typename T>
+    bool equalPrefix(const std::vector<T>& first, const std::vector<T>& second, std::size_t count) {
+        return count == 0 || std::memcmp(first.data(), second.data(), count * sizeof(T)) == 0;
+    }
+
+    /*
+    ** @brief: Valid utf8 of about 'length' bytes. Each text leans towards one
+    **    mix so that long ascii runs, runs of one sequence length and
+    **    every mix in between all turn up.
+    */
+    std::string makeUtf8(std::size_t length) {
+        static const uint32_t edges[] = {
+            0x0, 0x1f, 0x7f, 0x80, 0x9f, 0xff, 0x100, 0x7ff, 0x800, 0xd7ff,
+            0xe000, 0xfeff, 0xfffd, 0xffff, 0x10000, 0x10ffff
+        };
+        const int mix = static_cast<int>(pick(6));
+        std::string text;
+
+        while (text.size() < length) {
+            const int kind = mix < 4 && pick(4) != 0 ? mix : static_cast<int>(pick(5));
+            uint32_t codePoint;
+            switch (kind) {
+                case 0: codePoint = static_cast<uint32_t>(pick(0x80)); break;
+                case 1: codePoint = static_cast<uint32_t>(0x80 + pick(0x780)); break;
+                case 2: codePoint = static_cast<uint32_t>(0x800 + pick(0xf800)); break;
+                case 3: codePoint = static_cast<uint32_t>(0x10000 + pick(0x100000)); break;
+                default: codePoint = edges[pick(sizeof(edges) / sizeof(edges[0]))]; break;
+            }
+            if (not detail::scalar::isScalarValue(codePoint)) {
+                continue;
+            }
+            char bytes[4];
+            text.append(bytes, detail::scalar::encodeUtf8Sequence(codePoint, bytes));
+        }
+        return text;
+    }
+
+    /*
+    ** @brief: Overwrites a few bytes with ones that break sequences (stray
+    **    trails, bad leads, the leads of overlong, surrogate and out of
+    **    range forms) and sometimes cuts the end off.
+    */
+    void corrupt(std::string& text) {
+        static const unsigned char bad[] = {
+            0x80, 0xbf, 0xc0, 0xc1, 0xc2, 0xdf, 0xe0, 0xed, 0xef, 0xf0, 0xf4,
+            0xf5, 0xff, 0xa0, 0x90, 0x8f, 0x41, 0x00
+        };
+        if (text.empty()) {
+            return;
+        }
+        for (std::size_t count = 1 + pick(3); count != 0; --count) {
+            text[pick(text.size())] = static_cast<char>(bad[pick(sizeof(bad))]);
+        }
+        if (pick(4) == 0) {
+            text.resize(text.size() - pick(text.size() < 3 ? text.size() : 3));
+        }
+    }
+
+    void checkValidation(const unsigned char* bytes, std::size_t length) {
+        const std::size_t offset = detail::scalar::validateUtf8(bytes, length);
+        check(detail::validateUtf8(bytes, length) == offset, "validateUtf8");
+
+        uint64_t scalarHash = 0;
+        uint64_t hash = 0;
+        check(detail::scalar::validateAndHashUtf8(bytes, length, scalarHash) == offset,
+            "scalar validateAndHashUtf8 offset");
+        check(detail::validateAndHashUtf8(bytes, length, hash) == offset,
+            "validateAndHashUtf8 offset");
+        if (offset == length) {
+            check(hash == scalarHash, "validateAndHashUtf8 hash");
+            check(detail::hashBytes(bytes, length) == scalarHash, "hashBytes");
+        }
+
+        uint32_t scalarSeen = 0;
+        uint32_t seen = 0;
+        std::size_t scalarCodePoints = 0;
+        std::size_t codePoints = 0;
+        check(detail::scalar::classifyUtf8(bytes, length, scalarSeen, scalarCodePoints) == offset,
+            "scalar classifyUtf8 offset");
+        check(detail::classifyUtf8(bytes, length, seen, codePoints) == offset,
+            "classifyUtf8 offset");
+        check(seen == scalarSeen, "classifyUtf8 seen");
+        check(codePoints == scalarCodePoints, "classifyUtf8 code points");
+
+        // Both share 'classifyBytes', so check them against the code points
+        // of the valid prefix too.
+        uint32_t expectedSeen = 0;
+        std::size_t expectedCodePoints = 0;
+        for (std::size_t pos = 0; pos < offset; ++expectedCodePoints) {
+            uint32_t codePoint = 0;
+            pos += detail::scalar::decodeUtf8Sequence(bytes + pos, length - pos, codePoint);
+            expectedSeen |= codePoint >= 0x80 ? detail::SEEN_NON_ASCII : 0;
+            expectedSeen |= codePoint >= 0x100 ? detail::SEEN_NON_LATIN1 : 0;
+            expectedSeen |= codePoint >= 0x10000 ? detail::SEEN_SUPPLEMENTARY : 0;
+            if (codePoint < 0x20 || (codePoint >= 0x7f && codePoint < 0xa0)) {
+                expectedSeen |= detail::SEEN_CONTROL;
+            }
+            expectedSeen |= codePoint == 0 ? detail::SEEN_NUL : 0;
+        }
+        check(scalarSeen == expectedSeen, "classifyBytes seen");
+        check(scalarCodePoints == expectedCodePoints, "classifyBytes code points");
+    }
+
+    void checkFromUtf8(const unsigned char* bytes, std::size_t length) {
+        std::vector<char32_t> wide(length);
+        std::vector<char32_t> scalarWide(length);
+        const auto result32 = detail::convertUtf8ToUtf32(bytes, length, wide.data());
+        const auto scalar32 = detail::scalar::convertUtf8ToUtf32(bytes, length, scalarWide.data());
+        check(result32.ok == scalar32.ok && result32.read == scalar32.read &&
+            result32.written == scalar32.written, "convertUtf8ToUtf32 result");
+        check(equalPrefix(wide, scalarWide, scalar32.written), "convertUtf8ToUtf32 output");
+
+        std::vector<char16_t> units(length);
+        std::vector<char16_t> scalarUnits(length);
+        const auto result16 = detail::convertUtf8ToUtf16(bytes, length, units.data());
+        const auto scalar16 = detail::scalar::convertUtf8ToUtf16(bytes, length, scalarUnits.data());
+        check(result16.ok == scalar16.ok && result16.read == scalar16.read &&
+            result16.written == scalar16.written, "convertUtf8ToUtf16 result");
+        check(equalPrefix(units, scalarUnits, scalar16.written), "convertUtf8ToUtf16 output");
+
+        for (bool lossy : {false, true}) {
+            std::vector<char> latin1(length);
+            std::vector<char> scalarLatin1(length);
+            const auto result = detail::convertUtf8ToLatin1(bytes, length, latin1.data(), lossy);
+            const auto scalar = detail::scalar::convertUtf8ToLatin1(
+                bytes, length, scalarLatin1.data(), lossy
+            );
+            check(result.ok == scalar.ok && result.read == scalar.read &&
+                result.written == scalar.written, "convertUtf8ToLatin1 result");
+            check(equalPrefix(latin1, scalarLatin1, scalar.written), "convertUtf8ToLatin1 output");
+        }
+
+        if (not scalar32.ok) {
+            return;
+        }
+
+        // Round trips, with a surrogate or an out of range value put in.
+        const std::size_t count32 = scalar32.written;
+        std::vector<char32_t> codePoints(scalarWide.begin(), scalarWide.begin() + count32);
+        if (count32 != 0 && pick(2) == 0) {
+            codePoints[pick(count32)] = pick(2) == 0
+                ? static_cast<char32_t>(0xd800 + pick(0x800))
+                : static_cast<char32_t>(0x110000 + pick(0x1000));
+        }
+        std::vector<char> encoded(4 * count32);
+        std::vector<char> scalarEncoded(4 * count32);
+        const auto from32 = detail::convertUtf32ToUtf8(codePoints.data(), count32, encoded.data());
+        const auto scalarFrom32 = detail::scalar::convertUtf32ToUtf8(
+            codePoints.data(), count32, scalarEncoded.data()
+        );
+        check(from32.ok == scalarFrom32.ok && from32.read == scalarFrom32.read &&
+            from32.written == scalarFrom32.written, "convertUtf32ToUtf8 result");
+        check(equalPrefix(encoded, scalarEncoded, scalarFrom32.written), "convertUtf32ToUtf8 output");
+
+        const std::size_t count16 = scalar16.written;
+        std::vector<char16_t> utf16(scalarUnits.begin(), scalarUnits.begin() + count16);
+        if (count16 != 0 && pick(2) == 0) {
+            utf16[pick(count16)] = static_cast<char16_t>(0xd800 + pick(0x800));
+        }
+        std::vector<char> encoded16(3 * count16);
+        std::vector<char> scalarEncoded16(3 * count16);
+        const auto from16 = detail::convertUtf16ToUtf8(utf16.data(), count16, encoded16.data());
+        const auto scalarFrom16 = detail::scalar::convertUtf16ToUtf8(
+            utf16.data(), count16, scalarEncoded16.data()
+        );
+        check(from16.ok == scalarFrom16.ok && from16.read == scalarFrom16.read &&
+            from16.written == scalarFrom16.written, "convertUtf16ToUtf8 result");
+        check(equalPrefix(encoded16, scalarEncoded16, scalarFrom16.written), "convertUtf16ToUtf8 output");
+    }
+
+    void checkLatin1(const unsigned char* bytes, std::size_t length) {
+        std::vector<char> encoded(2 * length);
+        std::vector<char> scalarEncoded(2 * length);
+        const std::size_t written = detail::convertLatin1ToUtf8(bytes, length, encoded.data());
+        check(written == detail::scalar::convertLatin1ToUtf8(bytes, length, scalarEncoded.data()),
+            "convertLatin1ToUtf8 length");
+        check(equalPrefix(encoded, scalarEncoded, written), "convertLatin1ToUtf8 output");
+    }
+
+    bool isUnreserved(unsigned char byte) {
+        return (byte >= 'a' && byte <= 'z') || (byte >= 'A' && byte <= 'Z') ||
+            (byte >= '0' && byte <= '9') || byte == '-' || byte == '.' ||
+            byte == '_' || byte == '~';
+    }
+
+    unsigned char toAsciiLower(unsigned char byte) {
+        return byte >= 'A' && byte <= 'Z' ? byte + 32 : byte;
+    }
+
+    /*
+    ** @brief: Checks the scans that have SIMD bodies and scalar tails
+    **    against plain loops.
+    */
+    void checkScans(const unsigned char* bytes, std::size_t length, const unsigned char* other) {
+        std::size_t ascii = 0;
+        while (ascii < length && bytes[ascii] < 0x80) {
+            ++ascii;
+        }
+        check(detail::asciiPrefixLength(bytes, length) == ascii, "asciiPrefixLength");
+
+        std::size_t nonAscii = 0;
+        std::size_t trails = 0;
+        std::size_t printable = 0;
+        for (std::size_t pos = 0; pos < length; ++pos) {
+            nonAscii += bytes[pos] >= 0x80;
+            trails += (bytes[pos] & 0xc0) == 0x80;
+            printable += pos < ascii && bytes[pos] >= 0x20 && bytes[pos] < 0x7f;
+        }
+        check(detail::countNonAscii(bytes, length) == nonAscii, "countNonAscii");
+        check(detail::countCodePoints(bytes, length) == length - trails, "countCodePoints");
+
+        std::size_t counted = 0;
+        check(detail::countAsciiPrintable(bytes, length, counted) == ascii &&
+            counted == printable, "countAsciiPrintable");
+
+        const std::size_t skip = pick(length + 2);
+        std::size_t skipped = 0;
+        std::size_t seen = 0;
+        for (; skipped < length; ++skipped) {
+            if ((bytes[skipped] & 0xc0) != 0x80 && seen++ == skip) {
+                break;
+            }
+        }
+        check(detail::skipCodePoints(bytes, length, skip) == skipped, "skipCodePoints");
+
+        for (bool upper : {false, true}) {
+            std::vector<char> out(length);
+            check(detail::convertAsciiCase(bytes, length, out.data(), upper) == ascii,
+                "convertAsciiCase length");
+            for (std::size_t pos = 0; pos < ascii; ++pos) {
+                const unsigned char byte = bytes[pos];
+                const unsigned char expected = upper
+                    ? (byte >= 'a' && byte <= 'z' ? byte - 32 : byte)
+                    : toAsciiLower(byte);
+                check(static_cast<unsigned char>(out[pos]) == expected, "convertAsciiCase output");
+            }
+        }
+
+        std::size_t common = 0;
+        while (common < length && bytes[common] == other[common]) {
+            ++common;
+        }
+        check(detail::commonPrefixLength(bytes, other, length) == common, "commonPrefixLength");
+
+        std::size_t folded = 0;
+        while (folded < length && bytes[folded] < 0x80 && other[folded] < 0x80 &&
+               toAsciiLower(bytes[folded]) == toAsciiLower(other[folded])) {
+            ++folded;
+        }
+        check(detail::asciiCaseInsensitivePrefix(bytes, other, length) == folded,
+            "asciiCaseInsensitivePrefix");
+
+        for (bool asciiOnly : {false, true}) {
+            std::size_t plain = 0;
+            while (plain < length && bytes[plain] >= 0x20 && bytes[plain] != '"' &&
+                   bytes[plain] != '\\' && (not asciiOnly || bytes[plain] < 0x80)) {
+                ++plain;
+            }
+            check(detail::jsonPlainPrefixLength(bytes, length, asciiOnly) == plain,
+                "jsonPlainPrefixLength");
+        }
+
+        for (bool plus : {false, true}) {
+            std::size_t plain = 0;
+            while (plain < length && bytes[plain] != '%' && (not plus || bytes[plain] != '+')) {
+                ++plain;
+            }
+            check(detail::percentPlainPrefixLength(bytes, length, plus) == plain,
+                "percentPlainPrefixLength");
+        }
+
+        std::size_t unreserved = 0;
+        while (unreserved < length && isUnreserved(bytes[unreserved])) {
+            ++unreserved;
+        }
+        check(detail::unreservedPrefixLength(bytes, length) == unreserved, "unreservedPrefixLength");
+
+        if (length != 0) {
+            const std::size_t start = pick(length);
+            const std::size_t needleLength = 1 + pick(length - start < 8 ? length - start : 8);
+            const unsigned char* needle = pick(3) == 0 ? other + start : bytes + start;
+            std::size_t found = length;
+            for (std::size_t pos = 0; pos + needleLength <= length; ++pos) {
+                if (std::memcmp(bytes + pos, needle, needleLength) == 0) {
+                    found = pos;
+                    break;
+                }
+            }
+            check(detail::findByteSequence(bytes, length, needle, needleLength) == found,
+                "findByteSequence");
+        }
+    }
+
+    /*
+    ** @brief: Runs every check on one input, and on the same bytes shifted
+    **    by one so that the vector loads start at another alignment.
+    */
+    void checkInput(const std::string& text) {
+        current = text;
+        for (std::size_t shift = 0; shift < 2; ++shift) {
+            std::vector<unsigned char> bytes(shift + text.size());
+            std::copy(text.begin(), text.end(), bytes.begin() + shift);
+            const unsigned char* start = bytes.data() + shift;
+
+            // A copy that differs from a random point on, for the compares.
+            std::vector<unsigned char> other(start, start + text.size());
+            if (not other.empty()) {
+                const std::size_t from = pick(other.size());
+                other[from] = static_cast<unsigned char>(
+                    pick(2) == 0 ? other[from] ^ 0x20 : generator()
+                );
+            }
+
+            checkValidation(start, text.size());
+            checkFromUtf8(start, text.size());
+            checkLatin1(start, text.size());
+            checkScans(start, text.size(), other.data());
+        }
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    const long iterations = argc > 1 ? std::atol(argv[1]) : 20000;
+    const unsigned long seed = argc > 2 ? std::strtoul(argv[2], nullptr, 0) : 1;
+    generator.seed(seed);
+
+    for (long iteration = 0; iteration < iterations; ++iteration) {
+        // Mostly short texts, which hit the block edges most often, and
+        // now and then long ones that cross many blocks.
+        const std::size_t length = pick(iteration % 16 == 0 ? 4096 : 300);
+        std::string text = makeUtf8(length);
+        if (pick(2) == 0) {
+            corrupt(text);
+        }
+        checkInput(text);
+    }
+
+#if defined(GC_UTF8_AVX512) && defined(__AVX512VBMI2__)
+    const char* kernels = "avx512 + vbmi2";
+#elif defined(GC_UTF8_AVX512)
+    const char* kernels = "avx512";
+#elif defined(GC_UTF8_SSE2)
+    const char* kernels = "sse2";
+#else
+    const char* kernels = "scalar";
+#endif
+    std::printf("utf8_fuzz (%s): %ld inputs, seed %lu, no mismatches\n", kernels, iterations, seed);
+    return 0;
+}
@@ -0,0 +1,577 @@
+/*
+** Smoke tests: a few known answers for every public API, including the C
+** interface. The differential fuzzer covers the kernels in depth; this file
+** checks that each entry point is wired to them correctly.
+**
+** Build once per kernel set (see tests/run.sh), eg.
+**    g++ -std=c++17 -O2 -march=native -Isrc tests/utf8_smoke.cpp src/utf8_c.cpp -o utf8_smoke
+*/
+#include "utf8.h"
+#include "utf8_c.h"
+#include "utf8_case.h"
+#include "utf8_codepages.h"
+#include "utf8_graphemes.h"
+#include "utf8_intern_pool.h"
+#include "utf8_json.h"
+#include "utf8_line_index.h"
+#include "utf8_normalization.h"
+#include "utf8_properties.h"
+#include "utf8_rope.h"
+#include "utf8_search.h"
+#include "utf8_stats.h"
+#include "utf8_truncate.h"
+#include "utf8_url.h"
+#include "utf8_width.h"
+
+#include <cstdio>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+    int failures = 0;
+
+#define CHECK(condition) \
+    do { \
+        if (not (condition)) { \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            ++failures; \
+        } \
+    } while (false)
+
+    /*
+    ** @returns: Whether calling 'function' throws 'ExceptionT'.
+    */
+    template <typename ExceptionT, typename FunctionT>
+    bool throws(FunctionT function) {
+        try {
+            function();
+        } catch (const ExceptionT&) {
+            return true;
+        } catch (...) {
+            return false;
+        }
+        return false;
+    }
+
+    // "héllo wörld €𝄞": 1, 2, 3 and 4 byte sequences.
+    const std::string mixed = "h\xc3\xa9llo w\xc3\xb6rld \xe2\x82\xac\xf0\x9d\x84\x9e";
+
+    void testCore() {
+        CHECK(gc::getUtf8SequenceLength('a') == 1);
+        CHECK(gc::getUtf8SequenceLength(0xe2) == 3);
+        CHECK(gc::getUtf8SequenceLength(0x80) == 0);
+        CHECK(gc::isValidUtf8LeadByte(0xf0) and not gc::isValidUtf8LeadByte(0xbf));
+        CHECK(gc::isValidUtf8TrailByte(0xbf) and not gc::isValidUtf8TrailByte('a'));
+
+        auto it = mixed.begin() + 1;
+        CHECK(gc::getUtf8Character(it, mixed.end()) == 0xe9);
+        CHECK(it == mixed.begin() + 3);
+
+        std::string built;
+        gc::appendUtf8(built, 0x1d11e);
+        auto out = std::back_inserter(built);
+        gc::put_utf8_char(out, 0x20ac);
+        CHECK(built == "\xf0\x9d\x84\x9e\xe2\x82\xac");
+
+        const std::wstring wide = gc::convertUtf8ToWString(mixed);
+        CHECK(gc::convertWStringToUtf8(wide) == mixed);
+
+        CHECK(gc::isValidUtf8(mixed));
+        CHECK(gc::isValidUtf8(""));
+        gc::Utf8Error error;
+        CHECK(not gc::isValidUtf8("ab\xed\xa0\x80", error));
+        CHECK(error.kind == gc::Utf8ErrorKind::Surrogate and error.offset == 2);
+        CHECK(not gc::isValidUtf8("\xc0\xaf", error) and error.kind == gc::Utf8ErrorKind::Overlong);
+        CHECK(not gc::isValidUtf8("a\xe2\x82", error) and error.kind == gc::Utf8ErrorKind::Truncated);
+        CHECK(not gc::isValidUtf8("\xf4\x90\x80\x80", error) and error.kind == gc::Utf8ErrorKind::OutOfRange);
+
+        try {
+            gc::convertUtf8ToUtf32("abc\xff");
+            CHECK(false);
+        } catch (const gc::InvalidUtf8& exception) {
+            CHECK(exception.error().kind == gc::Utf8ErrorKind::BadLead);
+            CHECK(exception.error().offset == 3);
+        }
+    }
+
+    void testHashAndClassify() {
+        uint64_t hash = 0;
+        CHECK(gc::validateAndHashUtf8(mixed, hash));
+        CHECK(hash == gc::hashUtf8(mixed));
+        CHECK(gc::hashUtf8("a") != gc::hashUtf8("b"));
+        gc::Utf8Error error;
+        CHECK(not gc::validateAndHashUtf8("a\x80", hash, error) and error.offset == 1);
+
+        const auto ascii = gc::classifyUtf8("plain text");
+        CHECK(ascii.has(gc::Utf8Classification::Valid) and ascii.has(gc::Utf8Classification::Ascii));
+        CHECK(ascii.codePoints == 10);
+
+        const auto text = gc::classifyUtf8(mixed);
+        CHECK(text.has(gc::Utf8Classification::Valid));
+        CHECK(not text.has(gc::Utf8Classification::Ascii));
+        CHECK(not text.has(gc::Utf8Classification::Latin1));
+        CHECK(not text.has(gc::Utf8Classification::BmpOnly));
+        CHECK(text.has(gc::Utf8Classification::HasSupplementary));
+        CHECK(text.codePoints == 14);
+
+        const auto control = gc::classifyUtf8(std::string("a\0b\xc2\x85", 5));
+        CHECK(control.has(gc::Utf8Classification::HasNul));
+        CHECK(control.has(gc::Utf8Classification::HasControl));
+        CHECK(control.has(gc::Utf8Classification::Latin1));
+
+        CHECK(not gc::classifyUtf8("\xff").has(gc::Utf8Classification::Valid));
+    }
+
+    void testSanitize() {
+        std::string valid = mixed;
+        CHECK(gc::sanitizeUtf8(valid) == 0 and valid == mixed);
+
+        std::string broken = "ab\xff\xfe" "cd\xc0\xaf";
+        CHECK(gc::sanitizeUtf8(broken) == 4);
+        CHECK(broken == "ab\xef\xbf\xbd\xef\xbf\xbd" "cd\xef\xbf\xbd\xef\xbf\xbd");
+
+        std::string surrogate = "\xed\xa0\x80";
+        CHECK(gc::sanitizeUtf8(surrogate) == 3);
+        CHECK(gc::isValidUtf8(surrogate));
+    }
+
+    void testTranscoding() {
+        const std::u32string wide = gc::convertUtf8ToUtf32(mixed);
+        CHECK(wide.size() == 14 and wide[1] == 0xe9 and wide[13] == 0x1d11e);
+        CHECK(gc::convertUtf32ToUtf8(wide) == mixed);
+
+        const std::u16string units = gc::convertUtf8ToUtf16(mixed);
+        CHECK(units.size() == 15 and units[13] == 0xd834 and units[14] == 0xdd1e);
+        CHECK(gc::convertUtf16ToUtf8(units) == mixed);
+
+        CHECK(throws<gc::InvalidUtf8>([] { gc::convertUtf32ToUtf8(U"a\xd800"); }));
+        CHECK(throws<gc::InvalidUtf8>([] { gc::convertUtf16ToUtf8(u"a\xdc00"); }));
+
+        CHECK(gc::compareUtf8AsUtf16("a", "b") < 0);
+        CHECK(gc::compareUtf8AsUtf16("abc", "abc") == 0);
+        // U+1D11E (D834 DD1E) sorts before U+FFFD in utf16 order.
+        CHECK(gc::compareUtf8AsUtf16("\xf0\x9d\x84\x9e", "\xef\xbf\xbd") < 0);
+        CHECK(gc::Utf16OrderLess()("\xf0\x9d\x84\x9e", "\xef\xbf\xbd"));
+
+        CHECK(gc::convertLatin1ToUtf8("caf\xe9") == "caf\xc3\xa9");
+        CHECK(gc::convertUtf8ToLatin1("caf\xc3\xa9") == "caf\xe9");
+        CHECK(throws<gc::InvalidUtf8>([] { gc::convertUtf8ToLatin1("\xe2\x82\xac"); }));
+        CHECK(gc::convertUtf8ToLatin1("\xe2\x82\xac", gc::ConversionPolicy::Lossy) == "?");
+    }
+
+    void testCodepages() {
+        CHECK(gc::convertCodepageToUtf8("\x80", gc::Codepage::Windows1252) == "\xe2\x82\xac");
+        CHECK(gc::convertUtf8ToCodepage("\xe2\x82\xac", gc::Codepage::Windows1252) == "\x80");
+        CHECK(gc::convertCodepageToUtf8("\xa4", gc::Codepage::Iso8859_15) == "\xe2\x82\xac");
+        CHECK(gc::convertCodepageToUtf8("\xc1", gc::Codepage::Koi8R) == "\xd0\xb0");
+        CHECK(gc::convertCodepageToUtf8("\xb0", gc::Codepage::Iso8859_5) == "\xd0\x90");
+        CHECK(gc::convertCodepageToUtf8("\xa3", gc::Codepage::Iso8859_2) == "\xc5\x81");
+        CHECK(gc::convertCodepageToUtf8("\xdb", gc::Codepage::Cp437) == "\xe2\x96\x88");
+        CHECK(throws<gc::InvalidUtf8>([] {
+            gc::convertUtf8ToCodepage("\xe2\x82\xac", gc::Codepage::Koi8R);
+        }));
+        CHECK(gc::convertUtf8ToCodepage(
+            "\xe2\x82\xac", gc::Codepage::Koi8R, gc::ConversionPolicy::Lossy
+        ) == "?");
+    }
+
+    void testNormalization() {
+        const std::string composed = "\xc3\xa9";
+        const std::string decomposed = "e\xcc\x81";
+        CHECK(gc::normalizeUtf8(decomposed, gc::NormalizationForm::NFC) == composed);
+        CHECK(gc::normalizeUtf8(composed, gc::NormalizationForm::NFD) == decomposed);
+        // U+FB01 LATIN SMALL LIGATURE FI only decomposes in the K forms.
+        CHECK(gc::normalizeUtf8("\xef\xac\x81", gc::NormalizationForm::NFKC) == "fi");
+        CHECK(gc::normalizeUtf8("\xef\xac\x81", gc::NormalizationForm::NFC) == "\xef\xac\x81");
+        CHECK(gc::normalizeUtf8("\xef\xac\x81", gc::NormalizationForm::NFKD) == "fi");
+
+        CHECK(gc::quickCheckNormalization("abc", gc::NormalizationForm::NFC) == gc::QuickCheck::Yes);
+        CHECK(gc::quickCheckNormalization(decomposed, gc::NormalizationForm::NFC) != gc::QuickCheck::Yes);
+        CHECK(gc::isNormalized(composed, gc::NormalizationForm::NFC));
+        CHECK(not gc::isNormalized(composed, gc::NormalizationForm::NFD));
+
+        std::string buffer;
+        const std::string_view same = gc::normalizeUtf8("plain", gc::NormalizationForm::NFC, buffer);
+        CHECK(same == "plain");
+        CHECK(gc::normalizeUtf8(decomposed, gc::NormalizationForm::NFC, buffer) == composed);
+
+        // The input may view the buffer.
+        std::string text;
+        for (int copy = 0; copy < 200; ++copy) {
+            text += "e\xcc\x81\xe1\x84\x80\xe1\x85\xa1";
+        }
+        const std::string expected = gc::normalizeUtf8(text, gc::NormalizationForm::NFC);
+        buffer = text;
+        CHECK(gc::normalizeUtf8(buffer, gc::NormalizationForm::NFC, buffer) == expected);
+        // 'x' + U+0300 is normalized, but only a full check can tell.
+        buffer = "x\xcc\x80";
+        const std::string_view kept = gc::normalizeUtf8(buffer, gc::NormalizationForm::NFC, buffer);
+        CHECK(kept == "x\xcc\x80" and kept.data() == buffer.data());
+
+        // A long run of marks with alternating classes (U+0316 is 220,
+        // U+0301 is 230), which a quadratic reordering takes seconds over.
+        std::string marks = "a";
+        std::string lower;
+        std::string upper;
+        for (int mark = 0; mark < 40000; ++mark) {
+            marks += "\xcc\x96\xcc\x81";
+            lower += "\xcc\x96";
+            upper += "\xcc\x81";
+        }
+        CHECK(gc::normalizeUtf8(marks, gc::NormalizationForm::NFD) == "a" + lower + upper);
+        CHECK(gc::normalizeUtf8(marks, gc::NormalizationForm::NFC) ==
+            "\xc3\xa1" + lower + upper.substr(2));
+    }
+
+    void testCase() {
+        CHECK(gc::toLower("H\xc3\x89LLO \xce\xa3") == "h\xc3\xa9llo \xcf\x83");
+        CHECK(gc::toUpper("stra\xc3\x9f" "e") == "STRASSE");
+        CHECK(gc::caseFold("Stra\xc3\x9f" "e") == "strasse");
+
+        std::string output;
+        gc::toUpper(mixed, output);
+        CHECK(output == "H\xc3\x89LLO W\xc3\x96RLD \xe2\x82\xac\xf0\x9d\x84\x9e");
+
+        // Mapping a text in place, where the output outgrows its storage.
+        std::string text;
+        for (int i = 0; i < 200; ++i) {
+            text += "Stra\xc3\x9f" "e \xc4\xb0 ";
+        }
+        const std::string upper = gc::toUpper(text);
+        const std::string lower = gc::toLower(text);
+        const std::string folded = gc::caseFold(text);
+        output = text;
+        gc::toUpper(output, output);
+        CHECK(output == upper);
+        output = text;
+        gc::toLower(output, output);
+        CHECK(output == lower);
+        output = text;
+        gc::caseFold(std::string_view(output).substr(1), output);
+        CHECK(output == folded.substr(1));
+
+        CHECK(gc::caseInsensitiveEqual("Stra\xc3\x9f" "e", "STRASSE"));
+        CHECK(gc::caseInsensitiveCompare("apple", "BANANA") < 0);
+        CHECK(gc::caseInsensitiveHash("Hello") == gc::caseInsensitiveHash("hELLO"));
+
+        std::unordered_set<std::string, gc::CaseInsensitiveHash, gc::CaseInsensitiveEqual> keys;
+        keys.insert("Key");
+        CHECK(keys.count("KEY") == 1);
+        std::map<std::string, int, gc::CaseInsensitiveLess> ordered{{"b", 2}, {"A", 1}};
+        CHECK(ordered.begin()->second == 1);
+    }
+
+    void testGraphemesAndWidth() {
+        // e + combining acute, a flag (two regional indicators), then 'x'.
+        const std::string text = "e\xcc\x81\xf0\x9f\x87\xaf\xf0\x9f\x87\xb5x";
+        CHECK(gc::countGraphemes(text) == 3);
+        CHECK(gc::nextGraphemeBreak(text, 0) == 3);
+        CHECK(gc::previousGraphemeBreak(text, text.size()) == text.size() - 1);
+
+        std::vector<std::string_view> clusters;
+        for (std::string_view cluster : gc::graphemeClusters(text)) {
+            clusters.push_back(cluster);
+        }
+        CHECK(clusters.size() == 3 and clusters[0] == "e\xcc\x81" and clusters[2] == "x");
+
+        CHECK(gc::displayWidth("abc") == 3);
+        CHECK(gc::displayWidth("\xe4\xb8\xad\xe6\x96\x87") == 4);
+        CHECK(gc::displayWidth("e\xcc\x81") == 1);
+        std::size_t width = 0;
+        CHECK(gc::truncateToWidth("\xe4\xb8\xad\xe6\x96\x87", 3, width) == "\xe4\xb8\xad" and width == 2);
+        CHECK(gc::truncateToWidth("abcdef", 4) == "abcd");
+    }
+
+    void testProperties() {
+        CHECK(gc::generalCategory('A') == gc::GeneralCategory::UppercaseLetter);
+        CHECK(gc::generalCategory(0x0378) == gc::GeneralCategory::Unassigned);
+        CHECK(gc::script(0x3b1) == gc::Script::Greek);
+        CHECK(std::string(gc::getScriptName(gc::Script::Latin)) == "Latin");
+        CHECK(gc::isLetter(0x4e2d) and not gc::isLetter('1'));
+        CHECK(gc::isMark(0x301));
+        CHECK(gc::isNumber(0x2167) and not gc::isDigit(0x2167));
+        CHECK(gc::isDigit(0x0663));
+        CHECK(gc::isPunctuation('!') and gc::isSymbol('+'));
+        CHECK(gc::isWhiteSpace(0x3000) and not gc::isWhiteSpace('x'));
+        CHECK(gc::isAlphabetic(0x5d0) and gc::isAlphanumeric('7'));
+        static_assert(gc::isLetter('z'), "property lookups are constexpr");
+    }
+
+    void testSearchAndTruncate() {
+        CHECK(gc::findCodePoint(mixed, 0x20ac) == 14);
+        CHECK(gc::findCodePoint(mixed, 0xd800) == std::string_view::npos);
+        CHECK(gc::findSubstring(mixed, "w\xc3\xb6") == 7);
+        CHECK(gc::findSubstring(mixed, "zz") == std::string_view::npos);
+        CHECK(throws<gc::InvalidUtf8>([] { gc::findSubstring("abc", "\xff"); }));
+
+        CHECK(gc::truncateToBytes(mixed, 2) == "h");
+        CHECK(gc::truncateToBytes(mixed, 3) == "h\xc3\xa9");
+        CHECK(gc::truncateToCodePoints(mixed, 2) == "h\xc3\xa9");
+        CHECK(gc::truncateToCodePoints("e\xcc\x81x", 1, gc::TruncationBoundary::Grapheme) == "");
+        CHECK(gc::truncateToBytes("e\xcc\x81x", 3, gc::TruncationBoundary::Grapheme) == "e\xcc\x81");
+    }
+
+    void testJson() {
+        CHECK(gc::jsonEscape("a\"b\\c\n\x01") == "a\\\"b\\\\c\\n\\u0001");
+        CHECK(gc::jsonEscape("\xc3\xa9\xf0\x9d\x84\x9e", gc::JsonEscapeMode::AsciiOnly)
+            == "\\u00e9\\ud834\\udd1e");
+        CHECK(gc::jsonEscape("\xc3\xa9") == "\xc3\xa9");
+        CHECK(gc::jsonUnescape("a\\\"b\\u00e9\\ud834\\udd1e\\n") == "a\"b\xc3\xa9\xf0\x9d\x84\x9e\n");
+        CHECK(throws<gc::InvalidUtf8>([] { gc::jsonUnescape("\\ud834"); }));
+        CHECK(throws<gc::InvalidJsonString>([] { gc::jsonUnescape("\\q"); }));
+
+        std::string output;
+        gc::jsonEscape("tab\t", output);
+        CHECK(output == "tab\\t");
+        gc::jsonUnescape("tab\\t", output);
+        CHECK(output == "tab\t");
+
+        // Escaping and unescaping in place, including from a view that
+        // starts inside 'output'.
+        std::string text;
+        for (int i = 0; i < 100; ++i) {
+            text += "\"q\"\t\xc3\xa9 ";
+        }
+        const std::string escaped = gc::jsonEscape(text);
+        output = text;
+        gc::jsonEscape(output, output);
+        CHECK(output == escaped);
+        gc::jsonUnescape(output, output);
+        CHECK(output == text);
+        output = escaped;
+        gc::jsonUnescape(std::string_view(output).substr(2), output);
+        CHECK(output == text.substr(1));
+    }
+
+    void testUrl() {
+        CHECK(gc::percentEncode("a b/\xc3\xa9~") == "a%20b%2F%C3%A9~");
+        CHECK(gc::percentEncode("a b", gc::PercentEncoding::Form) == "a+b");
+        CHECK(gc::percentDecodeUtf8("a%20b%2f%C3%A9") == "a b/\xc3\xa9");
+        CHECK(gc::percentDecodeUtf8("a+b%", gc::PercentEncoding::Form) == "a b%");
+        CHECK(gc::percentDecodeUtf8("a+b") == "a+b");
+        CHECK(throws<gc::InvalidUtf8>([] { gc::percentDecodeUtf8("%ff"); }));
+        CHECK(throws<gc::InvalidUtf8>([] { gc::percentEncode("\xff"); }));
+
+        // Encoding and decoding in place, including from a view that starts
+        // inside 'output'.
+        std::string text;
+        for (int i = 0; i < 100; ++i) {
+            text += "a b/\xc3\xa9 ";
+        }
+        const std::string encoded = gc::percentEncode(text);
+        std::string output = text;
+        gc::percentEncode(output, output);
+        CHECK(output == encoded);
+        gc::percentDecodeUtf8(output, output);
+        CHECK(output == text);
+        output = encoded;
+        gc::percentDecodeUtf8(std::string_view(output).substr(1), output);
+        CHECK(output == text.substr(1));
+    }
+
+    void testLineIndex() {
+        const std::string text = "ab\n\xc3\xa9x\n\nlast";
+        const gc::Utf8LineIndex index(text);
+        CHECK(index.lineCount() == 4);
+        CHECK(index.codePointCount() == 11);
+        CHECK(index.lineStart(1) == 3 and index.lineLength(1) == 2);
+        const gc::LineColumn position = index.locate(5);
+        CHECK(position.line == 1 and position.column == 1);
+        CHECK(index.offsetOf(1, 1) == 5);
+    }
+
+    void testInternPool() {
+        gc::Utf8InternPool pool;
+        const auto first = pool.intern(mixed);
+        const auto second = pool.intern("key");
+        CHECK(pool.intern(std::string(mixed)) == first);
+        CHECK(first != second and pool.size() == 2);
+        CHECK(pool.view(first) == mixed);
+        CHECK(pool.codePointCount(first) == 14);
+        CHECK(pool.isAscii(second) and not pool.isAscii(first));
+        CHECK(pool.hash(first) != pool.hash(second));
+        CHECK(pool.hash(first) == gc::hashUtf8(mixed));
+
+        gc::Utf8InternPool::Handle found = 0;
+        CHECK(pool.find("key", found) and found == second);
+        CHECK(not pool.find("missing", found));
+        CHECK(throws<gc::InvalidUtf8>([&pool] { pool.intern("\xff"); }));
+
+        // Enough strings to grow the table a few times.
+        std::vector<gc::Utf8InternPool::Handle> handles;
+        for (int key = 0; key < 1000; ++key) {
+            handles.push_back(pool.intern("key " + std::to_string(key)));
+        }
+        bool allFound = pool.size() == 1002;
+        for (int key = 0; key < 1000; ++key) {
+            allFound = allFound and pool.find("key " + std::to_string(key), found) and
+                found == handles[key];
+        }
+        CHECK(allFound);
+    }
+
+    void testRope() {
+        gc::Utf8Rope rope("h\xc3\xa9llo");
+        rope.append("\nw\xc3\xb6rld");
+        rope.insert(1, "\xe2\x82\xac");
+        CHECK(rope.toString() == "h\xe2\x82\xac\xc3\xa9llo\nw\xc3\xb6rld");
+        CHECK(rope.codePointCount() == 12 and rope.lineCount() == 2);
+        CHECK(rope.substr(1, 2) == "\xe2\x82\xac\xc3\xa9");
+        rope.erase(1, 1);
+        CHECK(rope.toString() == "h\xc3\xa9llo\nw\xc3\xb6rld");
+        CHECK(rope.line(1) == "w\xc3\xb6rld" and rope.lineStart(1) == 6);
+        CHECK(rope.lineOf(7) == 1);
+
+        const gc::Utf8Rope copy = rope;
+        CHECK(copy.toString() == rope.toString());
+
+        // A rope that has been moved from is empty, and still usable.
+        gc::Utf8Rope moved(std::move(rope));
+        CHECK(rope.size() == 0 and rope.toString().empty());
+        rope.append("x");
+        CHECK(rope.toString() == "x");
+        rope = std::move(moved);
+        CHECK(rope.toString() == copy.toString() and moved.size() == 0);
+        moved = rope;
+        CHECK(moved.toString() == rope.toString());
+        CHECK(throws<gc::InvalidUtf8>([&rope] { rope.append("\xc0"); }));
+        CHECK(throws<std::out_of_range>([&rope] { rope.insert(100, "x"); }));
+
+        std::string large;
+        for (int line = 0; line < 2000; ++line) {
+            large += "line \xe2\x82\xac " + std::to_string(line) + "\n";
+        }
+        gc::Utf8Rope big(large);
+        big.erase(10, 5000);
+        big.insert(3, "\xf0\x9d\x84\x9e");
+        std::string expected = gc::convertUtf32ToUtf8(gc::convertUtf8ToUtf32(large).erase(10, 5000));
+        expected.insert(3, "\xf0\x9d\x84\x9e");
+        CHECK(big.toString() == expected);
+    }
+
+#if defined(GC_UTF8_STATS)
+    uint64_t countErrors() {
+        const gc::Utf8Stats stats = gc::getUtf8Stats();
+        uint64_t total = 0;
+        for (uint64_t count : stats.errors) {
+            total += count;
+        }
+        return total;
+    }
+#endif
+
+    void testStats() {
+        gc::resetUtf8Stats();
+        CHECK(gc::getUtf8Stats().bytesValidated == 0);
+
+#if defined(GC_UTF8_STATS)
+        // Each error counts once, where it is repaired, returned or thrown.
+        std::string text = "\xed\xa0\x80";
+        CHECK(gc::sanitizeUtf8(text) == 3);
+        CHECK(countErrors() == 3);
+        CHECK(gc::getUtf8Stats().errors[static_cast<int>(gc::Utf8ErrorKind::Surrogate)] == 1);
+
+        gc::resetUtf8Stats();
+        text = "ab\xff\xfe" "cd\xc0\xaf";
+        CHECK(gc::sanitizeUtf8(text) == 4);
+        CHECK(countErrors() == 4);
+
+        gc::resetUtf8Stats();
+        uint64_t hash = 0;
+        gc::Utf8Error error;
+        CHECK(not gc::isValidUtf8("a\xff"));
+        CHECK(not gc::isValidUtf8("a\xff", error));
+        CHECK(not gc::validateAndHashUtf8("a\xff", hash));
+        CHECK(not gc::validateAndHashUtf8("a\xff", hash, error));
+        CHECK(not gc::classifyUtf8("a\xff").has(gc::Utf8Classification::Valid));
+        CHECK(throws<gc::InvalidUtf8>([] { gc::toUpper("a\xff"); }));
+        CHECK(throws<gc::InvalidUtf8>([] { gc::convertUtf16ToUtf8(u"\xd800"); }));
+        CHECK(gc_utf8_validate("a\xff", 2).status == GC_UTF8_INVALID);
+        CHECK(countErrors() == 8);
+        CHECK(gc::getUtf8Stats().errors[static_cast<int>(gc::Utf8ErrorKind::BadLead)] == 7);
+
+        // Valid text counts nothing.
+        gc::resetUtf8Stats();
+        CHECK(gc::isValidUtf8(mixed));
+        CHECK(gc::sanitizeUtf8(text) == 0);
+        CHECK(countErrors() == 0);
+
+        // What threads count is kept once they exit.
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < 4; ++thread) {
+            threads.emplace_back([] { gc::isValidUtf8("\xff"); });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        CHECK(countErrors() == 4);
+#endif
+    }
+
+    void testCInterface() {
+        gc_utf8_result result = gc_utf8_validate(mixed.data(), mixed.size());
+        CHECK(result.status == GC_UTF8_OK and result.read == mixed.size());
+        result = gc_utf8_validate("ab\xc0\xaf", 4);
+        CHECK(result.status == GC_UTF8_INVALID and result.read == 2);
+        CHECK(result.error_kind == GC_UTF8_ERROR_OVERLONG);
+        CHECK(gc_utf8_validate(nullptr, 1).status == GC_UTF8_BAD_ARGUMENT);
+
+        result = gc_utf8_count_code_points(mixed.data(), mixed.size());
+        CHECK(result.status == GC_UTF8_OK and result.written == 14);
+
+        uint16_t units[16];
+        result = gc_utf8_to_utf16(mixed.data(), mixed.size(), units, 16);
+        CHECK(result.status == GC_UTF8_OK and result.written == 15 and units[14] == 0xdd1e);
+        result = gc_utf8_to_utf16(mixed.data(), mixed.size(), units, 14);
+        CHECK(result.status == GC_UTF8_OUTPUT_TOO_SMALL and result.read == 17 and result.written == 13);
+
+        uint32_t codePoints[16];
+        result = gc_utf8_to_utf32(mixed.data(), mixed.size(), codePoints, 16);
+        CHECK(result.status == GC_UTF8_OK and result.written == 14 and codePoints[13] == 0x1d11e);
+
+        char bytes[64];
+        result = gc_utf16_to_utf8(units, 15, bytes, sizeof(bytes));
+        CHECK(result.status == GC_UTF8_OK and std::string(bytes, result.written) == mixed);
+        const uint16_t lone[] = {'a', 0xd800};
+        result = gc_utf16_to_utf8(lone, 2, bytes, sizeof(bytes));
+        CHECK(result.status == GC_UTF8_INVALID and result.read == 1);
+
+        result = gc_utf32_to_utf8(codePoints, 14, bytes, sizeof(bytes));
+        CHECK(result.status == GC_UTF8_OK and std::string(bytes, result.written) == mixed);
+        const uint32_t large[] = {0x110000};
+        result = gc_utf32_to_utf8(large, 1, bytes, sizeof(bytes));
+        CHECK(result.status == GC_UTF8_INVALID and result.error_kind == GC_UTF8_ERROR_OUT_OF_RANGE);
+    }
+} // namespace
+
+int main() {
+    testCore();
+    testHashAndClassify();
+    testSanitize();
+    testTranscoding();
+    testCodepages();
+    testNormalization();
+    testCase();
+    testGraphemesAndWidth();
+    testProperties();
+    testSearchAndTruncate();
+    testJson();
+    testUrl();
+    testLineIndex();
+    testInternPool();
+    testRope();
+    testStats();
+    testCInterface();
+
+    if (failures != 0) {
+        std::fprintf(stderr, "utf8_smoke: %d checks failed\n", failures);
+        return 1;
+    }
+    std::printf("utf8_smoke: all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+"""Downloads the Unicode Character Database files that the generators read
+into data/ucd, as they are published.
+
+Usage: tools/fetch_ucd.py
+
+The files are those of UCD_VERSION (see unicode_tables.py), from
+https://www.unicode.org/Public/<version>/ucd/. Each one is checked to say
+that it is of that version before it is written.
+"""
+
+import os
+import sys
+import urllib.request
+
+from unicode_tables import UCD_DIRECTORY, UCD_VERSION, parse_ucd_version
+
+BASE_URL = "https://www.unicode.org/Public/%s/ucd/" % UCD_VERSION
+
+# The paths of the files under the ucd directory.
+FILES = [
+    "auxiliary/GraphemeBreakProperty.txt",
+    "emoji/emoji-data.txt",
+    "extracted/DerivedGeneralCategory.txt",
+    "DerivedCoreProperties.txt",
+    "PropList.txt",
+    "Scripts.txt",
+]
+
+
+def main():
+    os.makedirs(UCD_DIRECTORY, exist_ok=True)
+    for path in FILES:
+        with urllib.request.urlopen(BASE_URL + path) as response:
+            data = response.read()
+
+        name = os.path.basename(path)
+        version = parse_ucd_version(data.decode("utf-8").splitlines())
+        assert version == UCD_VERSION, (name, version, UCD_VERSION)
+
+        with open(os.path.join(UCD_DIRECTORY, name), "wb") as f:
+            f.write(data)
+        print("%s: Unicode %s, %d bytes" % (name, version, len(data)), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
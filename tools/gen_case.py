@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""Generates src/utf8_case_tables.h from Python's case mappings.
+
+Usage: tools/gen_case.py > src/utf8_case_tables.h
+
+str.lower, str.upper and str.casefold implement the full, locale-independent
+mappings of UnicodeData.txt, SpecialCasing.txt and CaseFolding.txt (status C
+and F), for the Unicode version of the Python running the script, which has
+to be UCD_VERSION (see unicode_tables.py).
+"""
+
+from unicode_tables import (MAX_CODE_POINT, check_unicode_version, emit_array,
+                            emit_two_stage, header_close, header_open)
+
+GUARD = "__GENIUS_C_UTF8_CASE_TABLES__"
+
+CASED = 1
+CASE_IGNORABLE = 2
+
+SIGMA = "Σ"
+
+
+def final_sigma_flags(ch):
+    """Recovers the Cased and Case_Ignorable properties as str.lower sees them
+    when it decides whether a capital sigma is final.
+    """
+    def is_final(before, after):
+        return (before + SIGMA + after).lower()[len(before.lower())] == "ς"
+
+    # 'A' is cased and not case-ignorable.
+    cased_not_ignorable = is_final(ch, "")
+    ignorable_or_cased = is_final("A" + ch, "")
+    ignorable_or_uncased = is_final("A", ch)
+
+    if ignorable_or_cased and ignorable_or_uncased:
+        return CASE_IGNORABLE
+    return CASED if cased_not_ignorable else 0
+
+
+def main():
+    check_unicode_version()
+    pool = bytearray(b"\0")  # offset 0 means "no special mapping"
+    pool_index = {}
+
+    def special(text):
+        encoded = text.encode("utf-8")
+        if encoded not in pool_index:
+            pool_index[encoded] = len(pool)
+            pool.append(len(encoded))
+            pool.extend(encoded)
+        return pool_index[encoded]
+
+    records = {}
+    record_list = []
+    values = [0] * (MAX_CODE_POINT + 1)
+    max_bytes = 4
+
+    for cp in range(MAX_CODE_POINT + 1):
+        if 0xD800 <= cp <= 0xDFFF:
+            continue
+        ch = chr(cp)
+        deltas = []
+        specials = []
+        for mapped in (ch.lower(), ch.upper(), ch.casefold()):
+            max_bytes = max(max_bytes, len(mapped.encode("utf-8")))
+            if len(mapped) == 1:
+                deltas.append(ord(mapped) - cp)
+                specials.append(0)
+            else:
+                deltas.append(0)
+                specials.append(special(mapped))
+
+        record = tuple(deltas) + tuple(specials) + (final_sigma_flags(ch),)
+        if record not in records:
+            records[record] = len(record_list)
+            record_list.append(record)
+        values[cp] = records[record]
+
+    assert len(pool) < 0x10000
+
+    out = []
+    header_open(out, "gen_case.py", GUARD)
+    out.append("    inline constexpr uint8_t CASE_CASED = %d;" % CASED)
+    out.append("    inline constexpr uint8_t CASE_IGNORABLE = %d;" % CASE_IGNORABLE)
+    out.append("")
+    out.append("    // The most bytes a single code point maps to.")
+    out.append("    inline constexpr int CASE_MAX_MAPPING_BYTES = %d;" % max_bytes)
+    out.append("")
+    out.append("    /*")
+    out.append("    ** Mappings are indexed by 'CaseMapping'. A mapping to a single code")
+    out.append("    ** point is a delta; longer ones are an offset into CASE_SPECIAL_POOL,")
+    out.append("    ** where a length byte precedes the utf8 bytes.")
+    out.append("    */")
+    out.append("    struct CaseRecord {")
+    out.append("        int32_t delta[3];")
+    out.append("        uint16_t special[3];")
+    out.append("        uint8_t flags;")
+    out.append("    };")
+    out.append("")
+    out.append("    inline constexpr CaseRecord CASE_RECORDS[%d] = {" % len(record_list))
+    for r in record_list:
+        out.append("        {{%d, %d, %d}, {%d, %d, %d}, %d}," % r)
+    out.append("    };")
+    out.append("")
+    emit_two_stage(out, "CASE_RECORD", values, qualifier="inline constexpr")
+    out.append("")
+    emit_array(out, "CASE_SPECIAL_POOL", "unsigned char", list(pool), 12, "0x%02x",
+               "inline constexpr")
+    header_close(out, GUARD)
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""Generates src/utf8_codepage_tables.h from Python's codec tables.
+
+Usage: tools/gen_codepages.py > src/utf8_codepage_tables.h
+"""
+
+import codecs
+
+# (enumerator, python codec name, description)
+CODEPAGES = [
+    ("Windows1252", "cp1252", "Windows-1252 (Western European)"),
+    ("Iso8859_2", "iso8859_2", "ISO-8859-2 (Central European)"),
+    ("Iso8859_5", "iso8859_5", "ISO-8859-5 (Cyrillic)"),
+    ("Iso8859_15", "iso8859_15", "ISO-8859-15 (Western European with euro)"),
+    ("Koi8R", "koi8_r", "KOI8-R (Russian)"),
+    ("Cp437", "cp437", "CP437 (IBM PC)"),
+]
+
+UNDEFINED = 0xFFFF
+
+
+def decode_table(codec):
+    table = []
+    for byte in range(256):
+        try:
+            text = bytes([byte]).decode(codec)
+        except UnicodeDecodeError:
+            table.append(UNDEFINED)
+            continue
+        assert len(text) == 1, (codec, byte)
+        table.append(ord(text))
+    return table
+
+
+def main():
+    out = []
+    out.append("// Generated by tools/gen_codepages.py. Do not edit.")
+    out.append("#ifndef __GENIUS_C_UTF8_CODEPAGE_TABLES__")
+    out.append("#define __GENIUS_C_UTF8_CODEPAGE_TABLES__")
+    out.append("")
+    out.append("#include <cstdint>")
+    out.append("")
+    out.append("namespace gc {")
+    out.append("namespace detail {")
+    out.append("    // Marks a byte that the codepage leaves undefined.")
+    out.append("    inline constexpr uint16_t CODEPAGE_UNDEFINED = 0x%04x;" % UNDEFINED)
+    out.append("")
+    out.append("    struct CodepageInverseEntry {")
+    out.append("        uint16_t codePoint;")
+    out.append("        uint8_t byte;")
+    out.append("    };")
+    out.append("")
+    out.append("    struct CodepageTable {")
+    out.append("        // The code points of bytes 0x80 to 0xff.")
+    out.append("        uint16_t toUnicode[128];")
+    out.append("        // The defined upper-half bytes, sorted by code point.")
+    out.append("        const CodepageInverseEntry* fromUnicode;")
+    out.append("        int fromUnicodeSize;")
+    out.append("    };")
+
+    for name, codec, description in CODEPAGES:
+        table = decode_table(codec)
+        # Every supported codepage is an ascii superset, which is what lets
+        # the kernels copy ascii runs unchanged.
+        assert table[:128] == list(range(128)), codec
+        high = table[128:]
+        inverse = sorted(
+            (cp, 0x80 + i) for i, cp in enumerate(high) if cp != UNDEFINED
+        )
+
+        out.append("")
+        out.append("    // %s" % description)
+        out.append("    inline constexpr CodepageInverseEntry CODEPAGE_%s_INVERSE[] = {" % name.upper())
+        for start in range(0, len(inverse), 4):
+            row = ", ".join(
+                "{0x%04x, 0x%02x}" % entry for entry in inverse[start:start + 4]
+            )
+            out.append("        %s," % row)
+        out.append("    };")
+        out.append("")
+        out.append("    inline constexpr CodepageTable CODEPAGE_%s = {" % name.upper())
+        out.append("        {")
+        for start in range(0, 128, 8):
+            row = ", ".join("0x%04x" % cp for cp in high[start:start + 8])
+            out.append("            %s," % row)
+        out.append("        },")
+        out.append("        CODEPAGE_%s_INVERSE," % name.upper())
+        out.append("        %d" % len(inverse))
+        out.append("    };")
+
+    out.append("} // namespace detail")
+    out.append("} // namespace gc")
+    out.append("")
+    out.append("#endif // __GENIUS_C_UTF8_CODEPAGE_TABLES__")
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
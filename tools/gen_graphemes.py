@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+"""Generates src/utf8_grapheme_tables.h from data/ucd.
+
+Usage: tools/fetch_ucd.py (once), then
+       tools/gen_graphemes.py > src/utf8_grapheme_tables.h
+
+Reads the Grapheme_Cluster_Break values from GraphemeBreakProperty.txt and
+Extended_Pictographic from emoji-data.txt.
+"""
+
+from unicode_tables import (emit_three_stage, header_close, header_open,
+                            read_ucd_property)
+
+GUARD = "__GENIUS_C_UTF8_GRAPHEME_TABLES__"
+
+# Extended_Pictographic is a separate property, but only ever set on code
+# points whose Grapheme_Cluster_Break is Other, so it gets a value of its own.
+VALUES = [
+    ("Other", "GRAPHEME_OTHER"),
+    ("CR", "GRAPHEME_CR"),
+    ("LF", "GRAPHEME_LF"),
+    ("Control", "GRAPHEME_CONTROL"),
+    ("Extend", "GRAPHEME_EXTEND"),
+    ("ZWJ", "GRAPHEME_ZWJ"),
+    ("Regional_Indicator", "GRAPHEME_REGIONAL_INDICATOR"),
+    ("Prepend", "GRAPHEME_PREPEND"),
+    ("SpacingMark", "GRAPHEME_SPACING_MARK"),
+    ("L", "GRAPHEME_L"),
+    ("V", "GRAPHEME_V"),
+    ("T", "GRAPHEME_T"),
+    ("LV", "GRAPHEME_LV"),
+    ("LVT", "GRAPHEME_LVT"),
+    ("Extended_Pictographic", "GRAPHEME_EXTENDED_PICTOGRAPHIC"),
+]
+
+
+def main():
+    version, breaks = read_ucd_property("GraphemeBreakProperty.txt", "Other")
+    emoji_version, pictographic = read_ucd_property(
+        "emoji-data.txt", values={"Extended_Pictographic"})
+    assert version == emoji_version, (version, emoji_version)
+
+    codes = {name: index for index, (name, _) in enumerate(VALUES)}
+    values = []
+    for cp, value in enumerate(breaks):
+        if pictographic[cp]:
+            assert value == "Other", hex(cp)
+            value = "Extended_Pictographic"
+        values.append(codes[value])
+
+    out = []
+    header_open(out, "gen_graphemes.py", GUARD, version)
+    out.append("    enum GraphemeBreakProperty : uint8_t {")
+    for name, constant in VALUES:
+        out.append("        %s," % constant)
+    out.append("    };")
+    out.append("")
+    emit_three_stage(out, "GRAPHEME_BREAK", values, qualifier="inline constexpr")
+    header_close(out, GUARD)
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
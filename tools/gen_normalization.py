@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+"""Generates src/utf8_normalization_tables.h from Python's unicodedata.
+
+Usage: tools/gen_normalization.py > src/utf8_normalization_tables.h
+
+The Unicode version is that of the Python running the script, which has to
+be UCD_VERSION (see unicode_tables.py); it is recorded in the generated
+header.
+"""
+
+import unicodedata
+
+from unicode_tables import (MAX_CODE_POINT, check_unicode_version, emit_array,
+                            emit_two_stage, header_close, header_open)
+
+GUARD = "__GENIUS_C_UTF8_NORMALIZATION_TABLES__"
+
+# Quick-check flags, stored above the 8-bit canonical combining class.
+NFD_NO = 1 << 8
+NFKD_NO = 1 << 9
+NFC_NO = 1 << 10
+NFC_MAYBE = 1 << 11
+NFKC_NO = 1 << 12
+NFKC_MAYBE = 1 << 13
+
+HANGUL_FIRST = 0xAC00
+HANGUL_LAST = 0xD7A3
+
+
+def is_hangul_syllable(cp):
+    return HANGUL_FIRST <= cp <= HANGUL_LAST
+
+
+def main():
+    check_unicode_version()
+    props = [0] * (MAX_CODE_POINT + 1)
+    canonical = {}
+    compatibility = {}
+    compositions = []
+
+    for cp in range(MAX_CODE_POINT + 1):
+        if 0xD800 <= cp <= 0xDFFF:
+            continue
+        ch = chr(cp)
+        value = unicodedata.combining(ch)
+
+        nfd = unicodedata.normalize("NFD", ch)
+        nfkd = unicodedata.normalize("NFKD", ch)
+        if nfd != ch:
+            value |= NFD_NO
+        if nfkd != ch:
+            value |= NFKD_NO
+        if unicodedata.normalize("NFC", ch) != ch:
+            value |= NFC_NO
+        if unicodedata.normalize("NFKC", ch) != ch:
+            value |= NFKC_NO
+        props[cp] = value
+
+        # Hangul syllables are decomposed and composed arithmetically.
+        if is_hangul_syllable(cp):
+            continue
+        if nfd != ch:
+            canonical[cp] = [ord(c) for c in nfd]
+        if nfkd != nfd:
+            compatibility[cp] = [ord(c) for c in nfkd]
+
+        mapping = unicodedata.decomposition(ch)
+        if mapping and not mapping.startswith("<"):
+            parts = [int(p, 16) for p in mapping.split()]
+            # A primary composite is a canonical pair that NFC keeps.
+            if len(parts) == 2 and unicodedata.normalize("NFC", ch) == ch:
+                compositions.append((parts[0], parts[1], cp))
+
+    # Characters that can combine with what precedes them may change under
+    # composition: quick check answers "maybe" for them.
+    second = {pair[1] for pair in compositions}
+    second.update(range(0x1161, 0x1176))  # Hangul vowels
+    second.update(range(0x11A8, 0x11C3))  # Hangul trailing consonants
+    for cp in second:
+        if not props[cp] & NFC_NO:
+            props[cp] |= NFC_MAYBE
+        if not props[cp] & NFKC_NO:
+            props[cp] |= NFKC_MAYBE
+
+    out = []
+    header_open(out, "gen_normalization.py", GUARD)
+    out.append("    // Bits 0-7 hold the canonical combining class; the rest are quick")
+    out.append("    // check answers.")
+    for name, value in [("NFD_NO", NFD_NO), ("NFKD_NO", NFKD_NO),
+                        ("NFC_NO", NFC_NO), ("NFC_MAYBE", NFC_MAYBE),
+                        ("NFKC_NO", NFKC_NO), ("NFKC_MAYBE", NFKC_MAYBE)]:
+        out.append("    inline constexpr uint16_t NORMALIZATION_%s = 0x%04x;" % (name, value))
+    out.append("")
+    emit_two_stage(out, "NORMALIZATION_PROPS", props, "uint16_t", "inline constexpr")
+
+    pool = []
+    pool_index = {}
+
+    def intern(sequence):
+        key = tuple(sequence)
+        if key not in pool_index:
+            pool_index[key] = len(pool)
+            pool.extend(sequence)
+        return pool_index[key]
+
+    out.append("")
+    out.append("    struct DecompositionEntry {")
+    out.append("        uint32_t codePoint;")
+    out.append("        uint16_t offset;")
+    out.append("        uint8_t length;")
+    out.append("    };")
+
+    for name, table in [("CANONICAL", canonical), ("COMPATIBILITY", compatibility)]:
+        entries = [(cp, intern(seq), len(seq)) for cp, seq in sorted(table.items())]
+        out.append("")
+        out.append("    // Full %s decompositions, sorted by code point." % name.lower())
+        out.append("    inline constexpr DecompositionEntry %s_DECOMPOSITIONS[%d] = {" % (name, len(entries)))
+        for start in range(0, len(entries), 4):
+            out.append("        " + ", ".join(
+                "{0x%05x, %d, %d}" % e for e in entries[start:start + 4]) + ",")
+        out.append("    };")
+
+    assert len(pool) < 0x10000
+    out.append("")
+    emit_array(out, "DECOMPOSITION_POOL", "uint32_t", pool, 8, "0x%05x", "inline constexpr")
+
+    compositions.sort()
+    out.append("")
+    out.append("    struct CompositionEntry {")
+    out.append("        uint32_t first;")
+    out.append("        uint32_t second;")
+    out.append("        uint32_t composite;")
+    out.append("    };")
+    out.append("")
+    out.append("    // Primary composites, sorted by (first, second).")
+    out.append("    inline constexpr CompositionEntry COMPOSITIONS[%d] = {" % len(compositions))
+    for start in range(0, len(compositions), 3):
+        out.append("        " + ", ".join(
+            "{0x%05x, 0x%05x, 0x%05x}" % c for c in compositions[start:start + 3]) + ",")
+    out.append("    };")
+
+    header_close(out, GUARD)
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
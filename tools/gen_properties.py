@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+"""Generates src/utf8_property_tables.h from data/ucd.
+
+Usage: tools/fetch_ucd.py (once), then
+       tools/gen_properties.py > src/utf8_property_tables.h
+
+Reads DerivedGeneralCategory.txt, Scripts.txt, PropList.txt and
+DerivedCoreProperties.txt. Each property gets a three-stage table of its
+own, so a lookup only touches the table of the property it asks for.
+"""
+
+from unicode_tables import (emit_three_stage, read_ucd_file,
+                            read_ucd_property)
+
+GUARD = "__GENIUS_C_UTF8_PROPERTY_TABLES__"
+
+CATEGORIES = [
+    ("Lu", "UppercaseLetter"),
+    ("Ll", "LowercaseLetter"),
+    ("Lt", "TitlecaseLetter"),
+    ("Lm", "ModifierLetter"),
+    ("Lo", "OtherLetter"),
+    ("Mn", "NonspacingMark"),
+    ("Mc", "SpacingMark"),
+    ("Me", "EnclosingMark"),
+    ("Nd", "DecimalNumber"),
+    ("Nl", "LetterNumber"),
+    ("No", "OtherNumber"),
+    ("Pc", "ConnectorPunctuation"),
+    ("Pd", "DashPunctuation"),
+    ("Ps", "OpenPunctuation"),
+    ("Pe", "ClosePunctuation"),
+    ("Pi", "InitialPunctuation"),
+    ("Pf", "FinalPunctuation"),
+    ("Po", "OtherPunctuation"),
+    ("Sm", "MathSymbol"),
+    ("Sc", "CurrencySymbol"),
+    ("Sk", "ModifierSymbol"),
+    ("So", "OtherSymbol"),
+    ("Zs", "SpaceSeparator"),
+    ("Zl", "LineSeparator"),
+    ("Zp", "ParagraphSeparator"),
+    ("Cc", "Control"),
+    ("Cf", "Format"),
+    ("Cs", "Surrogate"),
+    ("Co", "PrivateUse"),
+    ("Cn", "Unassigned"),
+]
+
+# Binary properties, by file. The order gives the bits of the flags table.
+FLAGS = [
+    ("PropList.txt", "White_Space", "PROPERTY_WHITE_SPACE"),
+    ("DerivedCoreProperties.txt", "Alphabetic", "PROPERTY_ALPHABETIC"),
+    ("DerivedCoreProperties.txt", "Lowercase", "PROPERTY_LOWERCASE"),
+    ("DerivedCoreProperties.txt", "Uppercase", "PROPERTY_UPPERCASE"),
+    ("DerivedCoreProperties.txt", "ID_Start", "PROPERTY_ID_START"),
+    ("DerivedCoreProperties.txt", "ID_Continue", "PROPERTY_ID_CONTINUE"),
+]
+
+
+def enumerator(name):
+    return "".join(part[:1].upper() + part[1:] for part in name.split("_"))
+
+
+def main():
+    versions = set()
+
+    version, categories = read_ucd_property("DerivedGeneralCategory.txt", "Cn")
+    versions.add(version)
+    for cp in range(0xD800, 0xE000):
+        categories[cp] = "Cs"
+    codes = {short: index for index, (short, _) in enumerate(CATEGORIES)}
+    category_values = [codes[value] for value in categories]
+
+    version, scripts = read_ucd_property("Scripts.txt", "Unknown")
+    versions.add(version)
+    script_names = ["Unknown"] + sorted(set(scripts) - {"Unknown"})
+    codes = {name: index for index, name in enumerate(script_names)}
+    script_values = [codes[value] for value in scripts]
+
+    flag_values = [0] * len(scripts)
+    for bit, (name, value, _) in enumerate(FLAGS):
+        version, entries = read_ucd_file(name)
+        versions.add(version)
+        for first, last, entry in entries:
+            if entry == value:
+                for cp in range(first, last + 1):
+                    flag_values[cp] |= 1 << bit
+
+    assert len(versions) == 1, versions
+    version = versions.pop()
+
+    out = []
+    out.append("// Generated by tools/gen_properties.py from Unicode %s. Do not edit." % version)
+    out.append("#ifndef %s" % GUARD)
+    out.append("#define %s" % GUARD)
+    out.append("")
+    out.append("#include <cstdint>")
+    out.append("")
+    out.append("namespace gc {")
+    out.append("    /*")
+    out.append("    ** @brief: The General_Category values, with the two-letter aliases")
+    out.append("    **    in comments.")
+    out.append("    */")
+    out.append("    enum class GeneralCategory : uint8_t {")
+    for short, name in CATEGORIES:
+        out.append("        %s, // %s" % (name, short))
+    out.append("    };")
+    out.append("")
+    out.append("    /*")
+    out.append("    ** @brief: The Script values. 'Unknown' is the default for unassigned")
+    out.append("    **    code points.")
+    out.append("    */")
+    out.append("    enum class Script : uint8_t {")
+    for name in script_names:
+        out.append("        %s," % enumerator(name))
+    out.append("    };")
+    out.append("")
+    out.append("namespace detail {")
+    for bit, (_, _, constant) in enumerate(FLAGS):
+        out.append("    inline constexpr uint8_t %s = 0x%02x;" % (constant, 1 << bit))
+    out.append("")
+    out.append("    // The Unicode names of the scripts, indexed by 'Script'.")
+    out.append("    inline constexpr const char* SCRIPT_NAMES[%d] = {" % len(script_names))
+    for name in script_names:
+        out.append('        "%s",' % name)
+    out.append("    };")
+    for prefix, values in [("CATEGORY", category_values),
+                           ("SCRIPT", script_values),
+                           ("PROPERTY_FLAGS", flag_values)]:
+        out.append("")
+        emit_three_stage(out, prefix, values, qualifier="inline constexpr")
+    out.append("} // namespace detail")
+    out.append("} // namespace gc")
+    out.append("")
+    out.append("#endif // %s" % GUARD)
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+"""Generates src/utf8_width_tables.h.
+
+Usage: tools/fetch_ucd.py (once), then
+       tools/gen_width.py > src/utf8_width_tables.h
+
+Column widths come from the general category and East_Asian_Width in
+Python's unicodedata. The Emoji property comes from data/ucd/emoji-data.txt.
+"""
+
+import unicodedata
+
+from unicode_tables import (MAX_CODE_POINT, emit_three_stage, header_close,
+                            header_open, read_ucd_property, unicode_version)
+
+GUARD = "__GENIUS_C_UTF8_WIDTH_TABLES__"
+
+# Bits 0-1 hold the width; bit 2 is set for code points with the Emoji
+# property, whose presentation variation selectors change the width.
+WIDTH_EMOJI = 4
+
+
+def column_width(cp):
+    ch = chr(cp)
+    category = unicodedata.category(ch)
+
+    if cp == 0x00AD:  # soft hyphen: shown when the line breaks there
+        return 1
+    if category in ("Mn", "Me", "Cf", "Cc", "Zl", "Zp"):
+        return 0
+    # Hangul medial vowels and final consonants join the initial consonant.
+    if 0x1160 <= cp <= 0x11FF or 0xD7B0 <= cp <= 0xD7FF:
+        return 0
+    if unicodedata.east_asian_width(ch) in ("W", "F"):
+        return 2
+    # Unassigned code points of the ideographic planes default to wide.
+    if 0x20000 <= cp <= 0x2FFFD or 0x30000 <= cp <= 0x3FFFD:
+        return 2
+    return 1
+
+
+def main():
+    version, emoji = read_ucd_property("emoji-data.txt", values={"Emoji"})
+    assert version == unicode_version(), (version, unicode_version())
+
+    values = [0] * (MAX_CODE_POINT + 1)
+    for cp in range(MAX_CODE_POINT + 1):
+        if 0xD800 <= cp <= 0xDFFF:
+            continue
+        values[cp] = column_width(cp) | (WIDTH_EMOJI if emoji[cp] else 0)
+
+    out = []
+    header_open(out, "gen_width.py", GUARD)
+    out.append("    // Bits 0-1 hold the number of columns; WIDTH_EMOJI marks code points")
+    out.append("    // with the Emoji property.")
+    out.append("    inline constexpr uint8_t WIDTH_EMOJI = %d;" % WIDTH_EMOJI)
+    out.append("")
+    emit_three_stage(out, "WIDTH", values, qualifier="inline constexpr")
+    header_close(out, GUARD)
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
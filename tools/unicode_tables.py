@@ -0,0 +1,192 @@
+"""Helpers shared by the Unicode table generators in this directory."""
+
+import os
+import re
+import sys
+import unicodedata
+
+MAX_CODE_POINT = 0x10FFFF
+
+# The Unicode version of the checked-in tables. All of them have to agree.
+UCD_VERSION = "15.0.0"
+
+
+def unicode_version():
+    return unicodedata.unidata_version
+
+
+def check_unicode_version():
+    """Stops a generator that reads Python's unicodedata when the Python
+    running it has another Unicode version than the rest of the tables.
+    """
+    assert unicode_version() == UCD_VERSION, (
+        "this Python has Unicode %s; the tables are Unicode %s"
+        % (unicode_version(), UCD_VERSION))
+
+
+def two_stage(values, shifts=range(4, 10)):
+    """Splits a per-code-point list into a block index and unique blocks.
+
+    Returns (shift, index, blocks), where the value of code point c is
+    blocks[(index[c >> shift] << shift) + (c & ((1 << shift) - 1))]. The
+    shift that gives the smallest pair of tables is chosen.
+    """
+    best = None
+    for shift in shifts:
+        size = 1 << shift
+        unique = {}
+        index = []
+        blocks = []
+        for start in range(0, len(values), size):
+            block = tuple(values[start:start + size])
+            if block not in unique:
+                unique[block] = len(unique)
+                blocks.extend(block)
+            index.append(unique[block])
+        cost = len(index) * (1 if len(unique) <= 256 else 2) + len(blocks) * 2
+        if best is None or cost < best[0]:
+            best = (cost, shift, index, blocks)
+    return best[1], best[2], best[3]
+
+
+def table_size(values):
+    return len(values) * {"uint8_t": 1, "uint16_t": 2, "uint32_t": 4}[c_type_for(values)]
+
+
+def three_stage(values):
+    """Like two_stage, with the block index split again in the same way.
+
+    Returns (shift1, shift2, index, middle, blocks), where the value of code
+    point c is blocks[(middle[(index[c >> (shift1 + shift2)] << shift1) +
+    ((c >> shift2) & ((1 << shift1) - 1))] << shift2) +
+    (c & ((1 << shift2) - 1))].
+    """
+    best = None
+    for shift2 in range(4, 8):
+        _, inner, blocks = two_stage(values, [shift2])
+        for shift1 in range(2, 8):
+            _, index, middle = two_stage(inner, [shift1])
+            cost = table_size(index) + table_size(middle) + table_size(blocks)
+            if best is None or cost < best[0]:
+                best = (cost, shift1, shift2, index, middle, blocks)
+    return best[1:]
+
+
+def c_type_for(values):
+    top = max(values) if values else 0
+    if top <= 0xFF:
+        return "uint8_t"
+    if top <= 0xFFFF:
+        return "uint16_t"
+    return "uint32_t"
+
+
+def emit_array(out, name, ctype, values, per_line=12, fmt="%d", qualifier="const"):
+    out.append("    %s %s %s[%d] = {" % (qualifier, ctype, name, len(values)))
+    for start in range(0, len(values), per_line):
+        out.append("        " + ", ".join(fmt % v for v in values[start:start + per_line]) + ",")
+    out.append("    };")
+
+
+def emit_two_stage(out, prefix, values, value_type=None, qualifier="const"):
+    """Emits PREFIX_SHIFT, PREFIX_INDEX and PREFIX_BLOCKS."""
+    shift, index, blocks = two_stage(values)
+    out.append("    %s int %s_SHIFT = %d;" % (qualifier, prefix, shift))
+    emit_array(out, prefix + "_INDEX", c_type_for(index), index, qualifier=qualifier)
+    emit_array(out, prefix + "_BLOCKS", value_type or c_type_for(blocks), blocks,
+               qualifier=qualifier)
+    return shift, len(index), len(blocks)
+
+
+UCD_DIRECTORY = os.path.join(os.path.dirname(__file__), "..", "data", "ucd")
+
+
+def parse_ucd_version(lines):
+    """Finds the Unicode version in the header of a UCD file. The first line
+    of most files names the file and its version (eg. "# Scripts-15.0.0.txt");
+    emoji-data.txt instead gives the emoji version, which follows Unicode's.
+    """
+    for line in lines:
+        if not line.startswith("#"):
+            break
+        match = re.match(r"# \S+-(\d+\.\d+\.\d+)\.txt", line)
+        if match:
+            return match.group(1)
+        match = re.match(r"# Used with Emoji Version (\d+\.\d+)\b", line)
+        if match:
+            return match.group(1) + ".0"
+    return None
+
+
+def read_ucd_file(name):
+    """Parses a UCD property file from data/ucd, which has to be of
+    UCD_VERSION.
+
+    Returns (version, entries) where entries is a list of
+    (first, last, value) tuples.
+    """
+    path = os.path.join(UCD_DIRECTORY, name)
+    if not os.path.exists(path):
+        sys.exit("%s is missing; tools/fetch_ucd.py downloads it" % os.path.normpath(path))
+
+    with open(path, encoding="utf-8") as f:
+        lines = f.read().splitlines()
+    version = parse_ucd_version(lines)
+    assert version == UCD_VERSION, (name, version, UCD_VERSION)
+
+    entries = []
+    for line in lines:
+        data = line.split("#", 1)[0].strip()
+        if not data:
+            continue
+        fields = [field.strip() for field in data.split(";")]
+        bounds = fields[0].split("..")
+        first = int(bounds[0], 16)
+        last = int(bounds[-1], 16)
+        entries.append((first, last, fields[1]))
+    return version, entries
+
+
+def read_ucd_property(name, default=None, values=None):
+    """Returns a per-code-point list of the values in a UCD property file,
+    optionally restricted to the given values.
+    """
+    version, entries = read_ucd_file(name)
+    result = [default] * (MAX_CODE_POINT + 1)
+    for first, last, value in entries:
+        if values is None or value in values:
+            for cp in range(first, last + 1):
+                result[cp] = value
+    return version, result
+
+
+def emit_three_stage(out, prefix, values, value_type=None, qualifier="const"):
+    """Emits PREFIX_SHIFT1, PREFIX_SHIFT2, PREFIX_INDEX, PREFIX_MIDDLE and
+    PREFIX_BLOCKS.
+    """
+    shift1, shift2, index, middle, blocks = three_stage(values)
+    out.append("    %s int %s_SHIFT1 = %d;" % (qualifier, prefix, shift1))
+    out.append("    %s int %s_SHIFT2 = %d;" % (qualifier, prefix, shift2))
+    emit_array(out, prefix + "_INDEX", c_type_for(index), index, qualifier=qualifier)
+    emit_array(out, prefix + "_MIDDLE", c_type_for(middle), middle, qualifier=qualifier)
+    emit_array(out, prefix + "_BLOCKS", value_type or c_type_for(blocks), blocks,
+               qualifier=qualifier)
+    return table_size(index) + table_size(middle) + table_size(blocks)
+
+
+def header_open(out, generator, guard, version=None):
+    out.append("// Generated by tools/%s from Unicode %s. Do not edit." % (generator, version or unicode_version()))
+    out.append("#ifndef %s" % guard)
+    out.append("#define %s" % guard)
+    out.append("")
+    out.append("#include <cstdint>")
+    out.append("")
+    out.append("namespace gc {")
+    out.append("namespace detail {")
+
+
+def header_close(out, guard):
+    out.append("} // namespace detail")
+    out.append("} // namespace gc")
+    out.append("")
+    out.append("#endif // %s" % guard)